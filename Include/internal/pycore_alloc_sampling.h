@@ -0,0 +1,89 @@
+#ifndef Py_INTERNAL_ALLOC_SAMPLING_H
+#define Py_INTERNAL_ALLOC_SAMPLING_H
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifndef Py_BUILD_CORE
+#  error "this header requires Py_BUILD_CORE define"
+#endif
+
+/* Allocation sampling: when enabled, the allocators of the "mem" and "obj"
+   domains are wrapped so that, on average, one allocation is recorded for
+   every `interval` bytes allocated.  Samples go to a ring buffer of fixed
+   size records that out-of-process profilers locate through
+   _Py_DebugOffsets and read without stopping the process. */
+
+/* Number of records in the ring buffer (a power of two) */
+#define _Py_ALLOC_SAMPLING_CAPACITY 2048
+/* Maximum number of Python frames stored per record */
+#define _Py_ALLOC_SAMPLING_MAX_FRAMES 32
+
+struct _Py_alloc_sample_frame {
+    /* PyCodeObject being executed */
+    uintptr_t code;
+    /* Instruction pointer of the frame, as _PyInterpreterFrame.instr_ptr */
+    uintptr_t instr_ptr;
+    /* Thread-local bytecode index (free-threaded build, otherwise 0) */
+    int32_t tlbc_index;
+};
+
+struct _Py_alloc_sample {
+    /* Record index plus one once the record is complete, 0 while it is
+       being written.  Readers discard records with an unexpected value. */
+    uint64_t sequence;
+    /* Size in bytes of the sampled allocation */
+    uint64_t size;
+    /* Number of sampling intervals the allocation accounts for */
+    uint64_t weight;
+    /* Native thread ID of the allocating thread, as reported by
+       RemoteUnwinder.get_stack_trace() */
+    uint64_t thread_id;
+    /* PyInterpreterState.id of the allocating thread */
+    int64_t interpreter_id;
+    /* Interpreter of the allocating thread, and its code object generation
+       when the sample was taken: if code objects were freed since, frames
+       may refer to freed memory. */
+    uintptr_t interp;
+    uint64_t code_object_generation;
+    /* Number of items used in frames, innermost first */
+    uint32_t nframes;
+    struct _Py_alloc_sample_frame frames[_Py_ALLOC_SAMPLING_MAX_FRAMES];
+};
+
+struct _alloc_sampling_runtime_state {
+    /* Mean number of bytes between two samples, 0 if sampling is off.
+       Stored atomically. */
+    uint64_t interval;
+    /* Number of records ever written: the next record goes to
+       samples[write_index % _Py_ALLOC_SAMPLING_CAPACITY].
+       Incremented atomically. */
+    uint64_t write_index;
+    /* Ring buffer, allocated the first time sampling is enabled */
+    struct _Py_alloc_sample *samples;
+    uint32_t capacity;
+    /* Serializes enabling and disabling */
+    PyMutex mutex;
+    /* Allocators wrapped by the sampling hooks while they are installed */
+    struct {
+        PyMemAllocatorEx mem;
+        PyMemAllocatorEx obj;
+    } allocators;
+    int hooks_installed;
+};
+
+#define _alloc_sampling_runtime_state_INIT \
+    { \
+        .capacity = _Py_ALLOC_SAMPLING_CAPACITY, \
+    }
+
+// Start sampling one allocation every `interval` bytes on average, or stop
+// sampling if `interval` is 0.  Return -1 with an exception set on error.
+extern int _PyAllocSampling_SetInterval(uint64_t interval);
+extern uint64_t _PyAllocSampling_GetInterval(void);
+extern void _PyAllocSampling_Fini(void);
+
+#ifdef __cplusplus
+}
+#endif
+#endif  // !Py_INTERNAL_ALLOC_SAMPLING_H
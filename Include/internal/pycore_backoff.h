@@ -135,6 +135,13 @@ initial_jump_backoff_counter(_PyOptimizationConfig *opt_config)
         opt_config->jump_backward_initial_backoff);
 }
 
+/* JUMP_BACKWARD counter for loops listed in the JIT profile (see
+ * PYTHON_JIT_PROFILE), which were hot in an earlier run.  Like the default
+ * value, it must be larger than ADAPTIVE_COOLDOWN_VALUE so that the loop body
+ * is specialized before it is traced. */
+#define JUMP_BACKWARD_PROFILED_VALUE 63
+#define JUMP_BACKWARD_PROFILED_BACKOFF 6
+
 /* Initial exit temperature.
  * Must be larger than ADAPTIVE_COOLDOWN_VALUE,
  * otherwise when a side exit warms up we may construct
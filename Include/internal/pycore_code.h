@@ -462,6 +462,9 @@ write_location_entry_start(uint8_t *ptr, int code, int length)
 #if SIDE_EXIT_INITIAL_VALUE <= ADAPTIVE_COOLDOWN_VALUE
 #  error  "Cold exit value should be larger than adaptive cooldown value"
 #endif
+#if JUMP_BACKWARD_PROFILED_VALUE <= ADAPTIVE_COOLDOWN_VALUE
+#  error  "Profiled JIT threshold value should be larger than adaptive cooldown value"
+#endif
 
 static inline _Py_BackoffCounter
 adaptive_counter_bits(uint16_t value, uint16_t backoff) {
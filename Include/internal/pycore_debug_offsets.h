@@ -73,6 +73,7 @@ typedef struct _Py_DebugOffsets {
         uint64_t size;
         uint64_t finalizing;
         uint64_t interpreters_head;
+        uint64_t alloc_sampling;
     } runtime_state;
 
     // Interpreter state offset;
@@ -245,6 +246,30 @@ typedef struct _Py_DebugOffsets {
         uint64_t debugger_script_path;
         uint64_t debugger_script_path_size;
     } debugger_support;
+
+    // Allocation sampling state and ring buffer records
+    struct _alloc_sampling {
+        uint64_t size;
+        uint64_t interval;
+        uint64_t write_index;
+        uint64_t samples;
+        uint64_t capacity;
+        uint64_t max_frames;
+        uint64_t sample_size;
+        uint64_t sample_sequence;
+        uint64_t sample_alloc_size;
+        uint64_t sample_weight;
+        uint64_t sample_thread_id;
+        uint64_t sample_interpreter_id;
+        uint64_t sample_interp;
+        uint64_t sample_code_object_generation;
+        uint64_t sample_nframes;
+        uint64_t sample_frames;
+        uint64_t frame_size;
+        uint64_t frame_code;
+        uint64_t frame_instr_ptr;
+        uint64_t frame_tlbc_index;
+    } alloc_sampling;
 } _Py_DebugOffsets;
 
 
@@ -256,6 +281,7 @@ typedef struct _Py_DebugOffsets {
         .size = sizeof(_PyRuntimeState), \
         .finalizing = offsetof(_PyRuntimeState, _finalizing), \
         .interpreters_head = offsetof(_PyRuntimeState, interpreters.head), \
+        .alloc_sampling = offsetof(_PyRuntimeState, alloc_sampling), \
     }, \
     .interpreter_state = { \
         .size = sizeof(PyInterpreterState), \
@@ -392,6 +418,28 @@ typedef struct _Py_DebugOffsets {
         .debugger_script_path = offsetof(_PyRemoteDebuggerSupport, debugger_script_path),  \
         .debugger_script_path_size = _Py_MAX_SCRIPT_PATH_SIZE, \
     }, \
+    .alloc_sampling = { \
+        .size = sizeof(struct _alloc_sampling_runtime_state), \
+        .interval = offsetof(struct _alloc_sampling_runtime_state, interval), \
+        .write_index = offsetof(struct _alloc_sampling_runtime_state, write_index), \
+        .samples = offsetof(struct _alloc_sampling_runtime_state, samples), \
+        .capacity = offsetof(struct _alloc_sampling_runtime_state, capacity), \
+        .max_frames = _Py_ALLOC_SAMPLING_MAX_FRAMES, \
+        .sample_size = sizeof(struct _Py_alloc_sample), \
+        .sample_sequence = offsetof(struct _Py_alloc_sample, sequence), \
+        .sample_alloc_size = offsetof(struct _Py_alloc_sample, size), \
+        .sample_weight = offsetof(struct _Py_alloc_sample, weight), \
+        .sample_thread_id = offsetof(struct _Py_alloc_sample, thread_id), \
+        .sample_interpreter_id = offsetof(struct _Py_alloc_sample, interpreter_id), \
+        .sample_interp = offsetof(struct _Py_alloc_sample, interp), \
+        .sample_code_object_generation = offsetof(struct _Py_alloc_sample, code_object_generation), \
+        .sample_nframes = offsetof(struct _Py_alloc_sample, nframes), \
+        .sample_frames = offsetof(struct _Py_alloc_sample, frames), \
+        .frame_size = sizeof(struct _Py_alloc_sample_frame), \
+        .frame_code = offsetof(struct _Py_alloc_sample_frame, code), \
+        .frame_instr_ptr = offsetof(struct _Py_alloc_sample_frame, instr_ptr), \
+        .frame_tlbc_index = offsetof(struct _Py_alloc_sample_frame, tlbc_index), \
+    }, \
 }
 
 
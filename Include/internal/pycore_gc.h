@@ -355,6 +355,24 @@ extern void _PyGC_Unfreeze(PyInterpreterState *interp);
 extern Py_ssize_t _PyGC_GetFreezeCount(PyInterpreterState *interp);
 
 extern PyObject *_PyGC_GetObjects(PyInterpreterState *interp, int generation);
+
+/* Fold the outcome of a collection into the moving average of the fraction
+   of candidates that survived it. */
+static inline void
+_PyGC_UpdateSurvivalRate(struct gc_generation_stats *stats,
+                         Py_ssize_t candidates, Py_ssize_t collected)
+{
+    if (candidates <= 0) {
+        return;
+    }
+    double rate = (double)(candidates - collected) / (double)candidates;
+    if (stats->collections <= 1) {
+        stats->survival_rate = rate;
+    }
+    else {
+        stats->survival_rate += (rate - stats->survival_rate) / 4;
+    }
+}
 extern PyObject *_PyGC_GetReferrers(PyInterpreterState *interp, PyObject *objs);
 
 // Functions to clear types free lists
@@ -370,6 +388,11 @@ extern int _PyGC_VisitStackRef(union _PyStackRef *ref, visitproc visit, void *ar
 #ifdef Py_GIL_DISABLED
 extern void _PyGC_VisitObjectsWorldStopped(PyInterpreterState *interp,
                                            gcvisitobjects_t callback, void *arg);
+
+/* Run automatic collections on a dedicated thread. See gc.set_background(). */
+extern int _PyGC_SetBackground(PyThreadState *tstate, int enabled);
+extern int _PyGC_GetBackground(PyInterpreterState *interp);
+extern void _PyGC_AfterFork(PyInterpreterState *interp);
 #endif
 
 #ifdef __cplusplus
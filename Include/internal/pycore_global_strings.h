@@ -254,13 +254,20 @@ struct _Py_global_strings {
         STRUCT_FOR_ID(_abstract_)
         STRUCT_FOR_ID(_active)
         STRUCT_FOR_ID(_anonymous_)
+        STRUCT_FOR_ID(_args)
         STRUCT_FOR_ID(_argtypes_)
         STRUCT_FOR_ID(_as_parameter_)
         STRUCT_FOR_ID(_asyncio_future_blocking)
         STRUCT_FOR_ID(_blksize)
         STRUCT_FOR_ID(_bootstrap)
+        STRUCT_FOR_ID(_call_soon)
+        STRUCT_FOR_ID(_callback)
+        STRUCT_FOR_ID(_cancelled)
         STRUCT_FOR_ID(_check_retval_)
+        STRUCT_FOR_ID(_closed)
+        STRUCT_FOR_ID(_context)
         STRUCT_FOR_ID(_dealloc_warn)
+        STRUCT_FOR_ID(_debug)
         STRUCT_FOR_ID(_feature_version)
         STRUCT_FOR_ID(_field_types)
         STRUCT_FOR_ID(_fields_)
@@ -282,10 +289,13 @@ struct _Py_global_strings {
         STRUCT_FOR_ID(_loop)
         STRUCT_FOR_ID(_needs_com_addref_)
         STRUCT_FOR_ID(_only_immortal)
+        STRUCT_FOR_ID(_ready)
         STRUCT_FOR_ID(_restype_)
+        STRUCT_FOR_ID(_run)
         STRUCT_FOR_ID(_showwarnmsg)
         STRUCT_FOR_ID(_shutdown)
         STRUCT_FOR_ID(_slotnames)
+        STRUCT_FOR_ID(_stopping)
         STRUCT_FOR_ID(_strptime)
         STRUCT_FOR_ID(_strptime_datetime_date)
         STRUCT_FOR_ID(_strptime_datetime_datetime)
@@ -330,6 +340,7 @@ struct _Py_global_strings {
         STRUCT_FOR_ID(block)
         STRUCT_FOR_ID(blocking)
         STRUCT_FOR_ID(bound)
+        STRUCT_FOR_ID(bucket_us)
         STRUCT_FOR_ID(buffer)
         STRUCT_FOR_ID(buffer_callback)
         STRUCT_FOR_ID(buffer_size)
@@ -452,6 +463,7 @@ struct _Py_global_strings {
         STRUCT_FOR_ID(end_lineno)
         STRUCT_FOR_ID(end_offset)
         STRUCT_FOR_ID(endpos)
+        STRUCT_FOR_ID(entries)
         STRUCT_FOR_ID(entrypoint)
         STRUCT_FOR_ID(env)
         STRUCT_FOR_ID(errors)
@@ -883,6 +895,7 @@ struct _Py_global_strings {
         STRUCT_FOR_ID(which)
         STRUCT_FOR_ID(who)
         STRUCT_FOR_ID(withdata)
+        STRUCT_FOR_ID(workers)
         STRUCT_FOR_ID(wrapcol)
         STRUCT_FOR_ID(writable)
         STRUCT_FOR_ID(write)
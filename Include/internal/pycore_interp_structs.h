@@ -199,6 +199,8 @@ struct gc_generation_stats {
     Py_ssize_t candidates;
     // Duration of the collection in seconds:
     double duration;
+    // Moving average of the fraction of candidates that survived:
+    double survival_rate;
 };
 
 enum _GCPhase {
@@ -236,6 +238,12 @@ struct _gc_runtime_state {
     int visited_space;
     int phase;
 
+    /* Target duration of automatic collections in seconds, or 0.0 if the
+       young generation threshold is not adapted (see gc.set_pause_target()) */
+    double pause_target;
+    /* Moving average of the time spent per candidate object */
+    double pause_cost;
+
 #ifdef Py_GIL_DISABLED
     /* This is the number of objects that survived the last full
        collection. It approximates the number of long lived objects
@@ -261,6 +269,17 @@ struct _gc_runtime_state {
 
     /* Mutex held for gc_should_collect_mem_usage(). */
     PyMutex mutex;
+
+    /* Number of threads used for the "mark alive" pass of a collection.
+       See gc.set_mark_threads(). */
+    int mark_threads;
+
+    /* True if automatic collections run on a dedicated thread.
+       See gc.set_background(). */
+    int background;
+    /* Used to wake up and stop the background collection thread. */
+    int background_state;
+    uintptr_t background_handle;
 #endif
 };
 
@@ -422,6 +441,23 @@ typedef struct _PyOptimizationConfig {
     bool uops_optimize_enabled;
 } _PyOptimizationConfig;
 
+// A loop that the tier 2 optimizer compiled in an earlier run, identified by
+// a hash of its code object and the offset of its JUMP_BACKWARD instruction.
+struct _PyJitProfileEntry {
+    uint64_t code_hash;
+    uint32_t offset;
+};
+
+// Hot loops loaded from and saved to the file named by PYTHON_JIT_PROFILE.
+typedef struct _PyJitProfile {
+    char *path;
+    // Sorted by code_hash, then offset:
+    struct _PyJitProfileEntry *entries;
+    Py_ssize_t size;
+    Py_ssize_t capacity;
+    bool modified;
+} _PyJitProfile;
+
 struct
 Bigint {
     struct Bigint *next;
@@ -972,6 +1008,7 @@ struct _is {
 
     // Optimization configuration (thresholds and flags for JIT and interpreter)
     _PyOptimizationConfig opt_config;
+    _PyJitProfile jit_profile;
     struct _PyExecutorObject *executor_list_head;
     struct _PyExecutorObject *executor_deletion_list_head;
     struct _PyExecutorObject *cold_executor;
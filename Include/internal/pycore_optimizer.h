@@ -100,8 +100,15 @@ typedef struct _PyJitTracerPreviousState {
     PyObject *recorded_value; // Strong, may be NULL
 } _PyJitTracerPreviousState;
 
+// Maximum number of loops in generators entered by a trace that the
+// trace may pass through (see can_trace_through_generator_loop()).
+#define MAX_GENERATOR_LOOPS_PER_TRACE 8
+
 typedef struct _PyJitTracerTranslatorState {
     int jump_backward_seen;
+    int generator_loops_len;
+    // Backward jumps of generator loops that the trace passed through:
+    _Py_CODEUNIT *generator_loops[MAX_GENERATOR_LOOPS_PER_TRACE];
 } _PyJitTracerTranslatorState;
 
 typedef struct _PyJitTracerState {
@@ -349,6 +356,11 @@ extern void _PyExecutor_Free(_PyExecutorObject *self);
 PyAPI_FUNC(int) _PyDumpExecutors(FILE *out);
 #ifdef _Py_TIER2
 PyAPI_FUNC(void) _Py_ClearExecutorDeletionList(PyInterpreterState *interp);
+
+/* Warm-start profile of hot loops, see PYTHON_JIT_PROFILE. */
+extern void _PyJit_LoadProfile(PyInterpreterState *interp, const char *path);
+extern void _PyJit_ApplyProfile(PyInterpreterState *interp, PyCodeObject *co);
+extern void _PyJit_SaveProfile(PyInterpreterState *interp);
 #endif
 
 PyAPI_FUNC(int) _PyJit_translate_single_bytecode_to_trace(PyThreadState *tstate, _PyInterpreterFrame *frame, _Py_CODEUNIT *next_instr, int stop_tracing_opcode);
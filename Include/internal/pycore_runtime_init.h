@@ -27,6 +27,7 @@ extern "C" {
 #include "pycore_runtime_init_generated.h"  // _Py_bytes_characters_INIT
 #include "pycore_signal.h"        // _signals_RUNTIME_INIT
 #include "pycore_tracemalloc.h"   // _tracemalloc_runtime_state_INIT
+#include "pycore_alloc_sampling.h" // _alloc_sampling_runtime_state_INIT
 #include "pycore_tuple.h"         // _PyTuple_HASH_EMPTY
 
 
@@ -77,6 +78,7 @@ extern PyTypeObject _PyExc_MemoryError;
         }, \
         .faulthandler = _faulthandler_runtime_state_INIT, \
         .tracemalloc = _tracemalloc_runtime_state_INIT, \
+        .alloc_sampling = _alloc_sampling_runtime_state_INIT, \
         .ref_tracer = { \
             .tracer_func = NULL, \
             .tracer_data = NULL, \
@@ -1529,13 +1529,20 @@ extern "C" {
     INIT_ID(_abstract_), \
     INIT_ID(_active), \
     INIT_ID(_anonymous_), \
+    INIT_ID(_args), \
     INIT_ID(_argtypes_), \
     INIT_ID(_as_parameter_), \
     INIT_ID(_asyncio_future_blocking), \
     INIT_ID(_blksize), \
     INIT_ID(_bootstrap), \
+    INIT_ID(_call_soon), \
+    INIT_ID(_callback), \
+    INIT_ID(_cancelled), \
     INIT_ID(_check_retval_), \
+    INIT_ID(_closed), \
+    INIT_ID(_context), \
     INIT_ID(_dealloc_warn), \
+    INIT_ID(_debug), \
     INIT_ID(_feature_version), \
     INIT_ID(_field_types), \
     INIT_ID(_fields_), \
@@ -1557,10 +1564,13 @@ extern "C" {
     INIT_ID(_loop), \
     INIT_ID(_needs_com_addref_), \
     INIT_ID(_only_immortal), \
+    INIT_ID(_ready), \
     INIT_ID(_restype_), \
+    INIT_ID(_run), \
     INIT_ID(_showwarnmsg), \
     INIT_ID(_shutdown), \
     INIT_ID(_slotnames), \
+    INIT_ID(_stopping), \
     INIT_ID(_strptime), \
     INIT_ID(_strptime_datetime_date), \
     INIT_ID(_strptime_datetime_datetime), \
@@ -1605,6 +1615,7 @@ extern "C" {
     INIT_ID(block), \
     INIT_ID(blocking), \
     INIT_ID(bound), \
+    INIT_ID(bucket_us), \
     INIT_ID(buffer), \
     INIT_ID(buffer_callback), \
     INIT_ID(buffer_size), \
@@ -1727,6 +1738,7 @@ extern "C" {
     INIT_ID(end_lineno), \
     INIT_ID(end_offset), \
     INIT_ID(endpos), \
+    INIT_ID(entries), \
     INIT_ID(entrypoint), \
     INIT_ID(env), \
     INIT_ID(errors), \
@@ -2158,6 +2170,7 @@ extern "C" {
     INIT_ID(which), \
     INIT_ID(who), \
     INIT_ID(withdata), \
+    INIT_ID(workers), \
     INIT_ID(wrapcol), \
     INIT_ID(writable), \
     INIT_ID(write), \
@@ -60,6 +60,7 @@ struct pyhash_runtime_state {
 };
 
 #include "pycore_tracemalloc.h"   // struct _tracemalloc_runtime_state
+#include "pycore_alloc_sampling.h" // struct _alloc_sampling_runtime_state
 
 struct _fileutils_state {
     int force_ascii;
@@ -249,6 +250,7 @@ struct pyruntimestate {
     struct _fileutils_state fileutils;
     struct _faulthandler_runtime_state faulthandler;
     struct _tracemalloc_runtime_state tracemalloc;
+    struct _alloc_sampling_runtime_state alloc_sampling;
     struct _reftracer_runtime_state ref_tracer;
 
     // The rwmutex is used to prevent overlapping global and per-interpreter
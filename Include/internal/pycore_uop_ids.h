@@ -13,23 +13,27 @@ extern "C" {
 #define _SET_IP 301
 #define _BINARY_OP 302
 #define _BINARY_OP_ADD_FLOAT 303
-#define _BINARY_OP_ADD_INT 304
-#define _BINARY_OP_ADD_UNICODE 305
-#define _BINARY_OP_EXTEND 306
-#define _BINARY_OP_INPLACE_ADD_UNICODE 307
-#define _BINARY_OP_MULTIPLY_FLOAT 308
-#define _BINARY_OP_MULTIPLY_INT 309
-#define _BINARY_OP_SUBSCR_CHECK_FUNC 310
-#define _BINARY_OP_SUBSCR_DICT 311
-#define _BINARY_OP_SUBSCR_INIT_CALL 312
-#define _BINARY_OP_SUBSCR_LIST_INT 313
-#define _BINARY_OP_SUBSCR_LIST_SLICE 314
-#define _BINARY_OP_SUBSCR_STR_INT 315
-#define _BINARY_OP_SUBSCR_TUPLE_INT 316
-#define _BINARY_OP_SUBSCR_USTR_INT 317
-#define _BINARY_OP_SUBTRACT_FLOAT 318
-#define _BINARY_OP_SUBTRACT_INT 319
-#define _BINARY_SLICE 320
+#define _BINARY_OP_ADD_FLOAT_INPLACE 304
+#define _BINARY_OP_ADD_INT 305
+#define _BINARY_OP_ADD_UNICODE 306
+#define _BINARY_OP_EXTEND 307
+#define _BINARY_OP_INPLACE_ADD_UNICODE 308
+#define _BINARY_OP_INPLACE_ADD_UNICODE_DEREF 309
+#define _BINARY_OP_MULTIPLY_FLOAT 310
+#define _BINARY_OP_MULTIPLY_FLOAT_INPLACE 311
+#define _BINARY_OP_MULTIPLY_INT 312
+#define _BINARY_OP_SUBSCR_CHECK_FUNC 313
+#define _BINARY_OP_SUBSCR_DICT 314
+#define _BINARY_OP_SUBSCR_INIT_CALL 315
+#define _BINARY_OP_SUBSCR_LIST_INT 316
+#define _BINARY_OP_SUBSCR_LIST_SLICE 317
+#define _BINARY_OP_SUBSCR_STR_INT 318
+#define _BINARY_OP_SUBSCR_TUPLE_INT 319
+#define _BINARY_OP_SUBSCR_USTR_INT 320
+#define _BINARY_OP_SUBTRACT_FLOAT 321
+#define _BINARY_OP_SUBTRACT_FLOAT_INPLACE 322
+#define _BINARY_OP_SUBTRACT_INT 323
+#define _BINARY_SLICE 324
 #define _BUILD_INTERPOLATION BUILD_INTERPOLATION
 #define _BUILD_LIST BUILD_LIST
 #define _BUILD_MAP BUILD_MAP
@@ -38,167 +42,167 @@ extern "C" {
 #define _BUILD_STRING BUILD_STRING
 #define _BUILD_TEMPLATE BUILD_TEMPLATE
 #define _BUILD_TUPLE BUILD_TUPLE
-#define _CALL_BUILTIN_CLASS 321
-#define _CALL_BUILTIN_FAST 322
-#define _CALL_BUILTIN_FAST_WITH_KEYWORDS 323
-#define _CALL_BUILTIN_O 324
-#define _CALL_FUNCTION_EX_NON_PY_GENERAL 325
+#define _CALL_BUILTIN_CLASS 325
+#define _CALL_BUILTIN_FAST 326
+#define _CALL_BUILTIN_FAST_WITH_KEYWORDS 327
+#define _CALL_BUILTIN_O 328
+#define _CALL_FUNCTION_EX_NON_PY_GENERAL 329
 #define _CALL_INTRINSIC_1 CALL_INTRINSIC_1
 #define _CALL_INTRINSIC_2 CALL_INTRINSIC_2
-#define _CALL_ISINSTANCE 326
-#define _CALL_KW_NON_PY 327
-#define _CALL_LEN 328
-#define _CALL_LIST_APPEND 329
-#define _CALL_METHOD_DESCRIPTOR_FAST 330
-#define _CALL_METHOD_DESCRIPTOR_FAST_WITH_KEYWORDS 331
-#define _CALL_METHOD_DESCRIPTOR_NOARGS 332
-#define _CALL_METHOD_DESCRIPTOR_O 333
-#define _CALL_NON_PY_GENERAL 334
-#define _CALL_STR_1 335
-#define _CALL_TUPLE_1 336
-#define _CALL_TYPE_1 337
-#define _CHECK_AND_ALLOCATE_OBJECT 338
-#define _CHECK_ATTR_CLASS 339
-#define _CHECK_ATTR_METHOD_LAZY_DICT 340
-#define _CHECK_CALL_BOUND_METHOD_EXACT_ARGS 341
+#define _CALL_ISINSTANCE 330
+#define _CALL_KW_NON_PY 331
+#define _CALL_LEN 332
+#define _CALL_LIST_APPEND 333
+#define _CALL_METHOD_DESCRIPTOR_FAST 334
+#define _CALL_METHOD_DESCRIPTOR_FAST_WITH_KEYWORDS 335
+#define _CALL_METHOD_DESCRIPTOR_NOARGS 336
+#define _CALL_METHOD_DESCRIPTOR_O 337
+#define _CALL_NON_PY_GENERAL 338
+#define _CALL_STR_1 339
+#define _CALL_TUPLE_1 340
+#define _CALL_TYPE_1 341
+#define _CHECK_AND_ALLOCATE_OBJECT 342
+#define _CHECK_ATTR_CLASS 343
+#define _CHECK_ATTR_METHOD_LAZY_DICT 344
+#define _CHECK_CALL_BOUND_METHOD_EXACT_ARGS 345
 #define _CHECK_EG_MATCH CHECK_EG_MATCH
 #define _CHECK_EXC_MATCH CHECK_EXC_MATCH
-#define _CHECK_FUNCTION_EXACT_ARGS 342
-#define _CHECK_FUNCTION_VERSION 343
-#define _CHECK_FUNCTION_VERSION_INLINE 344
-#define _CHECK_FUNCTION_VERSION_KW 345
-#define _CHECK_IS_NOT_PY_CALLABLE 346
-#define _CHECK_IS_NOT_PY_CALLABLE_EX 347
-#define _CHECK_IS_NOT_PY_CALLABLE_KW 348
-#define _CHECK_IS_PY_CALLABLE_EX 349
-#define _CHECK_MANAGED_OBJECT_HAS_VALUES 350
-#define _CHECK_METHOD_VERSION 351
-#define _CHECK_METHOD_VERSION_KW 352
-#define _CHECK_PEP_523 353
-#define _CHECK_PERIODIC 354
-#define _CHECK_PERIODIC_AT_END 355
-#define _CHECK_PERIODIC_IF_NOT_YIELD_FROM 356
-#define _CHECK_RECURSION_REMAINING 357
-#define _CHECK_STACK_SPACE 358
-#define _CHECK_STACK_SPACE_OPERAND 359
-#define _CHECK_VALIDITY 360
-#define _COLD_DYNAMIC_EXIT 361
-#define _COLD_EXIT 362
-#define _COMPARE_OP 363
-#define _COMPARE_OP_FLOAT 364
-#define _COMPARE_OP_INT 365
-#define _COMPARE_OP_STR 366
-#define _CONTAINS_OP 367
-#define _CONTAINS_OP_DICT 368
-#define _CONTAINS_OP_SET 369
+#define _CHECK_FUNCTION_EXACT_ARGS 346
+#define _CHECK_FUNCTION_VERSION 347
+#define _CHECK_FUNCTION_VERSION_INLINE 348
+#define _CHECK_FUNCTION_VERSION_KW 349
+#define _CHECK_IS_NOT_PY_CALLABLE 350
+#define _CHECK_IS_NOT_PY_CALLABLE_EX 351
+#define _CHECK_IS_NOT_PY_CALLABLE_KW 352
+#define _CHECK_IS_PY_CALLABLE_EX 353
+#define _CHECK_MANAGED_OBJECT_HAS_VALUES 354
+#define _CHECK_METHOD_VERSION 355
+#define _CHECK_METHOD_VERSION_KW 356
+#define _CHECK_PEP_523 357
+#define _CHECK_PERIODIC 358
+#define _CHECK_PERIODIC_AT_END 359
+#define _CHECK_PERIODIC_IF_NOT_YIELD_FROM 360
+#define _CHECK_RECURSION_REMAINING 361
+#define _CHECK_STACK_SPACE 362
+#define _CHECK_STACK_SPACE_OPERAND 363
+#define _CHECK_VALIDITY 364
+#define _COLD_DYNAMIC_EXIT 365
+#define _COLD_EXIT 366
+#define _COMPARE_OP 367
+#define _COMPARE_OP_FLOAT 368
+#define _COMPARE_OP_INT 369
+#define _COMPARE_OP_STR 370
+#define _CONTAINS_OP 371
+#define _CONTAINS_OP_DICT 372
+#define _CONTAINS_OP_SET 373
 #define _CONVERT_VALUE CONVERT_VALUE
-#define _COPY 370
-#define _COPY_1 371
-#define _COPY_2 372
-#define _COPY_3 373
+#define _COPY 374
+#define _COPY_1 375
+#define _COPY_2 376
+#define _COPY_3 377
 #define _COPY_FREE_VARS COPY_FREE_VARS
-#define _CREATE_INIT_FRAME 374
+#define _CREATE_INIT_FRAME 378
 #define _DELETE_ATTR DELETE_ATTR
 #define _DELETE_DEREF DELETE_DEREF
 #define _DELETE_FAST DELETE_FAST
 #define _DELETE_GLOBAL DELETE_GLOBAL
 #define _DELETE_NAME DELETE_NAME
 #define _DELETE_SUBSCR DELETE_SUBSCR
-#define _DEOPT 375
+#define _DEOPT 379
 #define _DICT_MERGE DICT_MERGE
 #define _DICT_UPDATE DICT_UPDATE
-#define _DO_CALL 376
-#define _DO_CALL_FUNCTION_EX 377
-#define _DO_CALL_KW 378
-#define _DYNAMIC_EXIT 379
+#define _DO_CALL 380
+#define _DO_CALL_FUNCTION_EX 381
+#define _DO_CALL_KW 382
+#define _DYNAMIC_EXIT 383
 #define _END_FOR END_FOR
 #define _END_SEND END_SEND
-#define _ERROR_POP_N 380
+#define _ERROR_POP_N 384
 #define _EXIT_INIT_CHECK EXIT_INIT_CHECK
-#define _EXPAND_METHOD 381
-#define _EXPAND_METHOD_KW 382
-#define _FATAL_ERROR 383
+#define _EXPAND_METHOD 385
+#define _EXPAND_METHOD_KW 386
+#define _FATAL_ERROR 387
 #define _FORMAT_SIMPLE FORMAT_SIMPLE
 #define _FORMAT_WITH_SPEC FORMAT_WITH_SPEC
-#define _FOR_ITER 384
-#define _FOR_ITER_GEN_FRAME 385
-#define _FOR_ITER_TIER_TWO 386
+#define _FOR_ITER 388
+#define _FOR_ITER_GEN_FRAME 389
+#define _FOR_ITER_TIER_TWO 390
 #define _GET_AITER GET_AITER
 #define _GET_ANEXT GET_ANEXT
 #define _GET_AWAITABLE GET_AWAITABLE
 #define _GET_ITER GET_ITER
 #define _GET_LEN GET_LEN
 #define _GET_YIELD_FROM_ITER GET_YIELD_FROM_ITER
-#define _GUARD_BINARY_OP_EXTEND 387
-#define _GUARD_BINARY_OP_SUBSCR_TUPLE_INT_BOUNDS 388
-#define _GUARD_BIT_IS_SET_POP 389
-#define _GUARD_BIT_IS_SET_POP_4 390
-#define _GUARD_BIT_IS_SET_POP_5 391
-#define _GUARD_BIT_IS_SET_POP_6 392
-#define _GUARD_BIT_IS_SET_POP_7 393
-#define _GUARD_BIT_IS_UNSET_POP 394
-#define _GUARD_BIT_IS_UNSET_POP_4 395
-#define _GUARD_BIT_IS_UNSET_POP_5 396
-#define _GUARD_BIT_IS_UNSET_POP_6 397
-#define _GUARD_BIT_IS_UNSET_POP_7 398
-#define _GUARD_CALLABLE_ISINSTANCE 399
-#define _GUARD_CALLABLE_LEN 400
-#define _GUARD_CALLABLE_LIST_APPEND 401
-#define _GUARD_CALLABLE_STR_1 402
-#define _GUARD_CALLABLE_TUPLE_1 403
-#define _GUARD_CALLABLE_TYPE_1 404
-#define _GUARD_CODE_VERSION 405
-#define _GUARD_DORV_NO_DICT 406
-#define _GUARD_DORV_VALUES_INST_ATTR_FROM_DICT 407
-#define _GUARD_GLOBALS_VERSION 408
-#define _GUARD_IP_RETURN_GENERATOR 409
-#define _GUARD_IP_RETURN_VALUE 410
-#define _GUARD_IP_YIELD_VALUE 411
-#define _GUARD_IP__PUSH_FRAME 412
-#define _GUARD_IS_FALSE_POP 413
-#define _GUARD_IS_NONE_POP 414
-#define _GUARD_IS_NOT_NONE_POP 415
-#define _GUARD_IS_TRUE_POP 416
-#define _GUARD_KEYS_VERSION 417
-#define _GUARD_NOS_COMPACT_ASCII 418
-#define _GUARD_NOS_DICT 419
-#define _GUARD_NOS_FLOAT 420
-#define _GUARD_NOS_INT 421
-#define _GUARD_NOS_LIST 422
-#define _GUARD_NOS_NOT_NULL 423
-#define _GUARD_NOS_NULL 424
-#define _GUARD_NOS_OVERFLOWED 425
-#define _GUARD_NOS_TUPLE 426
-#define _GUARD_NOS_UNICODE 427
-#define _GUARD_NOT_EXHAUSTED_LIST 428
-#define _GUARD_NOT_EXHAUSTED_RANGE 429
-#define _GUARD_NOT_EXHAUSTED_TUPLE 430
-#define _GUARD_THIRD_NULL 431
-#define _GUARD_TOS_ANY_SET 432
-#define _GUARD_TOS_DICT 433
-#define _GUARD_TOS_FLOAT 434
-#define _GUARD_TOS_INT 435
-#define _GUARD_TOS_LIST 436
-#define _GUARD_TOS_OVERFLOWED 437
-#define _GUARD_TOS_SLICE 438
-#define _GUARD_TOS_TUPLE 439
-#define _GUARD_TOS_UNICODE 440
-#define _GUARD_TYPE_VERSION 441
-#define _GUARD_TYPE_VERSION_AND_LOCK 442
-#define _HANDLE_PENDING_AND_DEOPT 443
+#define _GUARD_BINARY_OP_EXTEND 391
+#define _GUARD_BINARY_OP_SUBSCR_TUPLE_INT_BOUNDS 392
+#define _GUARD_BIT_IS_SET_POP 393
+#define _GUARD_BIT_IS_SET_POP_4 394
+#define _GUARD_BIT_IS_SET_POP_5 395
+#define _GUARD_BIT_IS_SET_POP_6 396
+#define _GUARD_BIT_IS_SET_POP_7 397
+#define _GUARD_BIT_IS_UNSET_POP 398
+#define _GUARD_BIT_IS_UNSET_POP_4 399
+#define _GUARD_BIT_IS_UNSET_POP_5 400
+#define _GUARD_BIT_IS_UNSET_POP_6 401
+#define _GUARD_BIT_IS_UNSET_POP_7 402
+#define _GUARD_CALLABLE_ISINSTANCE 403
+#define _GUARD_CALLABLE_LEN 404
+#define _GUARD_CALLABLE_LIST_APPEND 405
+#define _GUARD_CALLABLE_STR_1 406
+#define _GUARD_CALLABLE_TUPLE_1 407
+#define _GUARD_CALLABLE_TYPE_1 408
+#define _GUARD_CODE_VERSION 409
+#define _GUARD_DORV_NO_DICT 410
+#define _GUARD_DORV_VALUES_INST_ATTR_FROM_DICT 411
+#define _GUARD_GLOBALS_VERSION 412
+#define _GUARD_IP_RETURN_GENERATOR 413
+#define _GUARD_IP_RETURN_VALUE 414
+#define _GUARD_IP_YIELD_VALUE 415
+#define _GUARD_IP__PUSH_FRAME 416
+#define _GUARD_IS_FALSE_POP 417
+#define _GUARD_IS_NONE_POP 418
+#define _GUARD_IS_NOT_NONE_POP 419
+#define _GUARD_IS_TRUE_POP 420
+#define _GUARD_KEYS_VERSION 421
+#define _GUARD_NOS_COMPACT_ASCII 422
+#define _GUARD_NOS_DICT 423
+#define _GUARD_NOS_FLOAT 424
+#define _GUARD_NOS_INT 425
+#define _GUARD_NOS_LIST 426
+#define _GUARD_NOS_NOT_NULL 427
+#define _GUARD_NOS_NULL 428
+#define _GUARD_NOS_OVERFLOWED 429
+#define _GUARD_NOS_TUPLE 430
+#define _GUARD_NOS_UNICODE 431
+#define _GUARD_NOT_EXHAUSTED_LIST 432
+#define _GUARD_NOT_EXHAUSTED_RANGE 433
+#define _GUARD_NOT_EXHAUSTED_TUPLE 434
+#define _GUARD_THIRD_NULL 435
+#define _GUARD_TOS_ANY_SET 436
+#define _GUARD_TOS_DICT 437
+#define _GUARD_TOS_FLOAT 438
+#define _GUARD_TOS_INT 439
+#define _GUARD_TOS_LIST 440
+#define _GUARD_TOS_OVERFLOWED 441
+#define _GUARD_TOS_SLICE 442
+#define _GUARD_TOS_TUPLE 443
+#define _GUARD_TOS_UNICODE 444
+#define _GUARD_TYPE_VERSION 445
+#define _GUARD_TYPE_VERSION_AND_LOCK 446
+#define _HANDLE_PENDING_AND_DEOPT 447
 #define _IMPORT_FROM IMPORT_FROM
 #define _IMPORT_NAME IMPORT_NAME
-#define _INIT_CALL_BOUND_METHOD_EXACT_ARGS 444
-#define _INIT_CALL_PY_EXACT_ARGS 445
-#define _INIT_CALL_PY_EXACT_ARGS_0 446
-#define _INIT_CALL_PY_EXACT_ARGS_1 447
-#define _INIT_CALL_PY_EXACT_ARGS_2 448
-#define _INIT_CALL_PY_EXACT_ARGS_3 449
-#define _INIT_CALL_PY_EXACT_ARGS_4 450
-#define _INSERT_1_LOAD_CONST_INLINE 451
-#define _INSERT_1_LOAD_CONST_INLINE_BORROW 452
-#define _INSERT_2_LOAD_CONST_INLINE_BORROW 453
-#define _INSERT_NULL 454
+#define _INIT_CALL_BOUND_METHOD_EXACT_ARGS 448
+#define _INIT_CALL_PY_EXACT_ARGS 449
+#define _INIT_CALL_PY_EXACT_ARGS_0 450
+#define _INIT_CALL_PY_EXACT_ARGS_1 451
+#define _INIT_CALL_PY_EXACT_ARGS_2 452
+#define _INIT_CALL_PY_EXACT_ARGS_3 453
+#define _INIT_CALL_PY_EXACT_ARGS_4 454
+#define _INSERT_1_LOAD_CONST_INLINE 455
+#define _INSERT_1_LOAD_CONST_INLINE_BORROW 456
+#define _INSERT_2_LOAD_CONST_INLINE_BORROW 457
+#define _INSERT_NULL 458
 #define _INSTRUMENTED_FOR_ITER INSTRUMENTED_FOR_ITER
 #define _INSTRUMENTED_INSTRUCTION INSTRUMENTED_INSTRUCTION
 #define _INSTRUMENTED_JUMP_FORWARD INSTRUMENTED_JUMP_FORWARD
@@ -208,1050 +212,1193 @@ extern "C" {
 #define _INSTRUMENTED_POP_JUMP_IF_NONE INSTRUMENTED_POP_JUMP_IF_NONE
 #define _INSTRUMENTED_POP_JUMP_IF_NOT_NONE INSTRUMENTED_POP_JUMP_IF_NOT_NONE
 #define _INSTRUMENTED_POP_JUMP_IF_TRUE INSTRUMENTED_POP_JUMP_IF_TRUE
-#define _IS_NONE 455
-#define _IS_OP 456
-#define _ITER_CHECK_LIST 457
-#define _ITER_CHECK_RANGE 458
-#define _ITER_CHECK_TUPLE 459
-#define _ITER_JUMP_LIST 460
-#define _ITER_JUMP_RANGE 461
-#define _ITER_JUMP_TUPLE 462
-#define _ITER_NEXT_LIST 463
-#define _ITER_NEXT_LIST_TIER_TWO 464
-#define _ITER_NEXT_RANGE 465
-#define _ITER_NEXT_TUPLE 466
+#define _IS_NONE 459
+#define _IS_OP 460
+#define _ITER_CHECK_LIST 461
+#define _ITER_CHECK_RANGE 462
+#define _ITER_CHECK_TUPLE 463
+#define _ITER_JUMP_LIST 464
+#define _ITER_JUMP_RANGE 465
+#define _ITER_JUMP_TUPLE 466
+#define _ITER_NEXT_LIST 467
+#define _ITER_NEXT_LIST_TIER_TWO 468
+#define _ITER_NEXT_RANGE 469
+#define _ITER_NEXT_TUPLE 470
 #define _JUMP_BACKWARD_NO_INTERRUPT JUMP_BACKWARD_NO_INTERRUPT
-#define _JUMP_TO_TOP 467
+#define _JUMP_TO_TOP 471
 #define _LIST_APPEND LIST_APPEND
 #define _LIST_EXTEND LIST_EXTEND
-#define _LOAD_ATTR 468
-#define _LOAD_ATTR_CLASS 469
+#define _LOAD_ATTR 472
+#define _LOAD_ATTR_CLASS 473
 #define _LOAD_ATTR_GETATTRIBUTE_OVERRIDDEN LOAD_ATTR_GETATTRIBUTE_OVERRIDDEN
-#define _LOAD_ATTR_INSTANCE_VALUE 470
-#define _LOAD_ATTR_METHOD_LAZY_DICT 471
-#define _LOAD_ATTR_METHOD_NO_DICT 472
-#define _LOAD_ATTR_METHOD_WITH_VALUES 473
-#define _LOAD_ATTR_MODULE 474
-#define _LOAD_ATTR_NONDESCRIPTOR_NO_DICT 475
-#define _LOAD_ATTR_NONDESCRIPTOR_WITH_VALUES 476
-#define _LOAD_ATTR_PROPERTY_FRAME 477
-#define _LOAD_ATTR_SLOT 478
-#define _LOAD_ATTR_WITH_HINT 479
+#define _LOAD_ATTR_INSTANCE_VALUE 474
+#define _LOAD_ATTR_METHOD_LAZY_DICT 475
+#define _LOAD_ATTR_METHOD_NO_DICT 476
+#define _LOAD_ATTR_METHOD_WITH_VALUES 477
+#define _LOAD_ATTR_MODULE 478
+#define _LOAD_ATTR_NONDESCRIPTOR_NO_DICT 479
+#define _LOAD_ATTR_NONDESCRIPTOR_WITH_VALUES 480
+#define _LOAD_ATTR_PROPERTY_FRAME 481
+#define _LOAD_ATTR_SLOT 482
+#define _LOAD_ATTR_WITH_HINT 483
 #define _LOAD_BUILD_CLASS LOAD_BUILD_CLASS
-#define _LOAD_BYTECODE 480
+#define _LOAD_BYTECODE 484
 #define _LOAD_COMMON_CONSTANT LOAD_COMMON_CONSTANT
 #define _LOAD_CONST LOAD_CONST
-#define _LOAD_CONST_INLINE 481
-#define _LOAD_CONST_INLINE_BORROW 482
-#define _LOAD_CONST_UNDER_INLINE 483
-#define _LOAD_CONST_UNDER_INLINE_BORROW 484
+#define _LOAD_CONST_INLINE 485
+#define _LOAD_CONST_INLINE_BORROW 486
+#define _LOAD_CONST_UNDER_INLINE 487
+#define _LOAD_CONST_UNDER_INLINE_BORROW 488
 #define _LOAD_DEREF LOAD_DEREF
-#define _LOAD_FAST 485
-#define _LOAD_FAST_0 486
-#define _LOAD_FAST_1 487
-#define _LOAD_FAST_2 488
-#define _LOAD_FAST_3 489
-#define _LOAD_FAST_4 490
-#define _LOAD_FAST_5 491
-#define _LOAD_FAST_6 492
-#define _LOAD_FAST_7 493
+#define _LOAD_FAST 489
+#define _LOAD_FAST_0 490
+#define _LOAD_FAST_1 491
+#define _LOAD_FAST_2 492
+#define _LOAD_FAST_3 493
+#define _LOAD_FAST_4 494
+#define _LOAD_FAST_5 495
+#define _LOAD_FAST_6 496
+#define _LOAD_FAST_7 497
 #define _LOAD_FAST_AND_CLEAR LOAD_FAST_AND_CLEAR
-#define _LOAD_FAST_BORROW 494
-#define _LOAD_FAST_BORROW_0 495
-#define _LOAD_FAST_BORROW_1 496
-#define _LOAD_FAST_BORROW_2 497
-#define _LOAD_FAST_BORROW_3 498
-#define _LOAD_FAST_BORROW_4 499
-#define _LOAD_FAST_BORROW_5 500
-#define _LOAD_FAST_BORROW_6 501
-#define _LOAD_FAST_BORROW_7 502
+#define _LOAD_FAST_BORROW 498
+#define _LOAD_FAST_BORROW_0 499
+#define _LOAD_FAST_BORROW_1 500
+#define _LOAD_FAST_BORROW_2 501
+#define _LOAD_FAST_BORROW_3 502
+#define _LOAD_FAST_BORROW_4 503
+#define _LOAD_FAST_BORROW_5 504
+#define _LOAD_FAST_BORROW_6 505
+#define _LOAD_FAST_BORROW_7 506
 #define _LOAD_FAST_CHECK LOAD_FAST_CHECK
 #define _LOAD_FROM_DICT_OR_DEREF LOAD_FROM_DICT_OR_DEREF
 #define _LOAD_FROM_DICT_OR_GLOBALS LOAD_FROM_DICT_OR_GLOBALS
-#define _LOAD_GLOBAL 503
-#define _LOAD_GLOBAL_BUILTINS 504
-#define _LOAD_GLOBAL_MODULE 505
+#define _LOAD_GLOBAL 507
+#define _LOAD_GLOBAL_BUILTINS 508
+#define _LOAD_GLOBAL_MODULE 509
 #define _LOAD_LOCALS LOAD_LOCALS
 #define _LOAD_NAME LOAD_NAME
-#define _LOAD_SMALL_INT 506
-#define _LOAD_SMALL_INT_0 507
-#define _LOAD_SMALL_INT_1 508
-#define _LOAD_SMALL_INT_2 509
-#define _LOAD_SMALL_INT_3 510
-#define _LOAD_SPECIAL 511
+#define _LOAD_SMALL_INT 510
+#define _LOAD_SMALL_INT_0 511
+#define _LOAD_SMALL_INT_1 512
+#define _LOAD_SMALL_INT_2 513
+#define _LOAD_SMALL_INT_3 514
+#define _LOAD_SPECIAL 515
 #define _LOAD_SUPER_ATTR_ATTR LOAD_SUPER_ATTR_ATTR
 #define _LOAD_SUPER_ATTR_METHOD LOAD_SUPER_ATTR_METHOD
-#define _MAKE_CALLARGS_A_TUPLE 512
+#define _MAKE_CALLARGS_A_TUPLE 516
 #define _MAKE_CELL MAKE_CELL
 #define _MAKE_FUNCTION MAKE_FUNCTION
-#define _MAKE_WARM 513
+#define _MAKE_WARM 517
 #define _MAP_ADD MAP_ADD
 #define _MATCH_CLASS MATCH_CLASS
 #define _MATCH_KEYS MATCH_KEYS
 #define _MATCH_MAPPING MATCH_MAPPING
 #define _MATCH_SEQUENCE MATCH_SEQUENCE
-#define _MAYBE_EXPAND_METHOD 514
-#define _MAYBE_EXPAND_METHOD_KW 515
-#define _MONITOR_CALL 516
-#define _MONITOR_CALL_KW 517
-#define _MONITOR_JUMP_BACKWARD 518
-#define _MONITOR_RESUME 519
+#define _MAYBE_EXPAND_METHOD 518
+#define _MAYBE_EXPAND_METHOD_KW 519
+#define _MONITOR_CALL 520
+#define _MONITOR_CALL_KW 521
+#define _MONITOR_JUMP_BACKWARD 522
+#define _MONITOR_RESUME 523
 #define _NOP NOP
-#define _POP_CALL 520
-#define _POP_CALL_LOAD_CONST_INLINE_BORROW 521
-#define _POP_CALL_ONE 522
-#define _POP_CALL_ONE_LOAD_CONST_INLINE_BORROW 523
-#define _POP_CALL_TWO 524
-#define _POP_CALL_TWO_LOAD_CONST_INLINE_BORROW 525
+#define _POP_CALL 524
+#define _POP_CALL_LOAD_CONST_INLINE_BORROW 525
+#define _POP_CALL_ONE 526
+#define _POP_CALL_ONE_LOAD_CONST_INLINE_BORROW 527
+#define _POP_CALL_TWO 528
+#define _POP_CALL_TWO_LOAD_CONST_INLINE_BORROW 529
 #define _POP_EXCEPT POP_EXCEPT
 #define _POP_ITER POP_ITER
-#define _POP_JUMP_IF_FALSE 526
-#define _POP_JUMP_IF_TRUE 527
+#define _POP_JUMP_IF_FALSE 530
+#define _POP_JUMP_IF_TRUE 531
 #define _POP_TOP POP_TOP
-#define _POP_TOP_FLOAT 528
-#define _POP_TOP_INT 529
-#define _POP_TOP_LOAD_CONST_INLINE 530
-#define _POP_TOP_LOAD_CONST_INLINE_BORROW 531
-#define _POP_TOP_NOP 532
-#define _POP_TOP_UNICODE 533
-#define _POP_TWO 534
-#define _POP_TWO_LOAD_CONST_INLINE_BORROW 535
+#define _POP_TOP_FLOAT 532
+#define _POP_TOP_INT 533
+#define _POP_TOP_LOAD_CONST_INLINE 534
+#define _POP_TOP_LOAD_CONST_INLINE_BORROW 535
+#define _POP_TOP_NOP 536
+#define _POP_TOP_UNICODE 537
+#define _POP_TWO 538
+#define _POP_TWO_LOAD_CONST_INLINE_BORROW 539
 #define _PUSH_EXC_INFO PUSH_EXC_INFO
-#define _PUSH_FRAME 536
+#define _PUSH_FRAME 540
 #define _PUSH_NULL PUSH_NULL
-#define _PUSH_NULL_CONDITIONAL 537
-#define _PY_FRAME_EX 538
-#define _PY_FRAME_GENERAL 539
-#define _PY_FRAME_KW 540
-#define _QUICKEN_RESUME 541
-#define _RECORD_4OS 542
-#define _RECORD_BOUND_METHOD 543
-#define _RECORD_CALLABLE 544
-#define _RECORD_CODE 545
-#define _RECORD_NOS 546
-#define _RECORD_NOS_GEN_FUNC 547
-#define _RECORD_TOS 548
-#define _RECORD_TOS_TYPE 549
-#define _REPLACE_WITH_TRUE 550
+#define _PUSH_NULL_CONDITIONAL 541
+#define _PY_FRAME_EX 542
+#define _PY_FRAME_GENERAL 543
+#define _PY_FRAME_KW 544
+#define _QUICKEN_RESUME 545
+#define _RECORD_4OS 546
+#define _RECORD_BOUND_METHOD 547
+#define _RECORD_CALLABLE 548
+#define _RECORD_CODE 549
+#define _RECORD_NOS 550
+#define _RECORD_NOS_GEN_FUNC 551
+#define _RECORD_TOS 552
+#define _RECORD_TOS_TYPE 553
+#define _REPLACE_WITH_TRUE 554
 #define _RESUME_CHECK RESUME_CHECK
 #define _RETURN_GENERATOR RETURN_GENERATOR
 #define _RETURN_VALUE RETURN_VALUE
-#define _SAVE_RETURN_OFFSET 551
-#define _SEND 552
-#define _SEND_GEN_FRAME 553
+#define _SAVE_RETURN_OFFSET 555
+#define _SEND 556
+#define _SEND_GEN_FRAME 557
 #define _SETUP_ANNOTATIONS SETUP_ANNOTATIONS
 #define _SET_ADD SET_ADD
 #define _SET_FUNCTION_ATTRIBUTE SET_FUNCTION_ATTRIBUTE
 #define _SET_UPDATE SET_UPDATE
-#define _SHUFFLE_2_LOAD_CONST_INLINE_BORROW 554
-#define _SHUFFLE_3_LOAD_CONST_INLINE_BORROW 555
-#define _SPILL_OR_RELOAD 556
-#define _START_EXECUTOR 557
-#define _STORE_ATTR 558
-#define _STORE_ATTR_INSTANCE_VALUE 559
-#define _STORE_ATTR_SLOT 560
-#define _STORE_ATTR_WITH_HINT 561
+#define _SHUFFLE_2_LOAD_CONST_INLINE_BORROW 558
+#define _SHUFFLE_3_LOAD_CONST_INLINE_BORROW 559
+#define _SPILL_OR_RELOAD 560
+#define _START_EXECUTOR 561
+#define _STORE_ATTR 562
+#define _STORE_ATTR_INSTANCE_VALUE 563
+#define _STORE_ATTR_SLOT 564
+#define _STORE_ATTR_WITH_HINT 565
 #define _STORE_DEREF STORE_DEREF
 #define _STORE_GLOBAL STORE_GLOBAL
 #define _STORE_NAME STORE_NAME
-#define _STORE_SLICE 562
-#define _STORE_SUBSCR 563
-#define _STORE_SUBSCR_DICT 564
-#define _STORE_SUBSCR_LIST_INT 565
-#define _SWAP 566
-#define _SWAP_2 567
-#define _SWAP_3 568
-#define _SWAP_FAST 569
-#define _SWAP_FAST_0 570
-#define _SWAP_FAST_1 571
-#define _SWAP_FAST_2 572
-#define _SWAP_FAST_3 573
-#define _SWAP_FAST_4 574
-#define _SWAP_FAST_5 575
-#define _SWAP_FAST_6 576
-#define _SWAP_FAST_7 577
-#define _TIER2_RESUME_CHECK 578
-#define _TO_BOOL 579
+#define _STORE_SLICE 566
+#define _STORE_SUBSCR 567
+#define _STORE_SUBSCR_DICT 568
+#define _STORE_SUBSCR_LIST_INT 569
+#define _SWAP 570
+#define _SWAP_2 571
+#define _SWAP_3 572
+#define _SWAP_FAST 573
+#define _SWAP_FAST_0 574
+#define _SWAP_FAST_1 575
+#define _SWAP_FAST_2 576
+#define _SWAP_FAST_3 577
+#define _SWAP_FAST_4 578
+#define _SWAP_FAST_5 579
+#define _SWAP_FAST_6 580
+#define _SWAP_FAST_7 581
+#define _TIER2_RESUME_CHECK 582
+#define _TO_BOOL 583
 #define _TO_BOOL_BOOL TO_BOOL_BOOL
-#define _TO_BOOL_INT 580
-#define _TO_BOOL_LIST 581
+#define _TO_BOOL_INT 584
+#define _TO_BOOL_LIST 585
 #define _TO_BOOL_NONE TO_BOOL_NONE
-#define _TO_BOOL_STR 582
+#define _TO_BOOL_STR 586
 #define _TRACE_RECORD TRACE_RECORD
-#define _UNARY_INVERT 583
-#define _UNARY_NEGATIVE 584
+#define _UNARY_INVERT 587
+#define _UNARY_NEGATIVE 588
 #define _UNARY_NOT UNARY_NOT
 #define _UNPACK_EX UNPACK_EX
-#define _UNPACK_SEQUENCE 585
-#define _UNPACK_SEQUENCE_LIST 586
-#define _UNPACK_SEQUENCE_TUPLE 587
-#define _UNPACK_SEQUENCE_TWO_TUPLE 588
+#define _UNPACK_SEQUENCE 589
+#define _UNPACK_SEQUENCE_LIST 590
+#define _UNPACK_SEQUENCE_TUPLE 591
+#define _UNPACK_SEQUENCE_TWO_TUPLE 592
 #define _WITH_EXCEPT_START WITH_EXCEPT_START
 #define _YIELD_VALUE YIELD_VALUE
-#define MAX_UOP_ID 588
-#define _BINARY_OP_r23 589
-#define _BINARY_OP_ADD_FLOAT_r03 590
-#define _BINARY_OP_ADD_FLOAT_r13 591
-#define _BINARY_OP_ADD_FLOAT_r23 592
-#define _BINARY_OP_ADD_INT_r03 593
-#define _BINARY_OP_ADD_INT_r13 594
-#define _BINARY_OP_ADD_INT_r23 595
-#define _BINARY_OP_ADD_UNICODE_r03 596
-#define _BINARY_OP_ADD_UNICODE_r13 597
-#define _BINARY_OP_ADD_UNICODE_r23 598
-#define _BINARY_OP_EXTEND_r23 599
-#define _BINARY_OP_INPLACE_ADD_UNICODE_r21 600
-#define _BINARY_OP_MULTIPLY_FLOAT_r03 601
-#define _BINARY_OP_MULTIPLY_FLOAT_r13 602
-#define _BINARY_OP_MULTIPLY_FLOAT_r23 603
-#define _BINARY_OP_MULTIPLY_INT_r03 604
-#define _BINARY_OP_MULTIPLY_INT_r13 605
-#define _BINARY_OP_MULTIPLY_INT_r23 606
-#define _BINARY_OP_SUBSCR_CHECK_FUNC_r23 607
-#define _BINARY_OP_SUBSCR_DICT_r23 608
-#define _BINARY_OP_SUBSCR_INIT_CALL_r01 609
-#define _BINARY_OP_SUBSCR_INIT_CALL_r11 610
-#define _BINARY_OP_SUBSCR_INIT_CALL_r21 611
-#define _BINARY_OP_SUBSCR_INIT_CALL_r31 612
-#define _BINARY_OP_SUBSCR_LIST_INT_r23 613
-#define _BINARY_OP_SUBSCR_LIST_SLICE_r23 614
-#define _BINARY_OP_SUBSCR_STR_INT_r23 615
-#define _BINARY_OP_SUBSCR_TUPLE_INT_r03 616
-#define _BINARY_OP_SUBSCR_TUPLE_INT_r13 617
-#define _BINARY_OP_SUBSCR_TUPLE_INT_r23 618
-#define _BINARY_OP_SUBSCR_USTR_INT_r23 619
-#define _BINARY_OP_SUBTRACT_FLOAT_r03 620
-#define _BINARY_OP_SUBTRACT_FLOAT_r13 621
-#define _BINARY_OP_SUBTRACT_FLOAT_r23 622
-#define _BINARY_OP_SUBTRACT_INT_r03 623
-#define _BINARY_OP_SUBTRACT_INT_r13 624
-#define _BINARY_OP_SUBTRACT_INT_r23 625
-#define _BINARY_SLICE_r31 626
-#define _BUILD_INTERPOLATION_r01 627
-#define _BUILD_LIST_r01 628
-#define _BUILD_MAP_r01 629
-#define _BUILD_SET_r01 630
-#define _BUILD_SLICE_r01 631
-#define _BUILD_STRING_r01 632
-#define _BUILD_TEMPLATE_r21 633
-#define _BUILD_TUPLE_r01 634
-#define _CALL_BUILTIN_CLASS_r01 635
-#define _CALL_BUILTIN_FAST_r01 636
-#define _CALL_BUILTIN_FAST_WITH_KEYWORDS_r01 637
-#define _CALL_BUILTIN_O_r03 638
-#define _CALL_FUNCTION_EX_NON_PY_GENERAL_r31 639
-#define _CALL_INTRINSIC_1_r11 640
-#define _CALL_INTRINSIC_2_r21 641
-#define _CALL_ISINSTANCE_r31 642
-#define _CALL_KW_NON_PY_r11 643
-#define _CALL_LEN_r33 644
-#define _CALL_LIST_APPEND_r03 645
-#define _CALL_LIST_APPEND_r13 646
-#define _CALL_LIST_APPEND_r23 647
-#define _CALL_LIST_APPEND_r33 648
-#define _CALL_METHOD_DESCRIPTOR_FAST_r01 649
-#define _CALL_METHOD_DESCRIPTOR_FAST_WITH_KEYWORDS_r01 650
-#define _CALL_METHOD_DESCRIPTOR_NOARGS_r01 651
-#define _CALL_METHOD_DESCRIPTOR_O_r03 652
-#define _CALL_NON_PY_GENERAL_r01 653
-#define _CALL_STR_1_r32 654
-#define _CALL_TUPLE_1_r32 655
-#define _CALL_TYPE_1_r02 656
-#define _CALL_TYPE_1_r12 657
-#define _CALL_TYPE_1_r22 658
-#define _CALL_TYPE_1_r32 659
-#define _CHECK_AND_ALLOCATE_OBJECT_r00 660
-#define _CHECK_ATTR_CLASS_r01 661
-#define _CHECK_ATTR_CLASS_r11 662
-#define _CHECK_ATTR_CLASS_r22 663
-#define _CHECK_ATTR_CLASS_r33 664
-#define _CHECK_ATTR_METHOD_LAZY_DICT_r01 665
-#define _CHECK_ATTR_METHOD_LAZY_DICT_r11 666
-#define _CHECK_ATTR_METHOD_LAZY_DICT_r22 667
-#define _CHECK_ATTR_METHOD_LAZY_DICT_r33 668
-#define _CHECK_CALL_BOUND_METHOD_EXACT_ARGS_r00 669
-#define _CHECK_EG_MATCH_r22 670
-#define _CHECK_EXC_MATCH_r22 671
-#define _CHECK_FUNCTION_EXACT_ARGS_r00 672
-#define _CHECK_FUNCTION_VERSION_r00 673
-#define _CHECK_FUNCTION_VERSION_INLINE_r00 674
-#define _CHECK_FUNCTION_VERSION_INLINE_r11 675
-#define _CHECK_FUNCTION_VERSION_INLINE_r22 676
-#define _CHECK_FUNCTION_VERSION_INLINE_r33 677
-#define _CHECK_FUNCTION_VERSION_KW_r11 678
-#define _CHECK_IS_NOT_PY_CALLABLE_r00 679
-#define _CHECK_IS_NOT_PY_CALLABLE_EX_r03 680
-#define _CHECK_IS_NOT_PY_CALLABLE_EX_r13 681
-#define _CHECK_IS_NOT_PY_CALLABLE_EX_r23 682
-#define _CHECK_IS_NOT_PY_CALLABLE_EX_r33 683
-#define _CHECK_IS_NOT_PY_CALLABLE_KW_r11 684
-#define _CHECK_IS_PY_CALLABLE_EX_r03 685
-#define _CHECK_IS_PY_CALLABLE_EX_r13 686
-#define _CHECK_IS_PY_CALLABLE_EX_r23 687
-#define _CHECK_IS_PY_CALLABLE_EX_r33 688
-#define _CHECK_MANAGED_OBJECT_HAS_VALUES_r01 689
-#define _CHECK_MANAGED_OBJECT_HAS_VALUES_r11 690
-#define _CHECK_MANAGED_OBJECT_HAS_VALUES_r22 691
-#define _CHECK_MANAGED_OBJECT_HAS_VALUES_r33 692
-#define _CHECK_METHOD_VERSION_r00 693
-#define _CHECK_METHOD_VERSION_KW_r11 694
-#define _CHECK_PEP_523_r00 695
-#define _CHECK_PEP_523_r11 696
-#define _CHECK_PEP_523_r22 697
-#define _CHECK_PEP_523_r33 698
-#define _CHECK_PERIODIC_r00 699
-#define _CHECK_PERIODIC_AT_END_r00 700
-#define _CHECK_PERIODIC_IF_NOT_YIELD_FROM_r00 701
-#define _CHECK_RECURSION_REMAINING_r00 702
-#define _CHECK_RECURSION_REMAINING_r11 703
-#define _CHECK_RECURSION_REMAINING_r22 704
-#define _CHECK_RECURSION_REMAINING_r33 705
-#define _CHECK_STACK_SPACE_r00 706
-#define _CHECK_STACK_SPACE_OPERAND_r00 707
-#define _CHECK_STACK_SPACE_OPERAND_r11 708
-#define _CHECK_STACK_SPACE_OPERAND_r22 709
-#define _CHECK_STACK_SPACE_OPERAND_r33 710
-#define _CHECK_VALIDITY_r00 711
-#define _CHECK_VALIDITY_r11 712
-#define _CHECK_VALIDITY_r22 713
-#define _CHECK_VALIDITY_r33 714
-#define _COLD_DYNAMIC_EXIT_r00 715
-#define _COLD_EXIT_r00 716
-#define _COMPARE_OP_r21 717
-#define _COMPARE_OP_FLOAT_r03 718
-#define _COMPARE_OP_FLOAT_r13 719
-#define _COMPARE_OP_FLOAT_r23 720
-#define _COMPARE_OP_INT_r23 721
-#define _COMPARE_OP_STR_r23 722
-#define _CONTAINS_OP_r23 723
-#define _CONTAINS_OP_DICT_r23 724
-#define _CONTAINS_OP_SET_r23 725
-#define _CONVERT_VALUE_r11 726
-#define _COPY_r01 727
-#define _COPY_1_r02 728
-#define _COPY_1_r12 729
-#define _COPY_1_r23 730
-#define _COPY_2_r03 731
-#define _COPY_2_r13 732
-#define _COPY_2_r23 733
-#define _COPY_3_r03 734
-#define _COPY_3_r13 735
-#define _COPY_3_r23 736
-#define _COPY_3_r33 737
-#define _COPY_FREE_VARS_r00 738
-#define _COPY_FREE_VARS_r11 739
-#define _COPY_FREE_VARS_r22 740
-#define _COPY_FREE_VARS_r33 741
-#define _CREATE_INIT_FRAME_r01 742
-#define _DELETE_ATTR_r10 743
-#define _DELETE_DEREF_r00 744
-#define _DELETE_FAST_r00 745
-#define _DELETE_GLOBAL_r00 746
-#define _DELETE_NAME_r00 747
-#define _DELETE_SUBSCR_r20 748
-#define _DEOPT_r00 749
-#define _DEOPT_r10 750
-#define _DEOPT_r20 751
-#define _DEOPT_r30 752
-#define _DICT_MERGE_r10 753
-#define _DICT_UPDATE_r10 754
-#define _DO_CALL_r01 755
-#define _DO_CALL_FUNCTION_EX_r31 756
-#define _DO_CALL_KW_r11 757
-#define _DYNAMIC_EXIT_r00 758
-#define _DYNAMIC_EXIT_r10 759
-#define _DYNAMIC_EXIT_r20 760
-#define _DYNAMIC_EXIT_r30 761
-#define _END_FOR_r10 762
-#define _END_SEND_r21 763
-#define _ERROR_POP_N_r00 764
-#define _EXIT_INIT_CHECK_r10 765
-#define _EXIT_TRACE_r00 766
-#define _EXIT_TRACE_r10 767
-#define _EXIT_TRACE_r20 768
-#define _EXIT_TRACE_r30 769
-#define _EXPAND_METHOD_r00 770
-#define _EXPAND_METHOD_KW_r11 771
-#define _FATAL_ERROR_r00 772
-#define _FATAL_ERROR_r11 773
-#define _FATAL_ERROR_r22 774
-#define _FATAL_ERROR_r33 775
-#define _FORMAT_SIMPLE_r11 776
-#define _FORMAT_WITH_SPEC_r21 777
-#define _FOR_ITER_r23 778
-#define _FOR_ITER_GEN_FRAME_r03 779
-#define _FOR_ITER_GEN_FRAME_r13 780
-#define _FOR_ITER_GEN_FRAME_r23 781
-#define _FOR_ITER_TIER_TWO_r23 782
-#define _GET_AITER_r11 783
-#define _GET_ANEXT_r12 784
-#define _GET_AWAITABLE_r11 785
-#define _GET_ITER_r12 786
-#define _GET_LEN_r12 787
-#define _GET_YIELD_FROM_ITER_r11 788
-#define _GUARD_BINARY_OP_EXTEND_r22 789
-#define _GUARD_BINARY_OP_SUBSCR_TUPLE_INT_BOUNDS_r02 790
-#define _GUARD_BINARY_OP_SUBSCR_TUPLE_INT_BOUNDS_r12 791
-#define _GUARD_BINARY_OP_SUBSCR_TUPLE_INT_BOUNDS_r22 792
-#define _GUARD_BINARY_OP_SUBSCR_TUPLE_INT_BOUNDS_r33 793
-#define _GUARD_BIT_IS_SET_POP_r00 794
-#define _GUARD_BIT_IS_SET_POP_r10 795
-#define _GUARD_BIT_IS_SET_POP_r21 796
-#define _GUARD_BIT_IS_SET_POP_r32 797
-#define _GUARD_BIT_IS_SET_POP_4_r00 798
-#define _GUARD_BIT_IS_SET_POP_4_r10 799
-#define _GUARD_BIT_IS_SET_POP_4_r21 800
-#define _GUARD_BIT_IS_SET_POP_4_r32 801
-#define _GUARD_BIT_IS_SET_POP_5_r00 802
-#define _GUARD_BIT_IS_SET_POP_5_r10 803
-#define _GUARD_BIT_IS_SET_POP_5_r21 804
-#define _GUARD_BIT_IS_SET_POP_5_r32 805
-#define _GUARD_BIT_IS_SET_POP_6_r00 806
-#define _GUARD_BIT_IS_SET_POP_6_r10 807
-#define _GUARD_BIT_IS_SET_POP_6_r21 808
-#define _GUARD_BIT_IS_SET_POP_6_r32 809
-#define _GUARD_BIT_IS_SET_POP_7_r00 810
-#define _GUARD_BIT_IS_SET_POP_7_r10 811
-#define _GUARD_BIT_IS_SET_POP_7_r21 812
-#define _GUARD_BIT_IS_SET_POP_7_r32 813
-#define _GUARD_BIT_IS_UNSET_POP_r00 814
-#define _GUARD_BIT_IS_UNSET_POP_r10 815
-#define _GUARD_BIT_IS_UNSET_POP_r21 816
-#define _GUARD_BIT_IS_UNSET_POP_r32 817
-#define _GUARD_BIT_IS_UNSET_POP_4_r00 818
-#define _GUARD_BIT_IS_UNSET_POP_4_r10 819
-#define _GUARD_BIT_IS_UNSET_POP_4_r21 820
-#define _GUARD_BIT_IS_UNSET_POP_4_r32 821
-#define _GUARD_BIT_IS_UNSET_POP_5_r00 822
-#define _GUARD_BIT_IS_UNSET_POP_5_r10 823
-#define _GUARD_BIT_IS_UNSET_POP_5_r21 824
-#define _GUARD_BIT_IS_UNSET_POP_5_r32 825
-#define _GUARD_BIT_IS_UNSET_POP_6_r00 826
-#define _GUARD_BIT_IS_UNSET_POP_6_r10 827
-#define _GUARD_BIT_IS_UNSET_POP_6_r21 828
-#define _GUARD_BIT_IS_UNSET_POP_6_r32 829
-#define _GUARD_BIT_IS_UNSET_POP_7_r00 830
-#define _GUARD_BIT_IS_UNSET_POP_7_r10 831
-#define _GUARD_BIT_IS_UNSET_POP_7_r21 832
-#define _GUARD_BIT_IS_UNSET_POP_7_r32 833
-#define _GUARD_CALLABLE_ISINSTANCE_r03 834
-#define _GUARD_CALLABLE_ISINSTANCE_r13 835
-#define _GUARD_CALLABLE_ISINSTANCE_r23 836
-#define _GUARD_CALLABLE_ISINSTANCE_r33 837
-#define _GUARD_CALLABLE_LEN_r03 838
-#define _GUARD_CALLABLE_LEN_r13 839
-#define _GUARD_CALLABLE_LEN_r23 840
-#define _GUARD_CALLABLE_LEN_r33 841
-#define _GUARD_CALLABLE_LIST_APPEND_r03 842
-#define _GUARD_CALLABLE_LIST_APPEND_r13 843
-#define _GUARD_CALLABLE_LIST_APPEND_r23 844
-#define _GUARD_CALLABLE_LIST_APPEND_r33 845
-#define _GUARD_CALLABLE_STR_1_r03 846
-#define _GUARD_CALLABLE_STR_1_r13 847
-#define _GUARD_CALLABLE_STR_1_r23 848
-#define _GUARD_CALLABLE_STR_1_r33 849
-#define _GUARD_CALLABLE_TUPLE_1_r03 850
-#define _GUARD_CALLABLE_TUPLE_1_r13 851
-#define _GUARD_CALLABLE_TUPLE_1_r23 852
-#define _GUARD_CALLABLE_TUPLE_1_r33 853
-#define _GUARD_CALLABLE_TYPE_1_r03 854
-#define _GUARD_CALLABLE_TYPE_1_r13 855
-#define _GUARD_CALLABLE_TYPE_1_r23 856
-#define _GUARD_CALLABLE_TYPE_1_r33 857
-#define _GUARD_CODE_VERSION_r00 858
-#define _GUARD_CODE_VERSION_r11 859
-#define _GUARD_CODE_VERSION_r22 860
-#define _GUARD_CODE_VERSION_r33 861
-#define _GUARD_DORV_NO_DICT_r01 862
-#define _GUARD_DORV_NO_DICT_r11 863
-#define _GUARD_DORV_NO_DICT_r22 864
-#define _GUARD_DORV_NO_DICT_r33 865
-#define _GUARD_DORV_VALUES_INST_ATTR_FROM_DICT_r01 866
-#define _GUARD_DORV_VALUES_INST_ATTR_FROM_DICT_r11 867
-#define _GUARD_DORV_VALUES_INST_ATTR_FROM_DICT_r22 868
-#define _GUARD_DORV_VALUES_INST_ATTR_FROM_DICT_r33 869
-#define _GUARD_GLOBALS_VERSION_r00 870
-#define _GUARD_GLOBALS_VERSION_r11 871
-#define _GUARD_GLOBALS_VERSION_r22 872
-#define _GUARD_GLOBALS_VERSION_r33 873
-#define _GUARD_IP_RETURN_GENERATOR_r00 874
-#define _GUARD_IP_RETURN_GENERATOR_r11 875
-#define _GUARD_IP_RETURN_GENERATOR_r22 876
-#define _GUARD_IP_RETURN_GENERATOR_r33 877
-#define _GUARD_IP_RETURN_VALUE_r00 878
-#define _GUARD_IP_RETURN_VALUE_r11 879
-#define _GUARD_IP_RETURN_VALUE_r22 880
-#define _GUARD_IP_RETURN_VALUE_r33 881
-#define _GUARD_IP_YIELD_VALUE_r00 882
-#define _GUARD_IP_YIELD_VALUE_r11 883
-#define _GUARD_IP_YIELD_VALUE_r22 884
-#define _GUARD_IP_YIELD_VALUE_r33 885
-#define _GUARD_IP__PUSH_FRAME_r00 886
-#define _GUARD_IP__PUSH_FRAME_r11 887
-#define _GUARD_IP__PUSH_FRAME_r22 888
-#define _GUARD_IP__PUSH_FRAME_r33 889
-#define _GUARD_IS_FALSE_POP_r00 890
-#define _GUARD_IS_FALSE_POP_r10 891
-#define _GUARD_IS_FALSE_POP_r21 892
-#define _GUARD_IS_FALSE_POP_r32 893
-#define _GUARD_IS_NONE_POP_r00 894
-#define _GUARD_IS_NONE_POP_r10 895
-#define _GUARD_IS_NONE_POP_r21 896
-#define _GUARD_IS_NONE_POP_r32 897
-#define _GUARD_IS_NOT_NONE_POP_r10 898
-#define _GUARD_IS_TRUE_POP_r00 899
-#define _GUARD_IS_TRUE_POP_r10 900
-#define _GUARD_IS_TRUE_POP_r21 901
-#define _GUARD_IS_TRUE_POP_r32 902
-#define _GUARD_KEYS_VERSION_r01 903
-#define _GUARD_KEYS_VERSION_r11 904
-#define _GUARD_KEYS_VERSION_r22 905
-#define _GUARD_KEYS_VERSION_r33 906
-#define _GUARD_NOS_COMPACT_ASCII_r02 907
-#define _GUARD_NOS_COMPACT_ASCII_r12 908
-#define _GUARD_NOS_COMPACT_ASCII_r22 909
-#define _GUARD_NOS_COMPACT_ASCII_r33 910
-#define _GUARD_NOS_DICT_r02 911
-#define _GUARD_NOS_DICT_r12 912
-#define _GUARD_NOS_DICT_r22 913
-#define _GUARD_NOS_DICT_r33 914
-#define _GUARD_NOS_FLOAT_r02 915
-#define _GUARD_NOS_FLOAT_r12 916
-#define _GUARD_NOS_FLOAT_r22 917
-#define _GUARD_NOS_FLOAT_r33 918
-#define _GUARD_NOS_INT_r02 919
-#define _GUARD_NOS_INT_r12 920
-#define _GUARD_NOS_INT_r22 921
-#define _GUARD_NOS_INT_r33 922
-#define _GUARD_NOS_LIST_r02 923
-#define _GUARD_NOS_LIST_r12 924
-#define _GUARD_NOS_LIST_r22 925
-#define _GUARD_NOS_LIST_r33 926
-#define _GUARD_NOS_NOT_NULL_r02 927
-#define _GUARD_NOS_NOT_NULL_r12 928
-#define _GUARD_NOS_NOT_NULL_r22 929
-#define _GUARD_NOS_NOT_NULL_r33 930
-#define _GUARD_NOS_NULL_r02 931
-#define _GUARD_NOS_NULL_r12 932
-#define _GUARD_NOS_NULL_r22 933
-#define _GUARD_NOS_NULL_r33 934
-#define _GUARD_NOS_OVERFLOWED_r02 935
-#define _GUARD_NOS_OVERFLOWED_r12 936
-#define _GUARD_NOS_OVERFLOWED_r22 937
-#define _GUARD_NOS_OVERFLOWED_r33 938
-#define _GUARD_NOS_TUPLE_r02 939
-#define _GUARD_NOS_TUPLE_r12 940
-#define _GUARD_NOS_TUPLE_r22 941
-#define _GUARD_NOS_TUPLE_r33 942
-#define _GUARD_NOS_UNICODE_r02 943
-#define _GUARD_NOS_UNICODE_r12 944
-#define _GUARD_NOS_UNICODE_r22 945
-#define _GUARD_NOS_UNICODE_r33 946
-#define _GUARD_NOT_EXHAUSTED_LIST_r02 947
-#define _GUARD_NOT_EXHAUSTED_LIST_r12 948
-#define _GUARD_NOT_EXHAUSTED_LIST_r22 949
-#define _GUARD_NOT_EXHAUSTED_LIST_r33 950
-#define _GUARD_NOT_EXHAUSTED_RANGE_r02 951
-#define _GUARD_NOT_EXHAUSTED_RANGE_r12 952
-#define _GUARD_NOT_EXHAUSTED_RANGE_r22 953
-#define _GUARD_NOT_EXHAUSTED_RANGE_r33 954
-#define _GUARD_NOT_EXHAUSTED_TUPLE_r02 955
-#define _GUARD_NOT_EXHAUSTED_TUPLE_r12 956
-#define _GUARD_NOT_EXHAUSTED_TUPLE_r22 957
-#define _GUARD_NOT_EXHAUSTED_TUPLE_r33 958
-#define _GUARD_THIRD_NULL_r03 959
-#define _GUARD_THIRD_NULL_r13 960
-#define _GUARD_THIRD_NULL_r23 961
-#define _GUARD_THIRD_NULL_r33 962
-#define _GUARD_TOS_ANY_SET_r01 963
-#define _GUARD_TOS_ANY_SET_r11 964
-#define _GUARD_TOS_ANY_SET_r22 965
-#define _GUARD_TOS_ANY_SET_r33 966
-#define _GUARD_TOS_DICT_r01 967
-#define _GUARD_TOS_DICT_r11 968
-#define _GUARD_TOS_DICT_r22 969
-#define _GUARD_TOS_DICT_r33 970
-#define _GUARD_TOS_FLOAT_r01 971
-#define _GUARD_TOS_FLOAT_r11 972
-#define _GUARD_TOS_FLOAT_r22 973
-#define _GUARD_TOS_FLOAT_r33 974
-#define _GUARD_TOS_INT_r01 975
-#define _GUARD_TOS_INT_r11 976
-#define _GUARD_TOS_INT_r22 977
-#define _GUARD_TOS_INT_r33 978
-#define _GUARD_TOS_LIST_r01 979
-#define _GUARD_TOS_LIST_r11 980
-#define _GUARD_TOS_LIST_r22 981
-#define _GUARD_TOS_LIST_r33 982
-#define _GUARD_TOS_OVERFLOWED_r01 983
-#define _GUARD_TOS_OVERFLOWED_r11 984
-#define _GUARD_TOS_OVERFLOWED_r22 985
-#define _GUARD_TOS_OVERFLOWED_r33 986
-#define _GUARD_TOS_SLICE_r01 987
-#define _GUARD_TOS_SLICE_r11 988
-#define _GUARD_TOS_SLICE_r22 989
-#define _GUARD_TOS_SLICE_r33 990
-#define _GUARD_TOS_TUPLE_r01 991
-#define _GUARD_TOS_TUPLE_r11 992
-#define _GUARD_TOS_TUPLE_r22 993
-#define _GUARD_TOS_TUPLE_r33 994
-#define _GUARD_TOS_UNICODE_r01 995
-#define _GUARD_TOS_UNICODE_r11 996
-#define _GUARD_TOS_UNICODE_r22 997
-#define _GUARD_TOS_UNICODE_r33 998
-#define _GUARD_TYPE_VERSION_r01 999
-#define _GUARD_TYPE_VERSION_r11 1000
-#define _GUARD_TYPE_VERSION_r22 1001
-#define _GUARD_TYPE_VERSION_r33 1002
-#define _GUARD_TYPE_VERSION_AND_LOCK_r01 1003
-#define _GUARD_TYPE_VERSION_AND_LOCK_r11 1004
-#define _GUARD_TYPE_VERSION_AND_LOCK_r22 1005
-#define _GUARD_TYPE_VERSION_AND_LOCK_r33 1006
-#define _HANDLE_PENDING_AND_DEOPT_r00 1007
-#define _HANDLE_PENDING_AND_DEOPT_r10 1008
-#define _HANDLE_PENDING_AND_DEOPT_r20 1009
-#define _HANDLE_PENDING_AND_DEOPT_r30 1010
-#define _IMPORT_FROM_r12 1011
-#define _IMPORT_NAME_r21 1012
-#define _INIT_CALL_BOUND_METHOD_EXACT_ARGS_r00 1013
-#define _INIT_CALL_PY_EXACT_ARGS_r01 1014
-#define _INIT_CALL_PY_EXACT_ARGS_0_r01 1015
-#define _INIT_CALL_PY_EXACT_ARGS_1_r01 1016
-#define _INIT_CALL_PY_EXACT_ARGS_2_r01 1017
-#define _INIT_CALL_PY_EXACT_ARGS_3_r01 1018
-#define _INIT_CALL_PY_EXACT_ARGS_4_r01 1019
-#define _INSERT_1_LOAD_CONST_INLINE_r02 1020
-#define _INSERT_1_LOAD_CONST_INLINE_r12 1021
-#define _INSERT_1_LOAD_CONST_INLINE_r23 1022
-#define _INSERT_1_LOAD_CONST_INLINE_BORROW_r02 1023
-#define _INSERT_1_LOAD_CONST_INLINE_BORROW_r12 1024
-#define _INSERT_1_LOAD_CONST_INLINE_BORROW_r23 1025
-#define _INSERT_2_LOAD_CONST_INLINE_BORROW_r03 1026
-#define _INSERT_2_LOAD_CONST_INLINE_BORROW_r13 1027
-#define _INSERT_2_LOAD_CONST_INLINE_BORROW_r23 1028
-#define _INSERT_NULL_r10 1029
-#define _INSTRUMENTED_FOR_ITER_r23 1030
-#define _INSTRUMENTED_INSTRUCTION_r00 1031
-#define _INSTRUMENTED_JUMP_FORWARD_r00 1032
-#define _INSTRUMENTED_JUMP_FORWARD_r11 1033
-#define _INSTRUMENTED_JUMP_FORWARD_r22 1034
-#define _INSTRUMENTED_JUMP_FORWARD_r33 1035
-#define _INSTRUMENTED_LINE_r00 1036
-#define _INSTRUMENTED_NOT_TAKEN_r00 1037
-#define _INSTRUMENTED_NOT_TAKEN_r11 1038
-#define _INSTRUMENTED_NOT_TAKEN_r22 1039
-#define _INSTRUMENTED_NOT_TAKEN_r33 1040
-#define _INSTRUMENTED_POP_JUMP_IF_FALSE_r00 1041
-#define _INSTRUMENTED_POP_JUMP_IF_FALSE_r10 1042
-#define _INSTRUMENTED_POP_JUMP_IF_FALSE_r21 1043
-#define _INSTRUMENTED_POP_JUMP_IF_FALSE_r32 1044
-#define _INSTRUMENTED_POP_JUMP_IF_NONE_r10 1045
-#define _INSTRUMENTED_POP_JUMP_IF_NOT_NONE_r10 1046
-#define _INSTRUMENTED_POP_JUMP_IF_TRUE_r00 1047
-#define _INSTRUMENTED_POP_JUMP_IF_TRUE_r10 1048
-#define _INSTRUMENTED_POP_JUMP_IF_TRUE_r21 1049
-#define _INSTRUMENTED_POP_JUMP_IF_TRUE_r32 1050
-#define _IS_NONE_r11 1051
-#define _IS_OP_r03 1052
-#define _IS_OP_r13 1053
-#define _IS_OP_r23 1054
-#define _ITER_CHECK_LIST_r02 1055
-#define _ITER_CHECK_LIST_r12 1056
-#define _ITER_CHECK_LIST_r22 1057
-#define _ITER_CHECK_LIST_r33 1058
-#define _ITER_CHECK_RANGE_r02 1059
-#define _ITER_CHECK_RANGE_r12 1060
-#define _ITER_CHECK_RANGE_r22 1061
-#define _ITER_CHECK_RANGE_r33 1062
-#define _ITER_CHECK_TUPLE_r02 1063
-#define _ITER_CHECK_TUPLE_r12 1064
-#define _ITER_CHECK_TUPLE_r22 1065
-#define _ITER_CHECK_TUPLE_r33 1066
-#define _ITER_JUMP_LIST_r02 1067
-#define _ITER_JUMP_LIST_r12 1068
-#define _ITER_JUMP_LIST_r22 1069
-#define _ITER_JUMP_LIST_r33 1070
-#define _ITER_JUMP_RANGE_r02 1071
-#define _ITER_JUMP_RANGE_r12 1072
-#define _ITER_JUMP_RANGE_r22 1073
-#define _ITER_JUMP_RANGE_r33 1074
-#define _ITER_JUMP_TUPLE_r02 1075
-#define _ITER_JUMP_TUPLE_r12 1076
-#define _ITER_JUMP_TUPLE_r22 1077
-#define _ITER_JUMP_TUPLE_r33 1078
-#define _ITER_NEXT_LIST_r23 1079
-#define _ITER_NEXT_LIST_TIER_TWO_r23 1080
-#define _ITER_NEXT_RANGE_r03 1081
-#define _ITER_NEXT_RANGE_r13 1082
-#define _ITER_NEXT_RANGE_r23 1083
-#define _ITER_NEXT_TUPLE_r03 1084
-#define _ITER_NEXT_TUPLE_r13 1085
-#define _ITER_NEXT_TUPLE_r23 1086
-#define _JUMP_BACKWARD_NO_INTERRUPT_r00 1087
-#define _JUMP_BACKWARD_NO_INTERRUPT_r11 1088
-#define _JUMP_BACKWARD_NO_INTERRUPT_r22 1089
-#define _JUMP_BACKWARD_NO_INTERRUPT_r33 1090
-#define _JUMP_TO_TOP_r00 1091
-#define _LIST_APPEND_r10 1092
-#define _LIST_EXTEND_r10 1093
-#define _LOAD_ATTR_r10 1094
-#define _LOAD_ATTR_CLASS_r11 1095
-#define _LOAD_ATTR_GETATTRIBUTE_OVERRIDDEN_r11 1096
-#define _LOAD_ATTR_INSTANCE_VALUE_r02 1097
-#define _LOAD_ATTR_INSTANCE_VALUE_r12 1098
-#define _LOAD_ATTR_INSTANCE_VALUE_r23 1099
-#define _LOAD_ATTR_METHOD_LAZY_DICT_r02 1100
-#define _LOAD_ATTR_METHOD_LAZY_DICT_r12 1101
-#define _LOAD_ATTR_METHOD_LAZY_DICT_r23 1102
-#define _LOAD_ATTR_METHOD_NO_DICT_r02 1103
-#define _LOAD_ATTR_METHOD_NO_DICT_r12 1104
-#define _LOAD_ATTR_METHOD_NO_DICT_r23 1105
-#define _LOAD_ATTR_METHOD_WITH_VALUES_r02 1106
-#define _LOAD_ATTR_METHOD_WITH_VALUES_r12 1107
-#define _LOAD_ATTR_METHOD_WITH_VALUES_r23 1108
-#define _LOAD_ATTR_MODULE_r12 1109
-#define _LOAD_ATTR_NONDESCRIPTOR_NO_DICT_r11 1110
-#define _LOAD_ATTR_NONDESCRIPTOR_WITH_VALUES_r11 1111
-#define _LOAD_ATTR_PROPERTY_FRAME_r11 1112
-#define _LOAD_ATTR_SLOT_r02 1113
-#define _LOAD_ATTR_SLOT_r12 1114
-#define _LOAD_ATTR_SLOT_r23 1115
-#define _LOAD_ATTR_WITH_HINT_r12 1116
-#define _LOAD_BUILD_CLASS_r01 1117
-#define _LOAD_BYTECODE_r00 1118
-#define _LOAD_COMMON_CONSTANT_r01 1119
-#define _LOAD_COMMON_CONSTANT_r12 1120
-#define _LOAD_COMMON_CONSTANT_r23 1121
-#define _LOAD_CONST_r01 1122
-#define _LOAD_CONST_r12 1123
-#define _LOAD_CONST_r23 1124
-#define _LOAD_CONST_INLINE_r01 1125
-#define _LOAD_CONST_INLINE_r12 1126
-#define _LOAD_CONST_INLINE_r23 1127
-#define _LOAD_CONST_INLINE_BORROW_r01 1128
-#define _LOAD_CONST_INLINE_BORROW_r12 1129
-#define _LOAD_CONST_INLINE_BORROW_r23 1130
-#define _LOAD_CONST_UNDER_INLINE_r02 1131
-#define _LOAD_CONST_UNDER_INLINE_r12 1132
-#define _LOAD_CONST_UNDER_INLINE_r23 1133
-#define _LOAD_CONST_UNDER_INLINE_BORROW_r02 1134
-#define _LOAD_CONST_UNDER_INLINE_BORROW_r12 1135
-#define _LOAD_CONST_UNDER_INLINE_BORROW_r23 1136
-#define _LOAD_DEREF_r01 1137
-#define _LOAD_FAST_r01 1138
-#define _LOAD_FAST_r12 1139
-#define _LOAD_FAST_r23 1140
-#define _LOAD_FAST_0_r01 1141
-#define _LOAD_FAST_0_r12 1142
-#define _LOAD_FAST_0_r23 1143
-#define _LOAD_FAST_1_r01 1144
-#define _LOAD_FAST_1_r12 1145
-#define _LOAD_FAST_1_r23 1146
-#define _LOAD_FAST_2_r01 1147
-#define _LOAD_FAST_2_r12 1148
-#define _LOAD_FAST_2_r23 1149
-#define _LOAD_FAST_3_r01 1150
-#define _LOAD_FAST_3_r12 1151
-#define _LOAD_FAST_3_r23 1152
-#define _LOAD_FAST_4_r01 1153
-#define _LOAD_FAST_4_r12 1154
-#define _LOAD_FAST_4_r23 1155
-#define _LOAD_FAST_5_r01 1156
-#define _LOAD_FAST_5_r12 1157
-#define _LOAD_FAST_5_r23 1158
-#define _LOAD_FAST_6_r01 1159
-#define _LOAD_FAST_6_r12 1160
-#define _LOAD_FAST_6_r23 1161
-#define _LOAD_FAST_7_r01 1162
-#define _LOAD_FAST_7_r12 1163
-#define _LOAD_FAST_7_r23 1164
-#define _LOAD_FAST_AND_CLEAR_r01 1165
-#define _LOAD_FAST_AND_CLEAR_r12 1166
-#define _LOAD_FAST_AND_CLEAR_r23 1167
-#define _LOAD_FAST_BORROW_r01 1168
-#define _LOAD_FAST_BORROW_r12 1169
-#define _LOAD_FAST_BORROW_r23 1170
-#define _LOAD_FAST_BORROW_0_r01 1171
-#define _LOAD_FAST_BORROW_0_r12 1172
-#define _LOAD_FAST_BORROW_0_r23 1173
-#define _LOAD_FAST_BORROW_1_r01 1174
-#define _LOAD_FAST_BORROW_1_r12 1175
-#define _LOAD_FAST_BORROW_1_r23 1176
-#define _LOAD_FAST_BORROW_2_r01 1177
-#define _LOAD_FAST_BORROW_2_r12 1178
-#define _LOAD_FAST_BORROW_2_r23 1179
-#define _LOAD_FAST_BORROW_3_r01 1180
-#define _LOAD_FAST_BORROW_3_r12 1181
-#define _LOAD_FAST_BORROW_3_r23 1182
-#define _LOAD_FAST_BORROW_4_r01 1183
-#define _LOAD_FAST_BORROW_4_r12 1184
-#define _LOAD_FAST_BORROW_4_r23 1185
-#define _LOAD_FAST_BORROW_5_r01 1186
-#define _LOAD_FAST_BORROW_5_r12 1187
-#define _LOAD_FAST_BORROW_5_r23 1188
-#define _LOAD_FAST_BORROW_6_r01 1189
-#define _LOAD_FAST_BORROW_6_r12 1190
-#define _LOAD_FAST_BORROW_6_r23 1191
-#define _LOAD_FAST_BORROW_7_r01 1192
-#define _LOAD_FAST_BORROW_7_r12 1193
-#define _LOAD_FAST_BORROW_7_r23 1194
-#define _LOAD_FAST_BORROW_LOAD_FAST_BORROW_r02 1195
-#define _LOAD_FAST_BORROW_LOAD_FAST_BORROW_r13 1196
-#define _LOAD_FAST_CHECK_r01 1197
-#define _LOAD_FAST_CHECK_r12 1198
-#define _LOAD_FAST_CHECK_r23 1199
-#define _LOAD_FAST_LOAD_FAST_r02 1200
-#define _LOAD_FAST_LOAD_FAST_r13 1201
-#define _LOAD_FROM_DICT_OR_DEREF_r11 1202
-#define _LOAD_FROM_DICT_OR_GLOBALS_r11 1203
-#define _LOAD_GLOBAL_r00 1204
-#define _LOAD_GLOBAL_BUILTINS_r01 1205
-#define _LOAD_GLOBAL_MODULE_r01 1206
-#define _LOAD_LOCALS_r01 1207
-#define _LOAD_LOCALS_r12 1208
-#define _LOAD_LOCALS_r23 1209
-#define _LOAD_NAME_r01 1210
-#define _LOAD_SMALL_INT_r01 1211
-#define _LOAD_SMALL_INT_r12 1212
-#define _LOAD_SMALL_INT_r23 1213
-#define _LOAD_SMALL_INT_0_r01 1214
-#define _LOAD_SMALL_INT_0_r12 1215
-#define _LOAD_SMALL_INT_0_r23 1216
-#define _LOAD_SMALL_INT_1_r01 1217
-#define _LOAD_SMALL_INT_1_r12 1218
-#define _LOAD_SMALL_INT_1_r23 1219
-#define _LOAD_SMALL_INT_2_r01 1220
-#define _LOAD_SMALL_INT_2_r12 1221
-#define _LOAD_SMALL_INT_2_r23 1222
-#define _LOAD_SMALL_INT_3_r01 1223
-#define _LOAD_SMALL_INT_3_r12 1224
-#define _LOAD_SMALL_INT_3_r23 1225
-#define _LOAD_SPECIAL_r00 1226
-#define _LOAD_SUPER_ATTR_ATTR_r31 1227
-#define _LOAD_SUPER_ATTR_METHOD_r32 1228
-#define _MAKE_CALLARGS_A_TUPLE_r33 1229
-#define _MAKE_CELL_r00 1230
-#define _MAKE_FUNCTION_r11 1231
-#define _MAKE_WARM_r00 1232
-#define _MAKE_WARM_r11 1233
-#define _MAKE_WARM_r22 1234
-#define _MAKE_WARM_r33 1235
-#define _MAP_ADD_r20 1236
-#define _MATCH_CLASS_r31 1237
-#define _MATCH_KEYS_r23 1238
-#define _MATCH_MAPPING_r02 1239
-#define _MATCH_MAPPING_r12 1240
-#define _MATCH_MAPPING_r23 1241
-#define _MATCH_SEQUENCE_r02 1242
-#define _MATCH_SEQUENCE_r12 1243
-#define _MATCH_SEQUENCE_r23 1244
-#define _MAYBE_EXPAND_METHOD_r00 1245
-#define _MAYBE_EXPAND_METHOD_KW_r11 1246
-#define _MONITOR_CALL_r00 1247
-#define _MONITOR_CALL_KW_r11 1248
-#define _MONITOR_JUMP_BACKWARD_r00 1249
-#define _MONITOR_JUMP_BACKWARD_r11 1250
-#define _MONITOR_JUMP_BACKWARD_r22 1251
-#define _MONITOR_JUMP_BACKWARD_r33 1252
-#define _MONITOR_RESUME_r00 1253
-#define _NOP_r00 1254
-#define _NOP_r11 1255
-#define _NOP_r22 1256
-#define _NOP_r33 1257
-#define _POP_CALL_r20 1258
-#define _POP_CALL_LOAD_CONST_INLINE_BORROW_r21 1259
-#define _POP_CALL_ONE_r30 1260
-#define _POP_CALL_ONE_LOAD_CONST_INLINE_BORROW_r31 1261
-#define _POP_CALL_TWO_r30 1262
-#define _POP_CALL_TWO_LOAD_CONST_INLINE_BORROW_r31 1263
-#define _POP_EXCEPT_r10 1264
-#define _POP_ITER_r20 1265
-#define _POP_JUMP_IF_FALSE_r00 1266
-#define _POP_JUMP_IF_FALSE_r10 1267
-#define _POP_JUMP_IF_FALSE_r21 1268
-#define _POP_JUMP_IF_FALSE_r32 1269
-#define _POP_JUMP_IF_TRUE_r00 1270
-#define _POP_JUMP_IF_TRUE_r10 1271
-#define _POP_JUMP_IF_TRUE_r21 1272
-#define _POP_JUMP_IF_TRUE_r32 1273
-#define _POP_TOP_r10 1274
-#define _POP_TOP_FLOAT_r00 1275
-#define _POP_TOP_FLOAT_r10 1276
-#define _POP_TOP_FLOAT_r21 1277
-#define _POP_TOP_FLOAT_r32 1278
-#define _POP_TOP_INT_r00 1279
-#define _POP_TOP_INT_r10 1280
-#define _POP_TOP_INT_r21 1281
-#define _POP_TOP_INT_r32 1282
-#define _POP_TOP_LOAD_CONST_INLINE_r11 1283
-#define _POP_TOP_LOAD_CONST_INLINE_BORROW_r11 1284
-#define _POP_TOP_NOP_r00 1285
-#define _POP_TOP_NOP_r10 1286
-#define _POP_TOP_NOP_r21 1287
-#define _POP_TOP_NOP_r32 1288
-#define _POP_TOP_UNICODE_r00 1289
-#define _POP_TOP_UNICODE_r10 1290
-#define _POP_TOP_UNICODE_r21 1291
-#define _POP_TOP_UNICODE_r32 1292
-#define _POP_TWO_r20 1293
-#define _POP_TWO_LOAD_CONST_INLINE_BORROW_r21 1294
-#define _PUSH_EXC_INFO_r02 1295
-#define _PUSH_EXC_INFO_r12 1296
-#define _PUSH_EXC_INFO_r23 1297
-#define _PUSH_FRAME_r10 1298
-#define _PUSH_NULL_r01 1299
-#define _PUSH_NULL_r12 1300
-#define _PUSH_NULL_r23 1301
-#define _PUSH_NULL_CONDITIONAL_r00 1302
-#define _PY_FRAME_EX_r31 1303
-#define _PY_FRAME_GENERAL_r01 1304
-#define _PY_FRAME_KW_r11 1305
-#define _QUICKEN_RESUME_r00 1306
-#define _QUICKEN_RESUME_r11 1307
-#define _QUICKEN_RESUME_r22 1308
-#define _QUICKEN_RESUME_r33 1309
-#define _REPLACE_WITH_TRUE_r02 1310
-#define _REPLACE_WITH_TRUE_r12 1311
-#define _REPLACE_WITH_TRUE_r23 1312
-#define _RESUME_CHECK_r00 1313
-#define _RESUME_CHECK_r11 1314
-#define _RESUME_CHECK_r22 1315
-#define _RESUME_CHECK_r33 1316
-#define _RETURN_GENERATOR_r01 1317
-#define _RETURN_VALUE_r11 1318
-#define _SAVE_RETURN_OFFSET_r00 1319
-#define _SAVE_RETURN_OFFSET_r11 1320
-#define _SAVE_RETURN_OFFSET_r22 1321
-#define _SAVE_RETURN_OFFSET_r33 1322
-#define _SEND_r22 1323
-#define _SEND_GEN_FRAME_r22 1324
-#define _SETUP_ANNOTATIONS_r00 1325
-#define _SET_ADD_r10 1326
-#define _SET_FUNCTION_ATTRIBUTE_r01 1327
-#define _SET_FUNCTION_ATTRIBUTE_r11 1328
-#define _SET_FUNCTION_ATTRIBUTE_r21 1329
-#define _SET_FUNCTION_ATTRIBUTE_r32 1330
-#define _SET_IP_r00 1331
-#define _SET_IP_r11 1332
-#define _SET_IP_r22 1333
-#define _SET_IP_r33 1334
-#define _SET_UPDATE_r10 1335
-#define _SHUFFLE_2_LOAD_CONST_INLINE_BORROW_r02 1336
-#define _SHUFFLE_2_LOAD_CONST_INLINE_BORROW_r12 1337
-#define _SHUFFLE_2_LOAD_CONST_INLINE_BORROW_r22 1338
-#define _SHUFFLE_2_LOAD_CONST_INLINE_BORROW_r32 1339
-#define _SHUFFLE_3_LOAD_CONST_INLINE_BORROW_r03 1340
-#define _SHUFFLE_3_LOAD_CONST_INLINE_BORROW_r13 1341
-#define _SHUFFLE_3_LOAD_CONST_INLINE_BORROW_r23 1342
-#define _SHUFFLE_3_LOAD_CONST_INLINE_BORROW_r33 1343
-#define _SPILL_OR_RELOAD_r01 1344
-#define _SPILL_OR_RELOAD_r02 1345
-#define _SPILL_OR_RELOAD_r03 1346
-#define _SPILL_OR_RELOAD_r10 1347
-#define _SPILL_OR_RELOAD_r12 1348
-#define _SPILL_OR_RELOAD_r13 1349
-#define _SPILL_OR_RELOAD_r20 1350
-#define _SPILL_OR_RELOAD_r21 1351
-#define _SPILL_OR_RELOAD_r23 1352
-#define _SPILL_OR_RELOAD_r30 1353
-#define _SPILL_OR_RELOAD_r31 1354
-#define _SPILL_OR_RELOAD_r32 1355
-#define _START_EXECUTOR_r00 1356
-#define _STORE_ATTR_r20 1357
-#define _STORE_ATTR_INSTANCE_VALUE_r21 1358
-#define _STORE_ATTR_SLOT_r21 1359
-#define _STORE_ATTR_WITH_HINT_r21 1360
-#define _STORE_DEREF_r10 1361
-#define _STORE_FAST_LOAD_FAST_r11 1362
-#define _STORE_FAST_STORE_FAST_r20 1363
-#define _STORE_GLOBAL_r10 1364
-#define _STORE_NAME_r10 1365
-#define _STORE_SLICE_r30 1366
-#define _STORE_SUBSCR_r30 1367
-#define _STORE_SUBSCR_DICT_r31 1368
-#define _STORE_SUBSCR_LIST_INT_r32 1369
-#define _SWAP_r11 1370
-#define _SWAP_2_r02 1371
-#define _SWAP_2_r12 1372
-#define _SWAP_2_r22 1373
-#define _SWAP_2_r33 1374
-#define _SWAP_3_r03 1375
-#define _SWAP_3_r13 1376
-#define _SWAP_3_r23 1377
-#define _SWAP_3_r33 1378
-#define _SWAP_FAST_r01 1379
-#define _SWAP_FAST_r11 1380
-#define _SWAP_FAST_r22 1381
-#define _SWAP_FAST_r33 1382
-#define _SWAP_FAST_0_r01 1383
-#define _SWAP_FAST_0_r11 1384
-#define _SWAP_FAST_0_r22 1385
-#define _SWAP_FAST_0_r33 1386
-#define _SWAP_FAST_1_r01 1387
-#define _SWAP_FAST_1_r11 1388
-#define _SWAP_FAST_1_r22 1389
-#define _SWAP_FAST_1_r33 1390
-#define _SWAP_FAST_2_r01 1391
-#define _SWAP_FAST_2_r11 1392
-#define _SWAP_FAST_2_r22 1393
-#define _SWAP_FAST_2_r33 1394
-#define _SWAP_FAST_3_r01 1395
-#define _SWAP_FAST_3_r11 1396
-#define _SWAP_FAST_3_r22 1397
-#define _SWAP_FAST_3_r33 1398
-#define _SWAP_FAST_4_r01 1399
-#define _SWAP_FAST_4_r11 1400
-#define _SWAP_FAST_4_r22 1401
-#define _SWAP_FAST_4_r33 1402
-#define _SWAP_FAST_5_r01 1403
-#define _SWAP_FAST_5_r11 1404
-#define _SWAP_FAST_5_r22 1405
-#define _SWAP_FAST_5_r33 1406
-#define _SWAP_FAST_6_r01 1407
-#define _SWAP_FAST_6_r11 1408
-#define _SWAP_FAST_6_r22 1409
-#define _SWAP_FAST_6_r33 1410
-#define _SWAP_FAST_7_r01 1411
-#define _SWAP_FAST_7_r11 1412
-#define _SWAP_FAST_7_r22 1413
-#define _SWAP_FAST_7_r33 1414
-#define _TIER2_RESUME_CHECK_r00 1415
-#define _TIER2_RESUME_CHECK_r11 1416
-#define _TIER2_RESUME_CHECK_r22 1417
-#define _TIER2_RESUME_CHECK_r33 1418
-#define _TO_BOOL_r11 1419
-#define _TO_BOOL_BOOL_r01 1420
-#define _TO_BOOL_BOOL_r11 1421
-#define _TO_BOOL_BOOL_r22 1422
-#define _TO_BOOL_BOOL_r33 1423
-#define _TO_BOOL_INT_r02 1424
-#define _TO_BOOL_INT_r12 1425
-#define _TO_BOOL_INT_r23 1426
-#define _TO_BOOL_LIST_r02 1427
-#define _TO_BOOL_LIST_r12 1428
-#define _TO_BOOL_LIST_r23 1429
-#define _TO_BOOL_NONE_r01 1430
-#define _TO_BOOL_NONE_r11 1431
-#define _TO_BOOL_NONE_r22 1432
-#define _TO_BOOL_NONE_r33 1433
-#define _TO_BOOL_STR_r02 1434
-#define _TO_BOOL_STR_r12 1435
-#define _TO_BOOL_STR_r23 1436
-#define _TRACE_RECORD_r00 1437
-#define _UNARY_INVERT_r12 1438
-#define _UNARY_NEGATIVE_r12 1439
-#define _UNARY_NOT_r01 1440
-#define _UNARY_NOT_r11 1441
-#define _UNARY_NOT_r22 1442
-#define _UNARY_NOT_r33 1443
-#define _UNPACK_EX_r10 1444
-#define _UNPACK_SEQUENCE_r10 1445
-#define _UNPACK_SEQUENCE_LIST_r10 1446
-#define _UNPACK_SEQUENCE_TUPLE_r10 1447
-#define _UNPACK_SEQUENCE_TWO_TUPLE_r12 1448
-#define _WITH_EXCEPT_START_r33 1449
-#define _YIELD_VALUE_r11 1450
-#define MAX_UOP_REGS_ID 1450
+#define MAX_UOP_ID 592
+#define _BINARY_OP_r23 593
+#define _BINARY_OP_r33 594
+#define _BINARY_OP_ADD_FLOAT_r03 595
+#define _BINARY_OP_ADD_FLOAT_r13 596
+#define _BINARY_OP_ADD_FLOAT_r23 597
+#define _BINARY_OP_ADD_FLOAT_INPLACE_r23 598
+#define _BINARY_OP_ADD_INT_r03 599
+#define _BINARY_OP_ADD_INT_r13 600
+#define _BINARY_OP_ADD_INT_r23 601
+#define _BINARY_OP_ADD_UNICODE_r03 602
+#define _BINARY_OP_ADD_UNICODE_r13 603
+#define _BINARY_OP_ADD_UNICODE_r23 604
+#define _BINARY_OP_EXTEND_r23 605
+#define _BINARY_OP_EXTEND_r33 606
+#define _BINARY_OP_INPLACE_ADD_UNICODE_r21 607
+#define _BINARY_OP_INPLACE_ADD_UNICODE_DEREF_r21 608
+#define _BINARY_OP_MULTIPLY_FLOAT_r03 609
+#define _BINARY_OP_MULTIPLY_FLOAT_r13 610
+#define _BINARY_OP_MULTIPLY_FLOAT_r23 611
+#define _BINARY_OP_MULTIPLY_FLOAT_INPLACE_r23 612
+#define _BINARY_OP_MULTIPLY_INT_r03 613
+#define _BINARY_OP_MULTIPLY_INT_r13 614
+#define _BINARY_OP_MULTIPLY_INT_r23 615
+#define _BINARY_OP_SUBSCR_CHECK_FUNC_r23 616
+#define _BINARY_OP_SUBSCR_DICT_r23 617
+#define _BINARY_OP_SUBSCR_DICT_r33 618
+#define _BINARY_OP_SUBSCR_INIT_CALL_r01 619
+#define _BINARY_OP_SUBSCR_INIT_CALL_r11 620
+#define _BINARY_OP_SUBSCR_INIT_CALL_r21 621
+#define _BINARY_OP_SUBSCR_INIT_CALL_r31 622
+#define _BINARY_OP_SUBSCR_LIST_INT_r23 623
+#define _BINARY_OP_SUBSCR_LIST_SLICE_r23 624
+#define _BINARY_OP_SUBSCR_LIST_SLICE_r33 625
+#define _BINARY_OP_SUBSCR_STR_INT_r23 626
+#define _BINARY_OP_SUBSCR_TUPLE_INT_r03 627
+#define _BINARY_OP_SUBSCR_TUPLE_INT_r13 628
+#define _BINARY_OP_SUBSCR_TUPLE_INT_r23 629
+#define _BINARY_OP_SUBSCR_USTR_INT_r23 630
+#define _BINARY_OP_SUBTRACT_FLOAT_r03 631
+#define _BINARY_OP_SUBTRACT_FLOAT_r13 632
+#define _BINARY_OP_SUBTRACT_FLOAT_r23 633
+#define _BINARY_OP_SUBTRACT_FLOAT_INPLACE_r23 634
+#define _BINARY_OP_SUBTRACT_INT_r03 635
+#define _BINARY_OP_SUBTRACT_INT_r13 636
+#define _BINARY_OP_SUBTRACT_INT_r23 637
+#define _BINARY_SLICE_r31 638
+#define _BUILD_INTERPOLATION_r01 639
+#define _BUILD_LIST_r01 640
+#define _BUILD_MAP_r01 641
+#define _BUILD_SET_r01 642
+#define _BUILD_SLICE_r01 643
+#define _BUILD_STRING_r01 644
+#define _BUILD_TEMPLATE_r21 645
+#define _BUILD_TEMPLATE_r31 646
+#define _BUILD_TUPLE_r01 647
+#define _CALL_BUILTIN_CLASS_r01 648
+#define _CALL_BUILTIN_FAST_r01 649
+#define _CALL_BUILTIN_FAST_WITH_KEYWORDS_r01 650
+#define _CALL_BUILTIN_O_r03 651
+#define _CALL_FUNCTION_EX_NON_PY_GENERAL_r31 652
+#define _CALL_INTRINSIC_1_r11 653
+#define _CALL_INTRINSIC_1_r21 654
+#define _CALL_INTRINSIC_1_r31 655
+#define _CALL_INTRINSIC_2_r21 656
+#define _CALL_INTRINSIC_2_r31 657
+#define _CALL_ISINSTANCE_r31 658
+#define _CALL_KW_NON_PY_r11 659
+#define _CALL_LEN_r33 660
+#define _CALL_LIST_APPEND_r03 661
+#define _CALL_LIST_APPEND_r13 662
+#define _CALL_LIST_APPEND_r23 663
+#define _CALL_LIST_APPEND_r33 664
+#define _CALL_METHOD_DESCRIPTOR_FAST_r01 665
+#define _CALL_METHOD_DESCRIPTOR_FAST_WITH_KEYWORDS_r01 666
+#define _CALL_METHOD_DESCRIPTOR_NOARGS_r01 667
+#define _CALL_METHOD_DESCRIPTOR_O_r03 668
+#define _CALL_NON_PY_GENERAL_r01 669
+#define _CALL_STR_1_r32 670
+#define _CALL_TUPLE_1_r32 671
+#define _CALL_TYPE_1_r02 672
+#define _CALL_TYPE_1_r12 673
+#define _CALL_TYPE_1_r22 674
+#define _CALL_TYPE_1_r32 675
+#define _CHECK_AND_ALLOCATE_OBJECT_r00 676
+#define _CHECK_ATTR_CLASS_r01 677
+#define _CHECK_ATTR_CLASS_r11 678
+#define _CHECK_ATTR_CLASS_r22 679
+#define _CHECK_ATTR_CLASS_r33 680
+#define _CHECK_ATTR_METHOD_LAZY_DICT_r01 681
+#define _CHECK_ATTR_METHOD_LAZY_DICT_r11 682
+#define _CHECK_ATTR_METHOD_LAZY_DICT_r22 683
+#define _CHECK_ATTR_METHOD_LAZY_DICT_r33 684
+#define _CHECK_CALL_BOUND_METHOD_EXACT_ARGS_r00 685
+#define _CHECK_EG_MATCH_r22 686
+#define _CHECK_EXC_MATCH_r22 687
+#define _CHECK_EXC_MATCH_r32 688
+#define _CHECK_FUNCTION_EXACT_ARGS_r00 689
+#define _CHECK_FUNCTION_VERSION_r00 690
+#define _CHECK_FUNCTION_VERSION_INLINE_r00 691
+#define _CHECK_FUNCTION_VERSION_INLINE_r11 692
+#define _CHECK_FUNCTION_VERSION_INLINE_r22 693
+#define _CHECK_FUNCTION_VERSION_INLINE_r33 694
+#define _CHECK_FUNCTION_VERSION_KW_r11 695
+#define _CHECK_IS_NOT_PY_CALLABLE_r00 696
+#define _CHECK_IS_NOT_PY_CALLABLE_EX_r03 697
+#define _CHECK_IS_NOT_PY_CALLABLE_EX_r13 698
+#define _CHECK_IS_NOT_PY_CALLABLE_EX_r23 699
+#define _CHECK_IS_NOT_PY_CALLABLE_EX_r33 700
+#define _CHECK_IS_NOT_PY_CALLABLE_KW_r11 701
+#define _CHECK_IS_PY_CALLABLE_EX_r03 702
+#define _CHECK_IS_PY_CALLABLE_EX_r13 703
+#define _CHECK_IS_PY_CALLABLE_EX_r23 704
+#define _CHECK_IS_PY_CALLABLE_EX_r33 705
+#define _CHECK_MANAGED_OBJECT_HAS_VALUES_r01 706
+#define _CHECK_MANAGED_OBJECT_HAS_VALUES_r11 707
+#define _CHECK_MANAGED_OBJECT_HAS_VALUES_r22 708
+#define _CHECK_MANAGED_OBJECT_HAS_VALUES_r33 709
+#define _CHECK_METHOD_VERSION_r00 710
+#define _CHECK_METHOD_VERSION_KW_r11 711
+#define _CHECK_PEP_523_r00 712
+#define _CHECK_PEP_523_r11 713
+#define _CHECK_PEP_523_r22 714
+#define _CHECK_PEP_523_r33 715
+#define _CHECK_PERIODIC_r00 716
+#define _CHECK_PERIODIC_r10 717
+#define _CHECK_PERIODIC_r20 718
+#define _CHECK_PERIODIC_r30 719
+#define _CHECK_PERIODIC_AT_END_r00 720
+#define _CHECK_PERIODIC_AT_END_r10 721
+#define _CHECK_PERIODIC_AT_END_r20 722
+#define _CHECK_PERIODIC_AT_END_r30 723
+#define _CHECK_PERIODIC_IF_NOT_YIELD_FROM_r00 724
+#define _CHECK_PERIODIC_IF_NOT_YIELD_FROM_r10 725
+#define _CHECK_PERIODIC_IF_NOT_YIELD_FROM_r20 726
+#define _CHECK_PERIODIC_IF_NOT_YIELD_FROM_r30 727
+#define _CHECK_RECURSION_REMAINING_r00 728
+#define _CHECK_RECURSION_REMAINING_r11 729
+#define _CHECK_RECURSION_REMAINING_r22 730
+#define _CHECK_RECURSION_REMAINING_r33 731
+#define _CHECK_STACK_SPACE_r00 732
+#define _CHECK_STACK_SPACE_OPERAND_r00 733
+#define _CHECK_STACK_SPACE_OPERAND_r11 734
+#define _CHECK_STACK_SPACE_OPERAND_r22 735
+#define _CHECK_STACK_SPACE_OPERAND_r33 736
+#define _CHECK_VALIDITY_r00 737
+#define _CHECK_VALIDITY_r11 738
+#define _CHECK_VALIDITY_r22 739
+#define _CHECK_VALIDITY_r33 740
+#define _COLD_DYNAMIC_EXIT_r00 741
+#define _COLD_EXIT_r00 742
+#define _COMPARE_OP_r21 743
+#define _COMPARE_OP_r31 744
+#define _COMPARE_OP_FLOAT_r03 745
+#define _COMPARE_OP_FLOAT_r13 746
+#define _COMPARE_OP_FLOAT_r23 747
+#define _COMPARE_OP_INT_r23 748
+#define _COMPARE_OP_STR_r23 749
+#define _CONTAINS_OP_r23 750
+#define _CONTAINS_OP_r33 751
+#define _CONTAINS_OP_DICT_r23 752
+#define _CONTAINS_OP_DICT_r33 753
+#define _CONTAINS_OP_SET_r23 754
+#define _CONTAINS_OP_SET_r33 755
+#define _CONVERT_VALUE_r11 756
+#define _CONVERT_VALUE_r21 757
+#define _CONVERT_VALUE_r31 758
+#define _COPY_r01 759
+#define _COPY_1_r02 760
+#define _COPY_1_r12 761
+#define _COPY_1_r23 762
+#define _COPY_2_r03 763
+#define _COPY_2_r13 764
+#define _COPY_2_r23 765
+#define _COPY_3_r03 766
+#define _COPY_3_r13 767
+#define _COPY_3_r23 768
+#define _COPY_3_r33 769
+#define _COPY_FREE_VARS_r00 770
+#define _COPY_FREE_VARS_r11 771
+#define _COPY_FREE_VARS_r22 772
+#define _COPY_FREE_VARS_r33 773
+#define _CREATE_INIT_FRAME_r01 774
+#define _DELETE_ATTR_r10 775
+#define _DELETE_ATTR_r20 776
+#define _DELETE_ATTR_r30 777
+#define _DELETE_DEREF_r00 778
+#define _DELETE_DEREF_r10 779
+#define _DELETE_DEREF_r20 780
+#define _DELETE_DEREF_r30 781
+#define _DELETE_FAST_r00 782
+#define _DELETE_FAST_r10 783
+#define _DELETE_FAST_r20 784
+#define _DELETE_FAST_r30 785
+#define _DELETE_GLOBAL_r00 786
+#define _DELETE_GLOBAL_r10 787
+#define _DELETE_GLOBAL_r20 788
+#define _DELETE_GLOBAL_r30 789
+#define _DELETE_NAME_r00 790
+#define _DELETE_NAME_r10 791
+#define _DELETE_NAME_r20 792
+#define _DELETE_NAME_r30 793
+#define _DELETE_SUBSCR_r20 794
+#define _DELETE_SUBSCR_r30 795
+#define _DEOPT_r00 796
+#define _DEOPT_r10 797
+#define _DEOPT_r20 798
+#define _DEOPT_r30 799
+#define _DICT_MERGE_r10 800
+#define _DICT_UPDATE_r10 801
+#define _DO_CALL_r01 802
+#define _DO_CALL_FUNCTION_EX_r31 803
+#define _DO_CALL_KW_r11 804
+#define _DYNAMIC_EXIT_r00 805
+#define _DYNAMIC_EXIT_r10 806
+#define _DYNAMIC_EXIT_r20 807
+#define _DYNAMIC_EXIT_r30 808
+#define _END_FOR_r10 809
+#define _END_FOR_r20 810
+#define _END_FOR_r30 811
+#define _END_SEND_r21 812
+#define _END_SEND_r31 813
+#define _ERROR_POP_N_r00 814
+#define _EXIT_INIT_CHECK_r10 815
+#define _EXIT_INIT_CHECK_r20 816
+#define _EXIT_INIT_CHECK_r30 817
+#define _EXIT_TRACE_r00 818
+#define _EXIT_TRACE_r10 819
+#define _EXIT_TRACE_r20 820
+#define _EXIT_TRACE_r30 821
+#define _EXPAND_METHOD_r00 822
+#define _EXPAND_METHOD_KW_r11 823
+#define _FATAL_ERROR_r00 824
+#define _FATAL_ERROR_r11 825
+#define _FATAL_ERROR_r22 826
+#define _FATAL_ERROR_r33 827
+#define _FORMAT_SIMPLE_r11 828
+#define _FORMAT_SIMPLE_r21 829
+#define _FORMAT_SIMPLE_r31 830
+#define _FORMAT_WITH_SPEC_r21 831
+#define _FORMAT_WITH_SPEC_r31 832
+#define _FOR_ITER_r23 833
+#define _FOR_ITER_r33 834
+#define _FOR_ITER_GEN_FRAME_r03 835
+#define _FOR_ITER_GEN_FRAME_r13 836
+#define _FOR_ITER_GEN_FRAME_r23 837
+#define _FOR_ITER_TIER_TWO_r23 838
+#define _FOR_ITER_TIER_TWO_r33 839
+#define _GET_AITER_r11 840
+#define _GET_ANEXT_r12 841
+#define _GET_ANEXT_r22 842
+#define _GET_ANEXT_r32 843
+#define _GET_AWAITABLE_r11 844
+#define _GET_AWAITABLE_r21 845
+#define _GET_AWAITABLE_r31 846
+#define _GET_ITER_r12 847
+#define _GET_ITER_r22 848
+#define _GET_ITER_r32 849
+#define _GET_LEN_r12 850
+#define _GET_LEN_r22 851
+#define _GET_LEN_r32 852
+#define _GET_YIELD_FROM_ITER_r11 853
+#define _GET_YIELD_FROM_ITER_r21 854
+#define _GET_YIELD_FROM_ITER_r31 855
+#define _GUARD_BINARY_OP_EXTEND_r22 856
+#define _GUARD_BINARY_OP_EXTEND_r32 857
+#define _GUARD_BINARY_OP_SUBSCR_TUPLE_INT_BOUNDS_r02 858
+#define _GUARD_BINARY_OP_SUBSCR_TUPLE_INT_BOUNDS_r12 859
+#define _GUARD_BINARY_OP_SUBSCR_TUPLE_INT_BOUNDS_r22 860
+#define _GUARD_BINARY_OP_SUBSCR_TUPLE_INT_BOUNDS_r33 861
+#define _GUARD_BIT_IS_SET_POP_r00 862
+#define _GUARD_BIT_IS_SET_POP_r10 863
+#define _GUARD_BIT_IS_SET_POP_r21 864
+#define _GUARD_BIT_IS_SET_POP_r32 865
+#define _GUARD_BIT_IS_SET_POP_4_r00 866
+#define _GUARD_BIT_IS_SET_POP_4_r10 867
+#define _GUARD_BIT_IS_SET_POP_4_r21 868
+#define _GUARD_BIT_IS_SET_POP_4_r32 869
+#define _GUARD_BIT_IS_SET_POP_5_r00 870
+#define _GUARD_BIT_IS_SET_POP_5_r10 871
+#define _GUARD_BIT_IS_SET_POP_5_r21 872
+#define _GUARD_BIT_IS_SET_POP_5_r32 873
+#define _GUARD_BIT_IS_SET_POP_6_r00 874
+#define _GUARD_BIT_IS_SET_POP_6_r10 875
+#define _GUARD_BIT_IS_SET_POP_6_r21 876
+#define _GUARD_BIT_IS_SET_POP_6_r32 877
+#define _GUARD_BIT_IS_SET_POP_7_r00 878
+#define _GUARD_BIT_IS_SET_POP_7_r10 879
+#define _GUARD_BIT_IS_SET_POP_7_r21 880
+#define _GUARD_BIT_IS_SET_POP_7_r32 881
+#define _GUARD_BIT_IS_UNSET_POP_r00 882
+#define _GUARD_BIT_IS_UNSET_POP_r10 883
+#define _GUARD_BIT_IS_UNSET_POP_r21 884
+#define _GUARD_BIT_IS_UNSET_POP_r32 885
+#define _GUARD_BIT_IS_UNSET_POP_4_r00 886
+#define _GUARD_BIT_IS_UNSET_POP_4_r10 887
+#define _GUARD_BIT_IS_UNSET_POP_4_r21 888
+#define _GUARD_BIT_IS_UNSET_POP_4_r32 889
+#define _GUARD_BIT_IS_UNSET_POP_5_r00 890
+#define _GUARD_BIT_IS_UNSET_POP_5_r10 891
+#define _GUARD_BIT_IS_UNSET_POP_5_r21 892
+#define _GUARD_BIT_IS_UNSET_POP_5_r32 893
+#define _GUARD_BIT_IS_UNSET_POP_6_r00 894
+#define _GUARD_BIT_IS_UNSET_POP_6_r10 895
+#define _GUARD_BIT_IS_UNSET_POP_6_r21 896
+#define _GUARD_BIT_IS_UNSET_POP_6_r32 897
+#define _GUARD_BIT_IS_UNSET_POP_7_r00 898
+#define _GUARD_BIT_IS_UNSET_POP_7_r10 899
+#define _GUARD_BIT_IS_UNSET_POP_7_r21 900
+#define _GUARD_BIT_IS_UNSET_POP_7_r32 901
+#define _GUARD_CALLABLE_ISINSTANCE_r03 902
+#define _GUARD_CALLABLE_ISINSTANCE_r13 903
+#define _GUARD_CALLABLE_ISINSTANCE_r23 904
+#define _GUARD_CALLABLE_ISINSTANCE_r33 905
+#define _GUARD_CALLABLE_LEN_r03 906
+#define _GUARD_CALLABLE_LEN_r13 907
+#define _GUARD_CALLABLE_LEN_r23 908
+#define _GUARD_CALLABLE_LEN_r33 909
+#define _GUARD_CALLABLE_LIST_APPEND_r03 910
+#define _GUARD_CALLABLE_LIST_APPEND_r13 911
+#define _GUARD_CALLABLE_LIST_APPEND_r23 912
+#define _GUARD_CALLABLE_LIST_APPEND_r33 913
+#define _GUARD_CALLABLE_STR_1_r03 914
+#define _GUARD_CALLABLE_STR_1_r13 915
+#define _GUARD_CALLABLE_STR_1_r23 916
+#define _GUARD_CALLABLE_STR_1_r33 917
+#define _GUARD_CALLABLE_TUPLE_1_r03 918
+#define _GUARD_CALLABLE_TUPLE_1_r13 919
+#define _GUARD_CALLABLE_TUPLE_1_r23 920
+#define _GUARD_CALLABLE_TUPLE_1_r33 921
+#define _GUARD_CALLABLE_TYPE_1_r03 922
+#define _GUARD_CALLABLE_TYPE_1_r13 923
+#define _GUARD_CALLABLE_TYPE_1_r23 924
+#define _GUARD_CALLABLE_TYPE_1_r33 925
+#define _GUARD_CODE_VERSION_r00 926
+#define _GUARD_CODE_VERSION_r11 927
+#define _GUARD_CODE_VERSION_r22 928
+#define _GUARD_CODE_VERSION_r33 929
+#define _GUARD_DORV_NO_DICT_r01 930
+#define _GUARD_DORV_NO_DICT_r11 931
+#define _GUARD_DORV_NO_DICT_r22 932
+#define _GUARD_DORV_NO_DICT_r33 933
+#define _GUARD_DORV_VALUES_INST_ATTR_FROM_DICT_r01 934
+#define _GUARD_DORV_VALUES_INST_ATTR_FROM_DICT_r11 935
+#define _GUARD_DORV_VALUES_INST_ATTR_FROM_DICT_r22 936
+#define _GUARD_DORV_VALUES_INST_ATTR_FROM_DICT_r33 937
+#define _GUARD_GLOBALS_VERSION_r00 938
+#define _GUARD_GLOBALS_VERSION_r11 939
+#define _GUARD_GLOBALS_VERSION_r22 940
+#define _GUARD_GLOBALS_VERSION_r33 941
+#define _GUARD_IP_RETURN_GENERATOR_r00 942
+#define _GUARD_IP_RETURN_GENERATOR_r11 943
+#define _GUARD_IP_RETURN_GENERATOR_r22 944
+#define _GUARD_IP_RETURN_GENERATOR_r33 945
+#define _GUARD_IP_RETURN_VALUE_r00 946
+#define _GUARD_IP_RETURN_VALUE_r11 947
+#define _GUARD_IP_RETURN_VALUE_r22 948
+#define _GUARD_IP_RETURN_VALUE_r33 949
+#define _GUARD_IP_YIELD_VALUE_r00 950
+#define _GUARD_IP_YIELD_VALUE_r11 951
+#define _GUARD_IP_YIELD_VALUE_r22 952
+#define _GUARD_IP_YIELD_VALUE_r33 953
+#define _GUARD_IP__PUSH_FRAME_r00 954
+#define _GUARD_IP__PUSH_FRAME_r11 955
+#define _GUARD_IP__PUSH_FRAME_r22 956
+#define _GUARD_IP__PUSH_FRAME_r33 957
+#define _GUARD_IS_FALSE_POP_r00 958
+#define _GUARD_IS_FALSE_POP_r10 959
+#define _GUARD_IS_FALSE_POP_r21 960
+#define _GUARD_IS_FALSE_POP_r32 961
+#define _GUARD_IS_NONE_POP_r00 962
+#define _GUARD_IS_NONE_POP_r10 963
+#define _GUARD_IS_NONE_POP_r21 964
+#define _GUARD_IS_NONE_POP_r32 965
+#define _GUARD_IS_NOT_NONE_POP_r10 966
+#define _GUARD_IS_NOT_NONE_POP_r20 967
+#define _GUARD_IS_NOT_NONE_POP_r30 968
+#define _GUARD_IS_TRUE_POP_r00 969
+#define _GUARD_IS_TRUE_POP_r10 970
+#define _GUARD_IS_TRUE_POP_r21 971
+#define _GUARD_IS_TRUE_POP_r32 972
+#define _GUARD_KEYS_VERSION_r01 973
+#define _GUARD_KEYS_VERSION_r11 974
+#define _GUARD_KEYS_VERSION_r22 975
+#define _GUARD_KEYS_VERSION_r33 976
+#define _GUARD_NOS_COMPACT_ASCII_r02 977
+#define _GUARD_NOS_COMPACT_ASCII_r12 978
+#define _GUARD_NOS_COMPACT_ASCII_r22 979
+#define _GUARD_NOS_COMPACT_ASCII_r33 980
+#define _GUARD_NOS_DICT_r02 981
+#define _GUARD_NOS_DICT_r12 982
+#define _GUARD_NOS_DICT_r22 983
+#define _GUARD_NOS_DICT_r33 984
+#define _GUARD_NOS_FLOAT_r02 985
+#define _GUARD_NOS_FLOAT_r12 986
+#define _GUARD_NOS_FLOAT_r22 987
+#define _GUARD_NOS_FLOAT_r33 988
+#define _GUARD_NOS_INT_r02 989
+#define _GUARD_NOS_INT_r12 990
+#define _GUARD_NOS_INT_r22 991
+#define _GUARD_NOS_INT_r33 992
+#define _GUARD_NOS_LIST_r02 993
+#define _GUARD_NOS_LIST_r12 994
+#define _GUARD_NOS_LIST_r22 995
+#define _GUARD_NOS_LIST_r33 996
+#define _GUARD_NOS_NOT_NULL_r02 997
+#define _GUARD_NOS_NOT_NULL_r12 998
+#define _GUARD_NOS_NOT_NULL_r22 999
+#define _GUARD_NOS_NOT_NULL_r33 1000
+#define _GUARD_NOS_NULL_r02 1001
+#define _GUARD_NOS_NULL_r12 1002
+#define _GUARD_NOS_NULL_r22 1003
+#define _GUARD_NOS_NULL_r33 1004
+#define _GUARD_NOS_OVERFLOWED_r02 1005
+#define _GUARD_NOS_OVERFLOWED_r12 1006
+#define _GUARD_NOS_OVERFLOWED_r22 1007
+#define _GUARD_NOS_OVERFLOWED_r33 1008
+#define _GUARD_NOS_TUPLE_r02 1009
+#define _GUARD_NOS_TUPLE_r12 1010
+#define _GUARD_NOS_TUPLE_r22 1011
+#define _GUARD_NOS_TUPLE_r33 1012
+#define _GUARD_NOS_UNICODE_r02 1013
+#define _GUARD_NOS_UNICODE_r12 1014
+#define _GUARD_NOS_UNICODE_r22 1015
+#define _GUARD_NOS_UNICODE_r33 1016
+#define _GUARD_NOT_EXHAUSTED_LIST_r02 1017
+#define _GUARD_NOT_EXHAUSTED_LIST_r12 1018
+#define _GUARD_NOT_EXHAUSTED_LIST_r22 1019
+#define _GUARD_NOT_EXHAUSTED_LIST_r33 1020
+#define _GUARD_NOT_EXHAUSTED_RANGE_r02 1021
+#define _GUARD_NOT_EXHAUSTED_RANGE_r12 1022
+#define _GUARD_NOT_EXHAUSTED_RANGE_r22 1023
+#define _GUARD_NOT_EXHAUSTED_RANGE_r33 1024
+#define _GUARD_NOT_EXHAUSTED_TUPLE_r02 1025
+#define _GUARD_NOT_EXHAUSTED_TUPLE_r12 1026
+#define _GUARD_NOT_EXHAUSTED_TUPLE_r22 1027
+#define _GUARD_NOT_EXHAUSTED_TUPLE_r33 1028
+#define _GUARD_THIRD_NULL_r03 1029
+#define _GUARD_THIRD_NULL_r13 1030
+#define _GUARD_THIRD_NULL_r23 1031
+#define _GUARD_THIRD_NULL_r33 1032
+#define _GUARD_TOS_ANY_SET_r01 1033
+#define _GUARD_TOS_ANY_SET_r11 1034
+#define _GUARD_TOS_ANY_SET_r22 1035
+#define _GUARD_TOS_ANY_SET_r33 1036
+#define _GUARD_TOS_DICT_r01 1037
+#define _GUARD_TOS_DICT_r11 1038
+#define _GUARD_TOS_DICT_r22 1039
+#define _GUARD_TOS_DICT_r33 1040
+#define _GUARD_TOS_FLOAT_r01 1041
+#define _GUARD_TOS_FLOAT_r11 1042
+#define _GUARD_TOS_FLOAT_r22 1043
+#define _GUARD_TOS_FLOAT_r33 1044
+#define _GUARD_TOS_INT_r01 1045
+#define _GUARD_TOS_INT_r11 1046
+#define _GUARD_TOS_INT_r22 1047
+#define _GUARD_TOS_INT_r33 1048
+#define _GUARD_TOS_LIST_r01 1049
+#define _GUARD_TOS_LIST_r11 1050
+#define _GUARD_TOS_LIST_r22 1051
+#define _GUARD_TOS_LIST_r33 1052
+#define _GUARD_TOS_OVERFLOWED_r01 1053
+#define _GUARD_TOS_OVERFLOWED_r11 1054
+#define _GUARD_TOS_OVERFLOWED_r22 1055
+#define _GUARD_TOS_OVERFLOWED_r33 1056
+#define _GUARD_TOS_SLICE_r01 1057
+#define _GUARD_TOS_SLICE_r11 1058
+#define _GUARD_TOS_SLICE_r22 1059
+#define _GUARD_TOS_SLICE_r33 1060
+#define _GUARD_TOS_TUPLE_r01 1061
+#define _GUARD_TOS_TUPLE_r11 1062
+#define _GUARD_TOS_TUPLE_r22 1063
+#define _GUARD_TOS_TUPLE_r33 1064
+#define _GUARD_TOS_UNICODE_r01 1065
+#define _GUARD_TOS_UNICODE_r11 1066
+#define _GUARD_TOS_UNICODE_r22 1067
+#define _GUARD_TOS_UNICODE_r33 1068
+#define _GUARD_TYPE_VERSION_r01 1069
+#define _GUARD_TYPE_VERSION_r11 1070
+#define _GUARD_TYPE_VERSION_r22 1071
+#define _GUARD_TYPE_VERSION_r33 1072
+#define _GUARD_TYPE_VERSION_AND_LOCK_r01 1073
+#define _GUARD_TYPE_VERSION_AND_LOCK_r11 1074
+#define _GUARD_TYPE_VERSION_AND_LOCK_r22 1075
+#define _GUARD_TYPE_VERSION_AND_LOCK_r33 1076
+#define _HANDLE_PENDING_AND_DEOPT_r00 1077
+#define _HANDLE_PENDING_AND_DEOPT_r10 1078
+#define _HANDLE_PENDING_AND_DEOPT_r20 1079
+#define _HANDLE_PENDING_AND_DEOPT_r30 1080
+#define _IMPORT_FROM_r12 1081
+#define _IMPORT_FROM_r22 1082
+#define _IMPORT_FROM_r32 1083
+#define _IMPORT_NAME_r21 1084
+#define _IMPORT_NAME_r31 1085
+#define _INIT_CALL_BOUND_METHOD_EXACT_ARGS_r00 1086
+#define _INIT_CALL_PY_EXACT_ARGS_r01 1087
+#define _INIT_CALL_PY_EXACT_ARGS_0_r01 1088
+#define _INIT_CALL_PY_EXACT_ARGS_1_r01 1089
+#define _INIT_CALL_PY_EXACT_ARGS_2_r01 1090
+#define _INIT_CALL_PY_EXACT_ARGS_3_r01 1091
+#define _INIT_CALL_PY_EXACT_ARGS_4_r01 1092
+#define _INSERT_1_LOAD_CONST_INLINE_r02 1093
+#define _INSERT_1_LOAD_CONST_INLINE_r12 1094
+#define _INSERT_1_LOAD_CONST_INLINE_r23 1095
+#define _INSERT_1_LOAD_CONST_INLINE_BORROW_r02 1096
+#define _INSERT_1_LOAD_CONST_INLINE_BORROW_r12 1097
+#define _INSERT_1_LOAD_CONST_INLINE_BORROW_r23 1098
+#define _INSERT_2_LOAD_CONST_INLINE_BORROW_r03 1099
+#define _INSERT_2_LOAD_CONST_INLINE_BORROW_r13 1100
+#define _INSERT_2_LOAD_CONST_INLINE_BORROW_r23 1101
+#define _INSERT_NULL_r10 1102
+#define _INSTRUMENTED_FOR_ITER_r23 1103
+#define _INSTRUMENTED_FOR_ITER_r33 1104
+#define _INSTRUMENTED_INSTRUCTION_r00 1105
+#define _INSTRUMENTED_INSTRUCTION_r10 1106
+#define _INSTRUMENTED_INSTRUCTION_r20 1107
+#define _INSTRUMENTED_INSTRUCTION_r30 1108
+#define _INSTRUMENTED_JUMP_FORWARD_r00 1109
+#define _INSTRUMENTED_JUMP_FORWARD_r11 1110
+#define _INSTRUMENTED_JUMP_FORWARD_r22 1111
+#define _INSTRUMENTED_JUMP_FORWARD_r33 1112
+#define _INSTRUMENTED_LINE_r00 1113
+#define _INSTRUMENTED_NOT_TAKEN_r00 1114
+#define _INSTRUMENTED_NOT_TAKEN_r11 1115
+#define _INSTRUMENTED_NOT_TAKEN_r22 1116
+#define _INSTRUMENTED_NOT_TAKEN_r33 1117
+#define _INSTRUMENTED_POP_JUMP_IF_FALSE_r00 1118
+#define _INSTRUMENTED_POP_JUMP_IF_FALSE_r10 1119
+#define _INSTRUMENTED_POP_JUMP_IF_FALSE_r21 1120
+#define _INSTRUMENTED_POP_JUMP_IF_FALSE_r32 1121
+#define _INSTRUMENTED_POP_JUMP_IF_NONE_r10 1122
+#define _INSTRUMENTED_POP_JUMP_IF_NONE_r20 1123
+#define _INSTRUMENTED_POP_JUMP_IF_NONE_r30 1124
+#define _INSTRUMENTED_POP_JUMP_IF_NOT_NONE_r10 1125
+#define _INSTRUMENTED_POP_JUMP_IF_NOT_NONE_r20 1126
+#define _INSTRUMENTED_POP_JUMP_IF_NOT_NONE_r30 1127
+#define _INSTRUMENTED_POP_JUMP_IF_TRUE_r00 1128
+#define _INSTRUMENTED_POP_JUMP_IF_TRUE_r10 1129
+#define _INSTRUMENTED_POP_JUMP_IF_TRUE_r21 1130
+#define _INSTRUMENTED_POP_JUMP_IF_TRUE_r32 1131
+#define _IS_NONE_r11 1132
+#define _IS_NONE_r21 1133
+#define _IS_NONE_r31 1134
+#define _IS_OP_r03 1135
+#define _IS_OP_r13 1136
+#define _IS_OP_r23 1137
+#define _ITER_CHECK_LIST_r02 1138
+#define _ITER_CHECK_LIST_r12 1139
+#define _ITER_CHECK_LIST_r22 1140
+#define _ITER_CHECK_LIST_r33 1141
+#define _ITER_CHECK_RANGE_r02 1142
+#define _ITER_CHECK_RANGE_r12 1143
+#define _ITER_CHECK_RANGE_r22 1144
+#define _ITER_CHECK_RANGE_r33 1145
+#define _ITER_CHECK_TUPLE_r02 1146
+#define _ITER_CHECK_TUPLE_r12 1147
+#define _ITER_CHECK_TUPLE_r22 1148
+#define _ITER_CHECK_TUPLE_r33 1149
+#define _ITER_JUMP_LIST_r02 1150
+#define _ITER_JUMP_LIST_r12 1151
+#define _ITER_JUMP_LIST_r22 1152
+#define _ITER_JUMP_LIST_r33 1153
+#define _ITER_JUMP_RANGE_r02 1154
+#define _ITER_JUMP_RANGE_r12 1155
+#define _ITER_JUMP_RANGE_r22 1156
+#define _ITER_JUMP_RANGE_r33 1157
+#define _ITER_JUMP_TUPLE_r02 1158
+#define _ITER_JUMP_TUPLE_r12 1159
+#define _ITER_JUMP_TUPLE_r22 1160
+#define _ITER_JUMP_TUPLE_r33 1161
+#define _ITER_NEXT_LIST_r23 1162
+#define _ITER_NEXT_LIST_r33 1163
+#define _ITER_NEXT_LIST_TIER_TWO_r23 1164
+#define _ITER_NEXT_LIST_TIER_TWO_r33 1165
+#define _ITER_NEXT_RANGE_r03 1166
+#define _ITER_NEXT_RANGE_r13 1167
+#define _ITER_NEXT_RANGE_r23 1168
+#define _ITER_NEXT_TUPLE_r03 1169
+#define _ITER_NEXT_TUPLE_r13 1170
+#define _ITER_NEXT_TUPLE_r23 1171
+#define _JUMP_BACKWARD_NO_INTERRUPT_r00 1172
+#define _JUMP_BACKWARD_NO_INTERRUPT_r11 1173
+#define _JUMP_BACKWARD_NO_INTERRUPT_r22 1174
+#define _JUMP_BACKWARD_NO_INTERRUPT_r33 1175
+#define _JUMP_TO_TOP_r00 1176
+#define _LIST_APPEND_r10 1177
+#define _LIST_EXTEND_r10 1178
+#define _LOAD_ATTR_r10 1179
+#define _LOAD_ATTR_CLASS_r11 1180
+#define _LOAD_ATTR_CLASS_r21 1181
+#define _LOAD_ATTR_CLASS_r31 1182
+#define _LOAD_ATTR_GETATTRIBUTE_OVERRIDDEN_r11 1183
+#define _LOAD_ATTR_INSTANCE_VALUE_r02 1184
+#define _LOAD_ATTR_INSTANCE_VALUE_r12 1185
+#define _LOAD_ATTR_INSTANCE_VALUE_r23 1186
+#define _LOAD_ATTR_METHOD_LAZY_DICT_r02 1187
+#define _LOAD_ATTR_METHOD_LAZY_DICT_r12 1188
+#define _LOAD_ATTR_METHOD_LAZY_DICT_r23 1189
+#define _LOAD_ATTR_METHOD_NO_DICT_r02 1190
+#define _LOAD_ATTR_METHOD_NO_DICT_r12 1191
+#define _LOAD_ATTR_METHOD_NO_DICT_r23 1192
+#define _LOAD_ATTR_METHOD_WITH_VALUES_r02 1193
+#define _LOAD_ATTR_METHOD_WITH_VALUES_r12 1194
+#define _LOAD_ATTR_METHOD_WITH_VALUES_r23 1195
+#define _LOAD_ATTR_MODULE_r12 1196
+#define _LOAD_ATTR_NONDESCRIPTOR_NO_DICT_r11 1197
+#define _LOAD_ATTR_NONDESCRIPTOR_NO_DICT_r21 1198
+#define _LOAD_ATTR_NONDESCRIPTOR_NO_DICT_r31 1199
+#define _LOAD_ATTR_NONDESCRIPTOR_WITH_VALUES_r11 1200
+#define _LOAD_ATTR_NONDESCRIPTOR_WITH_VALUES_r21 1201
+#define _LOAD_ATTR_NONDESCRIPTOR_WITH_VALUES_r31 1202
+#define _LOAD_ATTR_PROPERTY_FRAME_r11 1203
+#define _LOAD_ATTR_SLOT_r02 1204
+#define _LOAD_ATTR_SLOT_r12 1205
+#define _LOAD_ATTR_SLOT_r23 1206
+#define _LOAD_ATTR_WITH_HINT_r12 1207
+#define _LOAD_BUILD_CLASS_r01 1208
+#define _LOAD_BUILD_CLASS_r11 1209
+#define _LOAD_BUILD_CLASS_r21 1210
+#define _LOAD_BUILD_CLASS_r31 1211
+#define _LOAD_BYTECODE_r00 1212
+#define _LOAD_BYTECODE_r10 1213
+#define _LOAD_BYTECODE_r20 1214
+#define _LOAD_BYTECODE_r30 1215
+#define _LOAD_COMMON_CONSTANT_r01 1216
+#define _LOAD_COMMON_CONSTANT_r12 1217
+#define _LOAD_COMMON_CONSTANT_r23 1218
+#define _LOAD_CONST_r01 1219
+#define _LOAD_CONST_r12 1220
+#define _LOAD_CONST_r23 1221
+#define _LOAD_CONST_INLINE_r01 1222
+#define _LOAD_CONST_INLINE_r12 1223
+#define _LOAD_CONST_INLINE_r23 1224
+#define _LOAD_CONST_INLINE_BORROW_r01 1225
+#define _LOAD_CONST_INLINE_BORROW_r12 1226
+#define _LOAD_CONST_INLINE_BORROW_r23 1227
+#define _LOAD_CONST_UNDER_INLINE_r02 1228
+#define _LOAD_CONST_UNDER_INLINE_r12 1229
+#define _LOAD_CONST_UNDER_INLINE_r23 1230
+#define _LOAD_CONST_UNDER_INLINE_BORROW_r02 1231
+#define _LOAD_CONST_UNDER_INLINE_BORROW_r12 1232
+#define _LOAD_CONST_UNDER_INLINE_BORROW_r23 1233
+#define _LOAD_DEREF_r01 1234
+#define _LOAD_DEREF_r11 1235
+#define _LOAD_DEREF_r21 1236
+#define _LOAD_DEREF_r31 1237
+#define _LOAD_FAST_r01 1238
+#define _LOAD_FAST_r12 1239
+#define _LOAD_FAST_r23 1240
+#define _LOAD_FAST_0_r01 1241
+#define _LOAD_FAST_0_r12 1242
+#define _LOAD_FAST_0_r23 1243
+#define _LOAD_FAST_1_r01 1244
+#define _LOAD_FAST_1_r12 1245
+#define _LOAD_FAST_1_r23 1246
+#define _LOAD_FAST_2_r01 1247
+#define _LOAD_FAST_2_r12 1248
+#define _LOAD_FAST_2_r23 1249
+#define _LOAD_FAST_3_r01 1250
+#define _LOAD_FAST_3_r12 1251
+#define _LOAD_FAST_3_r23 1252
+#define _LOAD_FAST_4_r01 1253
+#define _LOAD_FAST_4_r12 1254
+#define _LOAD_FAST_4_r23 1255
+#define _LOAD_FAST_5_r01 1256
+#define _LOAD_FAST_5_r12 1257
+#define _LOAD_FAST_5_r23 1258
+#define _LOAD_FAST_6_r01 1259
+#define _LOAD_FAST_6_r12 1260
+#define _LOAD_FAST_6_r23 1261
+#define _LOAD_FAST_7_r01 1262
+#define _LOAD_FAST_7_r12 1263
+#define _LOAD_FAST_7_r23 1264
+#define _LOAD_FAST_AND_CLEAR_r01 1265
+#define _LOAD_FAST_AND_CLEAR_r12 1266
+#define _LOAD_FAST_AND_CLEAR_r23 1267
+#define _LOAD_FAST_BORROW_r01 1268
+#define _LOAD_FAST_BORROW_r12 1269
+#define _LOAD_FAST_BORROW_r23 1270
+#define _LOAD_FAST_BORROW_0_r01 1271
+#define _LOAD_FAST_BORROW_0_r12 1272
+#define _LOAD_FAST_BORROW_0_r23 1273
+#define _LOAD_FAST_BORROW_1_r01 1274
+#define _LOAD_FAST_BORROW_1_r12 1275
+#define _LOAD_FAST_BORROW_1_r23 1276
+#define _LOAD_FAST_BORROW_2_r01 1277
+#define _LOAD_FAST_BORROW_2_r12 1278
+#define _LOAD_FAST_BORROW_2_r23 1279
+#define _LOAD_FAST_BORROW_3_r01 1280
+#define _LOAD_FAST_BORROW_3_r12 1281
+#define _LOAD_FAST_BORROW_3_r23 1282
+#define _LOAD_FAST_BORROW_4_r01 1283
+#define _LOAD_FAST_BORROW_4_r12 1284
+#define _LOAD_FAST_BORROW_4_r23 1285
+#define _LOAD_FAST_BORROW_5_r01 1286
+#define _LOAD_FAST_BORROW_5_r12 1287
+#define _LOAD_FAST_BORROW_5_r23 1288
+#define _LOAD_FAST_BORROW_6_r01 1289
+#define _LOAD_FAST_BORROW_6_r12 1290
+#define _LOAD_FAST_BORROW_6_r23 1291
+#define _LOAD_FAST_BORROW_7_r01 1292
+#define _LOAD_FAST_BORROW_7_r12 1293
+#define _LOAD_FAST_BORROW_7_r23 1294
+#define _LOAD_FAST_BORROW_LOAD_FAST_BORROW_r02 1295
+#define _LOAD_FAST_BORROW_LOAD_FAST_BORROW_r13 1296
+#define _LOAD_FAST_CHECK_r01 1297
+#define _LOAD_FAST_CHECK_r12 1298
+#define _LOAD_FAST_CHECK_r23 1299
+#define _LOAD_FAST_LOAD_FAST_r02 1300
+#define _LOAD_FAST_LOAD_FAST_r13 1301
+#define _LOAD_FROM_DICT_OR_DEREF_r11 1302
+#define _LOAD_FROM_DICT_OR_GLOBALS_r11 1303
+#define _LOAD_GLOBAL_r00 1304
+#define _LOAD_GLOBAL_BUILTINS_r01 1305
+#define _LOAD_GLOBAL_MODULE_r01 1306
+#define _LOAD_LOCALS_r01 1307
+#define _LOAD_LOCALS_r12 1308
+#define _LOAD_LOCALS_r23 1309
+#define _LOAD_NAME_r01 1310
+#define _LOAD_SMALL_INT_r01 1311
+#define _LOAD_SMALL_INT_r12 1312
+#define _LOAD_SMALL_INT_r23 1313
+#define _LOAD_SMALL_INT_0_r01 1314
+#define _LOAD_SMALL_INT_0_r12 1315
+#define _LOAD_SMALL_INT_0_r23 1316
+#define _LOAD_SMALL_INT_1_r01 1317
+#define _LOAD_SMALL_INT_1_r12 1318
+#define _LOAD_SMALL_INT_1_r23 1319
+#define _LOAD_SMALL_INT_2_r01 1320
+#define _LOAD_SMALL_INT_2_r12 1321
+#define _LOAD_SMALL_INT_2_r23 1322
+#define _LOAD_SMALL_INT_3_r01 1323
+#define _LOAD_SMALL_INT_3_r12 1324
+#define _LOAD_SMALL_INT_3_r23 1325
+#define _LOAD_SPECIAL_r00 1326
+#define _LOAD_SUPER_ATTR_ATTR_r31 1327
+#define _LOAD_SUPER_ATTR_METHOD_r32 1328
+#define _MAKE_CALLARGS_A_TUPLE_r33 1329
+#define _MAKE_CELL_r00 1330
+#define _MAKE_CELL_r10 1331
+#define _MAKE_CELL_r20 1332
+#define _MAKE_CELL_r30 1333
+#define _MAKE_FUNCTION_r11 1334
+#define _MAKE_FUNCTION_r21 1335
+#define _MAKE_FUNCTION_r31 1336
+#define _MAKE_WARM_r00 1337
+#define _MAKE_WARM_r11 1338
+#define _MAKE_WARM_r22 1339
+#define _MAKE_WARM_r33 1340
+#define _MAP_ADD_r20 1341
+#define _MATCH_CLASS_r31 1342
+#define _MATCH_KEYS_r23 1343
+#define _MATCH_KEYS_r33 1344
+#define _MATCH_MAPPING_r02 1345
+#define _MATCH_MAPPING_r12 1346
+#define _MATCH_MAPPING_r23 1347
+#define _MATCH_SEQUENCE_r02 1348
+#define _MATCH_SEQUENCE_r12 1349
+#define _MATCH_SEQUENCE_r23 1350
+#define _MAYBE_EXPAND_METHOD_r00 1351
+#define _MAYBE_EXPAND_METHOD_KW_r11 1352
+#define _MONITOR_CALL_r00 1353
+#define _MONITOR_CALL_KW_r11 1354
+#define _MONITOR_JUMP_BACKWARD_r00 1355
+#define _MONITOR_JUMP_BACKWARD_r11 1356
+#define _MONITOR_JUMP_BACKWARD_r22 1357
+#define _MONITOR_JUMP_BACKWARD_r33 1358
+#define _MONITOR_RESUME_r00 1359
+#define _MONITOR_RESUME_r10 1360
+#define _MONITOR_RESUME_r20 1361
+#define _MONITOR_RESUME_r30 1362
+#define _NOP_r00 1363
+#define _NOP_r11 1364
+#define _NOP_r22 1365
+#define _NOP_r33 1366
+#define _POP_CALL_r20 1367
+#define _POP_CALL_r30 1368
+#define _POP_CALL_LOAD_CONST_INLINE_BORROW_r21 1369
+#define _POP_CALL_LOAD_CONST_INLINE_BORROW_r31 1370
+#define _POP_CALL_ONE_r30 1371
+#define _POP_CALL_ONE_LOAD_CONST_INLINE_BORROW_r31 1372
+#define _POP_CALL_TWO_r30 1373
+#define _POP_CALL_TWO_LOAD_CONST_INLINE_BORROW_r31 1374
+#define _POP_EXCEPT_r10 1375
+#define _POP_EXCEPT_r20 1376
+#define _POP_EXCEPT_r30 1377
+#define _POP_ITER_r20 1378
+#define _POP_ITER_r30 1379
+#define _POP_JUMP_IF_FALSE_r00 1380
+#define _POP_JUMP_IF_FALSE_r10 1381
+#define _POP_JUMP_IF_FALSE_r21 1382
+#define _POP_JUMP_IF_FALSE_r32 1383
+#define _POP_JUMP_IF_TRUE_r00 1384
+#define _POP_JUMP_IF_TRUE_r10 1385
+#define _POP_JUMP_IF_TRUE_r21 1386
+#define _POP_JUMP_IF_TRUE_r32 1387
+#define _POP_TOP_r10 1388
+#define _POP_TOP_r20 1389
+#define _POP_TOP_r30 1390
+#define _POP_TOP_FLOAT_r00 1391
+#define _POP_TOP_FLOAT_r10 1392
+#define _POP_TOP_FLOAT_r21 1393
+#define _POP_TOP_FLOAT_r32 1394
+#define _POP_TOP_INT_r00 1395
+#define _POP_TOP_INT_r10 1396
+#define _POP_TOP_INT_r21 1397
+#define _POP_TOP_INT_r32 1398
+#define _POP_TOP_LOAD_CONST_INLINE_r11 1399
+#define _POP_TOP_LOAD_CONST_INLINE_r21 1400
+#define _POP_TOP_LOAD_CONST_INLINE_r31 1401
+#define _POP_TOP_LOAD_CONST_INLINE_BORROW_r11 1402
+#define _POP_TOP_LOAD_CONST_INLINE_BORROW_r21 1403
+#define _POP_TOP_LOAD_CONST_INLINE_BORROW_r31 1404
+#define _POP_TOP_NOP_r00 1405
+#define _POP_TOP_NOP_r10 1406
+#define _POP_TOP_NOP_r21 1407
+#define _POP_TOP_NOP_r32 1408
+#define _POP_TOP_UNICODE_r00 1409
+#define _POP_TOP_UNICODE_r10 1410
+#define _POP_TOP_UNICODE_r21 1411
+#define _POP_TOP_UNICODE_r32 1412
+#define _POP_TWO_r20 1413
+#define _POP_TWO_r30 1414
+#define _POP_TWO_LOAD_CONST_INLINE_BORROW_r21 1415
+#define _POP_TWO_LOAD_CONST_INLINE_BORROW_r31 1416
+#define _PUSH_EXC_INFO_r02 1417
+#define _PUSH_EXC_INFO_r12 1418
+#define _PUSH_EXC_INFO_r23 1419
+#define _PUSH_FRAME_r10 1420
+#define _PUSH_NULL_r01 1421
+#define _PUSH_NULL_r12 1422
+#define _PUSH_NULL_r23 1423
+#define _PUSH_NULL_CONDITIONAL_r00 1424
+#define _PY_FRAME_EX_r31 1425
+#define _PY_FRAME_GENERAL_r01 1426
+#define _PY_FRAME_KW_r11 1427
+#define _QUICKEN_RESUME_r00 1428
+#define _QUICKEN_RESUME_r11 1429
+#define _QUICKEN_RESUME_r22 1430
+#define _QUICKEN_RESUME_r33 1431
+#define _REPLACE_WITH_TRUE_r02 1432
+#define _REPLACE_WITH_TRUE_r12 1433
+#define _REPLACE_WITH_TRUE_r23 1434
+#define _RESUME_CHECK_r00 1435
+#define _RESUME_CHECK_r11 1436
+#define _RESUME_CHECK_r22 1437
+#define _RESUME_CHECK_r33 1438
+#define _RETURN_GENERATOR_r01 1439
+#define _RETURN_VALUE_r11 1440
+#define _RETURN_VALUE_r21 1441
+#define _RETURN_VALUE_r31 1442
+#define _SAVE_RETURN_OFFSET_r00 1443
+#define _SAVE_RETURN_OFFSET_r11 1444
+#define _SAVE_RETURN_OFFSET_r22 1445
+#define _SAVE_RETURN_OFFSET_r33 1446
+#define _SEND_r22 1447
+#define _SEND_GEN_FRAME_r22 1448
+#define _SETUP_ANNOTATIONS_r00 1449
+#define _SETUP_ANNOTATIONS_r10 1450
+#define _SETUP_ANNOTATIONS_r20 1451
+#define _SETUP_ANNOTATIONS_r30 1452
+#define _SET_ADD_r10 1453
+#define _SET_FUNCTION_ATTRIBUTE_r01 1454
+#define _SET_FUNCTION_ATTRIBUTE_r11 1455
+#define _SET_FUNCTION_ATTRIBUTE_r21 1456
+#define _SET_FUNCTION_ATTRIBUTE_r32 1457
+#define _SET_IP_r00 1458
+#define _SET_IP_r11 1459
+#define _SET_IP_r22 1460
+#define _SET_IP_r33 1461
+#define _SET_UPDATE_r10 1462
+#define _SHUFFLE_2_LOAD_CONST_INLINE_BORROW_r02 1463
+#define _SHUFFLE_2_LOAD_CONST_INLINE_BORROW_r12 1464
+#define _SHUFFLE_2_LOAD_CONST_INLINE_BORROW_r22 1465
+#define _SHUFFLE_2_LOAD_CONST_INLINE_BORROW_r32 1466
+#define _SHUFFLE_3_LOAD_CONST_INLINE_BORROW_r03 1467
+#define _SHUFFLE_3_LOAD_CONST_INLINE_BORROW_r13 1468
+#define _SHUFFLE_3_LOAD_CONST_INLINE_BORROW_r23 1469
+#define _SHUFFLE_3_LOAD_CONST_INLINE_BORROW_r33 1470
+#define _SPILL_OR_RELOAD_r01 1471
+#define _SPILL_OR_RELOAD_r02 1472
+#define _SPILL_OR_RELOAD_r03 1473
+#define _SPILL_OR_RELOAD_r10 1474
+#define _SPILL_OR_RELOAD_r12 1475
+#define _SPILL_OR_RELOAD_r13 1476
+#define _SPILL_OR_RELOAD_r20 1477
+#define _SPILL_OR_RELOAD_r21 1478
+#define _SPILL_OR_RELOAD_r23 1479
+#define _SPILL_OR_RELOAD_r30 1480
+#define _SPILL_OR_RELOAD_r31 1481
+#define _SPILL_OR_RELOAD_r32 1482
+#define _START_EXECUTOR_r00 1483
+#define _STORE_ATTR_r20 1484
+#define _STORE_ATTR_r30 1485
+#define _STORE_ATTR_INSTANCE_VALUE_r21 1486
+#define _STORE_ATTR_INSTANCE_VALUE_r31 1487
+#define _STORE_ATTR_SLOT_r21 1488
+#define _STORE_ATTR_SLOT_r31 1489
+#define _STORE_ATTR_WITH_HINT_r21 1490
+#define _STORE_DEREF_r10 1491
+#define _STORE_DEREF_r20 1492
+#define _STORE_DEREF_r30 1493
+#define _STORE_FAST_LOAD_FAST_r11 1494
+#define _STORE_FAST_LOAD_FAST_r21 1495
+#define _STORE_FAST_LOAD_FAST_r31 1496
+#define _STORE_FAST_STORE_FAST_r20 1497
+#define _STORE_FAST_STORE_FAST_r30 1498
+#define _STORE_GLOBAL_r10 1499
+#define _STORE_GLOBAL_r20 1500
+#define _STORE_GLOBAL_r30 1501
+#define _STORE_NAME_r10 1502
+#define _STORE_NAME_r20 1503
+#define _STORE_NAME_r30 1504
+#define _STORE_SLICE_r30 1505
+#define _STORE_SUBSCR_r30 1506
+#define _STORE_SUBSCR_DICT_r31 1507
+#define _STORE_SUBSCR_LIST_INT_r32 1508
+#define _SWAP_r11 1509
+#define _SWAP_2_r02 1510
+#define _SWAP_2_r12 1511
+#define _SWAP_2_r22 1512
+#define _SWAP_2_r33 1513
+#define _SWAP_3_r03 1514
+#define _SWAP_3_r13 1515
+#define _SWAP_3_r23 1516
+#define _SWAP_3_r33 1517
+#define _SWAP_FAST_r01 1518
+#define _SWAP_FAST_r11 1519
+#define _SWAP_FAST_r22 1520
+#define _SWAP_FAST_r33 1521
+#define _SWAP_FAST_0_r01 1522
+#define _SWAP_FAST_0_r11 1523
+#define _SWAP_FAST_0_r22 1524
+#define _SWAP_FAST_0_r33 1525
+#define _SWAP_FAST_1_r01 1526
+#define _SWAP_FAST_1_r11 1527
+#define _SWAP_FAST_1_r22 1528
+#define _SWAP_FAST_1_r33 1529
+#define _SWAP_FAST_2_r01 1530
+#define _SWAP_FAST_2_r11 1531
+#define _SWAP_FAST_2_r22 1532
+#define _SWAP_FAST_2_r33 1533
+#define _SWAP_FAST_3_r01 1534
+#define _SWAP_FAST_3_r11 1535
+#define _SWAP_FAST_3_r22 1536
+#define _SWAP_FAST_3_r33 1537
+#define _SWAP_FAST_4_r01 1538
+#define _SWAP_FAST_4_r11 1539
+#define _SWAP_FAST_4_r22 1540
+#define _SWAP_FAST_4_r33 1541
+#define _SWAP_FAST_5_r01 1542
+#define _SWAP_FAST_5_r11 1543
+#define _SWAP_FAST_5_r22 1544
+#define _SWAP_FAST_5_r33 1545
+#define _SWAP_FAST_6_r01 1546
+#define _SWAP_FAST_6_r11 1547
+#define _SWAP_FAST_6_r22 1548
+#define _SWAP_FAST_6_r33 1549
+#define _SWAP_FAST_7_r01 1550
+#define _SWAP_FAST_7_r11 1551
+#define _SWAP_FAST_7_r22 1552
+#define _SWAP_FAST_7_r33 1553
+#define _TIER2_RESUME_CHECK_r00 1554
+#define _TIER2_RESUME_CHECK_r11 1555
+#define _TIER2_RESUME_CHECK_r22 1556
+#define _TIER2_RESUME_CHECK_r33 1557
+#define _TO_BOOL_r11 1558
+#define _TO_BOOL_r21 1559
+#define _TO_BOOL_r31 1560
+#define _TO_BOOL_BOOL_r01 1561
+#define _TO_BOOL_BOOL_r11 1562
+#define _TO_BOOL_BOOL_r22 1563
+#define _TO_BOOL_BOOL_r33 1564
+#define _TO_BOOL_INT_r02 1565
+#define _TO_BOOL_INT_r12 1566
+#define _TO_BOOL_INT_r23 1567
+#define _TO_BOOL_LIST_r02 1568
+#define _TO_BOOL_LIST_r12 1569
+#define _TO_BOOL_LIST_r23 1570
+#define _TO_BOOL_NONE_r01 1571
+#define _TO_BOOL_NONE_r11 1572
+#define _TO_BOOL_NONE_r22 1573
+#define _TO_BOOL_NONE_r33 1574
+#define _TO_BOOL_STR_r02 1575
+#define _TO_BOOL_STR_r12 1576
+#define _TO_BOOL_STR_r23 1577
+#define _TRACE_RECORD_r00 1578
+#define _UNARY_INVERT_r12 1579
+#define _UNARY_INVERT_r22 1580
+#define _UNARY_INVERT_r32 1581
+#define _UNARY_NEGATIVE_r12 1582
+#define _UNARY_NEGATIVE_r22 1583
+#define _UNARY_NEGATIVE_r32 1584
+#define _UNARY_NOT_r01 1585
+#define _UNARY_NOT_r11 1586
+#define _UNARY_NOT_r22 1587
+#define _UNARY_NOT_r33 1588
+#define _UNPACK_EX_r10 1589
+#define _UNPACK_SEQUENCE_r10 1590
+#define _UNPACK_SEQUENCE_LIST_r10 1591
+#define _UNPACK_SEQUENCE_TUPLE_r10 1592
+#define _UNPACK_SEQUENCE_TWO_TUPLE_r12 1593
+#define _UNPACK_SEQUENCE_TWO_TUPLE_r22 1594
+#define _UNPACK_SEQUENCE_TWO_TUPLE_r32 1595
+#define _WITH_EXCEPT_START_r33 1596
+#define _YIELD_VALUE_r11 1597
+#define MAX_UOP_REGS_ID 1597
 
 #ifdef __cplusplus
 }
@@ -112,8 +112,12 @@ const uint32_t _PyUop_Flags[MAX_UOP_ID+1] = {
     [_BINARY_OP_MULTIPLY_FLOAT] = HAS_ERROR_FLAG | HAS_ERROR_NO_POP_FLAG | HAS_PURE_FLAG,
     [_BINARY_OP_ADD_FLOAT] = HAS_ERROR_FLAG | HAS_ERROR_NO_POP_FLAG | HAS_PURE_FLAG,
     [_BINARY_OP_SUBTRACT_FLOAT] = HAS_ERROR_FLAG | HAS_ERROR_NO_POP_FLAG | HAS_PURE_FLAG,
+    [_BINARY_OP_ADD_FLOAT_INPLACE] = HAS_ERROR_FLAG | HAS_ERROR_NO_POP_FLAG,
+    [_BINARY_OP_SUBTRACT_FLOAT_INPLACE] = HAS_ERROR_FLAG | HAS_ERROR_NO_POP_FLAG,
+    [_BINARY_OP_MULTIPLY_FLOAT_INPLACE] = HAS_ERROR_FLAG | HAS_ERROR_NO_POP_FLAG,
     [_BINARY_OP_ADD_UNICODE] = HAS_ERROR_FLAG | HAS_ERROR_NO_POP_FLAG | HAS_PURE_FLAG,
     [_BINARY_OP_INPLACE_ADD_UNICODE] = HAS_LOCAL_FLAG | HAS_DEOPT_FLAG | HAS_ERROR_FLAG | HAS_ESCAPES_FLAG,
+    [_BINARY_OP_INPLACE_ADD_UNICODE_DEREF] = HAS_LOCAL_FLAG | HAS_DEOPT_FLAG | HAS_ERROR_FLAG | HAS_ESCAPES_FLAG,
     [_GUARD_BINARY_OP_EXTEND] = HAS_DEOPT_FLAG | HAS_ESCAPES_FLAG,
     [_BINARY_OP_EXTEND] = HAS_ERROR_FLAG | HAS_ERROR_NO_POP_FLAG | HAS_ESCAPES_FLAG,
     [_BINARY_SLICE] = HAS_ERROR_FLAG | HAS_ESCAPES_FLAG,
@@ -408,21 +412,21 @@ const _PyUopCachingInfo _PyUop_Caching[MAX_UOP_ID+1] = {
         },
     },
     [_CHECK_PERIODIC] = {
-        .best = { 0, 0, 0, 0 },
+        .best = { 0, 1, 2, 3 },
         .entries = {
             { 0, 0, _CHECK_PERIODIC_r00 },
-            { -1, -1, -1 },
-            { -1, -1, -1 },
-            { -1, -1, -1 },
+            { 0, 0, _CHECK_PERIODIC_r10 },
+            { 0, 0, _CHECK_PERIODIC_r20 },
+            { 0, 0, _CHECK_PERIODIC_r30 },
         },
     },
     [_CHECK_PERIODIC_IF_NOT_YIELD_FROM] = {
-        .best = { 0, 0, 0, 0 },
+        .best = { 0, 1, 2, 3 },
         .entries = {
             { 0, 0, _CHECK_PERIODIC_IF_NOT_YIELD_FROM_r00 },
-            { -1, -1, -1 },
-            { -1, -1, -1 },
-            { -1, -1, -1 },
+            { 0, 0, _CHECK_PERIODIC_IF_NOT_YIELD_FROM_r10 },
+            { 0, 0, _CHECK_PERIODIC_IF_NOT_YIELD_FROM_r20 },
+            { 0, 0, _CHECK_PERIODIC_IF_NOT_YIELD_FROM_r30 },
         },
     },
     [_RESUME_CHECK] = {
@@ -750,12 +754,12 @@ const _PyUopCachingInfo _PyUop_Caching[MAX_UOP_ID+1] = {
         },
     },
     [_POP_TOP] = {
-        .best = { 1, 1, 1, 1 },
+        .best = { 1, 1, 2, 3 },
         .entries = {
             { -1, -1, -1 },
             { 0, 1, _POP_TOP_r10 },
-            { -1, -1, -1 },
-            { -1, -1, -1 },
+            { 0, 1, _POP_TOP_r20 },
+            { 0, 1, _POP_TOP_r30 },
         },
     },
     [_POP_TOP_NOP] = {
@@ -795,12 +799,12 @@ const _PyUopCachingInfo _PyUop_Caching[MAX_UOP_ID+1] = {
         },
     },
     [_POP_TWO] = {
-        .best = { 2, 2, 2, 2 },
+        .best = { 2, 2, 2, 3 },
         .entries = {
             { -1, -1, -1 },
             { -1, -1, -1 },
             { 0, 2, _POP_TWO_r20 },
-            { -1, -1, -1 },
+            { 0, 2, _POP_TWO_r30 },
         },
     },
     [_PUSH_NULL] = {
@@ -813,39 +817,39 @@ const _PyUopCachingInfo _PyUop_Caching[MAX_UOP_ID+1] = {
         },
     },
     [_END_FOR] = {
-        .best = { 1, 1, 1, 1 },
+        .best = { 1, 1, 2, 3 },
         .entries = {
             { -1, -1, -1 },
             { 0, 1, _END_FOR_r10 },
-            { -1, -1, -1 },
-            { -1, -1, -1 },
+            { 0, 1, _END_FOR_r20 },
+            { 0, 1, _END_FOR_r30 },
         },
     },
     [_POP_ITER] = {
-        .best = { 2, 2, 2, 2 },
+        .best = { 2, 2, 2, 3 },
         .entries = {
             { -1, -1, -1 },
             { -1, -1, -1 },
             { 0, 2, _POP_ITER_r20 },
-            { -1, -1, -1 },
+            { 0, 2, _POP_ITER_r30 },
         },
     },
     [_END_SEND] = {
-        .best = { 2, 2, 2, 2 },
+        .best = { 2, 2, 2, 3 },
         .entries = {
             { -1, -1, -1 },
             { -1, -1, -1 },
             { 1, 2, _END_SEND_r21 },
-            { -1, -1, -1 },
+            { 1, 2, _END_SEND_r31 },
         },
     },
     [_UNARY_NEGATIVE] = {
-        .best = { 1, 1, 1, 1 },
+        .best = { 1, 1, 2, 3 },
         .entries = {
             { -1, -1, -1 },
             { 2, 1, _UNARY_NEGATIVE_r12 },
-            { -1, -1, -1 },
-            { -1, -1, -1 },
+            { 2, 1, _UNARY_NEGATIVE_r22 },
+            { 2, 1, _UNARY_NEGATIVE_r32 },
         },
     },
     [_UNARY_NOT] = {
@@ -858,12 +862,12 @@ const _PyUopCachingInfo _PyUop_Caching[MAX_UOP_ID+1] = {
         },
     },
     [_TO_BOOL] = {
-        .best = { 1, 1, 1, 1 },
+        .best = { 1, 1, 2, 3 },
         .entries = {
             { -1, -1, -1 },
             { 1, 1, _TO_BOOL_r11 },
-            { -1, -1, -1 },
-            { -1, -1, -1 },
+            { 1, 1, _TO_BOOL_r21 },
+            { 1, 1, _TO_BOOL_r31 },
         },
     },
     [_TO_BOOL_BOOL] = {
@@ -975,12 +979,12 @@ const _PyUopCachingInfo _PyUop_Caching[MAX_UOP_ID+1] = {
         },
     },
     [_UNARY_INVERT] = {
-        .best = { 1, 1, 1, 1 },
+        .best = { 1, 1, 2, 3 },
         .entries = {
             { -1, -1, -1 },
             { 2, 1, _UNARY_INVERT_r12 },
-            { -1, -1, -1 },
-            { -1, -1, -1 },
+            { 2, 1, _UNARY_INVERT_r22 },
+            { 2, 1, _UNARY_INVERT_r32 },
         },
     },
     [_GUARD_NOS_INT] = {
@@ -1091,6 +1095,33 @@ const _PyUopCachingInfo _PyUop_Caching[MAX_UOP_ID+1] = {
             { -1, -1, -1 },
         },
     },
+    [_BINARY_OP_ADD_FLOAT_INPLACE] = {
+        .best = { 2, 2, 2, 2 },
+        .entries = {
+            { -1, -1, -1 },
+            { -1, -1, -1 },
+            { 3, 2, _BINARY_OP_ADD_FLOAT_INPLACE_r23 },
+            { -1, -1, -1 },
+        },
+    },
+    [_BINARY_OP_SUBTRACT_FLOAT_INPLACE] = {
+        .best = { 2, 2, 2, 2 },
+        .entries = {
+            { -1, -1, -1 },
+            { -1, -1, -1 },
+            { 3, 2, _BINARY_OP_SUBTRACT_FLOAT_INPLACE_r23 },
+            { -1, -1, -1 },
+        },
+    },
+    [_BINARY_OP_MULTIPLY_FLOAT_INPLACE] = {
+        .best = { 2, 2, 2, 2 },
+        .entries = {
+            { -1, -1, -1 },
+            { -1, -1, -1 },
+            { 3, 2, _BINARY_OP_MULTIPLY_FLOAT_INPLACE_r23 },
+            { -1, -1, -1 },
+        },
+    },
     [_BINARY_OP_ADD_UNICODE] = {
         .best = { 0, 1, 2, 2 },
         .entries = {
@@ -1109,22 +1140,31 @@ const _PyUopCachingInfo _PyUop_Caching[MAX_UOP_ID+1] = {
             { -1, -1, -1 },
         },
     },
-    [_GUARD_BINARY_OP_EXTEND] = {
+    [_BINARY_OP_INPLACE_ADD_UNICODE_DEREF] = {
         .best = { 2, 2, 2, 2 },
         .entries = {
             { -1, -1, -1 },
             { -1, -1, -1 },
-            { 2, 2, _GUARD_BINARY_OP_EXTEND_r22 },
+            { 1, 2, _BINARY_OP_INPLACE_ADD_UNICODE_DEREF_r21 },
             { -1, -1, -1 },
         },
     },
+    [_GUARD_BINARY_OP_EXTEND] = {
+        .best = { 2, 2, 2, 3 },
+        .entries = {
+            { -1, -1, -1 },
+            { -1, -1, -1 },
+            { 2, 2, _GUARD_BINARY_OP_EXTEND_r22 },
+            { 2, 2, _GUARD_BINARY_OP_EXTEND_r32 },
+        },
+    },
     [_BINARY_OP_EXTEND] = {
-        .best = { 2, 2, 2, 2 },
+        .best = { 2, 2, 2, 3 },
         .entries = {
             { -1, -1, -1 },
             { -1, -1, -1 },
             { 3, 2, _BINARY_OP_EXTEND_r23 },
-            { -1, -1, -1 },
+            { 3, 2, _BINARY_OP_EXTEND_r33 },
         },
     },
     [_BINARY_SLICE] = {
@@ -1155,12 +1195,12 @@ const _PyUopCachingInfo _PyUop_Caching[MAX_UOP_ID+1] = {
         },
     },
     [_BINARY_OP_SUBSCR_LIST_SLICE] = {
-        .best = { 2, 2, 2, 2 },
+        .best = { 2, 2, 2, 3 },
         .entries = {
             { -1, -1, -1 },
             { -1, -1, -1 },
             { 3, 2, _BINARY_OP_SUBSCR_LIST_SLICE_r23 },
-            { -1, -1, -1 },
+            { 3, 2, _BINARY_OP_SUBSCR_LIST_SLICE_r33 },
         },
     },
     [_BINARY_OP_SUBSCR_STR_INT] = {
@@ -1236,12 +1276,12 @@ const _PyUopCachingInfo _PyUop_Caching[MAX_UOP_ID+1] = {
         },
     },
     [_BINARY_OP_SUBSCR_DICT] = {
-        .best = { 2, 2, 2, 2 },
+        .best = { 2, 2, 2, 3 },
         .entries = {
             { -1, -1, -1 },
             { -1, -1, -1 },
             { 3, 2, _BINARY_OP_SUBSCR_DICT_r23 },
-            { -1, -1, -1 },
+            { 3, 2, _BINARY_OP_SUBSCR_DICT_r33 },
         },
     },
     [_BINARY_OP_SUBSCR_CHECK_FUNC] = {
@@ -1308,39 +1348,39 @@ const _PyUopCachingInfo _PyUop_Caching[MAX_UOP_ID+1] = {
         },
     },
     [_DELETE_SUBSCR] = {
-        .best = { 2, 2, 2, 2 },
+        .best = { 2, 2, 2, 3 },
         .entries = {
             { -1, -1, -1 },
             { -1, -1, -1 },
             { 0, 2, _DELETE_SUBSCR_r20 },
-            { -1, -1, -1 },
+            { 0, 2, _DELETE_SUBSCR_r30 },
         },
     },
     [_CALL_INTRINSIC_1] = {
-        .best = { 1, 1, 1, 1 },
+        .best = { 1, 1, 2, 3 },
         .entries = {
             { -1, -1, -1 },
             { 1, 1, _CALL_INTRINSIC_1_r11 },
-            { -1, -1, -1 },
-            { -1, -1, -1 },
+            { 1, 1, _CALL_INTRINSIC_1_r21 },
+            { 1, 1, _CALL_INTRINSIC_1_r31 },
         },
     },
     [_CALL_INTRINSIC_2] = {
-        .best = { 2, 2, 2, 2 },
+        .best = { 2, 2, 2, 3 },
         .entries = {
             { -1, -1, -1 },
             { -1, -1, -1 },
             { 1, 2, _CALL_INTRINSIC_2_r21 },
-            { -1, -1, -1 },
+            { 1, 2, _CALL_INTRINSIC_2_r31 },
         },
     },
     [_RETURN_VALUE] = {
-        .best = { 1, 1, 1, 1 },
+        .best = { 1, 1, 2, 3 },
         .entries = {
             { -1, -1, -1 },
             { 1, 1, _RETURN_VALUE_r11 },
-            { -1, -1, -1 },
-            { -1, -1, -1 },
+            { 1, 1, _RETURN_VALUE_r21 },
+            { 1, 1, _RETURN_VALUE_r31 },
         },
     },
     [_GET_AITER] = {
@@ -1353,21 +1393,21 @@ const _PyUopCachingInfo _PyUop_Caching[MAX_UOP_ID+1] = {
         },
     },
     [_GET_ANEXT] = {
-        .best = { 1, 1, 1, 1 },
+        .best = { 1, 1, 2, 3 },
         .entries = {
             { -1, -1, -1 },
             { 2, 1, _GET_ANEXT_r12 },
-            { -1, -1, -1 },
-            { -1, -1, -1 },
+            { 2, 1, _GET_ANEXT_r22 },
+            { 2, 1, _GET_ANEXT_r32 },
         },
     },
     [_GET_AWAITABLE] = {
-        .best = { 1, 1, 1, 1 },
+        .best = { 1, 1, 2, 3 },
         .entries = {
             { -1, -1, -1 },
             { 1, 1, _GET_AWAITABLE_r11 },
-            { -1, -1, -1 },
-            { -1, -1, -1 },
+            { 1, 1, _GET_AWAITABLE_r21 },
+            { 1, 1, _GET_AWAITABLE_r31 },
         },
     },
     [_SEND_GEN_FRAME] = {
@@ -1389,12 +1429,12 @@ const _PyUopCachingInfo _PyUop_Caching[MAX_UOP_ID+1] = {
         },
     },
     [_POP_EXCEPT] = {
-        .best = { 1, 1, 1, 1 },
+        .best = { 1, 1, 2, 3 },
         .entries = {
             { -1, -1, -1 },
             { 0, 1, _POP_EXCEPT_r10 },
-            { -1, -1, -1 },
-            { -1, -1, -1 },
+            { 0, 1, _POP_EXCEPT_r20 },
+            { 0, 1, _POP_EXCEPT_r30 },
         },
     },
     [_LOAD_COMMON_CONSTANT] = {
@@ -1407,30 +1447,30 @@ const _PyUopCachingInfo _PyUop_Caching[MAX_UOP_ID+1] = {
         },
     },
     [_LOAD_BUILD_CLASS] = {
-        .best = { 0, 0, 0, 0 },
+        .best = { 0, 1, 2, 3 },
         .entries = {
             { 1, 0, _LOAD_BUILD_CLASS_r01 },
-            { -1, -1, -1 },
-            { -1, -1, -1 },
-            { -1, -1, -1 },
+            { 1, 0, _LOAD_BUILD_CLASS_r11 },
+            { 1, 0, _LOAD_BUILD_CLASS_r21 },
+            { 1, 0, _LOAD_BUILD_CLASS_r31 },
         },
     },
     [_STORE_NAME] = {
-        .best = { 1, 1, 1, 1 },
+        .best = { 1, 1, 2, 3 },
         .entries = {
             { -1, -1, -1 },
             { 0, 1, _STORE_NAME_r10 },
-            { -1, -1, -1 },
-            { -1, -1, -1 },
+            { 0, 1, _STORE_NAME_r20 },
+            { 0, 1, _STORE_NAME_r30 },
         },
     },
     [_DELETE_NAME] = {
-        .best = { 0, 0, 0, 0 },
+        .best = { 0, 1, 2, 3 },
         .entries = {
             { 0, 0, _DELETE_NAME_r00 },
-            { -1, -1, -1 },
-            { -1, -1, -1 },
-            { -1, -1, -1 },
+            { 0, 0, _DELETE_NAME_r10 },
+            { 0, 0, _DELETE_NAME_r20 },
+            { 0, 0, _DELETE_NAME_r30 },
         },
     },
     [_UNPACK_SEQUENCE] = {
@@ -1443,12 +1483,12 @@ const _PyUopCachingInfo _PyUop_Caching[MAX_UOP_ID+1] = {
         },
     },
     [_UNPACK_SEQUENCE_TWO_TUPLE] = {
-        .best = { 1, 1, 1, 1 },
+        .best = { 1, 1, 2, 3 },
         .entries = {
             { -1, -1, -1 },
             { 2, 1, _UNPACK_SEQUENCE_TWO_TUPLE_r12 },
-            { -1, -1, -1 },
-            { -1, -1, -1 },
+            { 2, 1, _UNPACK_SEQUENCE_TWO_TUPLE_r22 },
+            { 2, 1, _UNPACK_SEQUENCE_TWO_TUPLE_r32 },
         },
     },
     [_UNPACK_SEQUENCE_TUPLE] = {
@@ -1479,39 +1519,39 @@ const _PyUopCachingInfo _PyUop_Caching[MAX_UOP_ID+1] = {
         },
     },
     [_STORE_ATTR] = {
-        .best = { 2, 2, 2, 2 },
+        .best = { 2, 2, 2, 3 },
         .entries = {
             { -1, -1, -1 },
             { -1, -1, -1 },
             { 0, 2, _STORE_ATTR_r20 },
-            { -1, -1, -1 },
+            { 0, 2, _STORE_ATTR_r30 },
         },
     },
     [_DELETE_ATTR] = {
-        .best = { 1, 1, 1, 1 },
+        .best = { 1, 1, 2, 3 },
         .entries = {
             { -1, -1, -1 },
             { 0, 1, _DELETE_ATTR_r10 },
-            { -1, -1, -1 },
-            { -1, -1, -1 },
+            { 0, 1, _DELETE_ATTR_r20 },
+            { 0, 1, _DELETE_ATTR_r30 },
         },
     },
     [_STORE_GLOBAL] = {
-        .best = { 1, 1, 1, 1 },
+        .best = { 1, 1, 2, 3 },
         .entries = {
             { -1, -1, -1 },
             { 0, 1, _STORE_GLOBAL_r10 },
-            { -1, -1, -1 },
-            { -1, -1, -1 },
+            { 0, 1, _STORE_GLOBAL_r20 },
+            { 0, 1, _STORE_GLOBAL_r30 },
         },
     },
     [_DELETE_GLOBAL] = {
-        .best = { 0, 0, 0, 0 },
+        .best = { 0, 1, 2, 3 },
         .entries = {
             { 0, 0, _DELETE_GLOBAL_r00 },
-            { -1, -1, -1 },
-            { -1, -1, -1 },
-            { -1, -1, -1 },
+            { 0, 0, _DELETE_GLOBAL_r10 },
+            { 0, 0, _DELETE_GLOBAL_r20 },
+            { 0, 0, _DELETE_GLOBAL_r30 },
         },
     },
     [_LOAD_LOCALS] = {
@@ -1578,30 +1618,30 @@ const _PyUopCachingInfo _PyUop_Caching[MAX_UOP_ID+1] = {
         },
     },
     [_DELETE_FAST] = {
-        .best = { 0, 0, 0, 0 },
+        .best = { 0, 1, 2, 3 },
         .entries = {
             { 0, 0, _DELETE_FAST_r00 },
-            { -1, -1, -1 },
-            { -1, -1, -1 },
-            { -1, -1, -1 },
+            { 0, 0, _DELETE_FAST_r10 },
+            { 0, 0, _DELETE_FAST_r20 },
+            { 0, 0, _DELETE_FAST_r30 },
         },
     },
     [_MAKE_CELL] = {
-        .best = { 0, 0, 0, 0 },
+        .best = { 0, 1, 2, 3 },
         .entries = {
             { 0, 0, _MAKE_CELL_r00 },
-            { -1, -1, -1 },
-            { -1, -1, -1 },
-            { -1, -1, -1 },
+            { 0, 0, _MAKE_CELL_r10 },
+            { 0, 0, _MAKE_CELL_r20 },
+            { 0, 0, _MAKE_CELL_r30 },
         },
     },
     [_DELETE_DEREF] = {
-        .best = { 0, 0, 0, 0 },
+        .best = { 0, 1, 2, 3 },
         .entries = {
             { 0, 0, _DELETE_DEREF_r00 },
-            { -1, -1, -1 },
-            { -1, -1, -1 },
-            { -1, -1, -1 },
+            { 0, 0, _DELETE_DEREF_r10 },
+            { 0, 0, _DELETE_DEREF_r20 },
+            { 0, 0, _DELETE_DEREF_r30 },
         },
     },
     [_LOAD_FROM_DICT_OR_DEREF] = {
@@ -1614,21 +1654,21 @@ const _PyUopCachingInfo _PyUop_Caching[MAX_UOP_ID+1] = {
         },
     },
     [_LOAD_DEREF] = {
-        .best = { 0, 0, 0, 0 },
+        .best = { 0, 1, 2, 3 },
         .entries = {
             { 1, 0, _LOAD_DEREF_r01 },
-            { -1, -1, -1 },
-            { -1, -1, -1 },
-            { -1, -1, -1 },
+            { 1, 0, _LOAD_DEREF_r11 },
+            { 1, 0, _LOAD_DEREF_r21 },
+            { 1, 0, _LOAD_DEREF_r31 },
         },
     },
     [_STORE_DEREF] = {
-        .best = { 1, 1, 1, 1 },
+        .best = { 1, 1, 2, 3 },
         .entries = {
             { -1, -1, -1 },
             { 0, 1, _STORE_DEREF_r10 },
-            { -1, -1, -1 },
-            { -1, -1, -1 },
+            { 0, 1, _STORE_DEREF_r20 },
+            { 0, 1, _STORE_DEREF_r30 },
         },
     },
     [_COPY_FREE_VARS] = {
@@ -1659,12 +1699,12 @@ const _PyUopCachingInfo _PyUop_Caching[MAX_UOP_ID+1] = {
         },
     },
     [_BUILD_TEMPLATE] = {
-        .best = { 2, 2, 2, 2 },
+        .best = { 2, 2, 2, 3 },
         .entries = {
             { -1, -1, -1 },
             { -1, -1, -1 },
             { 1, 2, _BUILD_TEMPLATE_r21 },
-            { -1, -1, -1 },
+            { 1, 2, _BUILD_TEMPLATE_r31 },
         },
     },
     [_BUILD_TUPLE] = {
@@ -1722,12 +1762,12 @@ const _PyUopCachingInfo _PyUop_Caching[MAX_UOP_ID+1] = {
         },
     },
     [_SETUP_ANNOTATIONS] = {
-        .best = { 0, 0, 0, 0 },
+        .best = { 0, 1, 2, 3 },
         .entries = {
             { 0, 0, _SETUP_ANNOTATIONS_r00 },
-            { -1, -1, -1 },
-            { -1, -1, -1 },
-            { -1, -1, -1 },
+            { 0, 0, _SETUP_ANNOTATIONS_r10 },
+            { 0, 0, _SETUP_ANNOTATIONS_r20 },
+            { 0, 0, _SETUP_ANNOTATIONS_r30 },
         },
     },
     [_DICT_UPDATE] = {
@@ -1857,12 +1897,12 @@ const _PyUopCachingInfo _PyUop_Caching[MAX_UOP_ID+1] = {
         },
     },
     [_LOAD_ATTR_CLASS] = {
-        .best = { 1, 1, 1, 1 },
+        .best = { 1, 1, 2, 3 },
         .entries = {
             { -1, -1, -1 },
             { 1, 1, _LOAD_ATTR_CLASS_r11 },
-            { -1, -1, -1 },
-            { -1, -1, -1 },
+            { 1, 1, _LOAD_ATTR_CLASS_r21 },
+            { 1, 1, _LOAD_ATTR_CLASS_r31 },
         },
     },
     [_LOAD_ATTR_PROPERTY_FRAME] = {
@@ -1884,12 +1924,12 @@ const _PyUopCachingInfo _PyUop_Caching[MAX_UOP_ID+1] = {
         },
     },
     [_STORE_ATTR_INSTANCE_VALUE] = {
-        .best = { 2, 2, 2, 2 },
+        .best = { 2, 2, 2, 3 },
         .entries = {
             { -1, -1, -1 },
             { -1, -1, -1 },
             { 1, 2, _STORE_ATTR_INSTANCE_VALUE_r21 },
-            { -1, -1, -1 },
+            { 1, 2, _STORE_ATTR_INSTANCE_VALUE_r31 },
         },
     },
     [_STORE_ATTR_WITH_HINT] = {
@@ -1902,21 +1942,21 @@ const _PyUopCachingInfo _PyUop_Caching[MAX_UOP_ID+1] = {
         },
     },
     [_STORE_ATTR_SLOT] = {
-        .best = { 2, 2, 2, 2 },
+        .best = { 2, 2, 2, 3 },
         .entries = {
             { -1, -1, -1 },
             { -1, -1, -1 },
             { 1, 2, _STORE_ATTR_SLOT_r21 },
-            { -1, -1, -1 },
+            { 1, 2, _STORE_ATTR_SLOT_r31 },
         },
     },
     [_COMPARE_OP] = {
-        .best = { 2, 2, 2, 2 },
+        .best = { 2, 2, 2, 3 },
         .entries = {
             { -1, -1, -1 },
             { -1, -1, -1 },
             { 1, 2, _COMPARE_OP_r21 },
-            { -1, -1, -1 },
+            { 1, 2, _COMPARE_OP_r31 },
         },
     },
     [_COMPARE_OP_FLOAT] = {
@@ -1956,12 +1996,12 @@ const _PyUopCachingInfo _PyUop_Caching[MAX_UOP_ID+1] = {
         },
     },
     [_CONTAINS_OP] = {
-        .best = { 2, 2, 2, 2 },
+        .best = { 2, 2, 2, 3 },
         .entries = {
             { -1, -1, -1 },
             { -1, -1, -1 },
             { 3, 2, _CONTAINS_OP_r23 },
-            { -1, -1, -1 },
+            { 3, 2, _CONTAINS_OP_r33 },
         },
     },
     [_GUARD_TOS_ANY_SET] = {
@@ -1974,21 +2014,21 @@ const _PyUopCachingInfo _PyUop_Caching[MAX_UOP_ID+1] = {
         },
     },
     [_CONTAINS_OP_SET] = {
-        .best = { 2, 2, 2, 2 },
+        .best = { 2, 2, 2, 3 },
         .entries = {
             { -1, -1, -1 },
             { -1, -1, -1 },
             { 3, 2, _CONTAINS_OP_SET_r23 },
-            { -1, -1, -1 },
+            { 3, 2, _CONTAINS_OP_SET_r33 },
         },
     },
     [_CONTAINS_OP_DICT] = {
-        .best = { 2, 2, 2, 2 },
+        .best = { 2, 2, 2, 3 },
         .entries = {
             { -1, -1, -1 },
             { -1, -1, -1 },
             { 3, 2, _CONTAINS_OP_DICT_r23 },
-            { -1, -1, -1 },
+            { 3, 2, _CONTAINS_OP_DICT_r33 },
         },
     },
     [_CHECK_EG_MATCH] = {
@@ -2001,48 +2041,48 @@ const _PyUopCachingInfo _PyUop_Caching[MAX_UOP_ID+1] = {
         },
     },
     [_CHECK_EXC_MATCH] = {
-        .best = { 2, 2, 2, 2 },
+        .best = { 2, 2, 2, 3 },
         .entries = {
             { -1, -1, -1 },
             { -1, -1, -1 },
             { 2, 2, _CHECK_EXC_MATCH_r22 },
-            { -1, -1, -1 },
+            { 2, 2, _CHECK_EXC_MATCH_r32 },
         },
     },
     [_IMPORT_NAME] = {
-        .best = { 2, 2, 2, 2 },
+        .best = { 2, 2, 2, 3 },
         .entries = {
             { -1, -1, -1 },
             { -1, -1, -1 },
             { 1, 2, _IMPORT_NAME_r21 },
-            { -1, -1, -1 },
+            { 1, 2, _IMPORT_NAME_r31 },
         },
     },
     [_IMPORT_FROM] = {
-        .best = { 1, 1, 1, 1 },
+        .best = { 1, 1, 2, 3 },
         .entries = {
             { -1, -1, -1 },
             { 2, 1, _IMPORT_FROM_r12 },
-            { -1, -1, -1 },
-            { -1, -1, -1 },
+            { 2, 1, _IMPORT_FROM_r22 },
+            { 2, 1, _IMPORT_FROM_r32 },
         },
     },
     [_IS_NONE] = {
-        .best = { 1, 1, 1, 1 },
+        .best = { 1, 1, 2, 3 },
         .entries = {
             { -1, -1, -1 },
             { 1, 1, _IS_NONE_r11 },
-            { -1, -1, -1 },
-            { -1, -1, -1 },
+            { 1, 1, _IS_NONE_r21 },
+            { 1, 1, _IS_NONE_r31 },
         },
     },
     [_GET_LEN] = {
-        .best = { 1, 1, 1, 1 },
+        .best = { 1, 1, 2, 3 },
         .entries = {
             { -1, -1, -1 },
             { 2, 1, _GET_LEN_r12 },
-            { -1, -1, -1 },
-            { -1, -1, -1 },
+            { 2, 1, _GET_LEN_r22 },
+            { 2, 1, _GET_LEN_r32 },
         },
     },
     [_MATCH_CLASS] = {
@@ -2073,39 +2113,39 @@ const _PyUopCachingInfo _PyUop_Caching[MAX_UOP_ID+1] = {
         },
     },
     [_MATCH_KEYS] = {
-        .best = { 2, 2, 2, 2 },
+        .best = { 2, 2, 2, 3 },
         .entries = {
             { -1, -1, -1 },
             { -1, -1, -1 },
             { 3, 2, _MATCH_KEYS_r23 },
-            { -1, -1, -1 },
+            { 3, 2, _MATCH_KEYS_r33 },
         },
     },
     [_GET_ITER] = {
-        .best = { 1, 1, 1, 1 },
+        .best = { 1, 1, 2, 3 },
         .entries = {
             { -1, -1, -1 },
             { 2, 1, _GET_ITER_r12 },
-            { -1, -1, -1 },
-            { -1, -1, -1 },
+            { 2, 1, _GET_ITER_r22 },
+            { 2, 1, _GET_ITER_r32 },
         },
     },
     [_GET_YIELD_FROM_ITER] = {
-        .best = { 1, 1, 1, 1 },
+        .best = { 1, 1, 2, 3 },
         .entries = {
             { -1, -1, -1 },
             { 1, 1, _GET_YIELD_FROM_ITER_r11 },
-            { -1, -1, -1 },
-            { -1, -1, -1 },
+            { 1, 1, _GET_YIELD_FROM_ITER_r21 },
+            { 1, 1, _GET_YIELD_FROM_ITER_r31 },
         },
     },
     [_FOR_ITER_TIER_TWO] = {
-        .best = { 2, 2, 2, 2 },
+        .best = { 2, 2, 2, 3 },
         .entries = {
             { -1, -1, -1 },
             { -1, -1, -1 },
             { 3, 2, _FOR_ITER_TIER_TWO_r23 },
-            { -1, -1, -1 },
+            { 3, 2, _FOR_ITER_TIER_TWO_r33 },
         },
     },
     [_ITER_CHECK_LIST] = {
@@ -2127,12 +2167,12 @@ const _PyUopCachingInfo _PyUop_Caching[MAX_UOP_ID+1] = {
         },
     },
     [_ITER_NEXT_LIST_TIER_TWO] = {
-        .best = { 2, 2, 2, 2 },
+        .best = { 2, 2, 2, 3 },
         .entries = {
             { -1, -1, -1 },
             { -1, -1, -1 },
             { 3, 2, _ITER_NEXT_LIST_TIER_TWO_r23 },
-            { -1, -1, -1 },
+            { 3, 2, _ITER_NEXT_LIST_TIER_TWO_r33 },
         },
     },
     [_ITER_CHECK_TUPLE] = {
@@ -2271,21 +2311,21 @@ const _PyUopCachingInfo _PyUop_Caching[MAX_UOP_ID+1] = {
         },
     },
     [_LOAD_ATTR_NONDESCRIPTOR_WITH_VALUES] = {
-        .best = { 1, 1, 1, 1 },
+        .best = { 1, 1, 2, 3 },
         .entries = {
             { -1, -1, -1 },
             { 1, 1, _LOAD_ATTR_NONDESCRIPTOR_WITH_VALUES_r11 },
-            { -1, -1, -1 },
-            { -1, -1, -1 },
+            { 1, 1, _LOAD_ATTR_NONDESCRIPTOR_WITH_VALUES_r21 },
+            { 1, 1, _LOAD_ATTR_NONDESCRIPTOR_WITH_VALUES_r31 },
         },
     },
     [_LOAD_ATTR_NONDESCRIPTOR_NO_DICT] = {
-        .best = { 1, 1, 1, 1 },
+        .best = { 1, 1, 2, 3 },
         .entries = {
             { -1, -1, -1 },
             { 1, 1, _LOAD_ATTR_NONDESCRIPTOR_NO_DICT_r11 },
-            { -1, -1, -1 },
-            { -1, -1, -1 },
+            { 1, 1, _LOAD_ATTR_NONDESCRIPTOR_NO_DICT_r21 },
+            { 1, 1, _LOAD_ATTR_NONDESCRIPTOR_NO_DICT_r31 },
         },
     },
     [_CHECK_ATTR_METHOD_LAZY_DICT] = {
@@ -2595,12 +2635,12 @@ const _PyUopCachingInfo _PyUop_Caching[MAX_UOP_ID+1] = {
         },
     },
     [_EXIT_INIT_CHECK] = {
-        .best = { 1, 1, 1, 1 },
+        .best = { 1, 1, 2, 3 },
         .entries = {
             { -1, -1, -1 },
             { 0, 1, _EXIT_INIT_CHECK_r10 },
-            { -1, -1, -1 },
-            { -1, -1, -1 },
+            { 0, 1, _EXIT_INIT_CHECK_r20 },
+            { 0, 1, _EXIT_INIT_CHECK_r30 },
         },
     },
     [_CALL_BUILTIN_CLASS] = {
@@ -2838,12 +2878,12 @@ const _PyUopCachingInfo _PyUop_Caching[MAX_UOP_ID+1] = {
         },
     },
     [_MAKE_FUNCTION] = {
-        .best = { 1, 1, 1, 1 },
+        .best = { 1, 1, 2, 3 },
         .entries = {
             { -1, -1, -1 },
             { 1, 1, _MAKE_FUNCTION_r11 },
-            { -1, -1, -1 },
-            { -1, -1, -1 },
+            { 1, 1, _MAKE_FUNCTION_r21 },
+            { 1, 1, _MAKE_FUNCTION_r31 },
         },
     },
     [_SET_FUNCTION_ATTRIBUTE] = {
@@ -2874,30 +2914,30 @@ const _PyUopCachingInfo _PyUop_Caching[MAX_UOP_ID+1] = {
         },
     },
     [_CONVERT_VALUE] = {
-        .best = { 1, 1, 1, 1 },
+        .best = { 1, 1, 2, 3 },
         .entries = {
             { -1, -1, -1 },
             { 1, 1, _CONVERT_VALUE_r11 },
-            { -1, -1, -1 },
-            { -1, -1, -1 },
+            { 1, 1, _CONVERT_VALUE_r21 },
+            { 1, 1, _CONVERT_VALUE_r31 },
         },
     },
     [_FORMAT_SIMPLE] = {
-        .best = { 1, 1, 1, 1 },
+        .best = { 1, 1, 2, 3 },
         .entries = {
             { -1, -1, -1 },
             { 1, 1, _FORMAT_SIMPLE_r11 },
-            { -1, -1, -1 },
-            { -1, -1, -1 },
+            { 1, 1, _FORMAT_SIMPLE_r21 },
+            { 1, 1, _FORMAT_SIMPLE_r31 },
         },
     },
     [_FORMAT_WITH_SPEC] = {
-        .best = { 2, 2, 2, 2 },
+        .best = { 2, 2, 2, 3 },
         .entries = {
             { -1, -1, -1 },
             { -1, -1, -1 },
             { 1, 2, _FORMAT_WITH_SPEC_r21 },
-            { -1, -1, -1 },
+            { 1, 2, _FORMAT_WITH_SPEC_r31 },
         },
     },
     [_COPY_1] = {
@@ -2937,12 +2977,12 @@ const _PyUopCachingInfo _PyUop_Caching[MAX_UOP_ID+1] = {
         },
     },
     [_BINARY_OP] = {
-        .best = { 2, 2, 2, 2 },
+        .best = { 2, 2, 2, 3 },
         .entries = {
             { -1, -1, -1 },
             { -1, -1, -1 },
             { 3, 2, _BINARY_OP_r23 },
-            { -1, -1, -1 },
+            { 3, 2, _BINARY_OP_r33 },
         },
     },
     [_SWAP_2] = {
@@ -3090,12 +3130,12 @@ const _PyUopCachingInfo _PyUop_Caching[MAX_UOP_ID+1] = {
         },
     },
     [_GUARD_IS_NOT_NONE_POP] = {
-        .best = { 1, 1, 1, 1 },
+        .best = { 1, 1, 2, 3 },
         .entries = {
             { -1, -1, -1 },
             { 0, 0, _GUARD_IS_NOT_NONE_POP_r10 },
-            { -1, -1, -1 },
-            { -1, -1, -1 },
+            { 0, 0, _GUARD_IS_NOT_NONE_POP_r20 },
+            { 0, 0, _GUARD_IS_NOT_NONE_POP_r30 },
         },
     },
     [_JUMP_TO_TOP] = {
@@ -3171,12 +3211,12 @@ const _PyUopCachingInfo _PyUop_Caching[MAX_UOP_ID+1] = {
         },
     },
     [_POP_TOP_LOAD_CONST_INLINE] = {
-        .best = { 1, 1, 1, 1 },
+        .best = { 1, 1, 2, 3 },
         .entries = {
             { -1, -1, -1 },
             { 1, 1, _POP_TOP_LOAD_CONST_INLINE_r11 },
-            { -1, -1, -1 },
-            { -1, -1, -1 },
+            { 1, 1, _POP_TOP_LOAD_CONST_INLINE_r21 },
+            { 1, 1, _POP_TOP_LOAD_CONST_INLINE_r31 },
         },
     },
     [_LOAD_CONST_INLINE_BORROW] = {
@@ -3189,12 +3229,12 @@ const _PyUopCachingInfo _PyUop_Caching[MAX_UOP_ID+1] = {
         },
     },
     [_POP_CALL] = {
-        .best = { 2, 2, 2, 2 },
+        .best = { 2, 2, 2, 3 },
         .entries = {
             { -1, -1, -1 },
             { -1, -1, -1 },
             { 0, 2, _POP_CALL_r20 },
-            { -1, -1, -1 },
+            { 0, 2, _POP_CALL_r30 },
         },
     },
     [_POP_CALL_ONE] = {
@@ -3216,30 +3256,30 @@ const _PyUopCachingInfo _PyUop_Caching[MAX_UOP_ID+1] = {
         },
     },
     [_POP_TOP_LOAD_CONST_INLINE_BORROW] = {
-        .best = { 1, 1, 1, 1 },
+        .best = { 1, 1, 2, 3 },
         .entries = {
             { -1, -1, -1 },
             { 1, 1, _POP_TOP_LOAD_CONST_INLINE_BORROW_r11 },
-            { -1, -1, -1 },
-            { -1, -1, -1 },
+            { 1, 1, _POP_TOP_LOAD_CONST_INLINE_BORROW_r21 },
+            { 1, 1, _POP_TOP_LOAD_CONST_INLINE_BORROW_r31 },
         },
     },
     [_POP_TWO_LOAD_CONST_INLINE_BORROW] = {
-        .best = { 2, 2, 2, 2 },
+        .best = { 2, 2, 2, 3 },
         .entries = {
             { -1, -1, -1 },
             { -1, -1, -1 },
             { 1, 2, _POP_TWO_LOAD_CONST_INLINE_BORROW_r21 },
-            { -1, -1, -1 },
+            { 1, 2, _POP_TWO_LOAD_CONST_INLINE_BORROW_r31 },
         },
     },
     [_POP_CALL_LOAD_CONST_INLINE_BORROW] = {
-        .best = { 2, 2, 2, 2 },
+        .best = { 2, 2, 2, 3 },
         .entries = {
             { -1, -1, -1 },
             { -1, -1, -1 },
             { 1, 2, _POP_CALL_LOAD_CONST_INLINE_BORROW_r21 },
-            { -1, -1, -1 },
+            { 1, 2, _POP_CALL_LOAD_CONST_INLINE_BORROW_r31 },
         },
     },
     [_POP_CALL_ONE_LOAD_CONST_INLINE_BORROW] = {
@@ -3457,7 +3497,13 @@ const uint16_t _PyUop_Uncached[MAX_UOP_REGS_ID+1] = {
     [_NOP_r22] = _NOP,
     [_NOP_r33] = _NOP,
     [_CHECK_PERIODIC_r00] = _CHECK_PERIODIC,
+    [_CHECK_PERIODIC_r10] = _CHECK_PERIODIC,
+    [_CHECK_PERIODIC_r20] = _CHECK_PERIODIC,
+    [_CHECK_PERIODIC_r30] = _CHECK_PERIODIC,
     [_CHECK_PERIODIC_IF_NOT_YIELD_FROM_r00] = _CHECK_PERIODIC_IF_NOT_YIELD_FROM,
+    [_CHECK_PERIODIC_IF_NOT_YIELD_FROM_r10] = _CHECK_PERIODIC_IF_NOT_YIELD_FROM,
+    [_CHECK_PERIODIC_IF_NOT_YIELD_FROM_r20] = _CHECK_PERIODIC_IF_NOT_YIELD_FROM,
+    [_CHECK_PERIODIC_IF_NOT_YIELD_FROM_r30] = _CHECK_PERIODIC_IF_NOT_YIELD_FROM,
     [_RESUME_CHECK_r00] = _RESUME_CHECK,
     [_RESUME_CHECK_r11] = _RESUME_CHECK,
     [_RESUME_CHECK_r22] = _RESUME_CHECK,
@@ -3577,6 +3623,8 @@ const uint16_t _PyUop_Uncached[MAX_UOP_REGS_ID+1] = {
     [_SWAP_FAST_r22] = _SWAP_FAST,
     [_SWAP_FAST_r33] = _SWAP_FAST,
     [_POP_TOP_r10] = _POP_TOP,
+    [_POP_TOP_r20] = _POP_TOP,
+    [_POP_TOP_r30] = _POP_TOP,
     [_POP_TOP_NOP_r00] = _POP_TOP_NOP,
     [_POP_TOP_NOP_r10] = _POP_TOP_NOP,
     [_POP_TOP_NOP_r21] = _POP_TOP_NOP,
@@ -3594,18 +3642,27 @@ const uint16_t _PyUop_Uncached[MAX_UOP_REGS_ID+1] = {
     [_POP_TOP_UNICODE_r21] = _POP_TOP_UNICODE,
     [_POP_TOP_UNICODE_r32] = _POP_TOP_UNICODE,
     [_POP_TWO_r20] = _POP_TWO,
+    [_POP_TWO_r30] = _POP_TWO,
     [_PUSH_NULL_r01] = _PUSH_NULL,
     [_PUSH_NULL_r12] = _PUSH_NULL,
     [_PUSH_NULL_r23] = _PUSH_NULL,
     [_END_FOR_r10] = _END_FOR,
+    [_END_FOR_r20] = _END_FOR,
+    [_END_FOR_r30] = _END_FOR,
     [_POP_ITER_r20] = _POP_ITER,
+    [_POP_ITER_r30] = _POP_ITER,
     [_END_SEND_r21] = _END_SEND,
+    [_END_SEND_r31] = _END_SEND,
     [_UNARY_NEGATIVE_r12] = _UNARY_NEGATIVE,
+    [_UNARY_NEGATIVE_r22] = _UNARY_NEGATIVE,
+    [_UNARY_NEGATIVE_r32] = _UNARY_NEGATIVE,
     [_UNARY_NOT_r01] = _UNARY_NOT,
     [_UNARY_NOT_r11] = _UNARY_NOT,
     [_UNARY_NOT_r22] = _UNARY_NOT,
     [_UNARY_NOT_r33] = _UNARY_NOT,
     [_TO_BOOL_r11] = _TO_BOOL,
+    [_TO_BOOL_r21] = _TO_BOOL,
+    [_TO_BOOL_r31] = _TO_BOOL,
     [_TO_BOOL_BOOL_r01] = _TO_BOOL_BOOL,
     [_TO_BOOL_BOOL_r11] = _TO_BOOL_BOOL,
     [_TO_BOOL_BOOL_r22] = _TO_BOOL_BOOL,
@@ -3651,6 +3708,8 @@ const uint16_t _PyUop_Uncached[MAX_UOP_REGS_ID+1] = {
     [_REPLACE_WITH_TRUE_r12] = _REPLACE_WITH_TRUE,
     [_REPLACE_WITH_TRUE_r23] = _REPLACE_WITH_TRUE,
     [_UNARY_INVERT_r12] = _UNARY_INVERT,
+    [_UNARY_INVERT_r22] = _UNARY_INVERT,
+    [_UNARY_INVERT_r32] = _UNARY_INVERT,
     [_GUARD_NOS_INT_r02] = _GUARD_NOS_INT,
     [_GUARD_NOS_INT_r12] = _GUARD_NOS_INT,
     [_GUARD_NOS_INT_r22] = _GUARD_NOS_INT,
@@ -3693,16 +3752,23 @@ const uint16_t _PyUop_Uncached[MAX_UOP_REGS_ID+1] = {
     [_BINARY_OP_SUBTRACT_FLOAT_r03] = _BINARY_OP_SUBTRACT_FLOAT,
     [_BINARY_OP_SUBTRACT_FLOAT_r13] = _BINARY_OP_SUBTRACT_FLOAT,
     [_BINARY_OP_SUBTRACT_FLOAT_r23] = _BINARY_OP_SUBTRACT_FLOAT,
+    [_BINARY_OP_ADD_FLOAT_INPLACE_r23] = _BINARY_OP_ADD_FLOAT_INPLACE,
+    [_BINARY_OP_SUBTRACT_FLOAT_INPLACE_r23] = _BINARY_OP_SUBTRACT_FLOAT_INPLACE,
+    [_BINARY_OP_MULTIPLY_FLOAT_INPLACE_r23] = _BINARY_OP_MULTIPLY_FLOAT_INPLACE,
     [_BINARY_OP_ADD_UNICODE_r03] = _BINARY_OP_ADD_UNICODE,
     [_BINARY_OP_ADD_UNICODE_r13] = _BINARY_OP_ADD_UNICODE,
     [_BINARY_OP_ADD_UNICODE_r23] = _BINARY_OP_ADD_UNICODE,
     [_BINARY_OP_INPLACE_ADD_UNICODE_r21] = _BINARY_OP_INPLACE_ADD_UNICODE,
+    [_BINARY_OP_INPLACE_ADD_UNICODE_DEREF_r21] = _BINARY_OP_INPLACE_ADD_UNICODE_DEREF,
     [_GUARD_BINARY_OP_EXTEND_r22] = _GUARD_BINARY_OP_EXTEND,
+    [_GUARD_BINARY_OP_EXTEND_r32] = _GUARD_BINARY_OP_EXTEND,
     [_BINARY_OP_EXTEND_r23] = _BINARY_OP_EXTEND,
+    [_BINARY_OP_EXTEND_r33] = _BINARY_OP_EXTEND,
     [_BINARY_SLICE_r31] = _BINARY_SLICE,
     [_STORE_SLICE_r30] = _STORE_SLICE,
     [_BINARY_OP_SUBSCR_LIST_INT_r23] = _BINARY_OP_SUBSCR_LIST_INT,
     [_BINARY_OP_SUBSCR_LIST_SLICE_r23] = _BINARY_OP_SUBSCR_LIST_SLICE,
+    [_BINARY_OP_SUBSCR_LIST_SLICE_r33] = _BINARY_OP_SUBSCR_LIST_SLICE,
     [_BINARY_OP_SUBSCR_STR_INT_r23] = _BINARY_OP_SUBSCR_STR_INT,
     [_BINARY_OP_SUBSCR_USTR_INT_r23] = _BINARY_OP_SUBSCR_USTR_INT,
     [_GUARD_NOS_TUPLE_r02] = _GUARD_NOS_TUPLE,
@@ -3729,6 +3795,7 @@ const uint16_t _PyUop_Uncached[MAX_UOP_REGS_ID+1] = {
     [_GUARD_TOS_DICT_r22] = _GUARD_TOS_DICT,
     [_GUARD_TOS_DICT_r33] = _GUARD_TOS_DICT,
     [_BINARY_OP_SUBSCR_DICT_r23] = _BINARY_OP_SUBSCR_DICT,
+    [_BINARY_OP_SUBSCR_DICT_r33] = _BINARY_OP_SUBSCR_DICT,
     [_BINARY_OP_SUBSCR_CHECK_FUNC_r23] = _BINARY_OP_SUBSCR_CHECK_FUNC,
     [_BINARY_OP_SUBSCR_INIT_CALL_r01] = _BINARY_OP_SUBSCR_INIT_CALL,
     [_BINARY_OP_SUBSCR_INIT_CALL_r11] = _BINARY_OP_SUBSCR_INIT_CALL,
@@ -3740,30 +3807,60 @@ const uint16_t _PyUop_Uncached[MAX_UOP_REGS_ID+1] = {
     [_STORE_SUBSCR_LIST_INT_r32] = _STORE_SUBSCR_LIST_INT,
     [_STORE_SUBSCR_DICT_r31] = _STORE_SUBSCR_DICT,
     [_DELETE_SUBSCR_r20] = _DELETE_SUBSCR,
+    [_DELETE_SUBSCR_r30] = _DELETE_SUBSCR,
     [_CALL_INTRINSIC_1_r11] = _CALL_INTRINSIC_1,
+    [_CALL_INTRINSIC_1_r21] = _CALL_INTRINSIC_1,
+    [_CALL_INTRINSIC_1_r31] = _CALL_INTRINSIC_1,
     [_CALL_INTRINSIC_2_r21] = _CALL_INTRINSIC_2,
+    [_CALL_INTRINSIC_2_r31] = _CALL_INTRINSIC_2,
     [_RETURN_VALUE_r11] = _RETURN_VALUE,
+    [_RETURN_VALUE_r21] = _RETURN_VALUE,
+    [_RETURN_VALUE_r31] = _RETURN_VALUE,
     [_GET_AITER_r11] = _GET_AITER,
     [_GET_ANEXT_r12] = _GET_ANEXT,
+    [_GET_ANEXT_r22] = _GET_ANEXT,
+    [_GET_ANEXT_r32] = _GET_ANEXT,
     [_GET_AWAITABLE_r11] = _GET_AWAITABLE,
+    [_GET_AWAITABLE_r21] = _GET_AWAITABLE,
+    [_GET_AWAITABLE_r31] = _GET_AWAITABLE,
     [_SEND_GEN_FRAME_r22] = _SEND_GEN_FRAME,
     [_YIELD_VALUE_r11] = _YIELD_VALUE,
     [_POP_EXCEPT_r10] = _POP_EXCEPT,
+    [_POP_EXCEPT_r20] = _POP_EXCEPT,
+    [_POP_EXCEPT_r30] = _POP_EXCEPT,
     [_LOAD_COMMON_CONSTANT_r01] = _LOAD_COMMON_CONSTANT,
     [_LOAD_COMMON_CONSTANT_r12] = _LOAD_COMMON_CONSTANT,
     [_LOAD_COMMON_CONSTANT_r23] = _LOAD_COMMON_CONSTANT,
     [_LOAD_BUILD_CLASS_r01] = _LOAD_BUILD_CLASS,
+    [_LOAD_BUILD_CLASS_r11] = _LOAD_BUILD_CLASS,
+    [_LOAD_BUILD_CLASS_r21] = _LOAD_BUILD_CLASS,
+    [_LOAD_BUILD_CLASS_r31] = _LOAD_BUILD_CLASS,
     [_STORE_NAME_r10] = _STORE_NAME,
+    [_STORE_NAME_r20] = _STORE_NAME,
+    [_STORE_NAME_r30] = _STORE_NAME,
     [_DELETE_NAME_r00] = _DELETE_NAME,
+    [_DELETE_NAME_r10] = _DELETE_NAME,
+    [_DELETE_NAME_r20] = _DELETE_NAME,
+    [_DELETE_NAME_r30] = _DELETE_NAME,
     [_UNPACK_SEQUENCE_r10] = _UNPACK_SEQUENCE,
     [_UNPACK_SEQUENCE_TWO_TUPLE_r12] = _UNPACK_SEQUENCE_TWO_TUPLE,
+    [_UNPACK_SEQUENCE_TWO_TUPLE_r22] = _UNPACK_SEQUENCE_TWO_TUPLE,
+    [_UNPACK_SEQUENCE_TWO_TUPLE_r32] = _UNPACK_SEQUENCE_TWO_TUPLE,
     [_UNPACK_SEQUENCE_TUPLE_r10] = _UNPACK_SEQUENCE_TUPLE,
     [_UNPACK_SEQUENCE_LIST_r10] = _UNPACK_SEQUENCE_LIST,
     [_UNPACK_EX_r10] = _UNPACK_EX,
     [_STORE_ATTR_r20] = _STORE_ATTR,
+    [_STORE_ATTR_r30] = _STORE_ATTR,
     [_DELETE_ATTR_r10] = _DELETE_ATTR,
+    [_DELETE_ATTR_r20] = _DELETE_ATTR,
+    [_DELETE_ATTR_r30] = _DELETE_ATTR,
     [_STORE_GLOBAL_r10] = _STORE_GLOBAL,
+    [_STORE_GLOBAL_r20] = _STORE_GLOBAL,
+    [_STORE_GLOBAL_r30] = _STORE_GLOBAL,
     [_DELETE_GLOBAL_r00] = _DELETE_GLOBAL,
+    [_DELETE_GLOBAL_r10] = _DELETE_GLOBAL,
+    [_DELETE_GLOBAL_r20] = _DELETE_GLOBAL,
+    [_DELETE_GLOBAL_r30] = _DELETE_GLOBAL,
     [_LOAD_LOCALS_r01] = _LOAD_LOCALS,
     [_LOAD_LOCALS_r12] = _LOAD_LOCALS,
     [_LOAD_LOCALS_r23] = _LOAD_LOCALS,
@@ -3777,11 +3874,25 @@ const uint16_t _PyUop_Uncached[MAX_UOP_REGS_ID+1] = {
     [_LOAD_GLOBAL_MODULE_r01] = _LOAD_GLOBAL_MODULE,
     [_LOAD_GLOBAL_BUILTINS_r01] = _LOAD_GLOBAL_BUILTINS,
     [_DELETE_FAST_r00] = _DELETE_FAST,
+    [_DELETE_FAST_r10] = _DELETE_FAST,
+    [_DELETE_FAST_r20] = _DELETE_FAST,
+    [_DELETE_FAST_r30] = _DELETE_FAST,
     [_MAKE_CELL_r00] = _MAKE_CELL,
+    [_MAKE_CELL_r10] = _MAKE_CELL,
+    [_MAKE_CELL_r20] = _MAKE_CELL,
+    [_MAKE_CELL_r30] = _MAKE_CELL,
     [_DELETE_DEREF_r00] = _DELETE_DEREF,
+    [_DELETE_DEREF_r10] = _DELETE_DEREF,
+    [_DELETE_DEREF_r20] = _DELETE_DEREF,
+    [_DELETE_DEREF_r30] = _DELETE_DEREF,
     [_LOAD_FROM_DICT_OR_DEREF_r11] = _LOAD_FROM_DICT_OR_DEREF,
     [_LOAD_DEREF_r01] = _LOAD_DEREF,
+    [_LOAD_DEREF_r11] = _LOAD_DEREF,
+    [_LOAD_DEREF_r21] = _LOAD_DEREF,
+    [_LOAD_DEREF_r31] = _LOAD_DEREF,
     [_STORE_DEREF_r10] = _STORE_DEREF,
+    [_STORE_DEREF_r20] = _STORE_DEREF,
+    [_STORE_DEREF_r30] = _STORE_DEREF,
     [_COPY_FREE_VARS_r00] = _COPY_FREE_VARS,
     [_COPY_FREE_VARS_r11] = _COPY_FREE_VARS,
     [_COPY_FREE_VARS_r22] = _COPY_FREE_VARS,
@@ -3789,6 +3900,7 @@ const uint16_t _PyUop_Uncached[MAX_UOP_REGS_ID+1] = {
     [_BUILD_STRING_r01] = _BUILD_STRING,
     [_BUILD_INTERPOLATION_r01] = _BUILD_INTERPOLATION,
     [_BUILD_TEMPLATE_r21] = _BUILD_TEMPLATE,
+    [_BUILD_TEMPLATE_r31] = _BUILD_TEMPLATE,
     [_BUILD_TUPLE_r01] = _BUILD_TUPLE,
     [_BUILD_LIST_r01] = _BUILD_LIST,
     [_LIST_EXTEND_r10] = _LIST_EXTEND,
@@ -3796,6 +3908,9 @@ const uint16_t _PyUop_Uncached[MAX_UOP_REGS_ID+1] = {
     [_BUILD_SET_r01] = _BUILD_SET,
     [_BUILD_MAP_r01] = _BUILD_MAP,
     [_SETUP_ANNOTATIONS_r00] = _SETUP_ANNOTATIONS,
+    [_SETUP_ANNOTATIONS_r10] = _SETUP_ANNOTATIONS,
+    [_SETUP_ANNOTATIONS_r20] = _SETUP_ANNOTATIONS,
+    [_SETUP_ANNOTATIONS_r30] = _SETUP_ANNOTATIONS,
     [_DICT_UPDATE_r10] = _DICT_UPDATE,
     [_DICT_MERGE_r10] = _DICT_MERGE,
     [_MAP_ADD_r20] = _MAP_ADD,
@@ -3827,15 +3942,20 @@ const uint16_t _PyUop_Uncached[MAX_UOP_REGS_ID+1] = {
     [_CHECK_ATTR_CLASS_r22] = _CHECK_ATTR_CLASS,
     [_CHECK_ATTR_CLASS_r33] = _CHECK_ATTR_CLASS,
     [_LOAD_ATTR_CLASS_r11] = _LOAD_ATTR_CLASS,
+    [_LOAD_ATTR_CLASS_r21] = _LOAD_ATTR_CLASS,
+    [_LOAD_ATTR_CLASS_r31] = _LOAD_ATTR_CLASS,
     [_LOAD_ATTR_PROPERTY_FRAME_r11] = _LOAD_ATTR_PROPERTY_FRAME,
     [_GUARD_DORV_NO_DICT_r01] = _GUARD_DORV_NO_DICT,
     [_GUARD_DORV_NO_DICT_r11] = _GUARD_DORV_NO_DICT,
     [_GUARD_DORV_NO_DICT_r22] = _GUARD_DORV_NO_DICT,
     [_GUARD_DORV_NO_DICT_r33] = _GUARD_DORV_NO_DICT,
     [_STORE_ATTR_INSTANCE_VALUE_r21] = _STORE_ATTR_INSTANCE_VALUE,
+    [_STORE_ATTR_INSTANCE_VALUE_r31] = _STORE_ATTR_INSTANCE_VALUE,
     [_STORE_ATTR_WITH_HINT_r21] = _STORE_ATTR_WITH_HINT,
     [_STORE_ATTR_SLOT_r21] = _STORE_ATTR_SLOT,
+    [_STORE_ATTR_SLOT_r31] = _STORE_ATTR_SLOT,
     [_COMPARE_OP_r21] = _COMPARE_OP,
+    [_COMPARE_OP_r31] = _COMPARE_OP,
     [_COMPARE_OP_FLOAT_r03] = _COMPARE_OP_FLOAT,
     [_COMPARE_OP_FLOAT_r13] = _COMPARE_OP_FLOAT,
     [_COMPARE_OP_FLOAT_r23] = _COMPARE_OP_FLOAT,
@@ -3845,18 +3965,29 @@ const uint16_t _PyUop_Uncached[MAX_UOP_REGS_ID+1] = {
     [_IS_OP_r13] = _IS_OP,
     [_IS_OP_r23] = _IS_OP,
     [_CONTAINS_OP_r23] = _CONTAINS_OP,
+    [_CONTAINS_OP_r33] = _CONTAINS_OP,
     [_GUARD_TOS_ANY_SET_r01] = _GUARD_TOS_ANY_SET,
     [_GUARD_TOS_ANY_SET_r11] = _GUARD_TOS_ANY_SET,
     [_GUARD_TOS_ANY_SET_r22] = _GUARD_TOS_ANY_SET,
     [_GUARD_TOS_ANY_SET_r33] = _GUARD_TOS_ANY_SET,
     [_CONTAINS_OP_SET_r23] = _CONTAINS_OP_SET,
+    [_CONTAINS_OP_SET_r33] = _CONTAINS_OP_SET,
     [_CONTAINS_OP_DICT_r23] = _CONTAINS_OP_DICT,
+    [_CONTAINS_OP_DICT_r33] = _CONTAINS_OP_DICT,
     [_CHECK_EG_MATCH_r22] = _CHECK_EG_MATCH,
     [_CHECK_EXC_MATCH_r22] = _CHECK_EXC_MATCH,
+    [_CHECK_EXC_MATCH_r32] = _CHECK_EXC_MATCH,
     [_IMPORT_NAME_r21] = _IMPORT_NAME,
+    [_IMPORT_NAME_r31] = _IMPORT_NAME,
     [_IMPORT_FROM_r12] = _IMPORT_FROM,
+    [_IMPORT_FROM_r22] = _IMPORT_FROM,
+    [_IMPORT_FROM_r32] = _IMPORT_FROM,
     [_IS_NONE_r11] = _IS_NONE,
+    [_IS_NONE_r21] = _IS_NONE,
+    [_IS_NONE_r31] = _IS_NONE,
     [_GET_LEN_r12] = _GET_LEN,
+    [_GET_LEN_r22] = _GET_LEN,
+    [_GET_LEN_r32] = _GET_LEN,
     [_MATCH_CLASS_r31] = _MATCH_CLASS,
     [_MATCH_MAPPING_r02] = _MATCH_MAPPING,
     [_MATCH_MAPPING_r12] = _MATCH_MAPPING,
@@ -3865,9 +3996,15 @@ const uint16_t _PyUop_Uncached[MAX_UOP_REGS_ID+1] = {
     [_MATCH_SEQUENCE_r12] = _MATCH_SEQUENCE,
     [_MATCH_SEQUENCE_r23] = _MATCH_SEQUENCE,
     [_MATCH_KEYS_r23] = _MATCH_KEYS,
+    [_MATCH_KEYS_r33] = _MATCH_KEYS,
     [_GET_ITER_r12] = _GET_ITER,
+    [_GET_ITER_r22] = _GET_ITER,
+    [_GET_ITER_r32] = _GET_ITER,
     [_GET_YIELD_FROM_ITER_r11] = _GET_YIELD_FROM_ITER,
+    [_GET_YIELD_FROM_ITER_r21] = _GET_YIELD_FROM_ITER,
+    [_GET_YIELD_FROM_ITER_r31] = _GET_YIELD_FROM_ITER,
     [_FOR_ITER_TIER_TWO_r23] = _FOR_ITER_TIER_TWO,
+    [_FOR_ITER_TIER_TWO_r33] = _FOR_ITER_TIER_TWO,
     [_ITER_CHECK_LIST_r02] = _ITER_CHECK_LIST,
     [_ITER_CHECK_LIST_r12] = _ITER_CHECK_LIST,
     [_ITER_CHECK_LIST_r22] = _ITER_CHECK_LIST,
@@ -3877,6 +4014,7 @@ const uint16_t _PyUop_Uncached[MAX_UOP_REGS_ID+1] = {
     [_GUARD_NOT_EXHAUSTED_LIST_r22] = _GUARD_NOT_EXHAUSTED_LIST,
     [_GUARD_NOT_EXHAUSTED_LIST_r33] = _GUARD_NOT_EXHAUSTED_LIST,
     [_ITER_NEXT_LIST_TIER_TWO_r23] = _ITER_NEXT_LIST_TIER_TWO,
+    [_ITER_NEXT_LIST_TIER_TWO_r33] = _ITER_NEXT_LIST_TIER_TWO,
     [_ITER_CHECK_TUPLE_r02] = _ITER_CHECK_TUPLE,
     [_ITER_CHECK_TUPLE_r12] = _ITER_CHECK_TUPLE,
     [_ITER_CHECK_TUPLE_r22] = _ITER_CHECK_TUPLE,
@@ -3923,7 +4061,11 @@ const uint16_t _PyUop_Uncached[MAX_UOP_REGS_ID+1] = {
     [_LOAD_ATTR_METHOD_NO_DICT_r12] = _LOAD_ATTR_METHOD_NO_DICT,
     [_LOAD_ATTR_METHOD_NO_DICT_r23] = _LOAD_ATTR_METHOD_NO_DICT,
     [_LOAD_ATTR_NONDESCRIPTOR_WITH_VALUES_r11] = _LOAD_ATTR_NONDESCRIPTOR_WITH_VALUES,
+    [_LOAD_ATTR_NONDESCRIPTOR_WITH_VALUES_r21] = _LOAD_ATTR_NONDESCRIPTOR_WITH_VALUES,
+    [_LOAD_ATTR_NONDESCRIPTOR_WITH_VALUES_r31] = _LOAD_ATTR_NONDESCRIPTOR_WITH_VALUES,
     [_LOAD_ATTR_NONDESCRIPTOR_NO_DICT_r11] = _LOAD_ATTR_NONDESCRIPTOR_NO_DICT,
+    [_LOAD_ATTR_NONDESCRIPTOR_NO_DICT_r21] = _LOAD_ATTR_NONDESCRIPTOR_NO_DICT,
+    [_LOAD_ATTR_NONDESCRIPTOR_NO_DICT_r31] = _LOAD_ATTR_NONDESCRIPTOR_NO_DICT,
     [_CHECK_ATTR_METHOD_LAZY_DICT_r01] = _CHECK_ATTR_METHOD_LAZY_DICT,
     [_CHECK_ATTR_METHOD_LAZY_DICT_r11] = _CHECK_ATTR_METHOD_LAZY_DICT,
     [_CHECK_ATTR_METHOD_LAZY_DICT_r22] = _CHECK_ATTR_METHOD_LAZY_DICT,
@@ -3994,6 +4136,8 @@ const uint16_t _PyUop_Uncached[MAX_UOP_REGS_ID+1] = {
     [_CHECK_AND_ALLOCATE_OBJECT_r00] = _CHECK_AND_ALLOCATE_OBJECT,
     [_CREATE_INIT_FRAME_r01] = _CREATE_INIT_FRAME,
     [_EXIT_INIT_CHECK_r10] = _EXIT_INIT_CHECK,
+    [_EXIT_INIT_CHECK_r20] = _EXIT_INIT_CHECK,
+    [_EXIT_INIT_CHECK_r30] = _EXIT_INIT_CHECK,
     [_CALL_BUILTIN_CLASS_r01] = _CALL_BUILTIN_CLASS,
     [_CALL_BUILTIN_O_r03] = _CALL_BUILTIN_O,
     [_CALL_BUILTIN_FAST_r01] = _CALL_BUILTIN_FAST,
@@ -4039,6 +4183,8 @@ const uint16_t _PyUop_Uncached[MAX_UOP_REGS_ID+1] = {
     [_CHECK_IS_NOT_PY_CALLABLE_EX_r33] = _CHECK_IS_NOT_PY_CALLABLE_EX,
     [_CALL_FUNCTION_EX_NON_PY_GENERAL_r31] = _CALL_FUNCTION_EX_NON_PY_GENERAL,
     [_MAKE_FUNCTION_r11] = _MAKE_FUNCTION,
+    [_MAKE_FUNCTION_r21] = _MAKE_FUNCTION,
+    [_MAKE_FUNCTION_r31] = _MAKE_FUNCTION,
     [_SET_FUNCTION_ATTRIBUTE_r01] = _SET_FUNCTION_ATTRIBUTE,
     [_SET_FUNCTION_ATTRIBUTE_r11] = _SET_FUNCTION_ATTRIBUTE,
     [_SET_FUNCTION_ATTRIBUTE_r21] = _SET_FUNCTION_ATTRIBUTE,
@@ -4046,8 +4192,13 @@ const uint16_t _PyUop_Uncached[MAX_UOP_REGS_ID+1] = {
     [_RETURN_GENERATOR_r01] = _RETURN_GENERATOR,
     [_BUILD_SLICE_r01] = _BUILD_SLICE,
     [_CONVERT_VALUE_r11] = _CONVERT_VALUE,
+    [_CONVERT_VALUE_r21] = _CONVERT_VALUE,
+    [_CONVERT_VALUE_r31] = _CONVERT_VALUE,
     [_FORMAT_SIMPLE_r11] = _FORMAT_SIMPLE,
+    [_FORMAT_SIMPLE_r21] = _FORMAT_SIMPLE,
+    [_FORMAT_SIMPLE_r31] = _FORMAT_SIMPLE,
     [_FORMAT_WITH_SPEC_r21] = _FORMAT_WITH_SPEC,
+    [_FORMAT_WITH_SPEC_r31] = _FORMAT_WITH_SPEC,
     [_COPY_1_r02] = _COPY_1,
     [_COPY_1_r12] = _COPY_1,
     [_COPY_1_r23] = _COPY_1,
@@ -4060,6 +4211,7 @@ const uint16_t _PyUop_Uncached[MAX_UOP_REGS_ID+1] = {
     [_COPY_3_r33] = _COPY_3,
     [_COPY_r01] = _COPY,
     [_BINARY_OP_r23] = _BINARY_OP,
+    [_BINARY_OP_r33] = _BINARY_OP,
     [_SWAP_2_r02] = _SWAP_2,
     [_SWAP_2_r12] = _SWAP_2,
     [_SWAP_2_r22] = _SWAP_2,
@@ -4122,6 +4274,8 @@ const uint16_t _PyUop_Uncached[MAX_UOP_REGS_ID+1] = {
     [_GUARD_IS_NONE_POP_r21] = _GUARD_IS_NONE_POP,
     [_GUARD_IS_NONE_POP_r32] = _GUARD_IS_NONE_POP,
     [_GUARD_IS_NOT_NONE_POP_r10] = _GUARD_IS_NOT_NONE_POP,
+    [_GUARD_IS_NOT_NONE_POP_r20] = _GUARD_IS_NOT_NONE_POP,
+    [_GUARD_IS_NOT_NONE_POP_r30] = _GUARD_IS_NOT_NONE_POP,
     [_JUMP_TO_TOP_r00] = _JUMP_TO_TOP,
     [_SET_IP_r00] = _SET_IP,
     [_SET_IP_r11] = _SET_IP,
@@ -4151,15 +4305,22 @@ const uint16_t _PyUop_Uncached[MAX_UOP_REGS_ID+1] = {
     [_LOAD_CONST_INLINE_r12] = _LOAD_CONST_INLINE,
     [_LOAD_CONST_INLINE_r23] = _LOAD_CONST_INLINE,
     [_POP_TOP_LOAD_CONST_INLINE_r11] = _POP_TOP_LOAD_CONST_INLINE,
+    [_POP_TOP_LOAD_CONST_INLINE_r21] = _POP_TOP_LOAD_CONST_INLINE,
+    [_POP_TOP_LOAD_CONST_INLINE_r31] = _POP_TOP_LOAD_CONST_INLINE,
     [_LOAD_CONST_INLINE_BORROW_r01] = _LOAD_CONST_INLINE_BORROW,
     [_LOAD_CONST_INLINE_BORROW_r12] = _LOAD_CONST_INLINE_BORROW,
     [_LOAD_CONST_INLINE_BORROW_r23] = _LOAD_CONST_INLINE_BORROW,
     [_POP_CALL_r20] = _POP_CALL,
+    [_POP_CALL_r30] = _POP_CALL,
     [_POP_CALL_ONE_r30] = _POP_CALL_ONE,
     [_POP_CALL_TWO_r30] = _POP_CALL_TWO,
     [_POP_TOP_LOAD_CONST_INLINE_BORROW_r11] = _POP_TOP_LOAD_CONST_INLINE_BORROW,
+    [_POP_TOP_LOAD_CONST_INLINE_BORROW_r21] = _POP_TOP_LOAD_CONST_INLINE_BORROW,
+    [_POP_TOP_LOAD_CONST_INLINE_BORROW_r31] = _POP_TOP_LOAD_CONST_INLINE_BORROW,
     [_POP_TWO_LOAD_CONST_INLINE_BORROW_r21] = _POP_TWO_LOAD_CONST_INLINE_BORROW,
+    [_POP_TWO_LOAD_CONST_INLINE_BORROW_r31] = _POP_TWO_LOAD_CONST_INLINE_BORROW,
     [_POP_CALL_LOAD_CONST_INLINE_BORROW_r21] = _POP_CALL_LOAD_CONST_INLINE_BORROW,
+    [_POP_CALL_LOAD_CONST_INLINE_BORROW_r31] = _POP_CALL_LOAD_CONST_INLINE_BORROW,
     [_POP_CALL_ONE_LOAD_CONST_INLINE_BORROW_r31] = _POP_CALL_ONE_LOAD_CONST_INLINE_BORROW,
     [_INSERT_1_LOAD_CONST_INLINE_r02] = _INSERT_1_LOAD_CONST_INLINE,
     [_INSERT_1_LOAD_CONST_INLINE_r12] = _INSERT_1_LOAD_CONST_INLINE,
@@ -4261,10 +4422,13 @@ const uint16_t _PyUop_SpillsAndReloads[4][4] = {
 const char *const _PyOpcode_uop_name[MAX_UOP_REGS_ID+1] = {
     [_BINARY_OP] = "_BINARY_OP",
     [_BINARY_OP_r23] = "_BINARY_OP_r23",
+    [_BINARY_OP_r33] = "_BINARY_OP_r33",
     [_BINARY_OP_ADD_FLOAT] = "_BINARY_OP_ADD_FLOAT",
     [_BINARY_OP_ADD_FLOAT_r03] = "_BINARY_OP_ADD_FLOAT_r03",
     [_BINARY_OP_ADD_FLOAT_r13] = "_BINARY_OP_ADD_FLOAT_r13",
     [_BINARY_OP_ADD_FLOAT_r23] = "_BINARY_OP_ADD_FLOAT_r23",
+    [_BINARY_OP_ADD_FLOAT_INPLACE] = "_BINARY_OP_ADD_FLOAT_INPLACE",
+    [_BINARY_OP_ADD_FLOAT_INPLACE_r23] = "_BINARY_OP_ADD_FLOAT_INPLACE_r23",
     [_BINARY_OP_ADD_INT] = "_BINARY_OP_ADD_INT",
     [_BINARY_OP_ADD_INT_r03] = "_BINARY_OP_ADD_INT_r03",
     [_BINARY_OP_ADD_INT_r13] = "_BINARY_OP_ADD_INT_r13",
@@ -4275,12 +4439,17 @@ const char *const _PyOpcode_uop_name[MAX_UOP_REGS_ID+1] = {
     [_BINARY_OP_ADD_UNICODE_r23] = "_BINARY_OP_ADD_UNICODE_r23",
     [_BINARY_OP_EXTEND] = "_BINARY_OP_EXTEND",
     [_BINARY_OP_EXTEND_r23] = "_BINARY_OP_EXTEND_r23",
+    [_BINARY_OP_EXTEND_r33] = "_BINARY_OP_EXTEND_r33",
     [_BINARY_OP_INPLACE_ADD_UNICODE] = "_BINARY_OP_INPLACE_ADD_UNICODE",
     [_BINARY_OP_INPLACE_ADD_UNICODE_r21] = "_BINARY_OP_INPLACE_ADD_UNICODE_r21",
+    [_BINARY_OP_INPLACE_ADD_UNICODE_DEREF] = "_BINARY_OP_INPLACE_ADD_UNICODE_DEREF",
+    [_BINARY_OP_INPLACE_ADD_UNICODE_DEREF_r21] = "_BINARY_OP_INPLACE_ADD_UNICODE_DEREF_r21",
     [_BINARY_OP_MULTIPLY_FLOAT] = "_BINARY_OP_MULTIPLY_FLOAT",
     [_BINARY_OP_MULTIPLY_FLOAT_r03] = "_BINARY_OP_MULTIPLY_FLOAT_r03",
     [_BINARY_OP_MULTIPLY_FLOAT_r13] = "_BINARY_OP_MULTIPLY_FLOAT_r13",
     [_BINARY_OP_MULTIPLY_FLOAT_r23] = "_BINARY_OP_MULTIPLY_FLOAT_r23",
+    [_BINARY_OP_MULTIPLY_FLOAT_INPLACE] = "_BINARY_OP_MULTIPLY_FLOAT_INPLACE",
+    [_BINARY_OP_MULTIPLY_FLOAT_INPLACE_r23] = "_BINARY_OP_MULTIPLY_FLOAT_INPLACE_r23",
     [_BINARY_OP_MULTIPLY_INT] = "_BINARY_OP_MULTIPLY_INT",
     [_BINARY_OP_MULTIPLY_INT_r03] = "_BINARY_OP_MULTIPLY_INT_r03",
     [_BINARY_OP_MULTIPLY_INT_r13] = "_BINARY_OP_MULTIPLY_INT_r13",
@@ -4289,6 +4458,7 @@ const char *const _PyOpcode_uop_name[MAX_UOP_REGS_ID+1] = {
     [_BINARY_OP_SUBSCR_CHECK_FUNC_r23] = "_BINARY_OP_SUBSCR_CHECK_FUNC_r23",
     [_BINARY_OP_SUBSCR_DICT] = "_BINARY_OP_SUBSCR_DICT",
     [_BINARY_OP_SUBSCR_DICT_r23] = "_BINARY_OP_SUBSCR_DICT_r23",
+    [_BINARY_OP_SUBSCR_DICT_r33] = "_BINARY_OP_SUBSCR_DICT_r33",
     [_BINARY_OP_SUBSCR_INIT_CALL] = "_BINARY_OP_SUBSCR_INIT_CALL",
     [_BINARY_OP_SUBSCR_INIT_CALL_r01] = "_BINARY_OP_SUBSCR_INIT_CALL_r01",
     [_BINARY_OP_SUBSCR_INIT_CALL_r11] = "_BINARY_OP_SUBSCR_INIT_CALL_r11",
@@ -4298,6 +4468,7 @@ const char *const _PyOpcode_uop_name[MAX_UOP_REGS_ID+1] = {
     [_BINARY_OP_SUBSCR_LIST_INT_r23] = "_BINARY_OP_SUBSCR_LIST_INT_r23",
     [_BINARY_OP_SUBSCR_LIST_SLICE] = "_BINARY_OP_SUBSCR_LIST_SLICE",
     [_BINARY_OP_SUBSCR_LIST_SLICE_r23] = "_BINARY_OP_SUBSCR_LIST_SLICE_r23",
+    [_BINARY_OP_SUBSCR_LIST_SLICE_r33] = "_BINARY_OP_SUBSCR_LIST_SLICE_r33",
     [_BINARY_OP_SUBSCR_STR_INT] = "_BINARY_OP_SUBSCR_STR_INT",
     [_BINARY_OP_SUBSCR_STR_INT_r23] = "_BINARY_OP_SUBSCR_STR_INT_r23",
     [_BINARY_OP_SUBSCR_TUPLE_INT] = "_BINARY_OP_SUBSCR_TUPLE_INT",
@@ -4310,6 +4481,8 @@ const char *const _PyOpcode_uop_name[MAX_UOP_REGS_ID+1] = {
     [_BINARY_OP_SUBTRACT_FLOAT_r03] = "_BINARY_OP_SUBTRACT_FLOAT_r03",
     [_BINARY_OP_SUBTRACT_FLOAT_r13] = "_BINARY_OP_SUBTRACT_FLOAT_r13",
     [_BINARY_OP_SUBTRACT_FLOAT_r23] = "_BINARY_OP_SUBTRACT_FLOAT_r23",
+    [_BINARY_OP_SUBTRACT_FLOAT_INPLACE] = "_BINARY_OP_SUBTRACT_FLOAT_INPLACE",
+    [_BINARY_OP_SUBTRACT_FLOAT_INPLACE_r23] = "_BINARY_OP_SUBTRACT_FLOAT_INPLACE_r23",
     [_BINARY_OP_SUBTRACT_INT] = "_BINARY_OP_SUBTRACT_INT",
     [_BINARY_OP_SUBTRACT_INT_r03] = "_BINARY_OP_SUBTRACT_INT_r03",
     [_BINARY_OP_SUBTRACT_INT_r13] = "_BINARY_OP_SUBTRACT_INT_r13",
@@ -4330,6 +4503,7 @@ const char *const _PyOpcode_uop_name[MAX_UOP_REGS_ID+1] = {
     [_BUILD_STRING_r01] = "_BUILD_STRING_r01",
     [_BUILD_TEMPLATE] = "_BUILD_TEMPLATE",
     [_BUILD_TEMPLATE_r21] = "_BUILD_TEMPLATE_r21",
+    [_BUILD_TEMPLATE_r31] = "_BUILD_TEMPLATE_r31",
     [_BUILD_TUPLE] = "_BUILD_TUPLE",
     [_BUILD_TUPLE_r01] = "_BUILD_TUPLE_r01",
     [_CALL_BUILTIN_CLASS] = "_CALL_BUILTIN_CLASS",
@@ -4344,8 +4518,11 @@ const char *const _PyOpcode_uop_name[MAX_UOP_REGS_ID+1] = {
     [_CALL_FUNCTION_EX_NON_PY_GENERAL_r31] = "_CALL_FUNCTION_EX_NON_PY_GENERAL_r31",
     [_CALL_INTRINSIC_1] = "_CALL_INTRINSIC_1",
     [_CALL_INTRINSIC_1_r11] = "_CALL_INTRINSIC_1_r11",
+    [_CALL_INTRINSIC_1_r21] = "_CALL_INTRINSIC_1_r21",
+    [_CALL_INTRINSIC_1_r31] = "_CALL_INTRINSIC_1_r31",
     [_CALL_INTRINSIC_2] = "_CALL_INTRINSIC_2",
     [_CALL_INTRINSIC_2_r21] = "_CALL_INTRINSIC_2_r21",
+    [_CALL_INTRINSIC_2_r31] = "_CALL_INTRINSIC_2_r31",
     [_CALL_ISINSTANCE] = "_CALL_ISINSTANCE",
     [_CALL_ISINSTANCE_r31] = "_CALL_ISINSTANCE_r31",
     [_CALL_KW_NON_PY] = "_CALL_KW_NON_PY",
@@ -4394,6 +4571,7 @@ const char *const _PyOpcode_uop_name[MAX_UOP_REGS_ID+1] = {
     [_CHECK_EG_MATCH_r22] = "_CHECK_EG_MATCH_r22",
     [_CHECK_EXC_MATCH] = "_CHECK_EXC_MATCH",
     [_CHECK_EXC_MATCH_r22] = "_CHECK_EXC_MATCH_r22",
+    [_CHECK_EXC_MATCH_r32] = "_CHECK_EXC_MATCH_r32",
     [_CHECK_FUNCTION_EXACT_ARGS] = "_CHECK_FUNCTION_EXACT_ARGS",
     [_CHECK_FUNCTION_EXACT_ARGS_r00] = "_CHECK_FUNCTION_EXACT_ARGS_r00",
     [_CHECK_FUNCTION_VERSION] = "_CHECK_FUNCTION_VERSION",
@@ -4435,8 +4613,14 @@ const char *const _PyOpcode_uop_name[MAX_UOP_REGS_ID+1] = {
     [_CHECK_PEP_523_r33] = "_CHECK_PEP_523_r33",
     [_CHECK_PERIODIC] = "_CHECK_PERIODIC",
     [_CHECK_PERIODIC_r00] = "_CHECK_PERIODIC_r00",
+    [_CHECK_PERIODIC_r10] = "_CHECK_PERIODIC_r10",
+    [_CHECK_PERIODIC_r20] = "_CHECK_PERIODIC_r20",
+    [_CHECK_PERIODIC_r30] = "_CHECK_PERIODIC_r30",
     [_CHECK_PERIODIC_IF_NOT_YIELD_FROM] = "_CHECK_PERIODIC_IF_NOT_YIELD_FROM",
     [_CHECK_PERIODIC_IF_NOT_YIELD_FROM_r00] = "_CHECK_PERIODIC_IF_NOT_YIELD_FROM_r00",
+    [_CHECK_PERIODIC_IF_NOT_YIELD_FROM_r10] = "_CHECK_PERIODIC_IF_NOT_YIELD_FROM_r10",
+    [_CHECK_PERIODIC_IF_NOT_YIELD_FROM_r20] = "_CHECK_PERIODIC_IF_NOT_YIELD_FROM_r20",
+    [_CHECK_PERIODIC_IF_NOT_YIELD_FROM_r30] = "_CHECK_PERIODIC_IF_NOT_YIELD_FROM_r30",
     [_CHECK_RECURSION_REMAINING] = "_CHECK_RECURSION_REMAINING",
     [_CHECK_RECURSION_REMAINING_r00] = "_CHECK_RECURSION_REMAINING_r00",
     [_CHECK_RECURSION_REMAINING_r11] = "_CHECK_RECURSION_REMAINING_r11",
@@ -4460,6 +4644,7 @@ const char *const _PyOpcode_uop_name[MAX_UOP_REGS_ID+1] = {
     [_COLD_EXIT_r00] = "_COLD_EXIT_r00",
     [_COMPARE_OP] = "_COMPARE_OP",
     [_COMPARE_OP_r21] = "_COMPARE_OP_r21",
+    [_COMPARE_OP_r31] = "_COMPARE_OP_r31",
     [_COMPARE_OP_FLOAT] = "_COMPARE_OP_FLOAT",
     [_COMPARE_OP_FLOAT_r03] = "_COMPARE_OP_FLOAT_r03",
     [_COMPARE_OP_FLOAT_r13] = "_COMPARE_OP_FLOAT_r13",
@@ -4470,12 +4655,17 @@ const char *const _PyOpcode_uop_name[MAX_UOP_REGS_ID+1] = {
     [_COMPARE_OP_STR_r23] = "_COMPARE_OP_STR_r23",
     [_CONTAINS_OP] = "_CONTAINS_OP",
     [_CONTAINS_OP_r23] = "_CONTAINS_OP_r23",
+    [_CONTAINS_OP_r33] = "_CONTAINS_OP_r33",
     [_CONTAINS_OP_DICT] = "_CONTAINS_OP_DICT",
     [_CONTAINS_OP_DICT_r23] = "_CONTAINS_OP_DICT_r23",
+    [_CONTAINS_OP_DICT_r33] = "_CONTAINS_OP_DICT_r33",
     [_CONTAINS_OP_SET] = "_CONTAINS_OP_SET",
     [_CONTAINS_OP_SET_r23] = "_CONTAINS_OP_SET_r23",
+    [_CONTAINS_OP_SET_r33] = "_CONTAINS_OP_SET_r33",
     [_CONVERT_VALUE] = "_CONVERT_VALUE",
     [_CONVERT_VALUE_r11] = "_CONVERT_VALUE_r11",
+    [_CONVERT_VALUE_r21] = "_CONVERT_VALUE_r21",
+    [_CONVERT_VALUE_r31] = "_CONVERT_VALUE_r31",
     [_COPY] = "_COPY",
     [_COPY_r01] = "_COPY_r01",
     [_COPY_1] = "_COPY_1",
@@ -4500,16 +4690,31 @@ const char *const _PyOpcode_uop_name[MAX_UOP_REGS_ID+1] = {
     [_CREATE_INIT_FRAME_r01] = "_CREATE_INIT_FRAME_r01",
     [_DELETE_ATTR] = "_DELETE_ATTR",
     [_DELETE_ATTR_r10] = "_DELETE_ATTR_r10",
+    [_DELETE_ATTR_r20] = "_DELETE_ATTR_r20",
+    [_DELETE_ATTR_r30] = "_DELETE_ATTR_r30",
     [_DELETE_DEREF] = "_DELETE_DEREF",
     [_DELETE_DEREF_r00] = "_DELETE_DEREF_r00",
+    [_DELETE_DEREF_r10] = "_DELETE_DEREF_r10",
+    [_DELETE_DEREF_r20] = "_DELETE_DEREF_r20",
+    [_DELETE_DEREF_r30] = "_DELETE_DEREF_r30",
     [_DELETE_FAST] = "_DELETE_FAST",
     [_DELETE_FAST_r00] = "_DELETE_FAST_r00",
+    [_DELETE_FAST_r10] = "_DELETE_FAST_r10",
+    [_DELETE_FAST_r20] = "_DELETE_FAST_r20",
+    [_DELETE_FAST_r30] = "_DELETE_FAST_r30",
     [_DELETE_GLOBAL] = "_DELETE_GLOBAL",
     [_DELETE_GLOBAL_r00] = "_DELETE_GLOBAL_r00",
+    [_DELETE_GLOBAL_r10] = "_DELETE_GLOBAL_r10",
+    [_DELETE_GLOBAL_r20] = "_DELETE_GLOBAL_r20",
+    [_DELETE_GLOBAL_r30] = "_DELETE_GLOBAL_r30",
     [_DELETE_NAME] = "_DELETE_NAME",
     [_DELETE_NAME_r00] = "_DELETE_NAME_r00",
+    [_DELETE_NAME_r10] = "_DELETE_NAME_r10",
+    [_DELETE_NAME_r20] = "_DELETE_NAME_r20",
+    [_DELETE_NAME_r30] = "_DELETE_NAME_r30",
     [_DELETE_SUBSCR] = "_DELETE_SUBSCR",
     [_DELETE_SUBSCR_r20] = "_DELETE_SUBSCR_r20",
+    [_DELETE_SUBSCR_r30] = "_DELETE_SUBSCR_r30",
     [_DEOPT] = "_DEOPT",
     [_DEOPT_r00] = "_DEOPT_r00",
     [_DEOPT_r10] = "_DEOPT_r10",
@@ -4526,12 +4731,17 @@ const char *const _PyOpcode_uop_name[MAX_UOP_REGS_ID+1] = {
     [_DYNAMIC_EXIT_r30] = "_DYNAMIC_EXIT_r30",
     [_END_FOR] = "_END_FOR",
     [_END_FOR_r10] = "_END_FOR_r10",
+    [_END_FOR_r20] = "_END_FOR_r20",
+    [_END_FOR_r30] = "_END_FOR_r30",
     [_END_SEND] = "_END_SEND",
     [_END_SEND_r21] = "_END_SEND_r21",
+    [_END_SEND_r31] = "_END_SEND_r31",
     [_ERROR_POP_N] = "_ERROR_POP_N",
     [_ERROR_POP_N_r00] = "_ERROR_POP_N_r00",
     [_EXIT_INIT_CHECK] = "_EXIT_INIT_CHECK",
     [_EXIT_INIT_CHECK_r10] = "_EXIT_INIT_CHECK_r10",
+    [_EXIT_INIT_CHECK_r20] = "_EXIT_INIT_CHECK_r20",
+    [_EXIT_INIT_CHECK_r30] = "_EXIT_INIT_CHECK_r30",
     [_EXIT_TRACE] = "_EXIT_TRACE",
     [_EXIT_TRACE_r00] = "_EXIT_TRACE_r00",
     [_EXIT_TRACE_r10] = "_EXIT_TRACE_r10",
@@ -4548,28 +4758,43 @@ const char *const _PyOpcode_uop_name[MAX_UOP_REGS_ID+1] = {
     [_FATAL_ERROR_r33] = "_FATAL_ERROR_r33",
     [_FORMAT_SIMPLE] = "_FORMAT_SIMPLE",
     [_FORMAT_SIMPLE_r11] = "_FORMAT_SIMPLE_r11",
+    [_FORMAT_SIMPLE_r21] = "_FORMAT_SIMPLE_r21",
+    [_FORMAT_SIMPLE_r31] = "_FORMAT_SIMPLE_r31",
     [_FORMAT_WITH_SPEC] = "_FORMAT_WITH_SPEC",
     [_FORMAT_WITH_SPEC_r21] = "_FORMAT_WITH_SPEC_r21",
+    [_FORMAT_WITH_SPEC_r31] = "_FORMAT_WITH_SPEC_r31",
     [_FOR_ITER_GEN_FRAME] = "_FOR_ITER_GEN_FRAME",
     [_FOR_ITER_GEN_FRAME_r03] = "_FOR_ITER_GEN_FRAME_r03",
     [_FOR_ITER_GEN_FRAME_r13] = "_FOR_ITER_GEN_FRAME_r13",
     [_FOR_ITER_GEN_FRAME_r23] = "_FOR_ITER_GEN_FRAME_r23",
     [_FOR_ITER_TIER_TWO] = "_FOR_ITER_TIER_TWO",
     [_FOR_ITER_TIER_TWO_r23] = "_FOR_ITER_TIER_TWO_r23",
+    [_FOR_ITER_TIER_TWO_r33] = "_FOR_ITER_TIER_TWO_r33",
     [_GET_AITER] = "_GET_AITER",
     [_GET_AITER_r11] = "_GET_AITER_r11",
     [_GET_ANEXT] = "_GET_ANEXT",
     [_GET_ANEXT_r12] = "_GET_ANEXT_r12",
+    [_GET_ANEXT_r22] = "_GET_ANEXT_r22",
+    [_GET_ANEXT_r32] = "_GET_ANEXT_r32",
     [_GET_AWAITABLE] = "_GET_AWAITABLE",
     [_GET_AWAITABLE_r11] = "_GET_AWAITABLE_r11",
+    [_GET_AWAITABLE_r21] = "_GET_AWAITABLE_r21",
+    [_GET_AWAITABLE_r31] = "_GET_AWAITABLE_r31",
     [_GET_ITER] = "_GET_ITER",
     [_GET_ITER_r12] = "_GET_ITER_r12",
+    [_GET_ITER_r22] = "_GET_ITER_r22",
+    [_GET_ITER_r32] = "_GET_ITER_r32",
     [_GET_LEN] = "_GET_LEN",
     [_GET_LEN_r12] = "_GET_LEN_r12",
+    [_GET_LEN_r22] = "_GET_LEN_r22",
+    [_GET_LEN_r32] = "_GET_LEN_r32",
     [_GET_YIELD_FROM_ITER] = "_GET_YIELD_FROM_ITER",
     [_GET_YIELD_FROM_ITER_r11] = "_GET_YIELD_FROM_ITER_r11",
+    [_GET_YIELD_FROM_ITER_r21] = "_GET_YIELD_FROM_ITER_r21",
+    [_GET_YIELD_FROM_ITER_r31] = "_GET_YIELD_FROM_ITER_r31",
     [_GUARD_BINARY_OP_EXTEND] = "_GUARD_BINARY_OP_EXTEND",
     [_GUARD_BINARY_OP_EXTEND_r22] = "_GUARD_BINARY_OP_EXTEND_r22",
+    [_GUARD_BINARY_OP_EXTEND_r32] = "_GUARD_BINARY_OP_EXTEND_r32",
     [_GUARD_BINARY_OP_SUBSCR_TUPLE_INT_BOUNDS] = "_GUARD_BINARY_OP_SUBSCR_TUPLE_INT_BOUNDS",
     [_GUARD_BINARY_OP_SUBSCR_TUPLE_INT_BOUNDS_r02] = "_GUARD_BINARY_OP_SUBSCR_TUPLE_INT_BOUNDS_r02",
     [_GUARD_BINARY_OP_SUBSCR_TUPLE_INT_BOUNDS_r12] = "_GUARD_BINARY_OP_SUBSCR_TUPLE_INT_BOUNDS_r12",
@@ -4707,6 +4932,8 @@ const char *const _PyOpcode_uop_name[MAX_UOP_REGS_ID+1] = {
     [_GUARD_IS_NONE_POP_r32] = "_GUARD_IS_NONE_POP_r32",
     [_GUARD_IS_NOT_NONE_POP] = "_GUARD_IS_NOT_NONE_POP",
     [_GUARD_IS_NOT_NONE_POP_r10] = "_GUARD_IS_NOT_NONE_POP_r10",
+    [_GUARD_IS_NOT_NONE_POP_r20] = "_GUARD_IS_NOT_NONE_POP_r20",
+    [_GUARD_IS_NOT_NONE_POP_r30] = "_GUARD_IS_NOT_NONE_POP_r30",
     [_GUARD_IS_TRUE_POP] = "_GUARD_IS_TRUE_POP",
     [_GUARD_IS_TRUE_POP_r00] = "_GUARD_IS_TRUE_POP_r00",
     [_GUARD_IS_TRUE_POP_r10] = "_GUARD_IS_TRUE_POP_r10",
@@ -4849,8 +5076,11 @@ const char *const _PyOpcode_uop_name[MAX_UOP_REGS_ID+1] = {
     [_HANDLE_PENDING_AND_DEOPT_r30] = "_HANDLE_PENDING_AND_DEOPT_r30",
     [_IMPORT_FROM] = "_IMPORT_FROM",
     [_IMPORT_FROM_r12] = "_IMPORT_FROM_r12",
+    [_IMPORT_FROM_r22] = "_IMPORT_FROM_r22",
+    [_IMPORT_FROM_r32] = "_IMPORT_FROM_r32",
     [_IMPORT_NAME] = "_IMPORT_NAME",
     [_IMPORT_NAME_r21] = "_IMPORT_NAME_r21",
+    [_IMPORT_NAME_r31] = "_IMPORT_NAME_r31",
     [_INIT_CALL_BOUND_METHOD_EXACT_ARGS] = "_INIT_CALL_BOUND_METHOD_EXACT_ARGS",
     [_INIT_CALL_BOUND_METHOD_EXACT_ARGS_r00] = "_INIT_CALL_BOUND_METHOD_EXACT_ARGS_r00",
     [_INIT_CALL_PY_EXACT_ARGS] = "_INIT_CALL_PY_EXACT_ARGS",
@@ -4881,6 +5111,8 @@ const char *const _PyOpcode_uop_name[MAX_UOP_REGS_ID+1] = {
     [_INSERT_NULL_r10] = "_INSERT_NULL_r10",
     [_IS_NONE] = "_IS_NONE",
     [_IS_NONE_r11] = "_IS_NONE_r11",
+    [_IS_NONE_r21] = "_IS_NONE_r21",
+    [_IS_NONE_r31] = "_IS_NONE_r31",
     [_IS_OP] = "_IS_OP",
     [_IS_OP_r03] = "_IS_OP_r03",
     [_IS_OP_r13] = "_IS_OP_r13",
@@ -4902,6 +5134,7 @@ const char *const _PyOpcode_uop_name[MAX_UOP_REGS_ID+1] = {
     [_ITER_CHECK_TUPLE_r33] = "_ITER_CHECK_TUPLE_r33",
     [_ITER_NEXT_LIST_TIER_TWO] = "_ITER_NEXT_LIST_TIER_TWO",
     [_ITER_NEXT_LIST_TIER_TWO_r23] = "_ITER_NEXT_LIST_TIER_TWO_r23",
+    [_ITER_NEXT_LIST_TIER_TWO_r33] = "_ITER_NEXT_LIST_TIER_TWO_r33",
     [_ITER_NEXT_RANGE] = "_ITER_NEXT_RANGE",
     [_ITER_NEXT_RANGE_r03] = "_ITER_NEXT_RANGE_r03",
     [_ITER_NEXT_RANGE_r13] = "_ITER_NEXT_RANGE_r13",
@@ -4920,6 +5153,8 @@ const char *const _PyOpcode_uop_name[MAX_UOP_REGS_ID+1] = {
     [_LOAD_ATTR_r10] = "_LOAD_ATTR_r10",
     [_LOAD_ATTR_CLASS] = "_LOAD_ATTR_CLASS",
     [_LOAD_ATTR_CLASS_r11] = "_LOAD_ATTR_CLASS_r11",
+    [_LOAD_ATTR_CLASS_r21] = "_LOAD_ATTR_CLASS_r21",
+    [_LOAD_ATTR_CLASS_r31] = "_LOAD_ATTR_CLASS_r31",
     [_LOAD_ATTR_INSTANCE_VALUE] = "_LOAD_ATTR_INSTANCE_VALUE",
     [_LOAD_ATTR_INSTANCE_VALUE_r02] = "_LOAD_ATTR_INSTANCE_VALUE_r02",
     [_LOAD_ATTR_INSTANCE_VALUE_r12] = "_LOAD_ATTR_INSTANCE_VALUE_r12",
@@ -4940,8 +5175,12 @@ const char *const _PyOpcode_uop_name[MAX_UOP_REGS_ID+1] = {
     [_LOAD_ATTR_MODULE_r12] = "_LOAD_ATTR_MODULE_r12",
     [_LOAD_ATTR_NONDESCRIPTOR_NO_DICT] = "_LOAD_ATTR_NONDESCRIPTOR_NO_DICT",
     [_LOAD_ATTR_NONDESCRIPTOR_NO_DICT_r11] = "_LOAD_ATTR_NONDESCRIPTOR_NO_DICT_r11",
+    [_LOAD_ATTR_NONDESCRIPTOR_NO_DICT_r21] = "_LOAD_ATTR_NONDESCRIPTOR_NO_DICT_r21",
+    [_LOAD_ATTR_NONDESCRIPTOR_NO_DICT_r31] = "_LOAD_ATTR_NONDESCRIPTOR_NO_DICT_r31",
     [_LOAD_ATTR_NONDESCRIPTOR_WITH_VALUES] = "_LOAD_ATTR_NONDESCRIPTOR_WITH_VALUES",
     [_LOAD_ATTR_NONDESCRIPTOR_WITH_VALUES_r11] = "_LOAD_ATTR_NONDESCRIPTOR_WITH_VALUES_r11",
+    [_LOAD_ATTR_NONDESCRIPTOR_WITH_VALUES_r21] = "_LOAD_ATTR_NONDESCRIPTOR_WITH_VALUES_r21",
+    [_LOAD_ATTR_NONDESCRIPTOR_WITH_VALUES_r31] = "_LOAD_ATTR_NONDESCRIPTOR_WITH_VALUES_r31",
     [_LOAD_ATTR_PROPERTY_FRAME] = "_LOAD_ATTR_PROPERTY_FRAME",
     [_LOAD_ATTR_PROPERTY_FRAME_r11] = "_LOAD_ATTR_PROPERTY_FRAME_r11",
     [_LOAD_ATTR_SLOT] = "_LOAD_ATTR_SLOT",
@@ -4952,6 +5191,9 @@ const char *const _PyOpcode_uop_name[MAX_UOP_REGS_ID+1] = {
     [_LOAD_ATTR_WITH_HINT_r12] = "_LOAD_ATTR_WITH_HINT_r12",
     [_LOAD_BUILD_CLASS] = "_LOAD_BUILD_CLASS",
     [_LOAD_BUILD_CLASS_r01] = "_LOAD_BUILD_CLASS_r01",
+    [_LOAD_BUILD_CLASS_r11] = "_LOAD_BUILD_CLASS_r11",
+    [_LOAD_BUILD_CLASS_r21] = "_LOAD_BUILD_CLASS_r21",
+    [_LOAD_BUILD_CLASS_r31] = "_LOAD_BUILD_CLASS_r31",
     [_LOAD_COMMON_CONSTANT] = "_LOAD_COMMON_CONSTANT",
     [_LOAD_COMMON_CONSTANT_r01] = "_LOAD_COMMON_CONSTANT_r01",
     [_LOAD_COMMON_CONSTANT_r12] = "_LOAD_COMMON_CONSTANT_r12",
@@ -4978,6 +5220,9 @@ const char *const _PyOpcode_uop_name[MAX_UOP_REGS_ID+1] = {
     [_LOAD_CONST_UNDER_INLINE_BORROW_r23] = "_LOAD_CONST_UNDER_INLINE_BORROW_r23",
     [_LOAD_DEREF] = "_LOAD_DEREF",
     [_LOAD_DEREF_r01] = "_LOAD_DEREF_r01",
+    [_LOAD_DEREF_r11] = "_LOAD_DEREF_r11",
+    [_LOAD_DEREF_r21] = "_LOAD_DEREF_r21",
+    [_LOAD_DEREF_r31] = "_LOAD_DEREF_r31",
     [_LOAD_FAST] = "_LOAD_FAST",
     [_LOAD_FAST_r01] = "_LOAD_FAST_r01",
     [_LOAD_FAST_r12] = "_LOAD_FAST_r12",
@@ -5102,8 +5347,13 @@ const char *const _PyOpcode_uop_name[MAX_UOP_REGS_ID+1] = {
     [_MAKE_CALLARGS_A_TUPLE_r33] = "_MAKE_CALLARGS_A_TUPLE_r33",
     [_MAKE_CELL] = "_MAKE_CELL",
     [_MAKE_CELL_r00] = "_MAKE_CELL_r00",
+    [_MAKE_CELL_r10] = "_MAKE_CELL_r10",
+    [_MAKE_CELL_r20] = "_MAKE_CELL_r20",
+    [_MAKE_CELL_r30] = "_MAKE_CELL_r30",
     [_MAKE_FUNCTION] = "_MAKE_FUNCTION",
     [_MAKE_FUNCTION_r11] = "_MAKE_FUNCTION_r11",
+    [_MAKE_FUNCTION_r21] = "_MAKE_FUNCTION_r21",
+    [_MAKE_FUNCTION_r31] = "_MAKE_FUNCTION_r31",
     [_MAKE_WARM] = "_MAKE_WARM",
     [_MAKE_WARM_r00] = "_MAKE_WARM_r00",
     [_MAKE_WARM_r11] = "_MAKE_WARM_r11",
@@ -5115,6 +5365,7 @@ const char *const _PyOpcode_uop_name[MAX_UOP_REGS_ID+1] = {
     [_MATCH_CLASS_r31] = "_MATCH_CLASS_r31",
     [_MATCH_KEYS] = "_MATCH_KEYS",
     [_MATCH_KEYS_r23] = "_MATCH_KEYS_r23",
+    [_MATCH_KEYS_r33] = "_MATCH_KEYS_r33",
     [_MATCH_MAPPING] = "_MATCH_MAPPING",
     [_MATCH_MAPPING_r02] = "_MATCH_MAPPING_r02",
     [_MATCH_MAPPING_r12] = "_MATCH_MAPPING_r12",
@@ -5134,8 +5385,10 @@ const char *const _PyOpcode_uop_name[MAX_UOP_REGS_ID+1] = {
     [_NOP_r33] = "_NOP_r33",
     [_POP_CALL] = "_POP_CALL",
     [_POP_CALL_r20] = "_POP_CALL_r20",
+    [_POP_CALL_r30] = "_POP_CALL_r30",
     [_POP_CALL_LOAD_CONST_INLINE_BORROW] = "_POP_CALL_LOAD_CONST_INLINE_BORROW",
     [_POP_CALL_LOAD_CONST_INLINE_BORROW_r21] = "_POP_CALL_LOAD_CONST_INLINE_BORROW_r21",
+    [_POP_CALL_LOAD_CONST_INLINE_BORROW_r31] = "_POP_CALL_LOAD_CONST_INLINE_BORROW_r31",
     [_POP_CALL_ONE] = "_POP_CALL_ONE",
     [_POP_CALL_ONE_r30] = "_POP_CALL_ONE_r30",
     [_POP_CALL_ONE_LOAD_CONST_INLINE_BORROW] = "_POP_CALL_ONE_LOAD_CONST_INLINE_BORROW",
@@ -5146,10 +5399,15 @@ const char *const _PyOpcode_uop_name[MAX_UOP_REGS_ID+1] = {
     [_POP_CALL_TWO_LOAD_CONST_INLINE_BORROW_r31] = "_POP_CALL_TWO_LOAD_CONST_INLINE_BORROW_r31",
     [_POP_EXCEPT] = "_POP_EXCEPT",
     [_POP_EXCEPT_r10] = "_POP_EXCEPT_r10",
+    [_POP_EXCEPT_r20] = "_POP_EXCEPT_r20",
+    [_POP_EXCEPT_r30] = "_POP_EXCEPT_r30",
     [_POP_ITER] = "_POP_ITER",
     [_POP_ITER_r20] = "_POP_ITER_r20",
+    [_POP_ITER_r30] = "_POP_ITER_r30",
     [_POP_TOP] = "_POP_TOP",
     [_POP_TOP_r10] = "_POP_TOP_r10",
+    [_POP_TOP_r20] = "_POP_TOP_r20",
+    [_POP_TOP_r30] = "_POP_TOP_r30",
     [_POP_TOP_FLOAT] = "_POP_TOP_FLOAT",
     [_POP_TOP_FLOAT_r00] = "_POP_TOP_FLOAT_r00",
     [_POP_TOP_FLOAT_r10] = "_POP_TOP_FLOAT_r10",
@@ -5162,8 +5420,12 @@ const char *const _PyOpcode_uop_name[MAX_UOP_REGS_ID+1] = {
     [_POP_TOP_INT_r32] = "_POP_TOP_INT_r32",
     [_POP_TOP_LOAD_CONST_INLINE] = "_POP_TOP_LOAD_CONST_INLINE",
     [_POP_TOP_LOAD_CONST_INLINE_r11] = "_POP_TOP_LOAD_CONST_INLINE_r11",
+    [_POP_TOP_LOAD_CONST_INLINE_r21] = "_POP_TOP_LOAD_CONST_INLINE_r21",
+    [_POP_TOP_LOAD_CONST_INLINE_r31] = "_POP_TOP_LOAD_CONST_INLINE_r31",
     [_POP_TOP_LOAD_CONST_INLINE_BORROW] = "_POP_TOP_LOAD_CONST_INLINE_BORROW",
     [_POP_TOP_LOAD_CONST_INLINE_BORROW_r11] = "_POP_TOP_LOAD_CONST_INLINE_BORROW_r11",
+    [_POP_TOP_LOAD_CONST_INLINE_BORROW_r21] = "_POP_TOP_LOAD_CONST_INLINE_BORROW_r21",
+    [_POP_TOP_LOAD_CONST_INLINE_BORROW_r31] = "_POP_TOP_LOAD_CONST_INLINE_BORROW_r31",
     [_POP_TOP_NOP] = "_POP_TOP_NOP",
     [_POP_TOP_NOP_r00] = "_POP_TOP_NOP_r00",
     [_POP_TOP_NOP_r10] = "_POP_TOP_NOP_r10",
@@ -5176,8 +5438,10 @@ const char *const _PyOpcode_uop_name[MAX_UOP_REGS_ID+1] = {
     [_POP_TOP_UNICODE_r32] = "_POP_TOP_UNICODE_r32",
     [_POP_TWO] = "_POP_TWO",
     [_POP_TWO_r20] = "_POP_TWO_r20",
+    [_POP_TWO_r30] = "_POP_TWO_r30",
     [_POP_TWO_LOAD_CONST_INLINE_BORROW] = "_POP_TWO_LOAD_CONST_INLINE_BORROW",
     [_POP_TWO_LOAD_CONST_INLINE_BORROW_r21] = "_POP_TWO_LOAD_CONST_INLINE_BORROW_r21",
+    [_POP_TWO_LOAD_CONST_INLINE_BORROW_r31] = "_POP_TWO_LOAD_CONST_INLINE_BORROW_r31",
     [_PUSH_EXC_INFO] = "_PUSH_EXC_INFO",
     [_PUSH_EXC_INFO_r02] = "_PUSH_EXC_INFO_r02",
     [_PUSH_EXC_INFO_r12] = "_PUSH_EXC_INFO_r12",
@@ -5217,6 +5481,8 @@ const char *const _PyOpcode_uop_name[MAX_UOP_REGS_ID+1] = {
     [_RETURN_GENERATOR_r01] = "_RETURN_GENERATOR_r01",
     [_RETURN_VALUE] = "_RETURN_VALUE",
     [_RETURN_VALUE_r11] = "_RETURN_VALUE_r11",
+    [_RETURN_VALUE_r21] = "_RETURN_VALUE_r21",
+    [_RETURN_VALUE_r31] = "_RETURN_VALUE_r31",
     [_SAVE_RETURN_OFFSET] = "_SAVE_RETURN_OFFSET",
     [_SAVE_RETURN_OFFSET_r00] = "_SAVE_RETURN_OFFSET_r00",
     [_SAVE_RETURN_OFFSET_r11] = "_SAVE_RETURN_OFFSET_r11",
@@ -5226,6 +5492,9 @@ const char *const _PyOpcode_uop_name[MAX_UOP_REGS_ID+1] = {
     [_SEND_GEN_FRAME_r22] = "_SEND_GEN_FRAME_r22",
     [_SETUP_ANNOTATIONS] = "_SETUP_ANNOTATIONS",
     [_SETUP_ANNOTATIONS_r00] = "_SETUP_ANNOTATIONS_r00",
+    [_SETUP_ANNOTATIONS_r10] = "_SETUP_ANNOTATIONS_r10",
+    [_SETUP_ANNOTATIONS_r20] = "_SETUP_ANNOTATIONS_r20",
+    [_SETUP_ANNOTATIONS_r30] = "_SETUP_ANNOTATIONS_r30",
     [_SET_ADD] = "_SET_ADD",
     [_SET_ADD_r10] = "_SET_ADD_r10",
     [_SET_FUNCTION_ATTRIBUTE] = "_SET_FUNCTION_ATTRIBUTE",
@@ -5267,18 +5536,27 @@ const char *const _PyOpcode_uop_name[MAX_UOP_REGS_ID+1] = {
     [_START_EXECUTOR_r00] = "_START_EXECUTOR_r00",
     [_STORE_ATTR] = "_STORE_ATTR",
     [_STORE_ATTR_r20] = "_STORE_ATTR_r20",
+    [_STORE_ATTR_r30] = "_STORE_ATTR_r30",
     [_STORE_ATTR_INSTANCE_VALUE] = "_STORE_ATTR_INSTANCE_VALUE",
     [_STORE_ATTR_INSTANCE_VALUE_r21] = "_STORE_ATTR_INSTANCE_VALUE_r21",
+    [_STORE_ATTR_INSTANCE_VALUE_r31] = "_STORE_ATTR_INSTANCE_VALUE_r31",
     [_STORE_ATTR_SLOT] = "_STORE_ATTR_SLOT",
     [_STORE_ATTR_SLOT_r21] = "_STORE_ATTR_SLOT_r21",
+    [_STORE_ATTR_SLOT_r31] = "_STORE_ATTR_SLOT_r31",
     [_STORE_ATTR_WITH_HINT] = "_STORE_ATTR_WITH_HINT",
     [_STORE_ATTR_WITH_HINT_r21] = "_STORE_ATTR_WITH_HINT_r21",
     [_STORE_DEREF] = "_STORE_DEREF",
     [_STORE_DEREF_r10] = "_STORE_DEREF_r10",
+    [_STORE_DEREF_r20] = "_STORE_DEREF_r20",
+    [_STORE_DEREF_r30] = "_STORE_DEREF_r30",
     [_STORE_GLOBAL] = "_STORE_GLOBAL",
     [_STORE_GLOBAL_r10] = "_STORE_GLOBAL_r10",
+    [_STORE_GLOBAL_r20] = "_STORE_GLOBAL_r20",
+    [_STORE_GLOBAL_r30] = "_STORE_GLOBAL_r30",
     [_STORE_NAME] = "_STORE_NAME",
     [_STORE_NAME_r10] = "_STORE_NAME_r10",
+    [_STORE_NAME_r20] = "_STORE_NAME_r20",
+    [_STORE_NAME_r30] = "_STORE_NAME_r30",
     [_STORE_SLICE] = "_STORE_SLICE",
     [_STORE_SLICE_r30] = "_STORE_SLICE_r30",
     [_STORE_SUBSCR] = "_STORE_SUBSCR",
@@ -5351,6 +5629,8 @@ const char *const _PyOpcode_uop_name[MAX_UOP_REGS_ID+1] = {
     [_TIER2_RESUME_CHECK_r33] = "_TIER2_RESUME_CHECK_r33",
     [_TO_BOOL] = "_TO_BOOL",
     [_TO_BOOL_r11] = "_TO_BOOL_r11",
+    [_TO_BOOL_r21] = "_TO_BOOL_r21",
+    [_TO_BOOL_r31] = "_TO_BOOL_r31",
     [_TO_BOOL_BOOL] = "_TO_BOOL_BOOL",
     [_TO_BOOL_BOOL_r01] = "_TO_BOOL_BOOL_r01",
     [_TO_BOOL_BOOL_r11] = "_TO_BOOL_BOOL_r11",
@@ -5375,8 +5655,12 @@ const char *const _PyOpcode_uop_name[MAX_UOP_REGS_ID+1] = {
     [_TO_BOOL_STR_r23] = "_TO_BOOL_STR_r23",
     [_UNARY_INVERT] = "_UNARY_INVERT",
     [_UNARY_INVERT_r12] = "_UNARY_INVERT_r12",
+    [_UNARY_INVERT_r22] = "_UNARY_INVERT_r22",
+    [_UNARY_INVERT_r32] = "_UNARY_INVERT_r32",
     [_UNARY_NEGATIVE] = "_UNARY_NEGATIVE",
     [_UNARY_NEGATIVE_r12] = "_UNARY_NEGATIVE_r12",
+    [_UNARY_NEGATIVE_r22] = "_UNARY_NEGATIVE_r22",
+    [_UNARY_NEGATIVE_r32] = "_UNARY_NEGATIVE_r32",
     [_UNARY_NOT] = "_UNARY_NOT",
     [_UNARY_NOT_r01] = "_UNARY_NOT_r01",
     [_UNARY_NOT_r11] = "_UNARY_NOT_r11",
@@ -5392,6 +5676,8 @@ const char *const _PyOpcode_uop_name[MAX_UOP_REGS_ID+1] = {
     [_UNPACK_SEQUENCE_TUPLE_r10] = "_UNPACK_SEQUENCE_TUPLE_r10",
     [_UNPACK_SEQUENCE_TWO_TUPLE] = "_UNPACK_SEQUENCE_TWO_TUPLE",
     [_UNPACK_SEQUENCE_TWO_TUPLE_r12] = "_UNPACK_SEQUENCE_TWO_TUPLE_r12",
+    [_UNPACK_SEQUENCE_TWO_TUPLE_r22] = "_UNPACK_SEQUENCE_TWO_TUPLE_r22",
+    [_UNPACK_SEQUENCE_TWO_TUPLE_r32] = "_UNPACK_SEQUENCE_TWO_TUPLE_r32",
     [_WITH_EXCEPT_START] = "_WITH_EXCEPT_START",
     [_WITH_EXCEPT_START_r33] = "_WITH_EXCEPT_START_r33",
     [_YIELD_VALUE] = "_YIELD_VALUE",
@@ -5554,10 +5840,18 @@ int _PyUop_num_popped(int opcode, int oparg)
             return 2;
         case _BINARY_OP_SUBTRACT_FLOAT:
             return 2;
+        case _BINARY_OP_ADD_FLOAT_INPLACE:
+            return 2;
+        case _BINARY_OP_SUBTRACT_FLOAT_INPLACE:
+            return 2;
+        case _BINARY_OP_MULTIPLY_FLOAT_INPLACE:
+            return 2;
         case _BINARY_OP_ADD_UNICODE:
             return 2;
         case _BINARY_OP_INPLACE_ADD_UNICODE:
             return 2;
+        case _BINARY_OP_INPLACE_ADD_UNICODE_DEREF:
+            return 2;
         case _GUARD_BINARY_OP_EXTEND:
             return 0;
         case _BINARY_OP_EXTEND:
@@ -136,86 +136,87 @@ extern "C" {
 #define BINARY_OP_ADD_INT                      130
 #define BINARY_OP_ADD_UNICODE                  131
 #define BINARY_OP_EXTEND                       132
-#define BINARY_OP_MULTIPLY_FLOAT               133
-#define BINARY_OP_MULTIPLY_INT                 134
-#define BINARY_OP_SUBSCR_DICT                  135
-#define BINARY_OP_SUBSCR_GETITEM               136
-#define BINARY_OP_SUBSCR_LIST_INT              137
-#define BINARY_OP_SUBSCR_LIST_SLICE            138
-#define BINARY_OP_SUBSCR_STR_INT               139
-#define BINARY_OP_SUBSCR_TUPLE_INT             140
-#define BINARY_OP_SUBSCR_USTR_INT              141
-#define BINARY_OP_SUBTRACT_FLOAT               142
-#define BINARY_OP_SUBTRACT_INT                 143
-#define CALL_ALLOC_AND_ENTER_INIT              144
-#define CALL_BOUND_METHOD_EXACT_ARGS           145
-#define CALL_BOUND_METHOD_GENERAL              146
-#define CALL_BUILTIN_CLASS                     147
-#define CALL_BUILTIN_FAST                      148
-#define CALL_BUILTIN_FAST_WITH_KEYWORDS        149
-#define CALL_BUILTIN_O                         150
-#define CALL_EX_NON_PY_GENERAL                 151
-#define CALL_EX_PY                             152
-#define CALL_ISINSTANCE                        153
-#define CALL_KW_BOUND_METHOD                   154
-#define CALL_KW_NON_PY                         155
-#define CALL_KW_PY                             156
-#define CALL_LEN                               157
-#define CALL_LIST_APPEND                       158
-#define CALL_METHOD_DESCRIPTOR_FAST            159
-#define CALL_METHOD_DESCRIPTOR_FAST_WITH_KEYWORDS 160
-#define CALL_METHOD_DESCRIPTOR_NOARGS          161
-#define CALL_METHOD_DESCRIPTOR_O               162
-#define CALL_NON_PY_GENERAL                    163
-#define CALL_PY_EXACT_ARGS                     164
-#define CALL_PY_GENERAL                        165
-#define CALL_STR_1                             166
-#define CALL_TUPLE_1                           167
-#define CALL_TYPE_1                            168
-#define COMPARE_OP_FLOAT                       169
-#define COMPARE_OP_INT                         170
-#define COMPARE_OP_STR                         171
-#define CONTAINS_OP_DICT                       172
-#define CONTAINS_OP_SET                        173
-#define FOR_ITER_GEN                           174
-#define FOR_ITER_LIST                          175
-#define FOR_ITER_RANGE                         176
-#define FOR_ITER_TUPLE                         177
-#define JUMP_BACKWARD_JIT                      178
-#define JUMP_BACKWARD_NO_JIT                   179
-#define LOAD_ATTR_CLASS                        180
-#define LOAD_ATTR_CLASS_WITH_METACLASS_CHECK   181
-#define LOAD_ATTR_GETATTRIBUTE_OVERRIDDEN      182
-#define LOAD_ATTR_INSTANCE_VALUE               183
-#define LOAD_ATTR_METHOD_LAZY_DICT             184
-#define LOAD_ATTR_METHOD_NO_DICT               185
-#define LOAD_ATTR_METHOD_WITH_VALUES           186
-#define LOAD_ATTR_MODULE                       187
-#define LOAD_ATTR_NONDESCRIPTOR_NO_DICT        188
-#define LOAD_ATTR_NONDESCRIPTOR_WITH_VALUES    189
-#define LOAD_ATTR_PROPERTY                     190
-#define LOAD_ATTR_SLOT                         191
-#define LOAD_ATTR_WITH_HINT                    192
-#define LOAD_GLOBAL_BUILTIN                    193
-#define LOAD_GLOBAL_MODULE                     194
-#define LOAD_SUPER_ATTR_ATTR                   195
-#define LOAD_SUPER_ATTR_METHOD                 196
-#define RESUME_CHECK                           197
-#define SEND_GEN                               198
-#define STORE_ATTR_INSTANCE_VALUE              199
-#define STORE_ATTR_SLOT                        200
-#define STORE_ATTR_WITH_HINT                   201
-#define STORE_SUBSCR_DICT                      202
-#define STORE_SUBSCR_LIST_INT                  203
-#define TO_BOOL_ALWAYS_TRUE                    204
-#define TO_BOOL_BOOL                           205
-#define TO_BOOL_INT                            206
-#define TO_BOOL_LIST                           207
-#define TO_BOOL_NONE                           208
-#define TO_BOOL_STR                            209
-#define UNPACK_SEQUENCE_LIST                   210
-#define UNPACK_SEQUENCE_TUPLE                  211
-#define UNPACK_SEQUENCE_TWO_TUPLE              212
+#define BINARY_OP_INPLACE_ADD_UNICODE_DEREF    133
+#define BINARY_OP_MULTIPLY_FLOAT               134
+#define BINARY_OP_MULTIPLY_INT                 135
+#define BINARY_OP_SUBSCR_DICT                  136
+#define BINARY_OP_SUBSCR_GETITEM               137
+#define BINARY_OP_SUBSCR_LIST_INT              138
+#define BINARY_OP_SUBSCR_LIST_SLICE            139
+#define BINARY_OP_SUBSCR_STR_INT               140
+#define BINARY_OP_SUBSCR_TUPLE_INT             141
+#define BINARY_OP_SUBSCR_USTR_INT              142
+#define BINARY_OP_SUBTRACT_FLOAT               143
+#define BINARY_OP_SUBTRACT_INT                 144
+#define CALL_ALLOC_AND_ENTER_INIT              145
+#define CALL_BOUND_METHOD_EXACT_ARGS           146
+#define CALL_BOUND_METHOD_GENERAL              147
+#define CALL_BUILTIN_CLASS                     148
+#define CALL_BUILTIN_FAST                      149
+#define CALL_BUILTIN_FAST_WITH_KEYWORDS        150
+#define CALL_BUILTIN_O                         151
+#define CALL_EX_NON_PY_GENERAL                 152
+#define CALL_EX_PY                             153
+#define CALL_ISINSTANCE                        154
+#define CALL_KW_BOUND_METHOD                   155
+#define CALL_KW_NON_PY                         156
+#define CALL_KW_PY                             157
+#define CALL_LEN                               158
+#define CALL_LIST_APPEND                       159
+#define CALL_METHOD_DESCRIPTOR_FAST            160
+#define CALL_METHOD_DESCRIPTOR_FAST_WITH_KEYWORDS 161
+#define CALL_METHOD_DESCRIPTOR_NOARGS          162
+#define CALL_METHOD_DESCRIPTOR_O               163
+#define CALL_NON_PY_GENERAL                    164
+#define CALL_PY_EXACT_ARGS                     165
+#define CALL_PY_GENERAL                        166
+#define CALL_STR_1                             167
+#define CALL_TUPLE_1                           168
+#define CALL_TYPE_1                            169
+#define COMPARE_OP_FLOAT                       170
+#define COMPARE_OP_INT                         171
+#define COMPARE_OP_STR                         172
+#define CONTAINS_OP_DICT                       173
+#define CONTAINS_OP_SET                        174
+#define FOR_ITER_GEN                           175
+#define FOR_ITER_LIST                          176
+#define FOR_ITER_RANGE                         177
+#define FOR_ITER_TUPLE                         178
+#define JUMP_BACKWARD_JIT                      179
+#define JUMP_BACKWARD_NO_JIT                   180
+#define LOAD_ATTR_CLASS                        181
+#define LOAD_ATTR_CLASS_WITH_METACLASS_CHECK   182
+#define LOAD_ATTR_GETATTRIBUTE_OVERRIDDEN      183
+#define LOAD_ATTR_INSTANCE_VALUE               184
+#define LOAD_ATTR_METHOD_LAZY_DICT             185
+#define LOAD_ATTR_METHOD_NO_DICT               186
+#define LOAD_ATTR_METHOD_WITH_VALUES           187
+#define LOAD_ATTR_MODULE                       188
+#define LOAD_ATTR_NONDESCRIPTOR_NO_DICT        189
+#define LOAD_ATTR_NONDESCRIPTOR_WITH_VALUES    190
+#define LOAD_ATTR_PROPERTY                     191
+#define LOAD_ATTR_SLOT                         192
+#define LOAD_ATTR_WITH_HINT                    193
+#define LOAD_GLOBAL_BUILTIN                    194
+#define LOAD_GLOBAL_MODULE                     195
+#define LOAD_SUPER_ATTR_ATTR                   196
+#define LOAD_SUPER_ATTR_METHOD                 197
+#define RESUME_CHECK                           198
+#define SEND_GEN                               199
+#define STORE_ATTR_INSTANCE_VALUE              200
+#define STORE_ATTR_SLOT                        201
+#define STORE_ATTR_WITH_HINT                   202
+#define STORE_SUBSCR_DICT                      203
+#define STORE_SUBSCR_LIST_INT                  204
+#define TO_BOOL_ALWAYS_TRUE                    205
+#define TO_BOOL_BOOL                           206
+#define TO_BOOL_INT                            207
+#define TO_BOOL_LIST                           208
+#define TO_BOOL_NONE                           209
+#define TO_BOOL_STR                            210
+#define UNPACK_SEQUENCE_LIST                   211
+#define UNPACK_SEQUENCE_TUPLE                  212
+#define UNPACK_SEQUENCE_TWO_TUPLE              213
 #define INSTRUMENTED_END_FOR                   233
 #define INSTRUMENTED_POP_ITER                  234
 #define INSTRUMENTED_END_SEND                  235
@@ -30,6 +30,7 @@ _specializations = {
         "BINARY_OP_SUBSCR_DICT",
         "BINARY_OP_SUBSCR_GETITEM",
         "BINARY_OP_INPLACE_ADD_UNICODE",
+        "BINARY_OP_INPLACE_ADD_UNICODE_DEREF",
         "BINARY_OP_EXTEND",
         "BINARY_OP_INPLACE_ADD_UNICODE",
     ],
@@ -132,86 +133,87 @@ _specialized_opmap = {
     'BINARY_OP_EXTEND': 132,
     'BINARY_OP_INPLACE_ADD_UNICODE': 3,
     'BINARY_OP_INPLACE_ADD_UNICODE': 3,
-    'BINARY_OP_MULTIPLY_FLOAT': 133,
-    'BINARY_OP_MULTIPLY_INT': 134,
-    'BINARY_OP_SUBSCR_DICT': 135,
-    'BINARY_OP_SUBSCR_GETITEM': 136,
-    'BINARY_OP_SUBSCR_LIST_INT': 137,
-    'BINARY_OP_SUBSCR_LIST_SLICE': 138,
-    'BINARY_OP_SUBSCR_STR_INT': 139,
-    'BINARY_OP_SUBSCR_TUPLE_INT': 140,
-    'BINARY_OP_SUBSCR_USTR_INT': 141,
-    'BINARY_OP_SUBTRACT_FLOAT': 142,
-    'BINARY_OP_SUBTRACT_INT': 143,
-    'CALL_ALLOC_AND_ENTER_INIT': 144,
-    'CALL_BOUND_METHOD_EXACT_ARGS': 145,
-    'CALL_BOUND_METHOD_GENERAL': 146,
-    'CALL_BUILTIN_CLASS': 147,
-    'CALL_BUILTIN_FAST': 148,
-    'CALL_BUILTIN_FAST_WITH_KEYWORDS': 149,
-    'CALL_BUILTIN_O': 150,
-    'CALL_EX_NON_PY_GENERAL': 151,
-    'CALL_EX_PY': 152,
-    'CALL_ISINSTANCE': 153,
-    'CALL_KW_BOUND_METHOD': 154,
-    'CALL_KW_NON_PY': 155,
-    'CALL_KW_PY': 156,
-    'CALL_LEN': 157,
-    'CALL_LIST_APPEND': 158,
-    'CALL_METHOD_DESCRIPTOR_FAST': 159,
-    'CALL_METHOD_DESCRIPTOR_FAST_WITH_KEYWORDS': 160,
-    'CALL_METHOD_DESCRIPTOR_NOARGS': 161,
-    'CALL_METHOD_DESCRIPTOR_O': 162,
-    'CALL_NON_PY_GENERAL': 163,
-    'CALL_PY_EXACT_ARGS': 164,
-    'CALL_PY_GENERAL': 165,
-    'CALL_STR_1': 166,
-    'CALL_TUPLE_1': 167,
-    'CALL_TYPE_1': 168,
-    'COMPARE_OP_FLOAT': 169,
-    'COMPARE_OP_INT': 170,
-    'COMPARE_OP_STR': 171,
-    'CONTAINS_OP_DICT': 172,
-    'CONTAINS_OP_SET': 173,
-    'FOR_ITER_GEN': 174,
-    'FOR_ITER_LIST': 175,
-    'FOR_ITER_RANGE': 176,
-    'FOR_ITER_TUPLE': 177,
-    'JUMP_BACKWARD_JIT': 178,
-    'JUMP_BACKWARD_NO_JIT': 179,
-    'LOAD_ATTR_CLASS': 180,
-    'LOAD_ATTR_CLASS_WITH_METACLASS_CHECK': 181,
-    'LOAD_ATTR_GETATTRIBUTE_OVERRIDDEN': 182,
-    'LOAD_ATTR_INSTANCE_VALUE': 183,
-    'LOAD_ATTR_METHOD_LAZY_DICT': 184,
-    'LOAD_ATTR_METHOD_NO_DICT': 185,
-    'LOAD_ATTR_METHOD_WITH_VALUES': 186,
-    'LOAD_ATTR_MODULE': 187,
-    'LOAD_ATTR_NONDESCRIPTOR_NO_DICT': 188,
-    'LOAD_ATTR_NONDESCRIPTOR_WITH_VALUES': 189,
-    'LOAD_ATTR_PROPERTY': 190,
-    'LOAD_ATTR_SLOT': 191,
-    'LOAD_ATTR_WITH_HINT': 192,
-    'LOAD_GLOBAL_BUILTIN': 193,
-    'LOAD_GLOBAL_MODULE': 194,
-    'LOAD_SUPER_ATTR_ATTR': 195,
-    'LOAD_SUPER_ATTR_METHOD': 196,
-    'RESUME_CHECK': 197,
-    'SEND_GEN': 198,
-    'STORE_ATTR_INSTANCE_VALUE': 199,
-    'STORE_ATTR_SLOT': 200,
-    'STORE_ATTR_WITH_HINT': 201,
-    'STORE_SUBSCR_DICT': 202,
-    'STORE_SUBSCR_LIST_INT': 203,
-    'TO_BOOL_ALWAYS_TRUE': 204,
-    'TO_BOOL_BOOL': 205,
-    'TO_BOOL_INT': 206,
-    'TO_BOOL_LIST': 207,
-    'TO_BOOL_NONE': 208,
-    'TO_BOOL_STR': 209,
-    'UNPACK_SEQUENCE_LIST': 210,
-    'UNPACK_SEQUENCE_TUPLE': 211,
-    'UNPACK_SEQUENCE_TWO_TUPLE': 212,
+    'BINARY_OP_INPLACE_ADD_UNICODE_DEREF': 133,
+    'BINARY_OP_MULTIPLY_FLOAT': 134,
+    'BINARY_OP_MULTIPLY_INT': 135,
+    'BINARY_OP_SUBSCR_DICT': 136,
+    'BINARY_OP_SUBSCR_GETITEM': 137,
+    'BINARY_OP_SUBSCR_LIST_INT': 138,
+    'BINARY_OP_SUBSCR_LIST_SLICE': 139,
+    'BINARY_OP_SUBSCR_STR_INT': 140,
+    'BINARY_OP_SUBSCR_TUPLE_INT': 141,
+    'BINARY_OP_SUBSCR_USTR_INT': 142,
+    'BINARY_OP_SUBTRACT_FLOAT': 143,
+    'BINARY_OP_SUBTRACT_INT': 144,
+    'CALL_ALLOC_AND_ENTER_INIT': 145,
+    'CALL_BOUND_METHOD_EXACT_ARGS': 146,
+    'CALL_BOUND_METHOD_GENERAL': 147,
+    'CALL_BUILTIN_CLASS': 148,
+    'CALL_BUILTIN_FAST': 149,
+    'CALL_BUILTIN_FAST_WITH_KEYWORDS': 150,
+    'CALL_BUILTIN_O': 151,
+    'CALL_EX_NON_PY_GENERAL': 152,
+    'CALL_EX_PY': 153,
+    'CALL_ISINSTANCE': 154,
+    'CALL_KW_BOUND_METHOD': 155,
+    'CALL_KW_NON_PY': 156,
+    'CALL_KW_PY': 157,
+    'CALL_LEN': 158,
+    'CALL_LIST_APPEND': 159,
+    'CALL_METHOD_DESCRIPTOR_FAST': 160,
+    'CALL_METHOD_DESCRIPTOR_FAST_WITH_KEYWORDS': 161,
+    'CALL_METHOD_DESCRIPTOR_NOARGS': 162,
+    'CALL_METHOD_DESCRIPTOR_O': 163,
+    'CALL_NON_PY_GENERAL': 164,
+    'CALL_PY_EXACT_ARGS': 165,
+    'CALL_PY_GENERAL': 166,
+    'CALL_STR_1': 167,
+    'CALL_TUPLE_1': 168,
+    'CALL_TYPE_1': 169,
+    'COMPARE_OP_FLOAT': 170,
+    'COMPARE_OP_INT': 171,
+    'COMPARE_OP_STR': 172,
+    'CONTAINS_OP_DICT': 173,
+    'CONTAINS_OP_SET': 174,
+    'FOR_ITER_GEN': 175,
+    'FOR_ITER_LIST': 176,
+    'FOR_ITER_RANGE': 177,
+    'FOR_ITER_TUPLE': 178,
+    'JUMP_BACKWARD_JIT': 179,
+    'JUMP_BACKWARD_NO_JIT': 180,
+    'LOAD_ATTR_CLASS': 181,
+    'LOAD_ATTR_CLASS_WITH_METACLASS_CHECK': 182,
+    'LOAD_ATTR_GETATTRIBUTE_OVERRIDDEN': 183,
+    'LOAD_ATTR_INSTANCE_VALUE': 184,
+    'LOAD_ATTR_METHOD_LAZY_DICT': 185,
+    'LOAD_ATTR_METHOD_NO_DICT': 186,
+    'LOAD_ATTR_METHOD_WITH_VALUES': 187,
+    'LOAD_ATTR_MODULE': 188,
+    'LOAD_ATTR_NONDESCRIPTOR_NO_DICT': 189,
+    'LOAD_ATTR_NONDESCRIPTOR_WITH_VALUES': 190,
+    'LOAD_ATTR_PROPERTY': 191,
+    'LOAD_ATTR_SLOT': 192,
+    'LOAD_ATTR_WITH_HINT': 193,
+    'LOAD_GLOBAL_BUILTIN': 194,
+    'LOAD_GLOBAL_MODULE': 195,
+    'LOAD_SUPER_ATTR_ATTR': 196,
+    'LOAD_SUPER_ATTR_METHOD': 197,
+    'RESUME_CHECK': 198,
+    'SEND_GEN': 199,
+    'STORE_ATTR_INSTANCE_VALUE': 200,
+    'STORE_ATTR_SLOT': 201,
+    'STORE_ATTR_WITH_HINT': 202,
+    'STORE_SUBSCR_DICT': 203,
+    'STORE_SUBSCR_LIST_INT': 204,
+    'TO_BOOL_ALWAYS_TRUE': 205,
+    'TO_BOOL_BOOL': 206,
+    'TO_BOOL_INT': 207,
+    'TO_BOOL_LIST': 208,
+    'TO_BOOL_NONE': 209,
+    'TO_BOOL_STR': 210,
+    'UNPACK_SEQUENCE_LIST': 211,
+    'UNPACK_SEQUENCE_TUPLE': 212,
+    'UNPACK_SEQUENCE_TWO_TUPLE': 213,
 }
 
 opmap = {
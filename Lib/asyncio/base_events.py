@@ -49,6 +49,11 @@
 from . import trsock
 from .log import logger
 
+try:
+    import _asyncio
+except ImportError:  # pragma: no cover
+    _asyncio = None
+
 
 __all__ = 'BaseEventLoop','Server',
 
@@ -420,7 +425,10 @@ def __init__(self):
         self._timer_cancelled_count = 0
         self._closed = False
         self._stopping = False
-        self._ready = collections.deque()
+        if _asyncio is not None:
+            self._ready = _asyncio.ReadyQueue(self)
+        else:
+            self._ready = collections.deque()
         self._scheduled = []
         self._default_executor = None
         self._internal_fds = 0
@@ -2027,6 +2035,11 @@ def _run_once(self):
         # they will be run the next time (after another I/O poll).
         # Use an idiom that is thread-safe without using locks.
         ntodo = len(self._ready)
+        if not self._debug and _asyncio is not None:
+            # Same as below, without going through Handle._run() for
+            # callbacks scheduled by Futures and Tasks.
+            self._ready.run(ntodo)
+            return
         for i in range(ntodo):
             handle = self._ready.popleft()
             if handle._cancelled:
@@ -2069,3 +2082,7 @@ def set_debug(self, enabled):
 
         if self.is_running():
             self.call_soon_threadsafe(self._set_coroutine_origin_tracking, enabled)
+
+
+if _asyncio is not None:
+    _asyncio._set_base_event_loop(BaseEventLoop)
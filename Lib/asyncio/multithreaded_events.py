@@ -0,0 +1,295 @@
+"""Event loop running callbacks and tasks on several threads."""
+
+import heapq
+import os
+import selectors
+import sys
+import threading
+
+from . import base_events
+from . import constants
+from . import events
+
+if sys.platform == 'win32':  # pragma: no cover
+    from .windows_events import SelectorEventLoop
+else:
+    from .unix_events import SelectorEventLoop
+
+try:
+    import _asyncio
+except ImportError:  # pragma: no cover
+    _asyncio = None
+
+
+__all__ = (
+    'MultiThreadedEventLoop',
+)
+
+
+class _IOSlot:
+    """Runs the reader or writer callback of a file descriptor.
+
+    A file descriptor stays ready until its callback has read the data (or
+    filled the buffer), so every poll would queue the callback again while
+    it is still running on another worker.  The slot lets only one run be
+    queued at a time, even if add_reader() replaces the callback meanwhile.
+    """
+
+    __slots__ = ('busy', 'handle', 'runner')
+
+    def __init__(self, loop):
+        self.busy = False
+        self.handle = None
+        self.runner = events.Handle(self._run, (), loop, None)
+
+    def _run(self):
+        handle = self.handle
+        self.handle = None
+        try:
+            if not handle._cancelled:
+                handle._run()
+        finally:
+            self.busy = False
+
+
+class MultiThreadedEventLoop(SelectorEventLoop):
+    """Selector event loop that runs callbacks on several threads.
+
+    run_forever() starts threads - 1 worker threads and makes the calling
+    thread the first worker.  The ready queue keeps one FIFO per worker:
+    callbacks scheduled by a worker (task steps, done callbacks) go to its
+    own FIFO, and a worker with an empty FIFO steals from the others.  I/O
+    polling and timers are handled by whichever idle worker takes the poll
+    lock; workers with nothing to do block in the ready queue.
+
+    Tasks and futures are thread-safe, but code running in different tasks
+    now runs in parallel: objects shared between tasks, including asyncio
+    queues, locks and transports, need to be protected by threading locks.
+    """
+
+    def __init__(self, selector=None, *, threads=None):
+        if threads is None:
+            threads = os.process_cpu_count() or 1
+        # Created before the base class adds the self-pipe reader.
+        self._poll_lock = threading.Lock()
+        # Reentrant: a TimerHandle may be cancelled by a finalizer run by
+        # the garbage collector while the heap is being updated.
+        self._timer_lock = threading.RLock()
+        self._selector_lock = threading.Lock()
+        self._worker_exception = None
+        self._io_slots = {}
+        self._pre_stopped = False
+        super().__init__(selector)
+        try:
+            if _asyncio is None:
+                raise RuntimeError(
+                    'MultiThreadedEventLoop requires the _asyncio module')
+            if threads < 1:
+                raise ValueError(
+                    f'threads must be at least 1, got {threads}')
+            self._ready = _asyncio.ReadyQueue(self, threads)
+        except:
+            self.close()
+            raise
+
+    def run_forever(self):
+        """Run until stop() is called."""
+        self._run_forever_setup()
+        if self._stopping:
+            # stop() was called before: run one iteration on this thread,
+            # like BaseEventLoop.run_forever().
+            try:
+                self._poll(pre_stopped=True)
+                self._ready.run(len(self._ready))
+            finally:
+                self._run_forever_cleanup()
+            return
+        workers = []
+        try:
+            for index in range(1, self._ready.workers):
+                worker = threading.Thread(
+                    target=self._run_worker_thread, args=(index,),
+                    name=f'asyncio-worker-{index}')
+                worker.start()
+                workers.append(worker)
+            self._run_worker(0)
+        finally:
+            self._stopping = True
+            self._wakeup_workers()
+            for worker in workers:
+                worker.join()
+            self._run_forever_cleanup()
+        exc = self._worker_exception
+        if exc is not None:
+            self._worker_exception = None
+            try:
+                raise exc
+            finally:
+                exc = None
+
+    def close(self):
+        super().close()
+        self._io_slots.clear()
+
+    def stop(self):
+        """Stop running the event loop.
+
+        The worker threads finish the callbacks they are running and exit;
+        callbacks which are still queued run the next time the loop runs.
+        """
+        self._stopping = True
+        self._wakeup_workers()
+
+    def _wakeup_workers(self):
+        self._ready.wakeup()
+        self._write_to_self()
+
+    def _check_thread(self):
+        if self._thread_id is None:
+            return
+        if events._get_running_loop() is not self:
+            raise RuntimeError(
+                "Non-thread-safe operation invoked on an event loop other "
+                "than the current one")
+
+    def _run_worker_thread(self, index):
+        sys.set_asyncgen_hooks(
+            firstiter=self._asyncgen_firstiter_hook,
+            finalizer=self._asyncgen_finalizer_hook)
+        if self._debug:
+            sys.set_coroutine_origin_tracking_depth(
+                constants.DEBUG_STACK_DEPTH)
+        events._set_running_loop(self)
+        try:
+            self._run_worker(index)
+        except BaseException as exc:
+            # Re-raised by run_forever(), like an exception escaping from
+            # a callback in a single-threaded loop.
+            if self._worker_exception is None:
+                self._worker_exception = exc
+            self.stop()
+        finally:
+            events._set_running_loop(None)
+
+    def _run_worker(self, index):
+        ready = self._ready
+        poll_lock = self._poll_lock
+        while not self._stopping:
+            if poll_lock.acquire(blocking=False):
+                try:
+                    self._poll()
+                finally:
+                    poll_lock.release()
+            ran = ready.run(len(ready), index)
+            if self._stopping:
+                break
+            if not ran:
+                ready.wait()
+
+    def _poll(self, pre_stopped=False):
+        """Poll for I/O and move the timers which are due to the ready queue.
+
+        The poll only blocks when every other worker is waiting in the
+        ready queue: a running worker may schedule callbacks that the
+        waiting ones would otherwise have to wait for.
+        """
+        ready = self._ready
+        self._pre_stopped = pre_stopped
+        with self._timer_lock:
+            while self._scheduled and self._scheduled[0]._cancelled:
+                self._timer_cancelled_count -= 1
+                handle = heapq.heappop(self._scheduled)
+                handle._scheduled = False
+            timeout = None
+            if (ready or self._stopping or
+                    ready.waiting < ready.workers - 1):
+                timeout = 0
+            elif self._scheduled:
+                timeout = self._scheduled[0]._when - self.time()
+                if timeout > base_events.MAXIMUM_SELECT_TIMEOUT:
+                    timeout = base_events.MAXIMUM_SELECT_TIMEOUT
+                elif timeout < 0:
+                    timeout = 0
+
+        event_list = self._selector.select(timeout)
+        self._process_events(event_list)
+        # Needed to break cycles when an exception occurs.
+        event_list = None
+
+        end_time = self.time() + self._clock_resolution
+        with self._timer_lock:
+            while self._scheduled:
+                handle = self._scheduled[0]
+                if handle._when >= end_time:
+                    break
+                handle = heapq.heappop(self._scheduled)
+                handle._scheduled = False
+                ready.append(handle)
+
+    def _process_events(self, event_list):
+        for key, mask in event_list:
+            fileobj, (reader, writer) = key.fileobj, key.data
+            if mask & selectors.EVENT_READ and reader is not None:
+                if reader._cancelled:
+                    self._remove_reader(fileobj)
+                else:
+                    self._add_io_callback(key.fd, selectors.EVENT_READ,
+                                          reader)
+            if mask & selectors.EVENT_WRITE and writer is not None:
+                if writer._cancelled:
+                    self._remove_writer(fileobj)
+                else:
+                    self._add_io_callback(key.fd, selectors.EVENT_WRITE,
+                                          writer)
+
+    def _add_io_callback(self, fd, event, handle):
+        # Only called by the worker holding the poll lock.
+        slot = self._io_slots.get((fd, event))
+        if slot is None:
+            slot = self._io_slots[fd, event] = _IOSlot(self)
+        # Once stop() has been called, don't run I/O callbacks again, like
+        # the single-threaded loop which stops polling: the callback which
+        # has just finished (clearing slot.busy) may be what called it.
+        if not slot.busy and (self._pre_stopped or not self._stopping):
+            slot.busy = True
+            slot.handle = handle
+            self._ready.append(slot.runner)
+
+    def call_at(self, when, callback, *args, context=None):
+        """Like call_later(), but uses an absolute time.
+
+        Absolute time corresponds to the event loop's time() method.
+        """
+        if when is None:
+            raise TypeError("when cannot be None")
+        self._check_closed()
+        if self._debug:
+            self._check_thread()
+            self._check_callback(callback, 'call_at')
+        timer = events.TimerHandle(when, callback, args, self, context)
+        if timer._source_traceback:
+            del timer._source_traceback[-1]
+        with self._timer_lock:
+            heapq.heappush(self._scheduled, timer)
+            timer._scheduled = True
+        return timer
+
+    def _timer_handle_cancelled(self, handle):
+        with self._timer_lock:
+            super()._timer_handle_cancelled(handle)
+
+    def _add_reader(self, fd, callback, *args):
+        with self._selector_lock:
+            return super()._add_reader(fd, callback, *args)
+
+    def _remove_reader(self, fd):
+        with self._selector_lock:
+            return super()._remove_reader(fd)
+
+    def _add_writer(self, fd, callback, *args):
+        with self._selector_lock:
+            return super()._add_writer(fd, callback, *args)
+
+    def _remove_writer(self, fd):
+        with self._selector_lock:
+            return super()._remove_writer(fd)
@@ -1221,11 +1221,23 @@ class _SelectorDatagramTransport(_SelectorTransport, transports.DatagramTranspor
     _buffer_factory = collections.deque
     _header_size = 8
 
+    # On platforms with recvmmsg() and sendmmsg(), UDP transports move up to
+    # _batch_size datagrams per system call.  Reads switch to batches once
+    # _batch_threshold datagrams have arrived, so that short-lived
+    # transports don't pay for the receive buffers.
+    _batch_size = 16
+    _batch_threshold = 64
+    _batch_buffer_size = 65536  # Larger than any UDP payload.
+
     def __init__(self, loop, sock, protocol, address=None,
                  waiter=None, extra=None):
         super().__init__(loop, sock, protocol, extra)
         self._address = address
         self._buffer_size = 0
+        self._can_batch = (hasattr(socket.socket, 'recvmmsg_into') and
+                           sock.family in (socket.AF_INET, socket.AF_INET6))
+        self._recv_count = 0
+        self._recv_buffers = None
         self._loop.call_soon(self._protocol.connection_made, self)
         # only start reading when connection_made() has been called
         self._loop.call_soon(self._add_reader,
@@ -1241,6 +1253,9 @@ def get_write_buffer_size(self):
     def _read_ready(self):
         if self._conn_lost:
             return
+        if self._recv_buffers is not None:
+            self._read_ready_batch()
+            return
         try:
             data, addr = self._sock.recvfrom(self.max_size)
         except (BlockingIOError, InterruptedError):
@@ -1253,6 +1268,30 @@ def _read_ready(self):
             self._fatal_error(exc, 'Fatal read error on datagram transport')
         else:
             self._protocol.datagram_received(data, addr)
+            if self._can_batch:
+                self._recv_count += 1
+                if self._recv_count >= self._batch_threshold:
+                    size = min(self.max_size, self._batch_buffer_size)
+                    buf = memoryview(bytearray(size * self._batch_size))
+                    self._recv_buffers = [buf[i:i + size] for i in
+                                          range(0, len(buf), size)]
+
+    def _read_ready_batch(self):
+        try:
+            received = self._sock.recvmmsg_into(self._recv_buffers)
+        except (BlockingIOError, InterruptedError):
+            pass
+        except OSError as exc:
+            self._protocol.error_received(exc)
+        except (SystemExit, KeyboardInterrupt):
+            raise
+        except BaseException as exc:
+            self._fatal_error(exc, 'Fatal read error on datagram transport')
+        else:
+            for buf, (nbytes, addr) in zip(self._recv_buffers, received):
+                if self._conn_lost:
+                    break
+                self._protocol.datagram_received(bytes(buf[:nbytes]), addr)
 
     def sendto(self, data, addr=None):
         if not isinstance(data, (bytes, bytearray, memoryview)):
@@ -1298,6 +1337,33 @@ def sendto(self, data, addr=None):
 
     def _sendto_ready(self):
         while self._buffer:
+            if self._can_batch and len(self._buffer) > 1:
+                # Send up to _batch_size datagrams with one sendmmsg().
+                batch = list(itertools.islice(self._buffer, self._batch_size))
+                if self._extra['peername']:
+                    batch = [data for data, addr in batch]
+                try:
+                    sent = self._sock.sendmmsg(batch)
+                except (BlockingIOError, InterruptedError):
+                    break
+                except OSError as exc:
+                    # Drop the datagram that failed, like the path below.
+                    data, addr = self._buffer.popleft()
+                    self._buffer_size -= len(data) + self._header_size
+                    self._protocol.error_received(exc)
+                    return
+                except (SystemExit, KeyboardInterrupt):
+                    raise
+                except BaseException as exc:
+                    self._fatal_error(
+                        exc, 'Fatal write error on datagram transport')
+                    return
+                if not sent:
+                    break
+                for _ in range(sent):
+                    data, addr = self._buffer.popleft()
+                    self._buffer_size -= len(data) + self._header_size
+                continue
             data, addr = self._buffer.popleft()
             self._buffer_size -= len(data) + self._header_size
             try:
@@ -0,0 +1,425 @@
+"""Proactor event loop for Linux using io_uring."""
+
+import errno
+import os
+import select
+import socket
+import time
+import weakref
+
+from . import futures
+from . import proactor_events
+from . import tasks
+from . import unix_events
+from .log import logger
+
+try:
+    import _uring
+except ImportError:  # pragma: no cover
+    _uring = None
+
+
+__all__ = (
+    'UringEventLoop', 'UringProactor',
+)
+
+
+# Number of operations that can be queued between two submissions.  More
+# are accepted, at the cost of an extra system call to flush the queue.
+RING_ENTRIES = 1024
+
+# Returned by a completion callback which has queued a follow-up operation
+# for the same future.
+_PENDING = object()
+
+# MSG_WAITALL makes the kernel retry short sends itself (Linux 5.19 and
+# newer).  Stored as an int: or-ing the IntFlag members on every send is
+# measurably slow.
+_SEND_FLAGS = int(socket.MSG_NOSIGNAL | socket.MSG_WAITALL)
+
+
+def _uring_available():
+    if _uring is None:
+        return False
+    try:
+        _uring.Ring(1).close()
+    except OSError:
+        # Kernel too old, or io_uring disabled by
+        # /proc/sys/kernel/io_uring_disabled or a seccomp policy.
+        return False
+    return True
+
+
+class _UringFuture(futures.Future):
+    """Subclass of Future which represents an io_uring operation.
+
+    Cancelling it asks the kernel to cancel the operation.
+    """
+
+    def __init__(self, op, *, loop=None):
+        super().__init__(loop=loop)
+        if self._source_traceback:
+            del self._source_traceback[-1]
+        self._op = op
+
+    def _repr_info(self):
+        info = super()._repr_info()
+        if self._op is not None:
+            state = 'pending' if self._op.pending else 'completed'
+            info.insert(1, f'operation=<{state}>')
+        return info
+
+    def _cancel_operation(self):
+        if self._op is None:
+            return
+        try:
+            self._op.cancel()
+        except OSError as exc:
+            context = {
+                'message': 'Cancelling an io_uring future failed',
+                'exception': exc,
+                'future': self,
+            }
+            if self._source_traceback:
+                context['source_traceback'] = self._source_traceback
+            self._loop.call_exception_handler(context)
+        self._op = None
+
+    def cancel(self, msg=None):
+        self._cancel_operation()
+        return super().cancel(msg=msg)
+
+    def set_exception(self, exception):
+        super().set_exception(exception)
+        self._cancel_operation()
+
+    def set_result(self, result):
+        super().set_result(result)
+        self._op = None
+
+
+class UringProactor:
+    """Proactor implementation using io_uring.
+
+    Reads, writes and accepts are submitted to the kernel as io_uring
+    operations, in one batch per event loop iteration.  Operations which
+    need a socket address (connect(), recvfrom(), sendto()) and sendfile()
+    wait for readiness with an io_uring poll operation instead, then use
+    the non-blocking socket call.
+    """
+
+    def __init__(self, entries=RING_ENTRIES):
+        if _uring is None:
+            raise OSError(errno.ENOSYS, 'io_uring is not supported')
+        self._loop = None
+        self._results = []
+        self._ring = _uring.Ring(entries)
+        self._cache = {}
+        self._stopped_serving = weakref.WeakSet()
+
+    def _check_closed(self):
+        if self._ring is None:
+            raise RuntimeError('UringProactor is closed')
+
+    def __repr__(self):
+        info = ['operation#=%s' % len(self._cache),
+                'result#=%s' % len(self._results)]
+        if self._ring is None:
+            info.append('closed')
+        return '<%s %s>' % (self.__class__.__name__, " ".join(info))
+
+    def set_loop(self, loop):
+        self._loop = loop
+
+    def select(self, timeout=None):
+        if not self._results:
+            self._poll(timeout)
+        tmp = self._results
+        self._results = []
+        try:
+            return tmp
+        finally:
+            # Needed to break cycles when an exception occurs.
+            tmp = None
+
+    def _result(self, value):
+        fut = self._loop.create_future()
+        fut.set_result(value)
+        return fut
+
+    @staticmethod
+    def finish_socket_func(obj, op):
+        return op.getresult()
+
+    def recv(self, conn, nbytes, flags=0):
+        self._check_closed()
+        if not isinstance(conn, socket.socket):
+            # Only write pipe transports recv() from a pipe, to learn when
+            # the other end is closed.  Poll for that instead of reading:
+            # the file may be open for reading and writing (a PTY).
+            op = self._ring.poll(conn.fileno(), select.POLLERR)
+            return self._register(op, conn, lambda obj, op: b'')
+        op = self._ring.recv(conn.fileno(), nbytes, flags)
+        return self._register(op, conn, self.finish_socket_func)
+
+    def recv_into(self, conn, buf, flags=0):
+        self._check_closed()
+        if isinstance(conn, socket.socket):
+            op = self._ring.recv_into(conn.fileno(), buf, flags)
+        else:
+            op = self._ring.readinto(conn.fileno(), buf)
+        return self._register(op, conn, self.finish_socket_func)
+
+    def recvfrom(self, conn, nbytes, flags=0):
+        return self._wait_ready(conn, select.POLLIN,
+                                lambda: conn.recvfrom(nbytes, flags))
+
+    def recvfrom_into(self, conn, buf, flags=0):
+        return self._wait_ready(conn, select.POLLIN,
+                                lambda: conn.recvfrom_into(buf, 0, flags))
+
+    def sendto(self, conn, buf, flags=0, addr=None):
+        return self._wait_ready(conn, select.POLLOUT,
+                                lambda: conn.sendto(buf, flags, addr))
+
+    def send(self, conn, buf, flags=0):
+        self._check_closed()
+        fd = conn.fileno()
+        if isinstance(conn, socket.socket):
+            flags |= _SEND_FLAGS
+            submit = lambda data: self._ring.send(fd, data, flags)
+        else:
+            submit = lambda data: self._ring.write(fd, data)
+        view = memoryview(buf).cast('B')
+        sent = 0
+
+        def finish_send(obj, op):
+            # Like WSASend() and WriteFile(), complete only once all the
+            # data has been written.
+            nonlocal sent
+            sent += op.getresult()
+            if sent == len(view) or f.done():
+                return sent
+            op = submit(view[sent:])
+            f._op = op
+            self._cache[op] = (f, op, conn, finish_send)
+            return _PENDING
+
+        return self._register(submit(view), conn, finish_send)
+
+    def accept(self, listener):
+        self._check_closed()
+        op = self._ring.accept(listener.fileno())
+
+        def finish_accept(obj, op):
+            fd = op.getresult()
+            conn = socket.socket(listener.family, listener.type,
+                                 listener.proto, fileno=fd)
+            conn.settimeout(listener.gettimeout())
+            try:
+                return conn, conn.getpeername()
+            except OSError:
+                conn.close()
+                raise
+
+        return self._register(op, listener, finish_accept)
+
+    def connect(self, conn, address):
+        self._check_closed()
+        try:
+            conn.connect(address)
+        except (BlockingIOError, InterruptedError):
+            pass
+        else:
+            return self._result(None)
+
+        def finish_connect():
+            err = conn.getsockopt(socket.SOL_SOCKET, socket.SO_ERROR)
+            if err != 0:
+                raise OSError(err, f'Connect call failed {address}')
+
+        return self._wait_ready(conn, select.POLLOUT, finish_connect,
+                                first_try=False)
+
+    def sendfile(self, sock, file, offset, count):
+        return tasks.ensure_future(
+            self._sendfile(sock, file.fileno(), offset, count),
+            loop=self._loop)
+
+    async def _sendfile(self, sock, fileno, offset, count):
+        start = offset
+        try:
+            while count:
+                await self.poll(sock, select.POLLOUT)
+                try:
+                    sent = os.sendfile(sock.fileno(), fileno, offset, count)
+                except (BlockingIOError, InterruptedError):
+                    continue
+                if sent == 0:
+                    break  # EOF
+                offset += sent
+                count -= sent
+        finally:
+            if count and offset != start:
+                # Interrupted part way: unlike TransmitFile(), the progress
+                # is known, so leave it in the file position as the Unix
+                # selector event loop does.
+                os.lseek(fileno, offset, os.SEEK_SET)
+
+    def poll(self, conn, events):
+        """Wait until one of the poll *events* is signalled on *conn*.
+
+        The result is the mask of events that occurred.
+        """
+        self._check_closed()
+        op = self._ring.poll(conn.fileno(), events)
+        return self._register(op, conn, self.finish_socket_func)
+
+    def _wait_ready(self, conn, events, func, first_try=True):
+        self._check_closed()
+        if first_try:
+            try:
+                return self._result(func())
+            except (BlockingIOError, InterruptedError):
+                pass
+            except OSError as exc:
+                fut = self._loop.create_future()
+                fut.set_exception(exc)
+                return fut
+
+        async def wait_ready():
+            while True:
+                await self.poll(conn, events)
+                try:
+                    return func()
+                except (BlockingIOError, InterruptedError):
+                    pass
+
+        return tasks.ensure_future(wait_ready(), loop=self._loop)
+
+    def _register(self, op, obj, callback):
+        self._check_closed()
+
+        # Return a future which will be set with the result of the
+        # operation when it completes.  The future's value is actually
+        # the value returned by callback().
+        f = _UringFuture(op, loop=self._loop)
+        if f._source_traceback:
+            del f._source_traceback[-1]
+
+        # Register the operation for later.  Note that we only store obj
+        # to prevent it from being garbage collected too early.
+        self._cache[op] = (f, op, obj, callback)
+        return f
+
+    def _poll(self, timeout=None):
+        if timeout is not None and timeout < 0:
+            raise ValueError("negative timeout")
+
+        for op in self._ring.wait(timeout):
+            try:
+                f, op, obj, callback = self._cache.pop(op)
+            except KeyError:
+                if self._loop.get_debug():
+                    self._loop.call_exception_handler({
+                        'message': ('io_uring returned an unexpected '
+                                    'completion'),
+                        'operation': op,
+                    })
+                continue
+
+            if obj in self._stopped_serving:
+                f.cancel()
+            # Don't call the callback if the future has been cancelled.
+            elif not f.done():
+                try:
+                    value = callback(obj, op)
+                except OSError as e:
+                    f.set_exception(e)
+                    self._results.append(f)
+                else:
+                    if value is not _PENDING:
+                        f.set_result(value)
+                        self._results.append(f)
+                finally:
+                    f = None
+
+    def _stop_serving(self, obj):
+        # obj is a socket.  It will be closed in
+        # BaseProactorEventLoop._stop_serving() which will make any
+        # pending operations fail quickly.
+        self._stopped_serving.add(obj)
+
+    def close(self):
+        if self._ring is None:
+            # already closed
+            return
+
+        # Cancel remaining registered operations.
+        for fut, op, obj, callback in list(self._cache.values()):
+            if not fut.cancelled():
+                fut.cancel()
+
+        # Wait until all cancelled operations complete: the kernel may
+        # still write into their buffers until then.  Display progress
+        # every second if the loop is still running.
+        msg_update = 1.0
+        start_time = time.monotonic()
+        next_msg = start_time + msg_update
+        while self._cache:
+            if next_msg <= time.monotonic():
+                logger.debug('%r is running after closing for %.1f seconds',
+                             self, time.monotonic() - start_time)
+                next_msg = time.monotonic() + msg_update
+
+            # handle a few events, or timeout
+            self._poll(msg_update)
+
+        self._results = []
+        self._stopped_serving.clear()
+
+        self._ring.close()
+        self._ring = None
+
+    def __del__(self):
+        self.close()
+
+
+class UringEventLoop(unix_events._UnixEventLoopMixin,
+                     proactor_events.BaseProactorEventLoop):
+    """Linux proactor event loop using io_uring.
+
+    If io_uring is not available, creating a UringEventLoop returns a
+    SelectorEventLoop instead.
+    """
+
+    def __new__(cls, proactor=None):
+        if proactor is None and not _uring_available():
+            logger.debug('io_uring is not available, '
+                         'falling back to SelectorEventLoop')
+            return unix_events.SelectorEventLoop()
+        return super().__new__(cls)
+
+    def __init__(self, proactor=None):
+        if proactor is None:
+            proactor = UringProactor()
+        super().__init__(proactor)
+        self._watcher = unix_events._ThreadedChildWatcher()
+
+    def _loop_self_reading(self, f=None):
+        # Signal numbers are written to the self-pipe by
+        # signal.set_wakeup_fd().
+        if f is not None and not f.cancelled() and f.exception() is None:
+            self._process_self_data(f.result())
+        super()._loop_self_reading(f)
+
+    def _run_forever_setup(self):
+        assert self._self_reading_future is None
+        self.call_soon(self._loop_self_reading)
+        super()._run_forever_setup()
+
+    def _run_forever_cleanup(self):
+        super()._run_forever_cleanup()
+        if self._self_reading_future is not None:
+            self._self_reading_future.cancel()
+            self._self_reading_future = None
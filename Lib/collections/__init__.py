@@ -8,6 +8,7 @@
 * Counter      dict subclass for counting hashable objects
 * OrderedDict  dict subclass that remembers the order entries were added
 * defaultdict  dict subclass that calls a factory function to supply missing values
+* ConcurrentDict  dict-like class sharded over independently locked dicts
 * UserDict     wrapper around dictionary objects for easier dict subclassing
 * UserList     wrapper around list objects for easier list subclassing
 * UserString   wrapper around string objects for easier string subclassing
@@ -16,6 +17,7 @@
 
 __all__ = [
     'ChainMap',
+    'ConcurrentDict',
     'Counter',
     'OrderedDict',
     'UserDict',
@@ -59,6 +61,13 @@
 except ImportError:
     pass
 
+try:
+    from _collections import ConcurrentDict
+except ImportError:
+    pass
+else:
+    _collections_abc.MutableMapping.register(ConcurrentDict)
+
 heapq = None  # Lazily imported
 
 
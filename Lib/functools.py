@@ -552,7 +552,7 @@ def _make_key(args, kwds, typed,
         return key[0]
     return key
 
-def lru_cache(maxsize=128, typed=False):
+def lru_cache(maxsize=128, typed=False, *, shards=1):
     """Least-recently-used cache decorator.
 
     If *maxsize* is set to None, the LRU features are disabled and the cache
@@ -563,6 +563,11 @@ def lru_cache(maxsize=128, typed=False):
     distinct calls with distinct results. Some types such as str and int may
     be cached separately even when typed is false.
 
+    If *shards* is greater than 1, a bounded cache is split into that many
+    parts, each locked separately and holding an equal share of *maxsize*
+    entries.  Cache hits then take no lock, at the cost of evicting entries
+    in approximate rather than exact LRU order.
+
     Arguments to the cached function must be hashable.
 
     View the cache statistics named tuple (hits, misses, maxsize, currsize)
@@ -578,6 +583,11 @@ def lru_cache(maxsize=128, typed=False):
     # The internals of the lru_cache are encapsulated for thread safety and
     # to allow the implementation to change (including a possible C version).
 
+    if not isinstance(shards, int):
+        raise TypeError('Expected shards to be an integer')
+    if shards < 1:
+        raise ValueError('shards must be positive')
+
     if isinstance(maxsize, int):
         # Negative maxsize is treated as 0
         if maxsize < 0:
@@ -586,22 +596,27 @@ def lru_cache(maxsize=128, typed=False):
     elif callable(maxsize) and isinstance(typed, bool):
         # The user_function was passed in directly via the maxsize argument
         user_function, maxsize = maxsize, 128
-        wrapper = _lru_cache_wrapper(user_function, maxsize, typed, _CacheInfo)
-        wrapper.cache_parameters = lambda : {'maxsize': maxsize, 'typed': typed}
-        return update_wrapper(wrapper, user_function)
+        return lru_cache(maxsize, typed, shards=shards)(user_function)
 
     elif maxsize is not None:
         raise TypeError(
             'Expected first argument to be an integer, a callable, or None')
 
+    parameters = {'maxsize': maxsize, 'typed': typed}
+    if shards != 1:
+        parameters['shards'] = shards
+
     def decorating_function(user_function):
-        wrapper = _lru_cache_wrapper(user_function, maxsize, typed, _CacheInfo)
-        wrapper.cache_parameters = lambda : {'maxsize': maxsize, 'typed': typed}
+        wrapper = _lru_cache_wrapper(user_function, maxsize, typed, _CacheInfo,
+                                     shards=shards)
+        wrapper.cache_parameters = lambda : dict(parameters)
         return update_wrapper(wrapper, user_function)
 
     return decorating_function
 
-def _lru_cache_wrapper(user_function, maxsize, typed, _CacheInfo):
+def _lru_cache_wrapper(user_function, maxsize, typed, _CacheInfo, shards=1):
+    # This version ignores *shards*: a single exact LRU list is a valid
+    # implementation of the approximate eviction order that sharding allows.
     if not callable(user_function):
         raise TypeError("the first argument must be callable")
 
@@ -1,5 +1,6 @@
 """Implementation of JSONDecoder
 """
+import codecs
 import re
 
 from json import scanner
@@ -7,8 +8,12 @@
     from _json import scanstring as c_scanstring
 except ImportError:
     c_scanstring = None
+try:
+    from _json import find_item_end as c_find_item_end
+except ImportError:
+    c_find_item_end = None
 
-__all__ = ['JSONDecoder', 'JSONDecodeError']
+__all__ = ['JSONDecoder', 'JSONDecodeError', 'JSONStreamDecoder']
 
 FLAGS = re.VERBOSE | re.MULTILINE | re.DOTALL
 
@@ -130,6 +135,56 @@ def py_scanstring(s, end, strict=True,
 # Use speedup if available
 scanstring = c_scanstring or py_scanstring
 
+
+STRUCTURE = re.compile(r'["\[\]{},]', FLAGS)
+STRING_SPECIAL = re.compile(r'["\\]', FLAGS)
+
+def py_find_item_end(s, idx, depth, in_string,
+        _structure=STRUCTURE.search, _string_special=STRING_SPECIAL.search):
+    """Find the end of the JSON array item that contains index idx of s.
+
+    Scanning starts at idx, which is nested depth levels deep in the item
+    and inside a string if in_string is true.  Returns a tuple
+    (end, depth, in_string).  If the item is complete, end is the index of
+    the ',', ']' or '}' following it and in_string is False.  Otherwise
+    end is where the scan should be resumed once more data is available.
+    """
+    if not 0 <= idx <= len(s):
+        raise ValueError("idx is out of bounds")
+    if depth < 0:
+        raise ValueError("depth must be non-negative")
+    while True:
+        if in_string:
+            m = _string_special(s, idx)
+            if m is None:
+                return len(s), depth, True
+            idx = m.start()
+            if s[idx] == '\\':
+                if idx + 1 == len(s):
+                    # Resume at the backslash to see what it escapes.
+                    return idx, depth, True
+                idx += 2
+                continue
+            in_string = False
+        else:
+            m = _structure(s, idx)
+            if m is None:
+                return len(s), depth, False
+            idx = m.start()
+            c = s[idx]
+            if c == '"':
+                in_string = True
+            elif c in '[{':
+                depth += 1
+            elif depth == 0:
+                return idx, 0, False
+            elif c != ',':
+                depth -= 1
+        idx += 1
+
+
+find_item_end = c_find_item_end or py_find_item_end
+
 WHITESPACE = re.compile(r'[ \t\n\r]*', FLAGS)
 WHITESPACE_STR = ' \t\n\r'
 
@@ -362,3 +417,123 @@ def raw_decode(self, s, idx=0):
         except StopIteration as err:
             raise JSONDecodeError("Expecting value", s, err.value) from None
         return obj, end
+
+
+
+class JSONStreamDecoder(JSONDecoder):
+    """Incremental decoder for a JSON array arriving in pieces.
+
+    Feed UTF-8 encoded data with :meth:`feed` and collect the array
+    elements completed so far with :meth:`iter_items`.  Only the text of the
+    element being decoded is kept in memory, so arbitrarily long arrays can
+    be decoded from files or sockets::
+
+        decoder = JSONStreamDecoder()
+        while chunk := f.read(65536):
+            decoder.feed(chunk)
+            for item in decoder.iter_items():
+                process(item)
+        decoder.close()
+
+    The keyword arguments are the same as for :class:`JSONDecoder`.
+    """
+
+    _EXPECT_ARRAY, _EXPECT_FIRST, _EXPECT_ITEM, _DONE = range(4)
+
+    def __init__(self, **kw):
+        super().__init__(**kw)
+        self._decoder = codecs.getincrementaldecoder('utf-8-sig')()
+        self._buf = ''
+        # Index in _buf of the first character not yet consumed, and of
+        # the last comma (for the trailing comma error message).
+        self._pos = 0
+        self._comma = 0
+        # Where and in which state find_item_end() resumes scanning.
+        self._scan_pos = 0
+        self._depth = 0
+        self._in_string = False
+        self._state = self._EXPECT_ARRAY
+        self._closed = False
+
+    def _append(self, text):
+        # Drop the consumed text, except for a comma that may still be
+        # needed for an error message.
+        keep = self._pos
+        if self._state == self._EXPECT_ITEM:
+            keep = min(keep, self._comma)
+        self._buf = self._buf[keep:] + text
+        self._pos -= keep
+        self._comma -= keep
+        self._scan_pos = max(self._scan_pos - keep, 0)
+
+    def feed(self, data):
+        """Add the bytes-like object *data* to the input."""
+        if self._closed:
+            raise ValueError("feed() called after close()")
+        self._append(self._decoder.decode(data))
+
+    def close(self):
+        """Signal the end of the input.
+
+        Return a list of the elements not returned by :meth:`iter_items`
+        yet.  Raise :exc:`JSONDecodeError` if the input is not a complete
+        array, optionally surrounded by whitespace.
+        """
+        if not self._closed:
+            self._append(self._decoder.decode(b'', final=True))
+            self._closed = True
+        items = list(self.iter_items())
+        if self._state != self._DONE:
+            msg = "Expecting value" if self._state == self._EXPECT_ARRAY \
+                  else "Unterminated array"
+            raise JSONDecodeError(msg, self._buf, len(self._buf))
+        return items
+
+    def iter_items(self, _w=WHITESPACE.match):
+        """Return an iterator over the array elements decoded so far.
+
+        An element is yielded as soon as the ',' or ']' following it has
+        been fed.  The iterator stops when more input is needed: call
+        :meth:`iter_items` again after the next :meth:`feed`.
+        """
+        while True:
+            s = self._buf
+            pos = self._pos = _w(s, self._pos).end()
+            if pos == len(s):
+                return
+            state = self._state
+            if state == self._EXPECT_ARRAY:
+                if s[pos] != '[':
+                    raise JSONDecodeError("Expecting '['", s, pos)
+                self._pos = self._scan_pos = pos + 1
+                self._state = self._EXPECT_FIRST
+                continue
+            if state == self._DONE:
+                raise JSONDecodeError("Extra data", s, pos)
+            if s[pos] == ']':
+                if state == self._EXPECT_ITEM:
+                    raise JSONDecodeError(
+                        "Illegal trailing comma before end of array",
+                        s, self._comma)
+                self._pos = pos + 1
+                self._state = self._DONE
+                continue
+            end, self._depth, self._in_string = find_item_end(
+                s, max(self._scan_pos, pos), self._depth, self._in_string)
+            if self._in_string or end == len(s):
+                self._scan_pos = end
+                return
+            try:
+                value, value_end = self.scan_once(s, pos)
+            except StopIteration as err:
+                raise JSONDecodeError("Expecting value", s, err.value) from None
+            value_end = _w(s, value_end).end()
+            if value_end != end or s[end] == '}':
+                raise JSONDecodeError("Expecting ',' delimiter", s, value_end)
+            self._pos = self._scan_pos = end + 1
+            if s[end] == ',':
+                self._comma = end
+                self._state = self._EXPECT_ITEM
+            else:
+                self._state = self._DONE
+            yield value
@@ -46,10 +46,15 @@ class BinaryCollector(Collector):
 
     The binary format uses string/frame deduplication and varint encoding
     for efficient storage.
+
+    With bucket_usec, samples are aggregated in memory instead: stacks are
+    deduplicated into a trie and only the number of samples each thread
+    spent in each stack is written, once per time bucket.  The file keeps
+    the per-bucket timeline but not individual sample timestamps.
     """
 
     def __init__(self, filename, sample_interval_usec, *, skip_idle=False,
-                 compression='auto'):
+                 compression='auto', bucket_usec=None):
         """Create a new binary collector.
 
         Args:
@@ -57,15 +62,22 @@ def __init__(self, filename, sample_interval_usec, *, skip_idle=False,
             sample_interval_usec: Sampling interval in microseconds
             skip_idle: If True, skip idle threads (not used in binary format)
             compression: 'auto', 'zstd', 'none', or int (0=none, 1=zstd)
+            bucket_usec: If set, aggregate samples into time buckets of this
+                         many microseconds
         """
         self.filename = filename
         self.sample_interval_usec = sample_interval_usec
         self.skip_idle = skip_idle
+        self.bucket_usec = bucket_usec
+
+        if bucket_usec is not None and bucket_usec <= 0:
+            raise ValueError("bucket_usec must be positive")
 
         compression_type = _resolve_compression(compression)
-        start_time_us = int(time.monotonic() * 1_000_000)
+        self.start_time_us = int(time.monotonic() * 1_000_000)
         self._writer = _remote_debugging.BinaryWriter(
-            filename, sample_interval_usec, start_time_us, compression=compression_type
+            filename, sample_interval_usec, self.start_time_us,
+            compression=compression_type, bucket_us=bucket_usec or 0
         )
 
     def collect(self, stack_frames, timestamp_us=None):
@@ -104,7 +116,8 @@ def get_stats(self):
 
         Returns:
             Dict with encoding statistics including repeat/full/suffix/pop-push
-            record counts, frames written/saved, and compression ratio.
+            record counts, frames written/saved, compression ratio, and the
+            bucket/count/stack node counts of aggregated files.
         """
         return self._writer.get_stats()
 
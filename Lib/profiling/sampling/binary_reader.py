@@ -48,7 +48,8 @@ def get_info(self):
                 - start_time_us: Start timestamp in microseconds
                 - string_count: Number of unique strings
                 - frame_count: Number of unique frames
-                - compression: Compression type used
+                - compression_type: Compression type used
+                - aggregated: True if samples were aggregated per time bucket
         """
         if self._reader is None:
             raise RuntimeError("Reader not open. Use as context manager.")
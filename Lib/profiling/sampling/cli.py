@@ -28,6 +28,8 @@
     PROFILING_MODE_CPU,
     PROFILING_MODE_GIL,
     PROFILING_MODE_EXCEPTION,
+    PROFILING_MODE_ALLOC,
+    DEFAULT_ALLOC_INTERVAL,
     SORT_MODE_NSAMPLES,
     SORT_MODE_TOTTIME,
     SORT_MODE_CUMTIME,
@@ -147,10 +149,16 @@ def _build_child_profiler_args(args):
     mode = getattr(args, 'mode', 'wall')
     if mode != "wall":
         child_args.extend(["--mode", mode])
+    if mode == "alloc":
+        child_args.extend(["--alloc-interval", str(args.alloc_interval)])
 
     # Format options (skip pstats as it's the default)
     if args.format != "pstats":
         child_args.append(f"--{args.format}")
+    if getattr(args, 'aggregate', False):
+        child_args.append("--aggregate")
+        if args.bucket_size is not None:
+            child_args.extend(["--bucket-size", str(args.bucket_size)])
 
     return child_args
 
@@ -186,6 +194,7 @@ def _parse_mode(mode_string):
         "cpu": PROFILING_MODE_CPU,
         "gil": PROFILING_MODE_GIL,
         "exception": PROFILING_MODE_EXCEPTION,
+        "alloc": PROFILING_MODE_ALLOC,
     }
     return mode_map[mode_string]
 
@@ -340,6 +349,31 @@ def _parse_sampling_rate(rate_str: str) -> int:
     return interval_usec
 
 
+_SIZE_SUFFIXES = {"": 1, "k": 1024, "m": 1024 ** 2, "g": 1024 ** 3}
+
+
+def _parse_bucket_size(value):
+    """Parse a --bucket-size value in seconds."""
+    try:
+        seconds = float(value)
+    except ValueError:
+        raise argparse.ArgumentTypeError(f"invalid bucket size: {value!r}")
+    if not seconds > 0:
+        raise argparse.ArgumentTypeError("bucket size must be positive")
+    return seconds
+
+
+def _parse_alloc_interval(size_str: str) -> int:
+    """Parse an allocation sampling interval (e.g. 4096, 512k, 1m) to bytes."""
+    match = re.fullmatch(r"(\d+)([kmg]?)b?", size_str.strip().lower())
+    if not match or int(match.group(1)) <= 0:
+        raise argparse.ArgumentTypeError(
+            f"Invalid allocation interval: {size_str}. "
+            "Expected: positive number of bytes with optional suffix (k, m, g) (e.g., 512k)"
+        )
+    return int(match.group(1)) * _SIZE_SUFFIXES[match.group(2)]
+
+
 def _add_sampling_options(parser):
     """Add sampling configuration options to a parser."""
     sampling_group = parser.add_argument_group("Sampling configuration")
@@ -412,13 +446,22 @@ def _add_mode_options(parser):
     mode_group = parser.add_argument_group("Mode options")
     mode_group.add_argument(
         "--mode",
-        choices=["wall", "cpu", "gil", "exception"],
+        choices=["wall", "cpu", "gil", "exception", "alloc"],
         default="wall",
         help="Sampling mode: wall (all samples), cpu (only samples when thread is on CPU), "
         "gil (only samples when thread holds the GIL), "
-        "exception (only samples when thread has an active exception). "
+        "exception (only samples when thread has an active exception), "
+        "alloc (samples memory allocations instead of time). "
         "Incompatible with --async-aware",
     )
+    mode_group.add_argument(
+        "--alloc-interval",
+        type=_parse_alloc_interval,
+        default=DEFAULT_ALLOC_INTERVAL,
+        metavar="SIZE",
+        help="Mean number of bytes allocated between two samples in alloc mode "
+        "(e.g., 4096, 64k, 1m)",
+    )
     mode_group.add_argument(
         "--async-mode",
         choices=["running", "all"],
@@ -484,6 +527,19 @@ def _add_format_options(parser, include_compression=True, include_binary=True):
             default="auto",
             help="Compression for binary format: auto (use zstd if available), zstd, none",
         )
+        output_group.add_argument(
+            "--aggregate",
+            action="store_true",
+            help="Aggregate binary format samples while profiling: write how many "
+            "samples each stack received per time bucket instead of every sample",
+        )
+        output_group.add_argument(
+            "--bucket-size",
+            type=_parse_bucket_size,
+            default=None,
+            metavar="SECONDS",
+            help="Time bucket size for --aggregate (default: 1 second)",
+        )
 
     output_group.add_argument(
         "-o",
@@ -544,8 +600,16 @@ def _sort_to_mode(sort_choice):
     }
     return sort_map.get(sort_choice, SORT_MODE_NSAMPLES)
 
+def _bucket_usec(args):
+    """Return the aggregation bucket size in microseconds, or None."""
+    if not getattr(args, 'aggregate', False):
+        return None
+    seconds = args.bucket_size if args.bucket_size is not None else 1.0
+    return max(1, int(seconds * MICROSECONDS_PER_SECOND))
+
+
 def _create_collector(format_type, sample_interval_usec, skip_idle, opcodes=False,
-                      output_file=None, compression='auto'):
+                      output_file=None, compression='auto', bucket_usec=None):
     """Create the appropriate collector based on format type.
 
     Args:
@@ -556,6 +620,8 @@ def _create_collector(format_type, sample_interval_usec, skip_idle, opcodes=Fals
                  for creating interval markers in Firefox Profiler)
         output_file: Output file path (required for binary format)
         compression: Compression type for binary format ('auto', 'zstd', 'none')
+        bucket_usec: Aggregation bucket size for binary format, or None to
+                     write every sample
 
     Returns:
         A collector instance of the appropriate type
@@ -569,7 +635,7 @@ def _create_collector(format_type, sample_interval_usec, skip_idle, opcodes=Fals
         if output_file is None:
             raise ValueError("Binary format requires an output file")
         return collector_class(output_file, sample_interval_usec, skip_idle=skip_idle,
-                              compression=compression)
+                              compression=compression, bucket_usec=bucket_usec)
 
     # Gecko format never skips idle (it needs both GIL and CPU data)
     # and is the only format that uses opcodes for interval markers
@@ -687,6 +753,12 @@ def _validate_args(args, parser):
             file=sys.stderr
         )
 
+    # Aggregation is a mode of the binary writer
+    if args.format != "binary" and getattr(args, 'aggregate', False):
+        parser.error("--aggregate is only valid with --binary.")
+    if getattr(args, 'bucket_size', None) is not None and not args.aggregate:
+        parser.error("--bucket-size requires --aggregate.")
+
     # Check if live mode is available
     if hasattr(args, 'live') and args.live and LiveStatsCollector is None:
         parser.error(
@@ -748,6 +820,15 @@ def _validate_args(args, parser):
             )
         return
 
+    # Allocation samples are not timed: only aggregating formats apply
+    if getattr(args, 'mode', 'wall') == "alloc":
+        if getattr(args, 'live', False):
+            parser.error("--mode=alloc is incompatible with --live.")
+        if args.format in ("gecko", "binary"):
+            parser.error(f"--mode=alloc is incompatible with --{args.format}.")
+        if args.blocking:
+            parser.error("--mode=alloc is incompatible with --blocking.")
+
     # Validate gecko mode doesn't use non-wall mode
     if args.format == "gecko" and getattr(args, 'mode', 'wall') != "wall":
         parser.error(
@@ -953,7 +1034,8 @@ def _handle_attach(args):
     collector = _create_collector(
         args.format, args.sample_interval_usec, skip_idle, args.opcodes,
         output_file=output_file,
-        compression=getattr(args, 'compression', 'auto')
+        compression=getattr(args, 'compression', 'auto'),
+        bucket_usec=_bucket_usec(args),
     )
 
     with _get_child_monitor_context(args, args.pid):
@@ -969,6 +1051,7 @@ def _handle_attach(args):
             gc=args.gc,
             opcodes=args.opcodes,
             blocking=args.blocking,
+            alloc_interval=args.alloc_interval,
         )
         _handle_output(collector, args, args.pid, mode)
 
@@ -1031,7 +1114,8 @@ def _handle_run(args):
     collector = _create_collector(
         args.format, args.sample_interval_usec, skip_idle, args.opcodes,
         output_file=output_file,
-        compression=getattr(args, 'compression', 'auto')
+        compression=getattr(args, 'compression', 'auto'),
+        bucket_usec=_bucket_usec(args),
     )
 
     with _get_child_monitor_context(args, process.pid):
@@ -1048,6 +1132,7 @@ def _handle_run(args):
                 gc=args.gc,
                 opcodes=args.opcodes,
                 blocking=args.blocking,
+                alloc_interval=args.alloc_interval,
             )
             _handle_output(collector, args, process.pid, mode)
         finally:
@@ -1179,6 +1264,8 @@ def _handle_replay(args):
         print(f"Replaying {info['sample_count']} samples from {args.input_file}")
         print(f"  Sample interval: {interval} us")
         print(f"  Compression: {'zstd' if info.get('compression_type', 0) == 1 else 'none'}")
+        if info.get('aggregated'):
+            print("  Aggregated: sample counts per time bucket")
 
         collector = _create_collector(args.format, interval, skip_idle=False)
 
@@ -10,6 +10,10 @@
 PROFILING_MODE_GIL = 2
 PROFILING_MODE_ALL = 3  # Combines GIL + CPU checks
 PROFILING_MODE_EXCEPTION = 4  # Only samples when thread has an active exception
+PROFILING_MODE_ALLOC = 5  # Samples memory allocations instead of time
+
+# Default mean number of bytes allocated between two allocation samples
+DEFAULT_ALLOC_INTERVAL = 512 * 1024
 
 # Sort mode constants
 SORT_MODE_NSAMPLES = 0
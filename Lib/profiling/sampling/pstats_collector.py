@@ -4,7 +4,11 @@
 
 from _colorize import ANSIColors
 from .collector import Collector, extract_lineno
-from .constants import MICROSECONDS_PER_SECOND, PROFILING_MODE_CPU
+from .constants import (
+    MICROSECONDS_PER_SECOND,
+    PROFILING_MODE_ALLOC,
+    PROFILING_MODE_CPU,
+)
 
 
 class PstatsCollector(Collector):
@@ -93,6 +97,9 @@ def print_stats(self, sort=-1, limit=None, show_summary=True, mode=None):
             print("No samples were collected.")
             if mode == PROFILING_MODE_CPU:
                 print("This can happen in CPU mode when all threads are idle.")
+            elif mode == PROFILING_MODE_ALLOC:
+                print("This can happen in alloc mode when the process "
+                      "allocates less memory than the allocation interval.")
             return
 
         # Get the stats data
@@ -176,6 +183,11 @@ def print_stats(self, sort=-1, limit=None, show_summary=True, mode=None):
 
         # Print header with colors and proper alignment
         print(f"{ANSIColors.BOLD_BLUE}Profile Stats:{ANSIColors.RESET}")
+        if mode == PROFILING_MODE_ALLOC:
+            print(
+                "Each sample stands for one allocation interval of memory "
+                "allocated; the time columns do not apply."
+            )
 
         header_nsamples = f"{ANSIColors.BOLD_BLUE}{'nsamples':>{col_widths['nsamples']}}{ANSIColors.RESET}"
         header_sample_pct = f"{ANSIColors.BOLD_BLUE}{'sample%':>{col_widths['sample_pct']}}{ANSIColors.RESET}"
@@ -4,6 +4,7 @@
 import statistics
 import sys
 import sysconfig
+import tempfile
 import time
 from collections import deque
 from _colorize import ANSIColors
@@ -34,6 +35,10 @@ def _pause_threads(unwinder, blocking):
     PROFILING_MODE_GIL,
     PROFILING_MODE_ALL,
     PROFILING_MODE_EXCEPTION,
+    PROFILING_MODE_ALLOC,
+    DEFAULT_ALLOC_INTERVAL,
+    THREAD_STATUS_HAS_GIL,
+    THREAD_STATUS_ON_CPU,
 )
 from ._format_utils import fmt
 try:
@@ -47,14 +52,43 @@ def _pause_threads(unwinder, blocking):
 # If fewer samples are collected, we skip the TUI and just print a message
 MIN_SAMPLES_FOR_TUI = 200
 
+def _set_remote_allocation_sampling(pid, interval):
+    """Make process *pid* sample one allocation every *interval* bytes.
+
+    An *interval* of 0 stops sampling. The request runs asynchronously, the
+    next time the main thread of the process runs Python code.
+    """
+    fd, path = tempfile.mkstemp(prefix="alloc_sampling_", suffix=".py")
+    with os.fdopen(fd, "w") as script:
+        # The script removes itself once the target process has run it
+        script.write(
+            "import os, sys\n"
+            "try:\n"
+            f"    sys._set_allocation_sampling({interval:d})\n"
+            "finally:\n"
+            "    try:\n"
+            f"        os.remove({path!r})\n"
+            "    except OSError:\n"
+            "        pass\n"
+        )
+    os.chmod(path, 0o644)
+    try:
+        sys.remote_exec(pid, path)
+    except BaseException:
+        os.remove(path)
+        raise
+
+
 class SampleProfiler:
-    def __init__(self, pid, sample_interval_usec, all_threads, *, mode=PROFILING_MODE_WALL, native=False, gc=True, opcodes=False, skip_non_matching_threads=True, collect_stats=False, blocking=False):
+    def __init__(self, pid, sample_interval_usec, all_threads, *, mode=PROFILING_MODE_WALL, native=False, gc=True, opcodes=False, skip_non_matching_threads=True, collect_stats=False, blocking=False, alloc_interval=DEFAULT_ALLOC_INTERVAL):
         self.pid = pid
         self.sample_interval_usec = sample_interval_usec
         self.all_threads = all_threads
         self.mode = mode  # Store mode for later use
         self.collect_stats = collect_stats
         self.blocking = blocking
+        self.alloc_interval = alloc_interval
+        self.total_allocation_samples = 0
         try:
             self.unwinder = self._new_unwinder(native, gc, opcodes, skip_non_matching_threads)
         except RuntimeError as err:
@@ -73,7 +107,8 @@ def _new_unwinder(self, native, gc, opcodes, skip_non_matching_threads):
 
         return _remote_debugging.RemoteUnwinder(
             self.pid,
-            mode=self.mode,
+            # Allocation samples carry their own stacks
+            mode=PROFILING_MODE_WALL if self.mode == PROFILING_MODE_ALLOC else self.mode,
             native=native,
             gc=gc,
             opcodes=opcodes,
@@ -83,7 +118,43 @@ def _new_unwinder(self, native, gc, opcodes, skip_non_matching_threads):
             **kwargs
         )
 
+    def _collect_allocations(self, collector):
+        """Feed the allocations sampled since the last call to *collector*.
+
+        Each allocation sample becomes a one-thread stack sample weighted by
+        the number of sampling intervals the allocation accounts for.
+        """
+        status = THREAD_STATUS_HAS_GIL | THREAD_STATUS_ON_CPU
+        for alloc in self.unwinder.get_allocation_samples():
+            if not alloc.frame_info:
+                continue
+            thread_info = _remote_debugging.ThreadInfo(
+                (alloc.thread_id, status, alloc.frame_info)
+            )
+            stack_frames = [
+                _remote_debugging.InterpreterInfo(
+                    (alloc.interpreter_id, [thread_info])
+                )
+            ]
+            collector.collect(stack_frames, timestamps_us=[0] * alloc.weight)
+            self.total_allocation_samples += alloc.weight
+
     def sample(self, collector, duration_sec=None, *, async_aware=False):
+        if self.mode != PROFILING_MODE_ALLOC:
+            self._sample(collector, duration_sec, async_aware=async_aware)
+            return
+
+        _set_remote_allocation_sampling(self.pid, self.alloc_interval)
+        try:
+            self._sample(collector, duration_sec, async_aware=async_aware)
+        finally:
+            try:
+                _set_remote_allocation_sampling(self.pid, 0)
+            except (RuntimeError, OSError):
+                # The process has exited
+                pass
+
+    def _sample(self, collector, duration_sec=None, *, async_aware=False):
         sample_interval_sec = self.sample_interval_usec / 1_000_000
         num_samples = 0
         errors = 0
@@ -107,13 +178,16 @@ def sample(self, collector, duration_sec=None, *, async_aware=False):
                 elif next_time < current_time:
                     try:
                         with _pause_threads(self.unwinder, self.blocking):
-                            if async_aware == "all":
-                                stack_frames = self.unwinder.get_all_awaited_by()
-                            elif async_aware == "running":
-                                stack_frames = self.unwinder.get_async_stack_trace()
+                            if self.mode == PROFILING_MODE_ALLOC:
+                                self._collect_allocations(collector)
                             else:
-                                stack_frames = self.unwinder.get_stack_trace()
-                            collector.collect(stack_frames)
+                                if async_aware == "all":
+                                    stack_frames = self.unwinder.get_all_awaited_by()
+                                elif async_aware == "running":
+                                    stack_frames = self.unwinder.get_async_stack_trace()
+                                else:
+                                    stack_frames = self.unwinder.get_stack_trace()
+                                collector.collect(stack_frames)
                     except ProcessLookupError as e:
                         running_time_sec = current_time - start_time
                         break
@@ -167,6 +241,11 @@ def sample(self, collector, duration_sec=None, *, async_aware=False):
             print(f"Captured {num_samples:n} samples in {fmt(running_time_sec, 2)} seconds")
             print(f"Sample rate: {fmt(sample_rate, 2)} samples/sec")
             print(f"Error rate: {fmt(error_rate, 2)}")
+            if self.mode == PROFILING_MODE_ALLOC:
+                print(
+                    f"Allocation samples: {self.total_allocation_samples:n} "
+                    f"(one per {self.alloc_interval:n} bytes allocated)"
+                )
 
             # Print unwinder stats if stats collection is enabled
             if self.collect_stats:
@@ -309,6 +388,13 @@ def _print_binary_stats(self, collector):
 
         print(f"  {ANSIColors.CYAN}Binary Encoding:{ANSIColors.RESET}")
 
+        if collector.bucket_usec is not None:
+            print(f"    Time buckets:     {stats.get('bucket_records', 0):,}")
+            print(f"    Stack counts:     {stats.get('cell_records', 0):,} [{stats.get('total_samples', 0):,} samples]")
+            print(f"    Stack nodes:      {stats.get('stack_nodes', 0):,}")
+            self._print_bytes_written(stats)
+            return
+
         repeat_records = stats.get('repeat_records', 0)
         repeat_samples = stats.get('repeat_samples', 0)
         full_records = stats.get('full_records', 0)
@@ -337,7 +423,9 @@ def _print_binary_stats(self, collector):
         print(f"  {ANSIColors.CYAN}Frame Efficiency:{ANSIColors.RESET}")
         print(f"    Frames written:   {frames_written:,}")
         print(f"    Frames saved:     {frames_saved:,} ({ANSIColors.GREEN}{compression_pct:.1f}%{ANSIColors.RESET})")
+        self._print_bytes_written(stats)
 
+    def _print_bytes_written(self, stats):
         bytes_written = stats.get('bytes_written', 0)
         if bytes_written >= 1024 * 1024:
             bytes_str = f"{bytes_written / (1024 * 1024):.1f} MB"
@@ -383,6 +471,7 @@ def sample(
     gc=True,
     opcodes=False,
     blocking=False,
+    alloc_interval=DEFAULT_ALLOC_INTERVAL,
 ):
     """Sample a process using the provided collector.
 
@@ -395,11 +484,14 @@ def sample(
         realtime_stats: Whether to print real-time sampling statistics
         mode: Profiling mode - WALL (all samples), CPU (only when on CPU),
               GIL (only when holding GIL), ALL (includes GIL and CPU status),
-              EXCEPTION (only when thread has an active exception)
+              EXCEPTION (only when thread has an active exception),
+              ALLOC (memory allocations instead of time)
         native: Whether to include native frames
         gc: Whether to include GC frames
         opcodes: Whether to include opcode information
         blocking: Whether to stop all threads before sampling for consistent snapshots
+        alloc_interval: Mean number of bytes allocated between two samples
+            in ALLOC mode
 
     Returns:
         The collector with collected samples
@@ -426,6 +518,7 @@ def sample(
         skip_non_matching_threads=skip_non_matching_threads,
         collect_stats=realtime_stats,
         blocking=blocking,
+        alloc_interval=alloc_interval,
     )
     profiler.realtime_stats = realtime_stats
 
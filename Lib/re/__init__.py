@@ -117,6 +117,10 @@
     X  VERBOSE     Ignore whitespace and comments for nicer looking RE's.
     U  UNICODE     For compatibility only. Ignored for string patterns (it
                    is the default), and forbidden for bytes patterns.
+    LINEAR         Match in time linear in the length of the string, with
+                   a different engine which does not support backreferences,
+                   look-around assertions, atomic groups, possessive
+                   quantifiers and conditional patterns.
 
 This module also defines exception 'PatternError', aliased to 'error' for
 backward compatibility.
@@ -135,7 +139,7 @@
     "findall", "finditer", "compile", "purge", "escape",
     "error", "Pattern", "Match", "A", "I", "L", "M", "S", "X", "U",
     "ASCII", "IGNORECASE", "LOCALE", "MULTILINE", "DOTALL", "VERBOSE",
-    "UNICODE", "NOFLAG", "RegexFlag", "PatternError"
+    "UNICODE", "LINEAR", "NOFLAG", "RegexFlag", "PatternError"
 ]
 
 @enum.global_enum
@@ -149,6 +153,7 @@ class RegexFlag:
     MULTILINE = M = _compiler.SRE_FLAG_MULTILINE # make anchors look for newline
     DOTALL = S = _compiler.SRE_FLAG_DOTALL # make dot match newline
     VERBOSE = X = _compiler.SRE_FLAG_VERBOSE # ignore whitespace and comments
+    LINEAR = _compiler.SRE_FLAG_LINEAR # match in linear time
     # sre extensions (experimental, don't rely on these)
     DEBUG = _compiler.SRE_FLAG_DEBUG # dump pattern after compilation
     __str__ = object.__str__
@@ -522,6 +522,53 @@ def _get_charset_prefix(pattern, flags):
         return charset
     return None
 
+def _iter_required(pattern, flags):
+    # internal: flatten subpatterns, which don't affect what is matched
+    for op, av in pattern.data:
+        if op is SUBPATTERN:
+            group, add_flags, del_flags, p = av
+            yield from _iter_required(p, _combine_flags(flags, add_flags,
+                                                         del_flags))
+        else:
+            yield op, av, flags
+
+def _get_required_literal(pattern, flags):
+    # look for the longest literal string that every match must contain,
+    # and for the range of offsets from the start of the match at which
+    # it can be found
+    best = [], 0, 0
+    literal = []
+    lo = hi = 0
+    for op, av, flags1 in _iter_required(pattern, flags):
+        if op is LITERAL:
+            iscased = _get_iscased(flags1)
+            if not (iscased and iscased(av) or
+                    flags1 & SRE_FLAG_IGNORECASE and
+                    flags1 & SRE_FLAG_LOCALE):
+                if not literal:
+                    literal_lo, literal_hi = lo, hi
+                literal.append(av)
+                lo += 1
+                hi += 1
+                continue
+        if len(literal) > len(best[0]):
+            best = literal, literal_lo, literal_hi
+        literal = []
+        if op is SUCCESS:
+            break
+        if op in _REPEATING_CODES and av[0] or op is ATOMIC_GROUP:
+            # the first repetition is always matched
+            l, i, j = _get_required_literal(av if op is ATOMIC_GROUP
+                                            else av[2], flags1)
+            if len(l) > len(best[0]):
+                best = l, lo + i, hi + j
+        i, j = _parser.SubPattern(pattern.state, [(op, av)]).getwidth()
+        lo += i
+        hi += j
+    if len(literal) > len(best[0]):
+        best = literal, literal_lo, literal_hi
+    return best
+
 def _compile_info(code, pattern, flags):
     # internal: compile an info block.  in the current version,
     # this contains min/max pattern width, and an optional literal
@@ -547,6 +594,14 @@ def _compile_info(code, pattern, flags):
                 assert not hascased
                 if charset == _CHARSET_ALL:
                     charset = None
+    # look for a literal string in the rest of the pattern
+    required = []
+    if not prefix:
+        required, required_lo, required_hi = _get_required_literal(pattern,
+                                                                   flags)
+        if required_lo >= MAXCODE:
+            required = []
+        required_hi = min(required_hi, MAXREPEAT)
 ##     if prefix:
 ##         print("*** PREFIX", prefix, prefix_skip)
 ##     if charset:
@@ -563,6 +618,8 @@ def _compile_info(code, pattern, flags):
             mask = mask | SRE_INFO_LITERAL
     elif charset:
         mask = mask | SRE_INFO_CHARSET
+    if required:
+        mask = mask | SRE_INFO_REQUIRED
     emit(mask)
     # pattern length
     if lo < MAXCODE:
@@ -571,6 +628,12 @@ def _compile_info(code, pattern, flags):
         emit(MAXCODE)
         prefix = prefix[:MAXCODE]
     emit(hi)
+    # add required literal
+    if required:
+        emit(len(required)) # length
+        emit(required_lo) # offset range
+        emit(required_hi)
+        code.extend(required)
     # add literal prefix
     if prefix:
         emit(len(prefix)) # length
@@ -602,10 +665,117 @@ def _code(p, flags):
 
     return code
 
+# Programs compiled for re.LINEAR have no loop counters: counted repeats
+# are expanded, and the matcher needs memory proportional to the size of
+# the program, so it is limited.
+_MAXLINEARCODE = 1 << 17
+
+_LINEAR_UNSUPPORTED = {
+    ASSERT: "look-around assertions",
+    ASSERT_NOT: "look-around assertions",
+    ATOMIC_GROUP: "atomic groups",
+    GROUPREF: "backreferences",
+    GROUPREF_EXISTS: "conditional patterns",
+    POSSESSIVE_REPEAT: "possessive quantifiers",
+}
+
+def _compile_linear(code, pattern, flags):
+    # internal: compile a (sub)pattern into a Thompson NFA for re.LINEAR.
+    # The program uses the character tests, AT, MARK, FAILURE and SUCCESS
+    # operators of the backtracking engine, but JUMP and BRANCH take
+    # absolute targets:
+    #   <JUMP> <target>
+    #   <BRANCH> <preferred target> <other target>
+    emit = code.append
+    _len = len
+    for op, av in pattern:
+        if op in _UNIT_CODES or op is AT:
+            _compile(code, [(op, av)], flags)
+        elif op is FAILURE:
+            emit(op)
+        elif op is SUBPATTERN:
+            group, add_flags, del_flags, p = av
+            if group:
+                emit(MARK)
+                emit((group-1)*2)
+            _compile_linear(code, p, _combine_flags(flags, add_flags, del_flags))
+            if group:
+                emit(MARK)
+                emit((group-1)*2+1)
+        elif op is BRANCH:
+            tail = []
+            *items, last = av[1]
+            for p in items:
+                emit(BRANCH)
+                emit(_len(code) + 2)
+                skip = _len(code); emit(0)
+                _compile_linear(code, p, flags)
+                emit(JUMP)
+                tail.append(_len(code)); emit(0)
+                code[skip] = _len(code)
+            _compile_linear(code, last, flags)
+            for tail in tail:
+                code[tail] = _len(code)
+        elif op is MAX_REPEAT or op is MIN_REPEAT:
+            lo, hi, p = av
+            for i in range(lo):
+                start = _len(code)
+                _compile_linear(code, p, flags)
+                if _len(code) == start:
+                    break  # nothing to repeat
+                _check_linear_size(code)
+            if hi == MAXREPEAT:
+                # Loop back with a branch rather than a jump: if the
+                # body matched the empty string, the loop head was
+                # already visited at this position, and the repeat ends
+                # with the groups of that last iteration, as in the
+                # backtracking engine.
+                loop = _len(code)
+                emit(BRANCH)
+                emit(loop + 3); emit(0)
+                _compile_linear(code, p, flags)
+                branches = [loop, _len(code)]
+                emit(BRANCH)
+                emit(loop); emit(0)
+            else:
+                branches = []
+                for i in range(hi - lo):
+                    branches.append(_len(code))
+                    emit(BRANCH)
+                    emit(_len(code) + 2); emit(0)
+                    _compile_linear(code, p, flags)
+                    _check_linear_size(code)
+            # The other target of each branch leaves the repeat.
+            for branch in branches:
+                code[branch+2] = _len(code)
+                if op is MIN_REPEAT:
+                    code[branch+1], code[branch+2] = code[branch+2], code[branch+1]
+        elif op in _LINEAR_UNSUPPORTED:
+            raise PatternError(f"{_LINEAR_UNSUPPORTED[op]} are not "
+                               f"supported with re.LINEAR")
+        else:
+            raise PatternError(f"internal: unsupported operand type {op!r}")
+        _check_linear_size(code)
+
+def _check_linear_size(code):
+    if len(code) > _MAXLINEARCODE:
+        raise PatternError("pattern too large for re.LINEAR")
+
+def _code_linear(p, flags):
+
+    flags = p.state.flags | flags
+    code = []
+
+    _compile_linear(code, p.data, flags)
+
+    code.append(SUCCESS)
+
+    return code
+
 def _hex_code(code):
     return '[%s]' % ', '.join('%#0*x' % (_sre.CODESIZE*2+2, x) for x in code)
 
-def dis(code):
+def dis(code, linear=False):
     import sys
 
     labels = set()
@@ -684,6 +854,14 @@ def print_2(*args):
                 arg = code[i]
                 i += 1
                 print_(op, arg)
+            elif op is JUMP and linear:
+                print_(op, to=code[i])
+                i += 1
+            elif op is BRANCH and linear:
+                preferred, other = code[i: i+2]
+                labels.update((preferred, other))
+                print_(op, '(to %d or %d)' % (preferred, other))
+                i += 2
             elif op is JUMP:
                 skip = code[i]
                 print_(op, skip, to=i+skip)
@@ -729,10 +907,21 @@ def print_2(*args):
                     max = 'MAXREPEAT'
                 print_(op, skip, bin(flags), min, max, to=i+skip)
                 start = i+4
+                if flags & SRE_INFO_REQUIRED:
+                    required_len, required_lo, required_hi = code[start: start+3]
+                    if required_hi == MAXREPEAT:
+                        required_hi = 'MAXREPEAT'
+                    print_2('  required_offset', required_lo, required_hi)
+                    start += 3
+                    required = code[start: start+required_len]
+                    print_2('  required',
+                            '[%s]' % ', '.join('%#02x' % x for x in required),
+                            '(%r)' % ''.join(map(chr, required)))
+                    start += required_len
                 if flags & SRE_INFO_PREFIX:
-                    prefix_len, prefix_skip = code[i+4: i+6]
+                    prefix_len, prefix_skip = code[start: start+2]
                     print_2('  prefix_skip', prefix_skip)
-                    start = i + 6
+                    start += 2
                     prefix = code[start: start+prefix_len]
                     print_2('  prefix',
                             '[%s]' % ', '.join('%#02x' % x for x in prefix),
@@ -763,11 +952,15 @@ def compile(p, flags=0):
     else:
         pattern = None
 
-    code = _code(p, flags)
+    linear = (flags | p.state.flags) & SRE_FLAG_LINEAR
+    if linear:
+        code = _code_linear(p, flags)
+    else:
+        code = _code(p, flags)
 
     if flags & SRE_FLAG_DEBUG:
         print()
-        dis(code)
+        dis(code, linear)
 
     # map in either direction
     groupindex = p.state.groupdict
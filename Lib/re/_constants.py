@@ -13,7 +13,7 @@
 
 # update when constants are added or removed
 
-MAGIC = 20230612
+MAGIC = 20261018
 
 from _sre import MAXREPEAT, MAXGROUPS  # noqa: F401
 
@@ -217,8 +217,10 @@ def _makecodes(*names):
 SRE_FLAG_VERBOSE = 64 # ignore whitespace and comments
 SRE_FLAG_DEBUG = 128 # debugging
 SRE_FLAG_ASCII = 256 # use ascii "locale"
+SRE_FLAG_LINEAR = 512 # linear time matching
 
 # flags for INFO primitive
 SRE_INFO_PREFIX = 1 # has prefix
 SRE_INFO_LITERAL = 2 # entire pattern is literal (given by prefix)
 SRE_INFO_CHARSET = 4 # pattern starts with character from given set
+SRE_INFO_REQUIRED = 8 # pattern contains a given literal string
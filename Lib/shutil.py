@@ -4,6 +4,7 @@
 
 """
 
+import io
 import os
 import sys
 import stat
@@ -57,6 +58,7 @@
 _USE_CP_SENDFILE = (hasattr(os, "sendfile")
                     and sys.platform.startswith(("linux", "android", "sunos")))
 _USE_CP_COPY_FILE_RANGE = hasattr(os, "copy_file_range")
+_USE_CP_SPLICE = hasattr(os, "splice")
 _HAS_FCOPYFILE = posix and hasattr(posix, "_fcopyfile")  # macOS
 
 # CMD defaults in Windows 10
@@ -180,15 +182,8 @@ def _fastcopy_sendfile(fsrc, fdst):
     high-performance sendfile(2) syscall.
     This should work on Linux >= 2.6.33, Android and Solaris.
     """
-    # Note: copyfileobj() is left alone in order to not introduce any
-    # unexpected breakage. Possible risks by using zero-copy calls
-    # in copyfileobj() are:
-    # - fdst cannot be open in "a"(ppend) mode
-    # - fsrc and fdst may be open in "t"(ext) mode
-    # - fsrc may be a BufferedReader (which hides unread data in a buffer),
-    #   GzipFile (which decompresses data), HTTPResponse (which decodes
-    #   chunks).
-    # - possibly others (e.g. encrypted fs/partition?)
+    # Note: copyfileobj() only uses zero-copy calls for plain binary file
+    # objects, see _fastcopy_fileobj().
     global _USE_CP_SENDFILE
     try:
         infd = fsrc.fileno()
@@ -226,6 +221,117 @@ def _fastcopy_sendfile(fsrc, fdst):
                 break  # EOF
             offset += sent
 
+def _fastcopy_fileobj_loop(copy_func, blocksize):
+    """Call copy_func(blocksize) until EOF and return the number of
+    bytes copied.  Raise _GiveupOnFastCopy if the first call fails.
+    """
+    copied = 0
+    while True:
+        try:
+            n = copy_func(blocksize)
+        except OSError as err:
+            if err.errno == errno.ENOSPC or copied:
+                raise
+            raise _GiveupOnFastCopy(err)
+        if n == 0:
+            return copied  # EOF
+        copied += n
+
+def _splice_through_pipe(infd, outfd):
+    """splice(2) between two descriptors which are not pipes, such as
+    a socket and a regular file, through an intermediate pipe.
+    """
+    r, w = os.pipe()
+    try:
+        def copy_func(blocksize):
+            n = os.splice(infd, w, blocksize)
+            left = n
+            while left:
+                left -= os.splice(r, outfd, left)
+            return n
+        # Each round trip moves at most the capacity of the pipe.
+        return _fastcopy_fileobj_loop(copy_func, 2 ** 16)
+    finally:
+        os.close(r)
+        os.close(w)
+
+# Types of file objects whose data is exactly what their file descriptor
+# reads or writes: no text decoding, decompression or chunked encoding.
+_FASTCOPY_READERS = (io.FileIO, io.BufferedReader, io.BufferedRandom)
+_FASTCOPY_WRITERS = (io.FileIO, io.BufferedWriter, io.BufferedRandom)
+
+def _fastcopy_fileobj(fsrc, fdst):
+    """Copy data from the current position of fsrc to fdst by using
+    zero-copy syscalls: copy_file_range(2) between regular files, then
+    splice(2) if either file is a pipe or fsrc is not a regular file,
+    then sendfile(2) from a regular file (Linux).
+
+    Only plain binary file objects are accepted: the data read ahead by a
+    buffered fsrc is written first, and a buffered fdst is flushed.
+    """
+    if (type(fsrc) not in _FASTCOPY_READERS
+            or type(fdst) not in _FASTCOPY_WRITERS
+            or type(getattr(fsrc, 'raw', fsrc)) is not io.FileIO
+            or type(getattr(fdst, 'raw', fdst)) is not io.FileIO
+            or 'a' in fdst.mode):
+        raise _GiveupOnFastCopy()
+    try:
+        infd = fsrc.fileno()
+        outfd = fdst.fileno()
+        st_in = os.fstat(infd)
+        st_out = os.fstat(outfd)
+    except Exception as err:
+        raise _GiveupOnFastCopy(err)
+    in_reg = stat.S_ISREG(st_in.st_mode)
+    out_reg = stat.S_ISREG(st_out.st_mode)
+    any_pipe = stat.S_ISFIFO(st_in.st_mode) or stat.S_ISFIFO(st_out.st_mode)
+    if not (in_reg and _USE_CP_SENDFILE
+            or in_reg and out_reg and _USE_CP_COPY_FILE_RANGE
+            or not (in_reg and out_reg) and _USE_CP_SPLICE):
+        raise _GiveupOnFastCopy()
+
+    if fsrc is not getattr(fsrc, 'raw', fsrc):
+        # peek() only reads from the file if nothing is buffered.
+        if data := fsrc.read1(len(fsrc.peek(1))):
+            fdst.write(data)
+        else:
+            return  # EOF
+    if fdst is not getattr(fdst, 'raw', fdst):
+        fdst.flush()
+
+    blocksize = _determine_linux_fastcopy_blocksize(infd)
+    try:
+        if in_reg and out_reg and _USE_CP_COPY_FILE_RANGE:
+            try:
+                # copy_file_range() may silently copy nothing, see
+                # _fastcopy_copy_file_range().
+                if _fastcopy_fileobj_loop(
+                        lambda n: os.copy_file_range(infd, outfd, n),
+                        blocksize):
+                    return
+            except _GiveupOnFastCopy:
+                pass
+        if _USE_CP_SPLICE and (any_pipe or not in_reg):
+            try:
+                if any_pipe:
+                    _fastcopy_fileobj_loop(
+                        lambda n: os.splice(infd, outfd, n), blocksize)
+                else:
+                    _splice_through_pipe(infd, outfd)
+                return
+            except _GiveupOnFastCopy:
+                pass
+        if in_reg and _USE_CP_SENDFILE:
+            _fastcopy_fileobj_loop(
+                lambda n: os.sendfile(outfd, infd, None, n), blocksize)
+            return
+        raise _GiveupOnFastCopy()
+    except OSError as err:
+        # ...in order to have a more informative exception.
+        err.filename = getattr(fsrc, 'name', None)
+        err.filename2 = getattr(fdst, 'name', None)
+        raise err from None
+
 def _copyfileobj_readinto(fsrc, fdst, length=COPY_BUFSIZE):
     """readinto()/memoryview() based variant of copyfileobj().
     *fsrc* must support readinto() method and both files must be
@@ -248,6 +354,13 @@ def _copyfileobj_readinto(fsrc, fdst, length=COPY_BUFSIZE):
 
 def copyfileobj(fsrc, fdst, length=0):
     """copy data from file-like object fsrc to file-like object fdst"""
+    if _USE_CP_SPLICE:
+        # Linux
+        try:
+            _fastcopy_fileobj(fsrc, fdst)
+            return
+        except _GiveupOnFastCopy:
+            pass
     if not length:
         length = COPY_BUFSIZE
     # Localize variable access to minimize overhead.
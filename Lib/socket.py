@@ -350,11 +350,15 @@ def makefile(self, mode="r", buffering=None, *,
         return text
 
     def _sendfile_zerocopy(self, zerocopy_func, giveup_exc_type, file,
-                           offset=0, count=None):
+                           offset=0, count=None, *, pipe=False):
         """
         Send a file using a zero-copy function.
+
+        If *pipe* is true, *file* must be a pipe rather than a regular
+        file, and *offset* is ignored.
         """
         import selectors
+        import stat
 
         self._check_sendfile_params(file, offset, count)
         sockno = self.fileno()
@@ -363,9 +367,18 @@ def _sendfile_zerocopy(self, zerocopy_func, giveup_exc_type, file,
         except (AttributeError, io.UnsupportedOperation) as err:
             raise giveup_exc_type(err)  # not a regular file
         try:
-            fsize = os.fstat(fileno).st_size
+            st = os.fstat(fileno)
         except OSError as err:
             raise giveup_exc_type(err)  # not a regular file
+        if pipe:
+            if not stat.S_ISFIFO(st.st_mode):
+                raise giveup_exc_type("not a pipe")
+            fsize = 2 ** 30
+        elif not stat.S_ISREG(st.st_mode):
+            # st_size is meaningless
+            raise giveup_exc_type("not a regular file")
+        else:
+            fsize = st.st_size
         if not fsize:
             return 0  # empty file
         # Truncate to 1GiB to avoid OverflowError, see bpo-38319.
@@ -416,7 +429,7 @@ def _sendfile_zerocopy(self, zerocopy_func, giveup_exc_type, file,
                     total_sent += sent
             return total_sent
         finally:
-            if total_sent > 0 and hasattr(file, 'seek'):
+            if total_sent > 0 and not pipe and hasattr(file, 'seek'):
                 file.seek(offset)
 
     if hasattr(os, 'sendfile'):
@@ -431,6 +444,46 @@ def _sendfile_use_sendfile(self, file, offset=0, count=None):
             raise _GiveupOnSendfile(
                 "os.sendfile() not available on this platform")
 
+    if hasattr(os, 'splice'):
+        def _sendfile_use_splice(self, file, offset=0, count=None):
+            if offset:
+                raise _GiveupOnSendfile("pipes cannot seek")
+            total_sent = 0
+            if isinstance(file, io.BufferedReader):
+                # Send the data read ahead into the buffer first.  peek()
+                # only reads from the pipe if nothing is buffered.
+                try:
+                    peeked = len(file.peek(1))
+                except (OSError, ValueError) as err:
+                    raise _GiveupOnSendfile(err)
+                data = file.read1(min(count, peeked) if count else peeked)
+                if not data:
+                    return 0  # EOF
+                self.sendall(data)
+                total_sent = len(data)
+                if count:
+                    count -= total_sent
+                    if not count:
+                        return total_sent
+            sockno = self.fileno()
+            try:
+                return total_sent + self._sendfile_zerocopy(
+                    lambda fileno, offset, blocksize:
+                        os.splice(fileno, sockno, blocksize),
+                    _GiveupOnSendfile,
+                    file, 0, count, pipe=True,
+                )
+            except _GiveupOnSendfile:
+                if total_sent:
+                    # The rest of the pipe is sent with send().
+                    return total_sent + self._sendfile_use_send(
+                        file, 0, count)
+                raise
+    else:
+        def _sendfile_use_splice(self, file, offset=0, count=None):
+            raise _GiveupOnSendfile(
+                "os.splice() not available on this platform")
+
     def _sendfile_use_send(self, file, offset=0, count=None):
         self._check_sendfile_params(file, offset, count)
         if self.gettimeout() == 0:
@@ -464,7 +517,8 @@ def _sendfile_use_send(self, file, offset=0, count=None):
                             break
             return total_sent
         finally:
-            if total_sent > 0 and hasattr(file, 'seek'):
+            if (total_sent > 0 and hasattr(file, 'seek')
+                    and getattr(file, 'seekable', lambda: True)()):
                 file.seek(offset + total_sent)
 
     def _check_sendfile_params(self, file, offset, count):
@@ -486,9 +540,11 @@ def sendfile(self, file, offset=0, count=None):
         Send a file until EOF is reached by using high-performance
         os.sendfile() and return the total number of bytes which
         were sent.
-        *file* must be a regular file object opened in binary mode.
+        *file* must be a file object opened in binary mode.  Data is
+        read from pipes with os.splice() where available.
         If os.sendfile() is not available (e.g. Windows) or file is
-        not a regular file socket.send() will be used instead.
+        neither a regular file nor a pipe, socket.send() will be used
+        instead.
         *offset* tells from where to start reading the file.
         If specified, *count* is the total number of bytes to transmit
         as opposed to sending the file until EOF is reached.
@@ -500,6 +556,10 @@ def sendfile(self, file, offset=0, count=None):
         """
         try:
             return self._sendfile_use_sendfile(file, offset, count)
+        except _GiveupOnSendfile:
+            pass
+        try:
+            return self._sendfile_use_splice(file, offset, count)
         except _GiveupOnSendfile:
             return self._sendfile_use_send(file, offset, count)
 
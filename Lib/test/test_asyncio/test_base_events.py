@@ -1,6 +1,7 @@
 """Tests for base_events.py"""
 
 import concurrent.futures
+import contextvars
 import errno
 import math
 import platform
@@ -2156,6 +2157,123 @@ async def stop_loop_coro(loop):
                          "took .* seconds$")
 
 
+@unittest.skipIf(base_events._asyncio is None,
+                 'requires the C _asyncio module')
+class ReadyQueueTests(unittest.TestCase):
+
+    def setUp(self):
+        self.loop = asyncio.new_event_loop()
+        self.loop.set_debug(False)
+
+    def tearDown(self):
+        self.loop.close()
+
+    def schedule_done_callback(self, callback, **kwargs):
+        fut = self.loop.create_future()
+        fut.add_done_callback(callback, **kwargs)
+        fut.set_result(None)
+        return fut
+
+    def test_callbacks_keep_order(self):
+        order = []
+        self.loop.call_soon(order.append, 1)
+        self.schedule_done_callback(lambda fut: order.append(2))
+        self.loop.call_soon(order.append, 3)
+        self.assertEqual(len(self.loop._ready), 3)
+
+        self.loop._ready.run(3)
+        self.assertEqual(order, [1, 2, 3])
+        self.assertFalse(self.loop._ready)
+
+    def test_popleft_creates_handle(self):
+        callback = mock.Mock()
+        context = contextvars.copy_context()
+        fut = self.schedule_done_callback(callback, context=context)
+
+        handle = self.loop._ready.popleft()
+        self.assertIsInstance(handle, asyncio.Handle)
+        self.assertIs(handle._callback, callback)
+        self.assertEqual(handle._args, (fut,))
+        self.assertIs(handle.get_context(), context)
+        self.assertFalse(self.loop._ready)
+        with self.assertRaises(IndexError):
+            self.loop._ready.popleft()
+
+        handle._run()
+        callback.assert_called_once_with(fut)
+
+    def test_iter_and_clear(self):
+        h = self.loop.call_soon(lambda: None)
+        self.schedule_done_callback(lambda fut: None)
+
+        handles = list(self.loop._ready)
+        self.assertEqual(len(handles), 2)
+        self.assertIs(handles[0], h)
+        self.assertIsInstance(handles[1], asyncio.Handle)
+        self.assertIn(h, self.loop._ready)
+
+        self.loop._ready.clear()
+        self.assertEqual(len(self.loop._ready), 0)
+        self.assertEqual(list(self.loop._ready), [])
+
+    def test_task_step(self):
+        async def coro():
+            await asyncio.sleep(0)
+            return 42
+
+        task = self.loop.create_task(coro())
+        [handle] = self.loop._ready
+        self.assertIs(handle._callback.__self__, task)
+        self.assertEqual(self.loop.run_until_complete(task), 42)
+
+    def test_cancelled_handle_is_skipped(self):
+        callback = mock.Mock()
+        self.loop.call_soon(callback).cancel()
+        self.loop._ready.run(1)
+        callback.assert_not_called()
+
+    def test_exception_in_callback(self):
+        def callback(fut):
+            raise ZeroDivisionError
+
+        handler = mock.Mock()
+        self.loop.set_exception_handler(handler)
+        self.schedule_done_callback(callback)
+        self.loop._ready.run(1)
+
+        handler.assert_called_once()
+        context = handler.call_args[0][1]
+        self.assertIsInstance(context['exception'], ZeroDivisionError)
+        self.assertRegex(context['message'],
+                         r'^Exception in callback .*callback')
+        self.assertIs(context['handle']._callback, callback)
+
+    def test_keyboard_interrupt_propagates(self):
+        def callback(fut):
+            raise KeyboardInterrupt
+
+        other = mock.Mock()
+        self.schedule_done_callback(callback)
+        self.loop.call_soon(other)
+        with self.assertRaises(KeyboardInterrupt):
+            self.loop._ready.run(2)
+        other.assert_not_called()
+        self.assertEqual(len(self.loop._ready), 1)
+
+    def test_overridden_call_soon_is_used(self):
+        callback = mock.Mock()
+        self.loop.call_soon = mock.Mock(wraps=self.loop.call_soon)
+        fut = self.schedule_done_callback(callback)
+        self.loop.call_soon.assert_called_once_with(
+            callback, fut, context=mock.ANY)
+
+    def test_debug_mode_uses_call_soon(self):
+        self.loop.set_debug(True)
+        self.schedule_done_callback(lambda fut: None)
+        handle = self.loop._ready.popleft()
+        self.assertIsNotNone(handle._source_traceback)
+
+
 class RunningLoopTests(unittest.TestCase):
 
     def test_running_loop_within_a_loop(self):
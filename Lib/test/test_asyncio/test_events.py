@@ -2366,6 +2366,45 @@ class PollEventLoopTests(EventLoopTestsMixin,
             def create_event_loop(self):
                 return asyncio.SelectorEventLoop(selectors.PollSelector())
 
+    if (sys.platform == 'linux'
+            and asyncio.uring_events._uring_available()):
+        class UringEventLoopTests(EventLoopTestsMixin,
+                                  SubprocessTestsMixin,
+                                  test_utils.TestCase):
+
+            def create_event_loop(self):
+                return asyncio.UringEventLoop()
+
+            def test_reader_callback(self):
+                raise unittest.SkipTest("UringEventLoop does not have add_reader()")
+
+            def test_reader_callback_cancel(self):
+                raise unittest.SkipTest("UringEventLoop does not have add_reader()")
+
+            def test_writer_callback(self):
+                raise unittest.SkipTest("UringEventLoop does not have add_writer()")
+
+            def test_writer_callback_cancel(self):
+                raise unittest.SkipTest("UringEventLoop does not have add_writer()")
+
+            def test_remove_fds_after_closing(self):
+                raise unittest.SkipTest("UringEventLoop does not have add_reader()")
+
+            # These tests read from the pipe synchronously after each write,
+            # without running the event loop to submit the write.
+            def test_write_pipe(self):
+                raise unittest.SkipTest("UringEventLoop writes asynchronously")
+
+            def test_write_pty(self):
+                raise unittest.SkipTest("UringEventLoop writes asynchronously")
+
+            def test_bidirectional_pty(self):
+                raise unittest.SkipTest("UringEventLoop writes asynchronously")
+
+            def test_unclosed_pipe_transport(self):
+                raise unittest.SkipTest("UringEventLoop uses proactor pipe "
+                                        "transports")
+
     # Should always exist.
     class SelectEventLoopTests(EventLoopTestsMixin,
                                SubprocessTestsMixin,
@@ -2375,6 +2414,22 @@ def create_event_loop(self):
             return asyncio.SelectorEventLoop(selectors.SelectSelector())
 
 
+class MultiThreadedEventLoopTests(EventLoopTestsMixin,
+                                  SubprocessTestsMixin,
+                                  test_utils.TestCase):
+
+    def create_event_loop(self):
+        return asyncio.MultiThreadedEventLoop(threads=4)
+
+    def test_call_soon_threadsafe(self):
+        raise unittest.SkipTest("MultiThreadedEventLoop runs callbacks "
+                                "in parallel")
+
+    def test_call_soon_threadsafe_same_thread(self):
+        raise unittest.SkipTest("MultiThreadedEventLoop runs callbacks "
+                                "in parallel")
+
+
 def noop(*args, **kwargs):
     pass
 
@@ -0,0 +1,235 @@
+"""Tests for asyncio.MultiThreadedEventLoop."""
+
+import asyncio
+import contextvars
+import threading
+import unittest
+from unittest import mock
+
+from asyncio import base_events
+
+
+def tearDownModule():
+    asyncio.events._set_event_loop_policy(None)
+
+
+@unittest.skipIf(base_events._asyncio is None,
+                 'requires the C _asyncio module')
+class ShardedReadyQueueTests(unittest.TestCase):
+
+    def setUp(self):
+        self.loop = asyncio.MultiThreadedEventLoop(threads=3)
+        self.ready = self.loop._ready
+
+    def tearDown(self):
+        self.loop.close()
+
+    def test_workers(self):
+        self.assertEqual(self.ready.workers, 3)
+        self.assertEqual(self.ready.waiting, 0)
+        with self.assertRaises(ValueError):
+            base_events._asyncio.ReadyQueue(self.loop, 0)
+        with self.assertRaises(ValueError):
+            self.ready.run(1, 3)
+        with self.assertRaises(ValueError):
+            self.ready.run(1, -1)
+
+    def test_append_spreads_over_workers(self):
+        for i in range(6):
+            self.ready.append(mock.Mock())
+        self.assertEqual(len(self.ready), 6)
+        self.assertEqual(len(list(self.ready)), 6)
+
+        # Each worker finds its own callbacks first, then steals.
+        self.assertEqual(self.ready.run(2, 1), 2)
+        self.assertEqual(len(self.ready), 4)
+        self.assertEqual(self.ready.run(4, 2), 4)
+        self.assertFalse(self.ready)
+        self.assertEqual(self.ready.run(1, 0), 0)
+
+    def test_callbacks_scheduled_by_a_worker_stay_on_it(self):
+        order = []
+
+        def first():
+            order.append(1)
+            self.loop.call_soon(order.append, 2)
+            self.loop.call_soon(order.append, 3)
+
+        self.loop.call_soon(first)
+        self.assertEqual(self.ready.run(3, 2), 3)
+        self.assertEqual(order, [1, 2, 3])
+
+    def test_context_entered_by_another_thread(self):
+        # A callback whose context is entered by another thread is queued
+        # again instead of failing.
+        context = contextvars.copy_context()
+        entered = threading.Event()
+        release = threading.Event()
+
+        def hold():
+            entered.set()
+            release.wait()
+
+        thread = threading.Thread(target=context.run, args=(hold,))
+        thread.start()
+        try:
+            entered.wait()
+            callback = mock.Mock()
+            self.loop.call_soon(callback, context=context)
+            fut = self.loop.create_future()
+            fut.add_done_callback(callback, context=context)
+            fut.set_result(None)
+            self.assertEqual(self.ready.run(2, 0), 2)
+            callback.assert_not_called()
+            self.assertEqual(len(self.ready), 2)
+        finally:
+            release.set()
+            thread.join()
+        self.assertEqual(self.ready.run(2, 0), 2)
+        self.assertEqual(callback.call_count, 2)
+        self.assertFalse(self.ready)
+
+    def test_clear(self):
+        for i in range(5):
+            self.loop.call_soon(lambda: None)
+        self.ready.clear()
+        self.assertEqual(len(self.ready), 0)
+        self.assertEqual(list(self.ready), [])
+
+    def test_wait_and_wakeup(self):
+        # With no callbacks queued, wait() blocks until wakeup() or until
+        # a callback is queued.
+        started = threading.Event()
+        done = threading.Event()
+
+        def waiter():
+            started.set()
+            self.ready.wait()
+            done.set()
+
+        thread = threading.Thread(target=waiter)
+        thread.start()
+        try:
+            started.wait()
+            self.loop.call_soon(lambda: None)
+            self.assertTrue(done.wait(timeout=30))
+        finally:
+            thread.join()
+        self.assertEqual(self.ready.waiting, 0)
+
+        done.clear()
+        self.ready.clear()
+        thread = threading.Thread(target=waiter)
+        thread.start()
+        try:
+            self.ready.wakeup()
+            while not done.wait(timeout=0.01):
+                self.ready.wakeup()
+        finally:
+            thread.join()
+
+    def test_wait_returns_when_stopping(self):
+        self.loop._stopping = True
+        self.ready.wait()
+        self.assertEqual(self.ready.waiting, 0)
+
+
+@unittest.skipIf(base_events._asyncio is None,
+                 'requires the C _asyncio module')
+class MultiThreadedEventLoopTests(unittest.TestCase):
+
+    def run_with_threads(self, coro, threads=4):
+        return asyncio.run(
+            coro, loop_factory=lambda: asyncio.MultiThreadedEventLoop(
+                threads=threads))
+
+    def test_invalid_threads(self):
+        with self.assertRaises(ValueError):
+            asyncio.MultiThreadedEventLoop(threads=0)
+
+    def test_default_threads(self):
+        loop = asyncio.MultiThreadedEventLoop()
+        try:
+            self.assertGreaterEqual(loop._ready.workers, 1)
+        finally:
+            loop.close()
+
+    def test_tasks_run_on_worker_threads(self):
+        lock = threading.Lock()
+        threads = set()
+
+        async def step():
+            for _ in range(20):
+                with lock:
+                    threads.add(threading.current_thread())
+                await asyncio.sleep(0)
+
+        async def main():
+            async with asyncio.TaskGroup() as tg:
+                for _ in range(50):
+                    tg.create_task(step())
+
+        self.run_with_threads(main())
+        # Which workers get to run tasks depends on the scheduler, but
+        # only the loop's own threads run them.
+        for thread in threads:
+            self.assertTrue(thread is threading.main_thread() or
+                            thread.name.startswith('asyncio-worker-'))
+
+    def test_results_and_all_tasks(self):
+        async def square(x):
+            await asyncio.sleep(0)
+            return x * x
+
+        async def main():
+            tasks = [asyncio.create_task(square(i)) for i in range(100)]
+            current = asyncio.current_task()
+            self.assertEqual(asyncio.all_tasks(), {current, *tasks})
+            results = await asyncio.gather(*tasks)
+            self.assertEqual(asyncio.all_tasks(), {current})
+            return results
+
+        self.assertEqual(self.run_with_threads(main()),
+                         [i * i for i in range(100)])
+
+    def test_sleep_and_executor(self):
+        async def main():
+            loop = asyncio.get_running_loop()
+            await asyncio.sleep(0.01)
+            return await loop.run_in_executor(None, sum, [1, 2, 3])
+
+        self.assertEqual(self.run_with_threads(main()), 6)
+
+    def test_exception_in_worker_thread(self):
+        loop = asyncio.MultiThreadedEventLoop(threads=2)
+        try:
+            def callback():
+                if threading.current_thread() is not threading.main_thread():
+                    raise KeyboardInterrupt
+                loop.call_soon(callback)
+
+            # Keep both workers busy until one of them is a worker thread.
+            loop.call_soon(callback)
+            loop.call_soon(callback)
+            with self.assertRaises(KeyboardInterrupt):
+                loop.run_forever()
+            self.assertFalse(loop.is_running())
+        finally:
+            loop._ready.clear()
+            loop.close()
+
+    def test_stop_before_run_forever(self):
+        loop = asyncio.MultiThreadedEventLoop(threads=4)
+        try:
+            callback = mock.Mock()
+            loop.call_soon(callback)
+            loop.stop()
+            loop.run_forever()
+            callback.assert_called_once_with()
+            self.assertFalse(loop.is_running())
+        finally:
+            loop.close()
+
+
+if __name__ == '__main__':
+    unittest.main()
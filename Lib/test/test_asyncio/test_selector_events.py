@@ -1634,6 +1634,104 @@ def test_sendto_ready_error_received_connection(self):
         self.assertFalse(transport._fatal_error.called)
         self.assertTrue(self.protocol.error_received.called)
 
+    def batch_transport(self, address=None):
+        self.sock.family = socket.AF_INET
+        transport = self.datagram_transport(address)
+        if not transport._can_batch:
+            self.skipTest('requires socket.recvmmsg_into()')
+        return transport
+
+    def test_read_ready_batch_threshold(self):
+        transport = self.batch_transport()
+        self.sock.recvfrom.return_value = (b'data', ('0.0.0.0', 1234))
+        for _ in range(transport._batch_threshold - 1):
+            transport._read_ready()
+        self.assertIsNone(transport._recv_buffers)
+        transport._read_ready()
+        self.assertEqual(len(transport._recv_buffers), transport._batch_size)
+        self.assertEqual(self.sock.recvfrom.call_count,
+                         transport._batch_threshold)
+
+        def recvmmsg_into(buffers):
+            buffers[0][:2] = b'ab'
+            buffers[1][:3] = b'cde'
+            return [(2, ('0.0.0.0', 1)), (3, ('0.0.0.0', 2))]
+
+        self.sock.recvmmsg_into.side_effect = recvmmsg_into
+        self.protocol.datagram_received.reset_mock()
+        transport._read_ready()
+        self.assertEqual(self.protocol.datagram_received.call_args_list,
+                         [mock.call(b'ab', ('0.0.0.0', 1)),
+                          mock.call(b'cde', ('0.0.0.0', 2))])
+        self.assertEqual(self.sock.recvfrom.call_count,
+                         transport._batch_threshold)
+
+    def test_read_ready_no_batch_unix(self):
+        self.sock.family = getattr(socket, 'AF_UNIX', None)
+        transport = self.datagram_transport()
+        self.sock.recvfrom.return_value = (b'data', '/tmp/sock')
+        for _ in range(transport._batch_threshold + 1):
+            transport._read_ready()
+        self.assertIsNone(transport._recv_buffers)
+        self.assertFalse(self.sock.recvmmsg_into.called)
+
+    def test_read_ready_batch_oserr(self):
+        transport = self.batch_transport()
+        transport._recv_buffers = [memoryview(bytearray(8))]
+        transport._fatal_error = mock.Mock()
+        err = self.sock.recvmmsg_into.side_effect = ConnectionRefusedError()
+        transport._read_ready()
+        self.assertFalse(transport._fatal_error.called)
+        self.protocol.error_received.assert_called_with(err)
+
+    def test_sendto_ready_batch(self):
+        transport = self.batch_transport()
+        # One full batch, then a single datagram sent with sendto().
+        count = transport._batch_size + 1
+        items = [(b'data%d' % i, ('0.0.0.0', i)) for i in range(count)]
+        transport._buffer.extend(items)
+        transport._buffer_size = sum(len(data) + transport._header_size
+                                     for data, _ in items)
+        self.sock.sendmmsg.side_effect = lambda msgs: len(msgs)
+        self.sock.sendto.return_value = 6
+        self.loop._add_writer(7, transport._sendto_ready)
+        transport._sendto_ready()
+
+        self.sock.sendmmsg.assert_called_once_with(items[:-1])
+        self.sock.sendto.assert_called_once_with(*items[-1])
+        self.assertFalse(transport._buffer)
+        self.assertEqual(transport._buffer_size, 0)
+        self.assertFalse(self.loop.writers)
+
+    def test_sendto_ready_batch_connected(self):
+        transport = self.batch_transport(address=('0.0.0.0', 1))
+        transport._buffer.extend([(b'data1', ()), (b'data2', ())])
+        self.sock.sendmmsg.return_value = 2
+        transport._sendto_ready()
+        self.sock.sendmmsg.assert_called_once_with([b'data1', b'data2'])
+        self.assertFalse(transport._buffer)
+
+    def test_sendto_ready_batch_partial(self):
+        transport = self.batch_transport()
+        transport._buffer.extend([(b'data1', ()), (b'data2', ()),
+                                  (b'data3', ())])
+        self.sock.sendmmsg.side_effect = [1, BlockingIOError]
+        self.loop._add_writer(7, transport._sendto_ready)
+        transport._sendto_ready()
+        self.loop.assert_writer(7, transport._sendto_ready)
+        self.assertEqual([(b'data2', ()), (b'data3', ())],
+                         list(transport._buffer))
+
+    def test_sendto_ready_batch_error_received(self):
+        transport = self.batch_transport()
+        transport._fatal_error = mock.Mock()
+        transport._buffer.extend([(b'data1', ()), (b'data2', ())])
+        err = self.sock.sendmmsg.side_effect = ConnectionRefusedError()
+        transport._sendto_ready()
+        self.assertFalse(transport._fatal_error.called)
+        self.protocol.error_received.assert_called_with(err)
+        self.assertEqual([(b'data2', ())], list(transport._buffer))
+
     @mock.patch('asyncio.base_events.logger.error')
     def test_fatal_error_connected(self, m_exc):
         transport = self.datagram_transport(address=('0.0.0.0', 1))
@@ -667,6 +667,14 @@ class PollEventLoopTests(BaseSockTestsMixin,
             def create_event_loop(self):
                 return asyncio.SelectorEventLoop(selectors.PollSelector())
 
+    if (sys.platform == 'linux'
+            and asyncio.uring_events._uring_available()):
+        class UringEventLoopTests(BaseSockTestsMixin,
+                                  test_utils.TestCase):
+
+            def create_event_loop(self):
+                return asyncio.UringEventLoop()
+
     # Should always exist.
     class SelectEventLoopTests(BaseSockTestsMixin,
                                test_utils.TestCase):
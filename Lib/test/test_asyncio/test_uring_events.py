@@ -0,0 +1,236 @@
+import errno
+import os
+import select
+import socket
+import sys
+import unittest
+from unittest import mock
+
+if sys.platform != 'linux':
+    raise unittest.SkipTest('Linux only')
+
+from test.support import import_helper
+_uring = import_helper.import_module('_uring')
+
+import asyncio
+from asyncio import uring_events
+from test.test_asyncio import utils as test_utils
+
+if not uring_events._uring_available():
+    raise unittest.SkipTest('io_uring is not available')
+
+
+def tearDownModule():
+    asyncio.events._set_event_loop_policy(None)
+
+
+class RingTests(unittest.TestCase):
+
+    def setUp(self):
+        self.ring = _uring.Ring(8)
+        self.addCleanup(self.ring.close)
+
+    def wait_for(self, op):
+        while op.pending:
+            self.ring.wait()
+        return op.getresult()
+
+    def test_closed(self):
+        ring = _uring.Ring(1)
+        self.assertFalse(ring.closed)
+        self.assertGreaterEqual(ring.fileno(), 0)
+        ring.close()
+        ring.close()
+        self.assertTrue(ring.closed)
+        self.assertRaises(ValueError, ring.fileno)
+        self.assertRaises(ValueError, ring.submit)
+        self.assertRaises(ValueError, ring.recv, 0, 1)
+
+    def test_invalid_arguments(self):
+        self.assertRaises(ValueError, _uring.Ring, 0)
+        self.assertRaises(ValueError, self.ring.read, 0, -1)
+        self.assertRaises(ValueError, self.ring.wait, -1)
+        self.assertRaises(TypeError, _uring.Operation)
+
+    def test_send_recv(self):
+        a, b = socket.socketpair()
+        with a, b:
+            recv = self.ring.recv(b.fileno(), 100)
+            self.assertTrue(recv.pending)
+            self.assertRaises(ValueError, recv.getresult)
+            send = self.ring.send(a.fileno(), b'spam')
+            self.assertEqual(self.ring.pending, 2)
+            self.assertEqual(self.wait_for(send), 4)
+            self.assertEqual(self.wait_for(recv), b'spam')
+            self.assertEqual(self.ring.pending, 0)
+
+            buf = bytearray(10)
+            recv = self.ring.recv_into(b.fileno(), buf)
+            a.send(b'eggs')
+            self.assertEqual(self.wait_for(recv), 4)
+            self.assertEqual(buf[:4], b'eggs')
+
+    def test_read_write(self):
+        r, w = os.pipe()
+        try:
+            write = self.ring.write(w, b'ham')
+            self.assertEqual(self.wait_for(write), 3)
+            read = self.ring.read(r, 10)
+            self.assertEqual(self.wait_for(read), b'ham')
+        finally:
+            os.close(r)
+            os.close(w)
+
+    def test_accept(self):
+        with socket.create_server(('127.0.0.1', 0)) as listener:
+            accept = self.ring.accept(listener.fileno())
+            with socket.create_connection(listener.getsockname()) as client:
+                fd = self.wait_for(accept)
+                with socket.socket(fileno=fd) as conn:
+                    self.assertFalse(os.get_inheritable(fd))
+                    self.assertEqual(conn.getpeername(),
+                                     client.getsockname())
+
+    def test_poll(self):
+        a, b = socket.socketpair()
+        with a, b:
+            poll = self.ring.poll(b.fileno(), select.POLLIN)
+            self.assertEqual(self.ring.wait(0), [])
+            a.send(b'x')
+            self.assertEqual(self.wait_for(poll) & select.POLLIN,
+                             select.POLLIN)
+
+    def test_error(self):
+        r, w = os.pipe()
+        os.close(w)
+        os.close(r)
+        read = self.ring.read(r, 1)
+        with self.assertRaises(OSError) as cm:
+            self.wait_for(read)
+        self.assertEqual(cm.exception.errno, errno.EBADF)
+
+    def test_cancel(self):
+        a, b = socket.socketpair()
+        with a, b:
+            recv = self.ring.recv(b.fileno(), 1)
+            self.ring.submit()
+            recv.cancel()
+            with self.assertRaises(OSError) as cm:
+                self.wait_for(recv)
+            self.assertEqual(cm.exception.errno, errno.ECANCELED)
+
+    def test_wait_timeout(self):
+        a, b = socket.socketpair()
+        with a, b:
+            self.ring.recv(b.fileno(), 1)
+            self.assertEqual(self.ring.wait(0.01), [])
+            self.assertEqual(self.ring.pending, 1)
+
+    def test_close_pending(self):
+        # Closing the ring cancels the operations still in flight.
+        a, b = socket.socketpair()
+        with a, b:
+            ring = _uring.Ring(1)
+            recv = ring.recv(b.fileno(), 1)
+            ring.submit()
+            ring.close()
+            self.assertFalse(recv.pending)
+            with self.assertRaises(OSError) as cm:
+                recv.getresult()
+            self.assertEqual(cm.exception.errno, errno.ECANCELED)
+
+
+class UringEventLoopTests(test_utils.TestCase):
+
+    def setUp(self):
+        super().setUp()
+        self.loop = asyncio.UringEventLoop()
+        self.set_event_loop(self.loop)
+
+    def test_proactor(self):
+        self.assertIsInstance(self.loop, asyncio.UringEventLoop)
+        self.assertIsInstance(self.loop._proactor, asyncio.UringProactor)
+
+    def test_fallback(self):
+        with mock.patch.object(uring_events, '_uring_available',
+                               return_value=False):
+            loop = asyncio.UringEventLoop()
+        self.addCleanup(loop.close)
+        self.assertIsInstance(loop, asyncio.SelectorEventLoop)
+
+    def test_large_write(self):
+        # io_uring may complete a send partially: the proactor must still
+        # write all the data before the write completes.
+        data = os.urandom(8 * 1024 * 1024)
+
+        async def handle(reader, writer):
+            writer.write(data)
+            await writer.drain()
+            writer.close()
+
+        async def main():
+            server = await asyncio.start_server(handle, '127.0.0.1', 0)
+            async with server:
+                reader, writer = await asyncio.open_connection(
+                    *server.sockets[0].getsockname())
+                received = await reader.read()
+                writer.close()
+                await writer.wait_closed()
+            return received
+
+        self.assertEqual(self.loop.run_until_complete(main()), data)
+
+    def test_many_connections(self):
+        async def handle(reader, writer):
+            writer.write(await reader.readline())
+            await writer.drain()
+            writer.close()
+
+        async def client(address, i):
+            reader, writer = await asyncio.open_connection(*address)
+            writer.write(b'%d\n' % i)
+            line = await reader.readline()
+            writer.close()
+            await writer.wait_closed()
+            return line
+
+        async def main():
+            server = await asyncio.start_server(handle, '127.0.0.1', 0)
+            async with server:
+                address = server.sockets[0].getsockname()
+                return await asyncio.gather(
+                    *(client(address, i) for i in range(100)))
+
+        self.assertEqual(self.loop.run_until_complete(main()),
+                         [b'%d\n' % i for i in range(100)])
+
+    def test_cancel_recv(self):
+        a, b = socket.socketpair()
+        self.addCleanup(a.close)
+        self.addCleanup(b.close)
+        b.setblocking(False)
+
+        async def main():
+            task = asyncio.create_task(self.loop.sock_recv(b, 1))
+            await asyncio.sleep(0)
+            task.cancel()
+            with self.assertRaises(asyncio.CancelledError):
+                await task
+            # The cancelled operation did not consume the data.
+            a.send(b'x')
+            return await self.loop.sock_recv(b, 1)
+
+        self.assertEqual(self.loop.run_until_complete(main()), b'x')
+
+    def test_close_with_pending_operation(self):
+        a, b = socket.socketpair()
+        self.addCleanup(a.close)
+        self.addCleanup(b.close)
+        fut = self.loop._proactor.recv(b, 1)
+        self.loop._proactor.close()
+        self.assertTrue(fut.cancelled())
+        self.assertEqual(self.loop._proactor._cache, {})
+
+
+if __name__ == '__main__':
+    unittest.main()
@@ -11,7 +11,7 @@
 
 from test.support import (script_helper, requires_specialization,
                           import_helper, Py_GIL_DISABLED, requires_jit_enabled,
-                          reset_code)
+                          reset_code, os_helper)
 
 _testinternalcapi = import_helper.import_module("_testinternalcapi")
 
@@ -2850,6 +2850,40 @@ def testfunc(args):
         uops = get_opnames(ex)
         self.assertIn("_POP_TOP_NOP", uops)
 
+    def test_float_op_reuses_temporary(self):
+        def testfunc(args):
+            a, b, n = args
+            for _ in range(n):
+                # a + b is a temporary that the multiplication can reuse.
+                c = (a + b) * b
+                # d is a local: it must not be modified by d + b.
+                d = a - b
+                e = d + b
+            return c, d, e
+
+        res, ex = self._run_with_optimizer(testfunc, (1.5, 2.0, TIER2_THRESHOLD))
+        self.assertEqual(res, (7.0, -0.5, 1.5))
+        self.assertIsNotNone(ex)
+        uops = get_opnames(ex)
+        self.assertIn("_BINARY_OP_MULTIPLY_FLOAT_INPLACE", uops)
+        self.assertIn("_BINARY_OP_ADD_FLOAT", uops)
+
+    def test_escaping_uop_spills_cached_items(self):
+        def testfunc(n):
+            x = 0
+            for i in range(n):
+                # Storing to x decrefs its old value while the iterator is cached.
+                x = i
+            return x
+
+        res, ex = self._run_with_optimizer(testfunc, TIER2_THRESHOLD)
+        self.assertEqual(res, TIER2_THRESHOLD - 1)
+        self.assertIsNotNone(ex)
+        uops = get_opnames(ex)
+        # The cached iterator is spilled by _POP_TOP itself.
+        self.assertIn("_POP_TOP", uops)
+        self.assertNotIn("_SPILL_OR_RELOAD", uops)
+
     def test_load_attr_instance_value(self):
         def testfunc(n):
             class C():
@@ -3825,6 +3859,30 @@ def testfunc(n):
         # _POP_TOP_NOP is a sign the optimizer ran and didn't hit bottom.
         self.assertGreaterEqual(count_ops(ex, "_POP_TOP_NOP"), 1)
 
+    def test_generator_pipeline_stitched(self):
+        def source(n):
+            for i in range(n):
+                yield i
+        def double(it):
+            for x in it:
+                yield x * 2
+        def testfunc(n):
+            total = 0
+            for x in double(source(n)):
+                total += x
+            return total
+
+        res, ex = self._run_with_optimizer(testfunc, TIER2_THRESHOLD*2)
+        self.assertEqual(res, TIER2_THRESHOLD * (TIER2_THRESHOLD*2 - 1) * 2)
+        self.assertIsNotNone(ex)
+        uops = get_opnames(ex)
+
+        # The loops of both generators are part of the consumer's trace,
+        # which closes its own loop instead of exiting into "double".
+        self.assertEqual(count_ops(ex, "_FOR_ITER_GEN_FRAME"), 2)
+        self.assertIn("_ITER_NEXT_RANGE", uops)
+        self.assertIn("_JUMP_TO_TOP", uops)
+
     def test_binary_op_subscr_init_frame(self):
         class B:
             def __getitem__(self, other):
@@ -4065,6 +4123,73 @@ def hot_loop():
         self.assertNotIn('_PyJit_TryInitializeTracing', stderr,
                          f"JIT tracer memory leak detected:\n{stderr}")
 
+@requires_specialization
+@unittest.skipIf(Py_GIL_DISABLED, "optimizer not yet supported in free-threaded builds")
+@requires_jit_enabled
+class TestJitProfile(unittest.TestCase):
+
+    SCRIPT = textwrap.dedent("""
+        import _opcode, sys
+
+        def f(n):
+            total = 0
+            for i in range(n):
+                total += i
+            return total
+
+        f(int(sys.argv[1]))
+        code = f.__code__
+        for i in range(0, len(code.co_code), 2):
+            try:
+                _opcode.get_executor(code, i)
+            except ValueError:
+                continue
+            print("executor")
+            break
+        """)
+
+    def run_script(self, n, **env):
+        script = os.path.join(self.tmpdir, "script.py")
+        with open(script, "w") as f:
+            f.write(self.SCRIPT)
+        res = script_helper.assert_python_ok(script, str(n), PYTHON_JIT="1",
+                                             **env)
+        return res.out.strip() == b"executor"
+
+    def setUp(self):
+        self.tmpdir = self.enterContext(os_helper.temp_dir())
+
+    def test_profile(self):
+        profile = os.path.join(self.tmpdir, "jit.profile")
+        # Too few iterations for the loop to get hot.
+        self.assertFalse(self.run_script(200))
+        self.assertFalse(self.run_script(200, PYTHON_JIT_PROFILE=profile))
+        self.assertFalse(os.path.exists(profile))
+
+        # The hot loop is recorded...
+        self.assertTrue(self.run_script(TIER2_THRESHOLD * 4,
+                                        PYTHON_JIT_PROFILE=profile))
+        with open(profile) as f:
+            lines = f.read().splitlines()
+        self.assertEqual(len(lines), 2)
+        self.assertTrue(lines[0].startswith("#"))
+
+        # ...and compiled much earlier in the next run.
+        self.assertTrue(self.run_script(200, PYTHON_JIT_PROFILE=profile))
+        self.assertFalse(self.run_script(200))
+        with open(profile) as f:
+            self.assertEqual(f.read().splitlines(), lines)
+
+    def test_invalid_profile(self):
+        profile = os.path.join(self.tmpdir, "jit.profile")
+        with open(profile, "w") as f:
+            f.write("not a profile\n")
+        self.assertFalse(self.run_script(200, PYTHON_JIT_PROFILE=profile))
+        with open(profile) as f:
+            self.assertEqual(f.read().splitlines(),
+                             ["# CPython JIT profile 1"])
+
+
 def global_identity(x):
     return x
 
@@ -0,0 +1,218 @@
+"""Unit tests for collections.ConcurrentDict."""
+
+import copy
+import gc
+import pickle
+import unittest
+import weakref
+
+from collections import ConcurrentDict
+from collections.abc import Mapping, MutableMapping
+
+
+class BadHash:
+    def __hash__(self):
+        raise ZeroDivisionError
+
+
+class SubWithInit(ConcurrentDict):
+    def __init__(self, *args, **kwds):
+        super().__init__()
+        self.extra = True
+
+
+class TestConcurrentDict(unittest.TestCase):
+
+    def test_basic(self):
+        d = ConcurrentDict()
+        self.assertEqual(len(d), 0)
+        d['a'] = 1
+        d[2] = 'b'
+        self.assertEqual(len(d), 2)
+        self.assertEqual(d['a'], 1)
+        self.assertEqual(d[2], 'b')
+        self.assertIn('a', d)
+        self.assertNotIn('b', d)
+        d['a'] = 3
+        self.assertEqual(d['a'], 3)
+        del d['a']
+        self.assertNotIn('a', d)
+        self.assertEqual(len(d), 1)
+        with self.assertRaises(KeyError) as cm:
+            d['a']
+        self.assertEqual(cm.exception.args, ('a',))
+        with self.assertRaises(KeyError):
+            del d['a']
+        with self.assertRaises(KeyError) as cm:
+            d[(1, 2)]
+        self.assertEqual(cm.exception.args, ((1, 2),))
+
+    def test_constructor(self):
+        self.assertEqual(ConcurrentDict({1: 2, 3: 4}), {1: 2, 3: 4})
+        self.assertEqual(ConcurrentDict([(1, 2), (3, 4)]), {1: 2, 3: 4})
+        self.assertEqual(ConcurrentDict(ConcurrentDict({1: 2})), {1: 2})
+        self.assertEqual(ConcurrentDict(shards=1).shards, 1)
+        self.assertEqual(ConcurrentDict(shards=None).shards,
+                         ConcurrentDict().shards)
+        self.assertRaises(TypeError, ConcurrentDict, 1)
+        self.assertRaises(TypeError, ConcurrentDict, {}, {})
+        self.assertRaises(TypeError, ConcurrentDict, a=1)
+        self.assertRaises(TypeError, ConcurrentDict, shards=1.5)
+        self.assertRaises(ValueError, ConcurrentDict, [(1, 2, 3)])
+        self.assertRaises(ValueError, ConcurrentDict, shards=0)
+        self.assertRaises(ValueError, ConcurrentDict, shards=-1)
+        self.assertRaises(ValueError, ConcurrentDict, shards=10**6)
+
+    def test_shards(self):
+        for shards in 1, 2, 7, 64:
+            d = ConcurrentDict(shards=shards)
+            self.assertEqual(d.shards, shards)
+            for i in range(1000):
+                d[i] = -i
+            self.assertEqual(len(d), 1000)
+            self.assertEqual(sorted(d), list(range(1000)))
+            for i in range(1000):
+                self.assertEqual(d[i], -i)
+        with self.assertRaises(AttributeError):
+            d.shards = 2
+
+    def test_unhashable(self):
+        d = ConcurrentDict()
+        self.assertRaises(TypeError, d.__getitem__, [])
+        self.assertRaises(TypeError, d.__setitem__, [], 1)
+        self.assertRaises(TypeError, d.__delitem__, [])
+        self.assertRaises(TypeError, d.__contains__, [])
+        self.assertRaises(ZeroDivisionError, d.get, BadHash())
+        self.assertRaises(ZeroDivisionError, d.pop, BadHash(), None)
+        self.assertRaises(ZeroDivisionError, d.setdefault, BadHash())
+        self.assertRaises(TypeError, hash, d)
+
+    def test_methods(self):
+        d = ConcurrentDict({'a': 1, 'b': 2})
+        self.assertEqual(d.get('a'), 1)
+        self.assertIsNone(d.get('z'))
+        self.assertEqual(d.get('z', 5), 5)
+        self.assertEqual(d.setdefault('a', 7), 1)
+        self.assertEqual(d.setdefault('c', 7), 7)
+        self.assertIsNone(d.setdefault('n'))
+        self.assertIn('n', d)
+        self.assertEqual(d.pop('c'), 7)
+        self.assertEqual(d.pop('c', 8), 8)
+        self.assertRaises(KeyError, d.pop, 'c')
+        self.assertEqual(sorted(d.keys()), ['a', 'b', 'n'])
+        self.assertEqual(sorted(d.items()), [('a', 1), ('b', 2), ('n', None)])
+        self.assertCountEqual(d.values(), [1, 2, None])
+        self.assertIsInstance(d.keys(), list)
+
+        d.update({'x': 1}, y=2)
+        d.update([('z', 3)])
+        d.update(w=4)
+        d.update()
+        self.assertEqual(d, {'a': 1, 'b': 2, 'n': None,
+                             'x': 1, 'y': 2, 'z': 3, 'w': 4})
+        self.assertRaises(TypeError, d.update, {}, {})
+
+        items = set()
+        while d:
+            items.add(d.popitem())
+        self.assertEqual(len(items), 7)
+        self.assertRaises(KeyError, d.popitem)
+
+        d.update({1: 2, 3: 4})
+        self.assertIsNone(d.clear())
+        self.assertEqual(len(d), 0)
+        self.assertEqual(list(d), [])
+
+    def test_iteration_is_snapshot(self):
+        d = ConcurrentDict({i: i for i in range(10)})
+        seen = []
+        for key in d:
+            seen.append(key)
+            d[key + 100] = 0
+        self.assertEqual(sorted(seen), list(range(10)))
+        self.assertEqual(len(d), 20)
+
+    def test_comparison(self):
+        d = ConcurrentDict({1: 2}, shards=3)
+        self.assertEqual(d, {1: 2})
+        self.assertEqual({1: 2}, d)
+        self.assertEqual(d, ConcurrentDict({1: 2}, shards=5))
+        self.assertNotEqual(d, {1: 3})
+        self.assertNotEqual(d, [(1, 2)])
+        self.assertRaises(TypeError, lambda: d < d)
+
+    def test_abc(self):
+        d = ConcurrentDict()
+        self.assertIsInstance(d, MutableMapping)
+        self.assertIsInstance(d, Mapping)
+        self.assertNotIsInstance(d, dict)
+
+    def test_repr(self):
+        self.assertEqual(repr(ConcurrentDict()), 'ConcurrentDict({})')
+        self.assertEqual(repr(ConcurrentDict({1: 2})), 'ConcurrentDict({1: 2})')
+        d = ConcurrentDict()
+        d[1] = d
+        self.assertEqual(repr(d), 'ConcurrentDict({1: ConcurrentDict({...})})')
+
+        class Sub(ConcurrentDict):
+            pass
+        self.assertEqual(repr(Sub({1: 2})), 'Sub({1: 2})')
+
+    def test_copy(self):
+        d = ConcurrentDict({1: [2]}, shards=3)
+        for c in d.copy(), copy.copy(d):
+            self.assertIs(type(c), ConcurrentDict)
+            self.assertEqual(c, d)
+            self.assertEqual(c.shards, 3)
+            self.assertIs(c[1], d[1])
+        c = copy.deepcopy(d)
+        self.assertEqual(c, d)
+        self.assertEqual(c.shards, 3)
+        self.assertIsNot(c[1], d[1])
+
+    def test_pickle(self):
+        d = ConcurrentDict({1: 2, 'a': [3]}, shards=5)
+        for proto in range(pickle.HIGHEST_PROTOCOL + 1):
+            with self.subTest(proto=proto):
+                e = pickle.loads(pickle.dumps(d, proto))
+                self.assertIs(type(e), ConcurrentDict)
+                self.assertEqual(e, d)
+                self.assertEqual(e.shards, 5)
+
+    def test_recursive_pickle(self):
+        d = ConcurrentDict()
+        d[1] = d
+        for proto in range(pickle.HIGHEST_PROTOCOL + 1):
+            with self.subTest(proto=proto):
+                e = pickle.loads(pickle.dumps(d, proto))
+                self.assertIs(e[1], e)
+
+    def test_subclass(self):
+        d = SubWithInit({1: 2}, shards=2)
+        self.assertEqual(d, {1: 2})
+        self.assertTrue(d.extra)
+        c = d.copy()
+        self.assertIs(type(c), SubWithInit)
+        self.assertEqual(c.shards, 2)
+        e = pickle.loads(pickle.dumps(d))
+        self.assertIs(type(e), SubWithInit)
+        self.assertEqual(e, d)
+
+    def test_generic_alias(self):
+        alias = ConcurrentDict[str, int]
+        self.assertIs(alias.__origin__, ConcurrentDict)
+        self.assertEqual(alias.__args__, (str, int))
+
+    def test_gc_cycle(self):
+        class Sub(ConcurrentDict):
+            pass
+        d = Sub()
+        d['self'] = d
+        ref = weakref.ref(d)
+        del d
+        gc.collect()
+        self.assertIsNone(ref())
+
+
+if __name__ == "__main__":
+    unittest.main()
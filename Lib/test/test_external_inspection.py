@@ -1957,6 +1957,45 @@ def get_trace_with_opcodes(pid):
                   location.col_offset, location.end_col_offset)
         self.assertIn(actual, valid_locations)
 
+    @skip_if_not_supported
+    @unittest.skipIf(
+        sys.platform == "linux" and not PROCESS_VM_READV_SUPPORTED,
+        "Test only runs on Linux with process_vm_readv support",
+    )
+    def test_self_allocation_samples(self):
+        """Test that sampled allocations are returned with their stacks."""
+        unwinder = RemoteUnwinder(os.getpid())
+        self.assertEqual(unwinder.get_allocation_samples(), [])
+
+        def allocate():
+            return [bytes(1000) for _ in range(1000)]
+
+        self.addCleanup(sys._set_allocation_sampling, 0)
+        sys._set_allocation_sampling(4096)
+        data = allocate()
+        sys._set_allocation_sampling(0)
+        self.assertEqual(len(data), 1000)
+
+        samples = unwinder.get_allocation_samples()
+        self.assertGreater(len(samples), 0)
+        allocate_samples = [
+            sample for sample in samples
+            if sample.frame_info
+            and sample.frame_info[0].funcname.endswith("allocate")
+        ]
+        self.assertGreater(len(allocate_samples), 0)
+        sample = allocate_samples[0]
+        self.assertEqual(sample.thread_id, threading.get_native_id())
+        self.assertEqual(sample.interpreter_id, 0)
+        self.assertGreater(sample.size, 0)
+        self.assertGreaterEqual(sample.weight, 1)
+        self.assertEqual(
+            sample.frame_info[1].funcname,
+            "TestGetStackTrace.test_self_allocation_samples",
+        )
+        # Only samples taken since the previous call are returned
+        self.assertEqual(unwinder.get_allocation_samples(), [])
+
 
 class TestUnsupportedPlatformHandling(unittest.TestCase):
     @unittest.skipIf(
@@ -3223,6 +3262,85 @@ def level1():
                 # Parent frames: must match exactly
                 self.assertEqual(loc_cached, loc_no_cache)
 
+    @skip_if_not_supported
+    @unittest.skipIf(
+        sys.platform == "linux" and not PROCESS_VM_READV_SUPPORTED,
+        "Test only runs on Linux with process_vm_readv support",
+    )
+    def test_workers_equivalence(self):
+        """Test that splitting remote reads between workers gives the same stacks."""
+        # Enough threads for the batched reads to be split between workers
+        num_threads = 100
+        script_body = f"""\
+            import threading
+
+            barrier = threading.Barrier({num_threads} + 1)
+            done = threading.Event()
+
+            def inner(i):
+                barrier.wait()
+                done.wait()
+
+            def outer(i):
+                inner(i)
+
+            threads = [threading.Thread(target=outer, args=(i,))
+                       for i in range({num_threads})]
+            for t in threads:
+                t.start()
+            barrier.wait()
+            sock.sendall(b"ready")
+            sock.recv(16)
+            done.set()
+            for t in threads:
+                t.join()
+            """
+
+        def sample(unwinder):
+            for _ in range(MAX_TRIES):
+                with contextlib.suppress(*TRANSIENT_ERRORS):
+                    stacks = sorted(
+                        tuple(f.funcname for f in thread.frame_info)
+                        for interp in unwinder.get_stack_trace()
+                        for thread in interp.threads
+                    )
+                    # Threads may still be leaving the barrier
+                    parked = [st for st in stacks
+                              if st[1:3] == ("Event.wait", "inner")]
+                    if len(parked) == num_threads:
+                        return stacks
+                time.sleep(RETRY_DELAY)
+            return None
+
+        with self._target_process(script_body) as (p, client_socket, _):
+            _wait_for_signal(client_socket, b"ready")
+            results = {}
+            for cache_frames in (False, True):
+                for workers in (0, 2):
+                    unwinder = RemoteUnwinder(
+                        p.pid,
+                        all_threads=True,
+                        cache_frames=cache_frames,
+                        workers=workers,
+                    )
+                    # Sample twice so that the second sample reuses the
+                    # thread states read ahead by the first one.
+                    sample(unwinder)
+                    results[cache_frames, workers] = sample(unwinder)
+            client_socket.sendall(b"done")
+
+        for key, stacks in results.items():
+            with self.subTest(cache_frames=key[0], workers=key[1]):
+                self.assertIsNotNone(stacks)
+                self.assertEqual(stacks, results[False, 0])
+
+    def test_workers_out_of_range(self):
+        """Test that an invalid number of workers raises ValueError."""
+        for workers in (-1, 33):
+            with self.subTest(workers=workers):
+                with self.assertRaises(ValueError):
+                    RemoteUnwinder(os.getpid(), workers=workers)
+
     @skip_if_not_supported
     @unittest.skipIf(
         sys.platform == "linux" and not PROCESS_VM_READV_SUPPORTED,
@@ -0,0 +1,111 @@
+import unittest
+
+from collections import ConcurrentDict
+from threading import Barrier, Thread
+
+from test.support import threading_helper
+
+
+NTHREADS = 8
+NKEYS = 500
+
+
+@threading_helper.requires_working_threading()
+class TestConcurrentDict(unittest.TestCase):
+
+    def run_threads(self, func, *args):
+        barrier = Barrier(NTHREADS)
+        def wrapper(i):
+            barrier.wait()
+            func(i, *args)
+        threads = [Thread(target=wrapper, args=(i,)) for i in range(NTHREADS)]
+        with threading_helper.start_threads(threads):
+            pass
+
+    def test_disjoint_writers(self):
+        d = ConcurrentDict(shards=4)
+
+        def writer(i):
+            for k in range(NKEYS):
+                d[i, k] = k
+            for k in range(0, NKEYS, 2):
+                del d[i, k]
+
+        self.run_threads(writer)
+        self.assertEqual(len(d), NTHREADS * NKEYS // 2)
+        for i in range(NTHREADS):
+            for k in range(NKEYS):
+                if k % 2:
+                    self.assertEqual(d[i, k], k)
+                else:
+                    self.assertNotIn((i, k), d)
+
+    def test_setdefault(self):
+        d = ConcurrentDict()
+        winners = []
+
+        def worker(i):
+            token = object()
+            for k in range(NKEYS):
+                if d.setdefault(k, token) is token:
+                    winners.append(k)
+
+        self.run_threads(worker)
+        # Exactly one thread inserted each key.
+        self.assertEqual(sorted(winners), list(range(NKEYS)))
+        self.assertEqual(len(d), NKEYS)
+
+    def test_pop(self):
+        d = ConcurrentDict({k: k for k in range(NKEYS)})
+        popped = []
+
+        def worker(i):
+            for k in range(NKEYS):
+                if d.pop(k, None) is not None:
+                    popped.append(k)
+
+        self.run_threads(worker)
+        self.assertEqual(sorted(popped), list(range(NKEYS)))
+        self.assertEqual(len(d), 0)
+
+    def test_mixed_operations(self):
+        d = ConcurrentDict({k: 0 for k in range(NKEYS)})
+
+        def worker(i):
+            for k in range(NKEYS):
+                d[k] = i
+                d.get(k)
+                k in d
+                if k % 50 == 0:
+                    len(d)
+                    list(d)
+                    d.items()
+                    d == {}
+                    repr(d)
+                if k % 100 == i:
+                    d.copy()
+                try:
+                    d.popitem()
+                except KeyError:
+                    pass
+            d.update({(i, k): k for k in range(10)})
+
+        self.run_threads(worker)
+        self.assertEqual(len(d), len(d.items()))
+
+    def test_clear_while_writing(self):
+        d = ConcurrentDict()
+
+        def worker(i):
+            for k in range(NKEYS):
+                d[i, k] = k
+                if k % 97 == 0:
+                    d.clear()
+
+        self.run_threads(worker)
+        self.assertLessEqual(len(d), NTHREADS * NKEYS)
+        self.assertEqual(len(d), len(d.keys()))
+
+
+if __name__ == "__main__":
+    unittest.main()
@@ -9,10 +9,10 @@
 @threading_helper.requires_working_threading()
 class TestLRUCache(unittest.TestCase):
 
-    def _test_concurrent_operations(self, maxsize):
+    def _test_concurrent_operations(self, maxsize, shards=1):
         num_threads = 10
         b = Barrier(num_threads)
-        @lru_cache(maxsize=maxsize)
+        @lru_cache(maxsize=maxsize, shards=shards)
         def func(arg=0):
             return object()
 
@@ -42,10 +42,13 @@ def test_concurrent_operations_unbounded(self):
     def test_concurrent_operations_bounded(self):
         self._test_concurrent_operations(maxsize=128)
 
-    def _test_reentrant_cache_clear(self, maxsize):
+    def test_concurrent_operations_sharded(self):
+        self._test_concurrent_operations(maxsize=128, shards=8)
+
+    def _test_reentrant_cache_clear(self, maxsize, shards=1):
         num_threads = 10
         b = Barrier(num_threads)
-        @lru_cache(maxsize=maxsize)
+        @lru_cache(maxsize=maxsize, shards=shards)
         def func(arg=0):
             func.cache_clear()
             return object()
@@ -70,6 +73,30 @@ def test_reentrant_cache_clear_unbounded(self):
     def test_reentrant_cache_clear_bounded(self):
         self._test_reentrant_cache_clear(maxsize=128)
 
+    def test_reentrant_cache_clear_sharded(self):
+        self._test_reentrant_cache_clear(maxsize=128, shards=8)
+
+    def test_concurrent_hits_sharded(self):
+        num_threads = 10
+        b = Barrier(num_threads)
+        @lru_cache(maxsize=64, shards=8)
+        def func(arg):
+            return (arg,)
+
+        def thread_func():
+            b.wait()
+            for i in range(2000):
+                # mostly hits on a small working set, with evictions
+                arg = i % 32 if i % 4 else random.randint(0, 1000)
+                self.assertEqual(func(arg), (arg,))
+
+        threads = [Thread(target=thread_func) for i in range(num_threads)]
+        with threading_helper.start_threads(threads):
+            pass
+        info = func.cache_info()
+        self.assertEqual(info.hits + info.misses, num_threads * 2000)
+        self.assertLessEqual(info.currsize, 64)
+
 
 if __name__ == "__main__":
     unittest.main()
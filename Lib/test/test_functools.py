@@ -2072,6 +2072,88 @@ def f():
             return 1
         self.assertEqual(f.cache_parameters(), {'maxsize': 1000, "typed": True})
 
+        @self.module.lru_cache(maxsize=100, shards=4)
+        def f():
+            return 1
+        self.assertEqual(f.cache_parameters(),
+                         {'maxsize': 100, "typed": False, "shards": 4})
+
+    def test_lru_sharded(self):
+        @self.module.lru_cache(maxsize=32, shards=8)
+        def f(x):
+            return x * 2
+
+        for i in range(100):
+            self.assertEqual(f(i), i * 2)
+            self.assertLessEqual(f.cache_info().currsize, 32)
+        self.assertEqual(f.cache_info().misses, 100)
+        self.assertEqual(f.cache_info().maxsize, 32)
+
+        # An entry which keeps being used is not evicted.
+        f.cache_clear()
+        self.assertEqual(f.cache_info(), (0, 0, 32, 0))
+        for i in range(1000):
+            f('hot')
+            f(i)
+        self.assertEqual(f.cache_info().hits, 999)
+        self.assertEqual(f.cache_info().misses, 1001)
+
+        # Keyword arguments, typed keys and more shards than entries.
+        @self.module.lru_cache(maxsize=3, typed=True, shards=16)
+        def g(x, y=0):
+            return x, y
+        for i in range(10):
+            self.assertEqual(g(i, y=1), (i, 1))
+            self.assertEqual(g(i, y=1), (i, 1))
+            self.assertEqual(g(float(i), y=1), (i, 1))
+            self.assertIsInstance(g(float(i), y=1)[0], float)
+        self.assertEqual(g.cache_info().hits, 20)
+        self.assertEqual(g.cache_info().misses, 20)
+        self.assertLessEqual(g.cache_info().currsize, 3)
+
+        # Unbounded and disabled caches ignore shards.
+        h = self.module.lru_cache(maxsize=None, shards=4)(lambda x: x)
+        for i in range(10):
+            h(i)
+        self.assertEqual(h.cache_info(), (0, 10, None, 10))
+        h = self.module.lru_cache(maxsize=0, shards=4)(lambda x: x)
+        h(1)
+        self.assertEqual(h.cache_info(), (0, 1, 0, 0))
+
+    def test_lru_sharded_errors(self):
+        with self.assertRaises(ValueError):
+            self.module.lru_cache(shards=0)
+        with self.assertRaises(TypeError):
+            self.module.lru_cache(shards=2.0)
+
+        @self.module.lru_cache(maxsize=8, shards=2)
+        def f(x):
+            if x < 0:
+                raise ValueError(x)
+            return x
+        with self.assertRaises(ValueError):
+            f(-1)
+        with self.assertRaises(TypeError):
+            f([])
+        self.assertEqual(f.cache_info(), (0, 1, 8, 0))
+
+    def test_lru_sharded_reentrant(self):
+        class Key:
+            def __init__(self, value):
+                self.value = value
+            def __hash__(self):
+                return 0
+            def __eq__(self, other):
+                f.cache_clear()
+                return self.value == other.value
+
+        @self.module.lru_cache(maxsize=4, shards=2)
+        def f(x):
+            return x
+        for i in range(20):
+            f(Key(i % 5))
+        self.assertLessEqual(f.cache_info().currsize, 4)
+
     def test_lru_cache_weakrefable(self):
         @self.module.lru_cache
         def test_function(x):
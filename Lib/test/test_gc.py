@@ -848,13 +848,18 @@ def test_get_stats(self):
             self.assertIsInstance(st, dict)
             self.assertEqual(
                 set(st),
-                {"collected", "collections", "uncollectable", "candidates", "duration"}
+                {"collected", "collections", "uncollectable", "candidates",
+                 "duration", "survival_rate", "threshold"}
             )
             self.assertGreaterEqual(st["collected"], 0)
             self.assertGreaterEqual(st["collections"], 0)
             self.assertGreaterEqual(st["uncollectable"], 0)
             self.assertGreaterEqual(st["candidates"], 0)
             self.assertGreaterEqual(st["duration"], 0)
+            self.assertGreaterEqual(st["survival_rate"], 0)
+            self.assertLessEqual(st["survival_rate"], 1)
+        self.assertEqual(tuple(st["threshold"] for st in stats),
+                         gc.get_threshold())
         # Check that collection counts are incremented correctly
         if gc.isenabled():
             self.addCleanup(gc.enable)
@@ -885,6 +890,143 @@ def test_get_stats(self):
             self.assertEqual(new[1][stat], old[1][stat])
             self.assertGreaterEqual(new[2][stat], old[2][stat])
 
+    def test_pause_target(self):
+        self.addCleanup(gc.set_pause_target, gc.get_pause_target())
+        self.assertEqual(gc.get_pause_target(), 0.0)
+        gc.set_pause_target(2.5)
+        self.assertEqual(gc.get_pause_target(), 2.5)
+        gc.set_pause_target(0)
+        self.assertEqual(gc.get_pause_target(), 0.0)
+        self.assertRaises(ValueError, gc.set_pause_target, -1)
+        self.assertRaises(ValueError, gc.set_pause_target, float('nan'))
+        self.assertRaises(ValueError, gc.set_pause_target, float('inf'))
+        self.assertRaises(TypeError, gc.set_pause_target, '1')
+
+    @requires_gil_enabled('the free-threaded GC ignores the pause target')
+    def test_pause_target_adapts_threshold(self):
+        if not gc.isenabled():
+            gc.enable()
+            self.addCleanup(gc.disable)
+        self.addCleanup(gc.set_pause_target, gc.get_pause_target())
+
+        def make_cycles(n):
+            for _ in range(n):
+                a = []
+                a.append(a)
+
+        def young_threshold():
+            return gc.get_stats()[0]["threshold"]
+
+        with gc_threshold(2000):
+            # No collection can meet this target: the threshold shrinks to
+            # its lower bound.
+            gc.set_pause_target(1e-9)
+            make_cycles(20_000)
+            self.assertEqual(young_threshold(), 100)
+
+            # Every collection is well under this target: the threshold grows.
+            gc.set_pause_target(1e6)
+            make_cycles(20_000)
+            self.assertGreater(young_threshold(), 100)
+
+            # Disabling the target keeps the last threshold.
+            gc.set_pause_target(0)
+            threshold = young_threshold()
+            make_cycles(20_000)
+            self.assertEqual(young_threshold(), threshold)
+
+    def test_mark_threads(self):
+        self.addCleanup(gc.set_mark_threads, gc.get_mark_threads())
+        self.assertEqual(gc.get_mark_threads(), 1)
+        gc.set_mark_threads(4)
+        self.assertEqual(gc.get_mark_threads(), 4 if Py_GIL_DISABLED else 1)
+        self.assertRaises(ValueError, gc.set_mark_threads, 0)
+        self.assertRaises(ValueError, gc.set_mark_threads, -1)
+        self.assertRaises(TypeError, gc.set_mark_threads, 1.5)
+
+    @threading_helper.requires_working_threading()
+    def test_parallel_mark(self):
+        self.addCleanup(gc.set_mark_threads, gc.get_mark_threads())
+        # Large enough for the collector to start its helper threads.
+        live = [[i, {'x': [i]}] for i in range(200_000)]
+        gc.collect()
+        gc.set_mark_threads(4)
+
+        class Node:
+            pass
+        garbage = []
+        for _ in range(1000):
+            a = Node()
+            b = Node()
+            a.other = b
+            b.other = a
+            garbage.append(weakref.ref(a))
+        del a, b
+        gc.collect()
+        self.assertTrue(all(r() is None for r in garbage))
+        self.assertEqual(live[123_456], [123_456, {'x': [123_456]}])
+        self.assertEqual(sum(len(item[1]['x']) for item in live), len(live))
+
+    @unittest.skipIf(Py_GIL_DISABLED, "requires the default build")
+    def test_background_not_implemented(self):
+        self.assertFalse(gc.get_background())
+        self.assertRaises(NotImplementedError, gc.set_background, True)
+
+    @unittest.skipUnless(Py_GIL_DISABLED, "requires the free-threaded build")
+    @threading_helper.requires_working_threading()
+    def test_background(self):
+        self.assertFalse(gc.get_background())
+        self.addCleanup(gc.set_background, False)
+        gc.set_background(True)
+        self.assertTrue(gc.get_background())
+        gc.set_background(True)
+
+        collected = threading.Event()
+        collector_threads = set()
+        def callback(phase, info):
+            if phase == 'stop':
+                collector_threads.add(threading.get_ident())
+                collected.set()
+        gc.callbacks.append(callback)
+        self.addCleanup(gc.callbacks.remove, callback)
+
+        if not gc.isenabled():
+            gc.enable()
+            self.addCleanup(gc.disable)
+        class Node:
+            pass
+        deadline = time.monotonic() + support.SHORT_TIMEOUT
+        with gc_threshold(100, 0):
+            while not collected.is_set() and time.monotonic() < deadline:
+                for _ in range(1000):
+                    a = Node()
+                    a.cycle = a
+                    del a
+        self.assertTrue(collected.is_set())
+        self.assertNotIn(threading.get_ident(), collector_threads)
+
+        gc.set_background(False)
+        self.assertFalse(gc.get_background())
+
+    @unittest.skipUnless(Py_GIL_DISABLED, "requires the free-threaded build")
+    @support.requires_fork()
+    def test_background_after_fork(self):
+        code = """if 1:
+            import gc, os
+            gc.set_background(True)
+            pid = os.fork()
+            if pid == 0:
+                assert not gc.get_background()
+                gc.set_background(True)
+                gc.set_background(False)
+                os._exit(0)
+            _, status = os.waitpid(pid, 0)
+            assert os.waitstatus_to_exitcode(status) == 0
+            assert gc.get_background()
+            gc.set_background(False)
+        """
+        assert_python_ok("-c", code)
+
     def test_freeze(self):
         gc.freeze()
         self.assertGreater(gc.get_freeze_count(), 0)
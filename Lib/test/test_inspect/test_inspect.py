@@ -6193,6 +6193,7 @@ def test_collections_module_has_signatures(self):
             'OrderedDict': {'update'},
         }
         methods_unsupported_signature = {
+            'ConcurrentDict': {'pop'},
             'deque': {'index'},
             'OrderedDict': {'pop'},
             'UserString': {'maketrans'},
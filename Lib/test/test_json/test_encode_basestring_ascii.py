@@ -24,6 +24,18 @@ def test_encode_basestring_ascii(self):
             self.assertEqual(result, expect,
                 f'{result!r} != {expect!r} for {fname}({input_string!r})')
 
+    def test_long_strings(self):
+        # Characters to escape at every position of strings long enough
+        # to be scanned in blocks, for all string kinds.
+        encode = self.json.encoder.encode_basestring_ascii
+        for filler, escaped in [('a', 'a'), ('\xe9', '\\u00e9'),
+                                ('\u20ac', '\\u20ac'),
+                                ('\U0001d120', '\\ud834\\udd20')]:
+            for i in range(40):
+                for c, c_escaped in [('"', '\\"'), ('\x7f', '\\u007f'), ('~', '~')]:
+                    self.assertEqual(encode(filler * i + c + filler * 40),
+                                     '"' + escaped * i + c_escaped + escaped * 40 + '"')
+
     def test_ordered_dict(self):
         # See issue 6105
         items = [('one', 1), ('two', 2), ('three', 3), ('four', 4), ('five', 5)]
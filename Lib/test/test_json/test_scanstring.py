@@ -101,6 +101,22 @@ def assertScan(given, expect):
         assertScan('"z\ud834\\udd20x"', 'z\ud834\udd20x')
         assertScan('"z\ud834x"', 'z\ud834x')
 
+    def test_long_strings(self):
+        # Escapes and the closing quote at every position of strings long
+        # enough to be scanned in blocks, for all string kinds.
+        scanstring = self.json.decoder.scanstring
+        for filler in 'a', '\xe9', '\u20ac', '\U0001d120':
+            for i in range(40):
+                prefix = filler * i
+                self.assertEqual(scanstring('"' + prefix + '"' + filler * 40, 1, True),
+                                 (prefix, i + 2))
+                self.assertEqual(scanstring('"' + prefix + '\\n' + filler * 40 + '"', 1, True),
+                                 (prefix + '\n' + filler * 40, i + 44))
+                with self.assertRaises(self.JSONDecodeError):
+                    scanstring('"' + prefix + '\x1f' + filler * 40 + '"', 1, True)
+                self.assertEqual(scanstring('"' + prefix + '\x1f' + filler * 40 + '"', 1, False),
+                                 (prefix + '\x1f' + filler * 40, i + 43))
+
     def test_bad_escapes(self):
         scanstring = self.json.decoder.scanstring
         bad_escapes = [
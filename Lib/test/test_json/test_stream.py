@@ -0,0 +1,106 @@
+from test.test_json import PyTest, CTest
+
+
+class TestStreamDecoder:
+    def decode_chunks(self, chunks, **kwargs):
+        decoder = self.json.JSONStreamDecoder(**kwargs)
+        items = []
+        for chunk in chunks:
+            decoder.feed(chunk)
+            items.extend(decoder.iter_items())
+        items.extend(decoder.close())
+        return items
+
+    def test_items(self):
+        items = [1, -2.5, 'a,b]', ['x', [']', '"']], {'k': '\\', '}': [{}]},
+                 True, False, None, 'caf\xe9 € \U0001f600']
+        data = self.dumps(items, ensure_ascii=False).encode()
+        self.assertEqual(self.decode_chunks([data]), items)
+        # Any split, including in the middle of tokens, escapes and UTF-8
+        # sequences, gives the same result.
+        for size in range(1, 12):
+            chunks = [data[i:i+size] for i in range(0, len(data), size)]
+            self.assertEqual(self.decode_chunks(chunks), items)
+
+    def test_items_are_returned_early(self):
+        decoder = self.json.JSONStreamDecoder()
+        decoder.feed(b' [ {"a": [1, 2]} ,')
+        self.assertEqual(list(decoder.iter_items()), [{'a': [1, 2]}])
+        decoder.feed(b' 12')
+        # The number might continue in the next chunk.
+        self.assertEqual(list(decoder.iter_items()), [])
+        decoder.feed(b'3 ] ')
+        self.assertEqual(list(decoder.iter_items()), [123])
+        self.assertEqual(decoder.close(), [])
+
+    def test_buffer_is_bounded(self):
+        decoder = self.json.JSONStreamDecoder()
+        decoder.feed(b'[')
+        for i in range(1000):
+            decoder.feed(b'"%s",' % (b'x' * 100))
+            self.assertEqual(list(decoder.iter_items()), ['x' * 100])
+            self.assertLess(len(decoder._buf), 200)
+        decoder.feed(b'0]')
+        self.assertEqual(decoder.close(), [0])
+
+    def test_empty(self):
+        self.assertEqual(self.decode_chunks([b' [ ', b' ] \n']), [])
+        self.assertEqual(self.decode_chunks([b'\xef\xbb\xbf[1]']), [1])
+
+    def test_options(self):
+        items = self.decode_chunks([b'[{"a": 1.5}, 2]'],
+                                   parse_float=str, parse_int=float,
+                                   object_pairs_hook=tuple)
+        self.assertEqual(items, [(('a', '1.5'),), 2.0])
+
+    def test_errors(self):
+        cases = [
+            b'',
+            b'{}',
+            b'[',
+            b'[1',
+            b'[1,',
+            b'["abc',
+            b'[1,]',
+            b'[,1]',
+            b'[1 2]',
+            b'[1}',
+            b'[{"a": 1]]',
+            b'[tru]',
+            b'[1] 2',
+            b'[1]]',
+        ]
+        for data in cases:
+            with self.subTest(data=data):
+                with self.assertRaises(self.JSONDecodeError):
+                    self.decode_chunks([data])
+                with self.assertRaises(self.JSONDecodeError):
+                    self.decode_chunks([data[i:i+1] for i in range(len(data))])
+        with self.assertRaises(UnicodeDecodeError):
+            self.decode_chunks([b'["\xe9"]'])
+        with self.assertRaises(UnicodeDecodeError):
+            self.decode_chunks([b'[1] \xc3'])
+
+    def test_feed_after_close(self):
+        decoder = self.json.JSONStreamDecoder()
+        decoder.feed(b'[]')
+        decoder.close()
+        with self.assertRaises(ValueError):
+            decoder.feed(b' ')
+
+    def test_find_item_end(self):
+        find_item_end = self.json.decoder.find_item_end
+        self.assertEqual(find_item_end('1, 2', 0, 0, False), (1, 0, False))
+        self.assertEqual(find_item_end('[1, 2], 3', 0, 0, False), (6, 0, False))
+        self.assertEqual(find_item_end('{"a,]": 1}]', 0, 0, False),
+                         (10, 0, False))
+        self.assertEqual(find_item_end('[{"a', 0, 0, False), (4, 2, True))
+        self.assertEqual(find_item_end('"a\\', 0, 0, False), (2, 0, True))
+        self.assertEqual(find_item_end('"a\\"', 2, 0, True), (4, 0, True))
+        self.assertEqual(find_item_end('b"]}]', 0, 2, True), (4, 0, False))
+        self.assertRaises(ValueError, find_item_end, 'abc', 4, 0, False)
+        self.assertRaises(ValueError, find_item_end, 'abc', 0, -1, False)
+
+
+class TestPyStreamDecoder(TestStreamDecoder, PyTest): pass
+class TestCStreamDecoder(TestStreamDecoder, CTest): pass
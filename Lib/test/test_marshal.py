@@ -704,6 +704,22 @@ def test_read_last_object_from_file(self):
                 _testcapi.pymarshal_read_last_object_from_file(os_helper.TESTFN)
             os_helper.unlink(os_helper.TESTFN)
 
+    def test_read_last_object_from_large_file(self):
+        # Larger than the limit for reading the file into a heap buffer.
+        obj = [b'x' * 100_000, 'y' * 100_000, b'z' * 100_000]
+        data = marshal.dumps(obj)
+        self.assertGreater(len(data), 1 << 18)
+        self.addCleanup(os_helper.unlink, os_helper.TESTFN)
+        with open(os_helper.TESTFN, 'wb') as f:
+            f.write(data)
+        r, p = _testcapi.pymarshal_read_last_object_from_file(os_helper.TESTFN)
+        self.assertEqual(r, obj)
+
+        with open(os_helper.TESTFN, 'wb') as f:
+            f.write(omit_last_byte(data))
+        with self.assertRaises(EOFError):
+            _testcapi.pymarshal_read_last_object_from_file(os_helper.TESTFN)
+
     def test_read_object_from_file(self):
         obj = ('\u20ac', b'abc', 123, 45.6, 7+8j)
         for v in range(marshal.version + 1):
@@ -5,7 +5,7 @@
 import types
 import unittest
 from test.support import (threading_helper, check_impl_detail,
-                          requires_specialization,
+                          requires_specialization, Py_GIL_DISABLED,
                           cpython_only, requires_jit_disabled, reset_code)
 from test.support.import_helper import import_module
 
@@ -1496,6 +1496,32 @@ def binary_op_bitwise_extend():
         self.assert_specialized(binary_op_bitwise_extend, "BINARY_OP_EXTEND")
         self.assert_no_opcode(binary_op_bitwise_extend, "BINARY_OP")
 
+    @cpython_only
+    @requires_specialization
+    @unittest.skipIf(Py_GIL_DISABLED, "not specialized without the GIL")
+    def test_binary_op_inplace_add_unicode_deref(self):
+        def make():
+            s = ""
+            def add(part):
+                nonlocal s
+                s += part
+                return s
+            return add
+
+        add = make()
+        for i in range(_testinternalcapi.SPECIALIZATION_THRESHOLD):
+            add(str(i))
+        self.assert_specialized(add, "BINARY_OP_INPLACE_ADD_UNICODE_DEREF")
+        self.assert_no_opcode(add, "BINARY_OP")
+
+        # Earlier values stay intact while the cell is extended.
+        expected = "".join(map(str, range(_testinternalcapi.SPECIALIZATION_THRESHOLD)))
+        first = add("a")
+        self.assertEqual(first, expected + "a")
+        self.assertEqual(add("b\xe9"), expected + "ab\xe9")
+        self.assertEqual(first, expected + "a")
+        self.assertEqual(add("\u20ac"), expected + "ab\xe9\u20ac")
+
     @cpython_only
     @requires_specialization
     def test_load_super_attr(self):
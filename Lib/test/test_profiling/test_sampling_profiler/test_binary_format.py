@@ -4,7 +4,7 @@
 import random
 import tempfile
 import unittest
-from collections import defaultdict
+from collections import Counter, defaultdict
 
 try:
     import _remote_debugging
@@ -1179,5 +1179,148 @@ def test_timestamp_preservation_with_rle(self):
         self.assertEqual(ts_collector.all_timestamps, expected_timestamps)
 
 
+class TestAggregatedBinary(BinaryFormatTestBase):
+    """Tests for binary files aggregated per time bucket while writing."""
+
+    def create_aggregated_file(self, samples, bucket_usec, compression="none"):
+        """Write (timestamp_offset_us, sample) pairs aggregated per bucket."""
+        with tempfile.NamedTemporaryFile(suffix=".bin", delete=False) as f:
+            filename = f.name
+        self.temp_files.append(filename)
+
+        collector = BinaryCollector(filename, 1000, compression=compression,
+                                    bucket_usec=bucket_usec)
+        start = collector.start_time_us
+        for offset, sample in samples:
+            collector.collect(sample, timestamp_us=start + offset)
+        collector.export(None)
+        return filename, start
+
+    def count_stacks(self, by_thread):
+        return {
+            key: Counter(
+                (s["status"], tuple(f["funcname"] for f in s["frames"]))
+                for s in samples
+            )
+            for key, samples in by_thread.items()
+        }
+
+    def random_samples(self, count, seed=0):
+        rng = random.Random(seed)
+        frames = [make_frame(f"mod{i}.py", i + 1, f"func{i}") for i in range(8)]
+        stacks = [
+            [rng.choice(frames) for _ in range(rng.randint(0, 6))]
+            for _ in range(10)
+        ]
+        samples = []
+        for i in range(count):
+            threads = [
+                make_thread(tid, rng.choice(stacks),
+                            rng.choice([0, THREAD_STATUS_HAS_GIL]))
+                for tid in (1, 2, 3)
+            ]
+            interps = [make_interpreter(0, threads)]
+            if i % 4 == 0:
+                interps.append(make_interpreter(1, [make_thread(1, rng.choice(stacks))]))
+            samples.append((i * 250, interps))
+        return samples
+
+    def test_counts_roundtrip(self):
+        """Every (thread, status, stack) keeps its number of samples."""
+        samples = self.random_samples(400)
+        filename, _ = self.create_aggregated_file(samples, bucket_usec=10_000)
+
+        collector = RawCollector()
+        with BinaryReader(filename) as reader:
+            count = reader.replay_samples(collector)
+
+        expected = samples_to_by_thread([sample for _, sample in samples])
+        self.assertEqual(count, sum(len(v) for v in expected.values()))
+        self.assertEqual(self.count_stacks(collector.by_thread),
+                         self.count_stacks(expected))
+
+    def test_bucket_timestamps(self):
+        """Samples are replayed at the start of their time bucket."""
+        frame = make_frame("bucket.py", 1, "func")
+        offsets = [0, 300, 999, 1000, 2500, 2999, 7000]
+        samples = [(offset, [make_interpreter(0, [make_thread(1, [frame])])])
+                   for offset in offsets]
+        filename, start = self.create_aggregated_file(samples, bucket_usec=1000)
+
+        ts_collector = TimestampCollector()
+        with BinaryReader(filename) as reader:
+            count = reader.replay_samples(ts_collector)
+
+        self.assertEqual(count, len(offsets))
+        self.assertEqual(ts_collector.all_timestamps,
+                         [start + offset // 1000 * 1000 for offset in offsets])
+
+    def test_info_and_stats(self):
+        """Aggregated files are flagged and stacks are deduplicated."""
+        frames = [make_frame("a.py", 1, "outer"), make_frame("a.py", 2, "inner")]
+        samples = [
+            (i * 100, [make_interpreter(0, [make_thread(1, frames[i % 2:])])])
+            for i in range(100)
+        ]
+        filename, _ = self.create_aggregated_file(samples, bucket_usec=5000)
+        plain = self.create_binary_file([sample for _, sample in samples])
+
+        with BinaryReader(filename) as reader:
+            info = reader.get_info()
+            self.assertTrue(info["aggregated"])
+            self.assertEqual(info["version"], 2)
+            self.assertEqual(info["sample_count"], 100)
+            reader.replay_samples(RawCollector())
+            stats = reader.get_stats()
+        self.assertEqual(stats["bucket_records"], 2)
+        # Two stacks, one status, one thread: two counts per bucket
+        self.assertEqual(stats["cell_records"], 4)
+        self.assertEqual(stats["total_samples"], 100)
+
+        with BinaryReader(plain) as reader:
+            info = reader.get_info()
+            self.assertFalse(info["aggregated"])
+            # Readers predating aggregation can still read plain files
+            self.assertEqual(info["version"], 1)
+
+    def test_smaller_than_plain_file(self):
+        samples = self.random_samples(2000)
+        filename, _ = self.create_aggregated_file(samples, bucket_usec=1_000_000)
+        plain = self.create_binary_file([sample for _, sample in samples])
+        self.assertLess(os.path.getsize(filename), os.path.getsize(plain) // 4)
+
+    def test_replay_twice(self):
+        """A reader can replay an aggregated file more than once."""
+        samples = self.random_samples(50)
+        filename, _ = self.create_aggregated_file(samples, bucket_usec=1000)
+
+        with BinaryReader(filename) as reader:
+            first = RawCollector()
+            reader.replay_samples(first)
+            second = RawCollector()
+            reader.replay_samples(second)
+        self.assertEqual(self.count_stacks(first.by_thread),
+                         self.count_stacks(second.by_thread))
+
+    @unittest.skipUnless(ZSTD_AVAILABLE, "zstd compression not available")
+    def test_zstd_compression(self):
+        samples = self.random_samples(200)
+        filename, _ = self.create_aggregated_file(samples, bucket_usec=1000,
+                                                  compression="zstd")
+
+        collector = RawCollector()
+        with BinaryReader(filename) as reader:
+            reader.replay_samples(collector)
+
+        expected = samples_to_by_thread([sample for _, sample in samples])
+        self.assertEqual(self.count_stacks(collector.by_thread),
+                         self.count_stacks(expected))
+
+    def test_invalid_bucket_size(self):
+        with tempfile.NamedTemporaryFile(suffix=".bin") as f:
+            with self.assertRaises(ValueError):
+                BinaryCollector(f.name, 1000, bucket_usec=0)
+
+
 if __name__ == "__main__":
     unittest.main()
@@ -483,6 +483,45 @@ def test_cli_custom_output_filenames(self):
 
                 mock_sample.assert_called_once()
 
+    def test_cli_aggregate_option(self):
+        """--aggregate creates a binary collector aggregating per bucket."""
+        test_args = [
+            "profiling.sampling.cli", "attach", "12345",
+            "--binary", "--aggregate", "--bucket-size", "0.5",
+            "-o", "profile.bin",
+        ]
+        with (
+            mock.patch("sys.argv", test_args),
+            mock.patch("profiling.sampling.cli._is_process_running", return_value=True),
+            mock.patch("profiling.sampling.cli._create_collector") as mock_create,
+            mock.patch("profiling.sampling.cli.sample"),
+            mock.patch("profiling.sampling.cli._handle_output"),
+        ):
+            main()
+
+        mock_create.assert_called_once()
+        self.assertEqual(mock_create.call_args.kwargs["bucket_usec"], 500_000)
+
+    def test_cli_aggregate_validation(self):
+        """--aggregate needs --binary and --bucket-size needs --aggregate."""
+        test_cases = [
+            (["--aggregate"], "--aggregate is only valid with --binary"),
+            (["--flamegraph", "--aggregate"], "--aggregate is only valid with --binary"),
+            (["--binary", "--bucket-size", "2"], "--bucket-size requires --aggregate"),
+            (["--binary", "--aggregate", "--bucket-size", "0"], "bucket size must be positive"),
+        ]
+        for extra, message in test_cases:
+            with (
+                self.subTest(extra=extra),
+                mock.patch("sys.argv", ["profiling.sampling.cli", "attach", "12345", *extra]),
+                mock.patch("sys.stderr", io.StringIO()) as mock_stderr,
+                mock.patch("profiling.sampling.cli.sample"),
+                self.assertRaises(SystemExit) as cm,
+            ):
+                main()
+            self.assertEqual(cm.exception.code, 2)
+            self.assertIn(message, mock_stderr.getvalue())
+
     def test_cli_missing_required_arguments(self):
         """Test that CLI requires subcommand."""
         with (
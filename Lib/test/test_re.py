@@ -2035,6 +2035,37 @@ def test_search_dot_unicode(self):
         self.assertTrue(re.search("123.*-", '123\U0010ffff-'))
         self.assertTrue(re.search("123.*-", '123\xe9\u20ac\U0010ffff-'))
 
+    def test_search_required_literal(self):
+        # The search skips to where a literal contained in the pattern
+        # can be reached.
+        for text in ['', 'x', 'ERROR', '\xe9', '\u20ac',
+                     '\U0010ffff']:
+            line = f'{text} ERROR {text} user={text}x {text}'
+            p = re.compile(r'.*ERROR.*user=(\S+)')
+            self.assertEqual(p.search(line).group(1), text + 'x')
+            self.assertIsNone(p.search(line.replace('ERROR', 'error')))
+            self.assertIsNone(p.search(line, line.rindex('ERROR') + 1))
+            p = re.compile(r'\w+(?:x|y)-(ab)')
+            self.assertIsNone(p.search(text + 'x-ab', 3 + len(text)))
+            m = p.search(f'{text}-ab ax-a yy-ab x-ab')
+            self.assertEqual(m.span(), (len(text) + 9, len(text) + 14))
+            p = re.compile(r'[ab]\w{2,3}(?:cd)+')
+            self.assertEqual(p.findall(f'b{text}cd ab1cd ab12cdcd a12cd'),
+                             ['ab1cd', 'ab12cdcd', 'a12cd'])
+        # Literals which don't fit in the string's character width.
+        self.assertIsNone(re.search(r'\w+\u20ac', 'a' * 100))
+        self.assertIsNone(re.search(r'\w+\U0010ffff', '\u20ac' * 100))
+        # Bytes of the literal straddling two characters.
+        self.assertIsNone(re.search(r'\w*ab', '\u6100\u6200\u0100'))
+        self.assertEqual(re.search(r'\w*ab', '\u6100\u6200\u0100ab').span(),
+                         (0, 5))
+        self.assertIsNone(re.search(r'\w*ab', '\x61\0\0\0\x62\0\0\0\U00010000'))
+        self.assertIsNone(re.search(rb'.*ab', b'a\nb\nba\na\nb'))
+        self.assertEqual(re.search(rb'.*ab', b'a\nb\nbab\na').span(), (4, 7))
+        # Case-insensitive literals are not looked for.
+        self.assertEqual(re.search(r'\d(?i:abc)', '1ABC').span(), (0, 4))
+        self.assertEqual(re.search(r'\d(?i:1bc)', '11BC').span(), (0, 4))
+
     def test_compile(self):
         # Test return value when given string and pattern as parameter
         pattern = re.compile('random pattern')
@@ -2806,14 +2837,48 @@ def test_atomic_group(self):
   MAX_REPEAT 0 1
     LITERAL 98
 
- 0. INFO 4 0b0 1 2 (to 5)
- 5: ATOMIC_GROUP 11 (to 17)
- 7.   LITERAL 0x61 ('a')
- 9.   REPEAT_ONE 6 0 1 (to 16)
-13.     LITERAL 0x62 ('b')
-15.     SUCCESS
-16:   SUCCESS
-17: SUCCESS
+ 0. INFO 8 0b1000 1 2 (to 9)
+      required_offset 0 0
+      required [0x61] ('a')
+ 9: ATOMIC_GROUP 11 (to 21)
+11.   LITERAL 0x61 ('a')
+13.   REPEAT_ONE 6 0 1 (to 20)
+17.     LITERAL 0x62 ('b')
+19.     SUCCESS
+20:   SUCCESS
+21: SUCCESS
+''')
+
+    def test_required_literal(self):
+        self.assertEqual(get_debug_out(r'\d+(?:x|y)-(ab)'), '''\
+MAX_REPEAT 1 MAXREPEAT
+  IN
+    CATEGORY CATEGORY_DIGIT
+IN
+  LITERAL 120
+  LITERAL 121
+LITERAL 45
+SUBPATTERN 1 0 0
+  LITERAL 97
+  LITERAL 98
+
+ 0. INFO 10 0b1000 5 MAXREPEAT (to 11)
+      required_offset 2 MAXREPEAT
+      required [0x2d, 0x61, 0x62] ('-ab')
+11: REPEAT_ONE 9 1 MAXREPEAT (to 21)
+15.   IN 4 (to 20)
+17.     CATEGORY UNI_DIGIT
+19.     FAILURE
+20:   SUCCESS
+21: IN 5 (to 27)
+23.   RANGE 0x78 0x79 ('x'-'y')
+26.   FAILURE
+27: LITERAL 0x2d ('-')
+29. MARK 0
+31. LITERAL 0x61 ('a')
+33. LITERAL 0x62 ('b')
+35. MARK 1
+37. SUCCESS
 ''')
 
     def test_possesive_repeat_one(self):
@@ -2916,11 +2981,129 @@ def test_flags_repr(self):
                          "re.IGNORECASE|re.DOTALL|re.VERBOSE|0x100000")
         self.assertEqual(
                 repr(~re.I),
-                "re.ASCII|re.LOCALE|re.UNICODE|re.MULTILINE|re.DOTALL|re.VERBOSE|re.DEBUG|0x1")
+                "re.ASCII|re.LOCALE|re.UNICODE|re.MULTILINE|re.DOTALL|re.VERBOSE|re.LINEAR|re.DEBUG|0x1")
         self.assertEqual(repr(~(re.I|re.S|re.X)),
-                         "re.ASCII|re.LOCALE|re.UNICODE|re.MULTILINE|re.DEBUG|0x1")
+                         "re.ASCII|re.LOCALE|re.UNICODE|re.MULTILINE|re.LINEAR|re.DEBUG|0x1")
         self.assertEqual(repr(~(re.I|re.S|re.X|(1<<20))),
-                         "re.ASCII|re.LOCALE|re.UNICODE|re.MULTILINE|re.DEBUG|0xffe01")
+                         "re.ASCII|re.LOCALE|re.UNICODE|re.MULTILINE|re.LINEAR|re.DEBUG|0xffc01")
+
+
+class LinearTests(unittest.TestCase):
+
+    def check_same(self, pattern, string, flags=0):
+        # The linear engine finds the same matches and groups as the
+        # backtracking engine.
+        a = re.compile(pattern, flags)
+        b = re.compile(pattern, flags | re.LINEAR)
+        for method in ('prefixmatch', 'fullmatch', 'search'):
+            with self.subTest(pattern=pattern, string=string, method=method):
+                ma = getattr(a, method)(string)
+                mb = getattr(b, method)(string)
+                if ma is None:
+                    self.assertIsNone(mb)
+                else:
+                    self.assertEqual(mb.span(), ma.span())
+                    self.assertEqual(mb.regs, ma.regs)
+                    self.assertEqual(mb.lastindex, ma.lastindex)
+                    self.assertEqual(mb.lastgroup, ma.lastgroup)
+        with self.subTest(pattern=pattern, string=string):
+            self.assertEqual([m.regs for m in b.finditer(string)],
+                             [m.regs for m in a.finditer(string)])
+            self.assertEqual(b.split(string), a.split(string))
+            repl = r'<\g<0>>' if isinstance(string, str) else rb'<\g<0>>'
+            self.assertEqual(b.sub(repl, string), a.sub(repl, string))
+
+    def test_same_results(self):
+        patterns = [
+            r'a', r'abc', r'a|b|c', r'(a|ab)(c|bcd)(d*)', r'(a*)(b*)',
+            r'(a+?)(a*)', r'(a|b)*c', r'(a|b)*?c', r'(?:(a)|(b))+',
+            r'(a(b)?)+', r'x*', r'\b\w+\b', r'\B', r'^(\w+)\s*=\s*(\S*)$',
+            r'(?P<key>\w+)=(?P<value>\d+)', r'[^a-c]+', r'.{2,3}', r'a{2}',
+            r'(a{1,2}?)(a*)', r'(?i:A)b', r'\Aab|b\Z', r'(?m)^b$', r'(?s).+',
+            r'(\d{1,3}(?:,\d{3})*)', r'(?!)',
+        ]
+        strings = ['', 'a', 'ab', 'abc', 'aab', 'abcd', 'bbaac', 'Ab\nb',
+                   'key=123, x=4', '1,234,567 and 89', 'aaa']
+        for pattern in patterns:
+            for string in strings:
+                self.check_same(pattern, string)
+        for string in strings:
+            self.check_same(r'a|b', string, re.I)
+            self.check_same(r'^a.$', string, re.M)
+            self.check_same(r'a.', string, re.S)
+            self.check_same(r'(\w+)', string, re.A)
+        self.check_same(r'(\w+)-(\d+)', '\xe9t\xe9-\u0664\u0662 x-1')
+        self.check_same(r'(\w+)-(\d+)', '\U0001d49c-1 \xff-\u0664')
+        self.check_same(r'(?i)\u212a|s', 'Kk\u017fS')
+        self.check_same(rb'(\w+)=(\d+)', b'a=1 bb=22')
+        self.check_same(rb'(?i)[a-c]+', b'xABcay')
+
+    def test_pathological(self):
+        # These take exponential time with the backtracking engine.
+        p = re.compile(r'(a+)+$', re.LINEAR)
+        self.assertIsNone(p.match('a' * 100_000 + '!'))
+        m = p.match('a' * 100_000)
+        self.assertEqual(m.span(1), (0, 100_000))
+        p = re.compile(r'(x+x+)+y', re.LINEAR)
+        self.assertIsNone(p.search('x' * 100_000))
+        p = re.compile(r'(?:a|a)*b', re.LINEAR)
+        self.assertIsNone(p.fullmatch('a' * 100_000))
+
+    def test_flags(self):
+        p = re.compile('a', re.LINEAR)
+        self.assertEqual(p.flags, re.LINEAR | re.UNICODE)
+        self.assertEqual(repr(p), "re.compile('a', re.LINEAR)")
+        self.assertEqual(repr(re.LINEAR), 're.LINEAR')
+        self.assertIn('LINEAR', re.__all__)
+        self.assertNotEqual(p, re.compile('a'))
+        self.assertEqual(p, re.compile('a', re.LINEAR))
+        import copy
+        self.assertEqual(copy.deepcopy(p), p)
+
+    def test_unsupported(self):
+        for pattern, what in [
+            (r'(a)\1', 'backreferences'),
+            (r'(?P<a>a)(?P=a)', 'backreferences'),
+            (r'a(?=b)', 'look-around assertions'),
+            (r'a(?!b)', 'look-around assertions'),
+            (r'(?<=a)b', 'look-around assertions'),
+            (r'(?<!a)b', 'look-around assertions'),
+            (r'(?>a+)', 'atomic groups'),
+            (r'a*+', 'possessive quantifiers'),
+            (r'(a)?(?(1)b|c)', 'conditional patterns'),
+        ]:
+            with self.subTest(pattern=pattern):
+                with self.assertRaisesRegex(re.PatternError, what):
+                    re.compile(pattern, re.LINEAR)
+                re.compile(pattern)
+
+    def test_too_large(self):
+        re.compile(r'a{1000}', re.LINEAR)
+        with self.assertRaisesRegex(re.PatternError, 'too large'):
+            re.compile(r'(?:a{1000}){1000}', re.LINEAR)
+        with self.assertRaisesRegex(re.PatternError, 'too large'):
+            re.compile(r'a{,1000000}', re.LINEAR)
+        self.assertTrue(re.fullmatch(r'(?:){1000000000}a', 'a', re.LINEAR))
+
+    def test_scanner(self):
+        p = re.compile(r'(\d+)|(\w+)|\s*', re.LINEAR)
+        scanner = p.scanner('12 ab 3')
+        self.assertEqual([m.lastindex for m in iter(scanner.search, None)],
+                         [1, None, 2, None, 1, None])
+
+    @cpython_only
+    def test_invalid_code(self):
+        import _sre
+        from re._constants import (SUCCESS, JUMP, BRANCH, LITERAL, MARK,
+                                   IN, INFO)
+        for code in ([SUCCESS], [JUMP, 0], [BRANCH, 0, 3, SUCCESS]):
+            _sre.compile('', re.LINEAR, code, 0, {}, ())
+        for code in ([], [LITERAL, 97], [JUMP, 1], [JUMP, 3, SUCCESS],
+                     [BRANCH, 0, 1, SUCCESS], [MARK, 0, SUCCESS],
+                     [IN, 1, SUCCESS], [INFO, 4, 0, 0, 0, SUCCESS]):
+            with self.subTest(code=code):
+                with self.assertRaisesRegex(RuntimeError, 'invalid SRE code'):
+                    _sre.compile('', re.LINEAR, code, 0, {}, ())
 
 
 class ImplementationTest(unittest.TestCase):
@@ -3146,6 +3329,27 @@ def test_re_tests(self):
                     self.assertTrue(obj.search(s))
 
 
+    def test_re_tests_linear(self):
+        're_tests test suite with re.LINEAR'
+        from test.re_tests import tests, SYNTAX_ERROR
+        for pattern, s, outcome, *_ in tests:
+            if outcome == SYNTAX_ERROR:
+                continue
+            with self.subTest(pattern=pattern, string=s):
+                try:
+                    obj = re.compile(pattern, re.LINEAR)
+                except re.PatternError as exc:
+                    self.assertIn('not supported with re.LINEAR', str(exc))
+                    continue
+                expected = re.compile(pattern).search(s)
+                result = obj.search(s)
+                if expected is None:
+                    self.assertIsNone(result)
+                else:
+                    self.assertEqual(result.regs, expected.regs)
+                    self.assertEqual(result.lastindex, expected.lastindex)
+
+
 class TestModule(unittest.TestCase):
     def test_deprecated__version__(self):
         with self.assertWarnsRegex(
@@ -15,6 +15,8 @@
 import string
 import contextlib
 import io
+import socket
+import threading
 from shutil import (make_archive,
                     register_archive_format, unregister_archive_format,
                     get_archive_formats, Error, unpack_archive,
@@ -3389,6 +3391,129 @@ def test_empty_file(self):
                 self.zerocopy_fun(src, dst)
 
 
+@unittest.skipUnless(shutil._USE_CP_SPLICE, "os.splice() not supported")
+class TestZeroCopyFileObj(unittest.TestCase):
+    DATA = random.randbytes(1024 * 1024)
+
+    def setUp(self):
+        self.addCleanup(os_helper.unlink, TESTFN)
+        self.addCleanup(os_helper.unlink, TESTFN2)
+        with open(TESTFN, "wb") as f:
+            f.write(self.DATA)
+
+    def read_pipe(self, r):
+        # Drain the pipe from a thread; return a function which waits for
+        # the thread and returns the data.
+        chunks = []
+        thread = threading.Thread(
+            target=lambda: chunks.extend(iter(lambda: os.read(r, 65536), b"")))
+        thread.start()
+        def result():
+            thread.join()
+            os.close(r)
+            return b"".join(chunks)
+        return result
+
+    def write_pipe(self, w, data):
+        thread = threading.Thread(
+            target=lambda: (os.write(w, data), os.close(w)))
+        thread.start()
+        self.addCleanup(thread.join)
+
+    def test_file_to_file(self):
+        # Data read ahead by the BufferedReader and buffered by the
+        # BufferedWriter must be copied in order.
+        with open(TESTFN, "rb") as src, open(TESTFN2, "wb") as dst:
+            src.read(10)
+            dst.write(b"xx")
+            with unittest.mock.patch("os.copy_file_range",
+                                     wraps=os.copy_file_range) as m:
+                shutil.copyfileobj(src, dst)
+            self.assertTrue(m.called)
+            self.assertEqual(src.tell(), len(self.DATA))
+        with open(TESTFN2, "rb") as f:
+            self.assertEqual(f.read(), b"xx" + self.DATA[10:])
+
+    def test_file_to_pipe(self):
+        r, w = os.pipe()
+        result = self.read_pipe(r)
+        with open(TESTFN, "rb") as src, open(w, "wb") as dst:
+            with unittest.mock.patch("os.splice", wraps=os.splice) as m:
+                shutil.copyfileobj(src, dst)
+            self.assertTrue(m.called)
+        self.assertEqual(result(), self.DATA)
+
+    def test_pipe_to_file(self):
+        r, w = os.pipe()
+        self.write_pipe(w, self.DATA)
+        with open(r, "rb") as src, open(TESTFN2, "wb") as dst:
+            self.assertEqual(src.read(5), self.DATA[:5])
+            with unittest.mock.patch("os.splice", wraps=os.splice) as m:
+                shutil.copyfileobj(src, dst)
+            self.assertTrue(m.called)
+        with open(TESTFN2, "rb") as f:
+            self.assertEqual(f.read(), self.DATA[5:])
+
+    @unittest.skipUnless(hasattr(socket, "socketpair"), "needs socketpair()")
+    def test_socket_to_file(self):
+        # Neither end is a pipe: splice through an intermediate pipe.
+        a, b = socket.socketpair()
+        self.addCleanup(b.close)
+        thread = threading.Thread(target=lambda: (a.sendall(self.DATA),
+                                                  a.close()))
+        thread.start()
+        self.addCleanup(thread.join)
+        with (open(b.fileno(), "rb", buffering=0, closefd=False) as src,
+              open(TESTFN2, "wb") as dst):
+            with unittest.mock.patch("os.splice", wraps=os.splice) as m:
+                shutil.copyfileobj(src, dst)
+            self.assertTrue(m.called)
+        with open(TESTFN2, "rb") as f:
+            self.assertEqual(f.read(), self.DATA)
+
+    def test_fallback(self):
+        # Append mode, and file objects which transform the data, use
+        # read() and write().
+        with open(TESTFN2, "wb") as f:
+            f.write(b"xx")
+        with unittest.mock.patch("shutil._fastcopy_fileobj_loop") as m:
+            with open(TESTFN, "rb") as src, open(TESTFN2, "ab") as dst:
+                shutil.copyfileobj(src, dst)
+            with open(TESTFN, "rb") as src, io.BytesIO() as dst:
+                shutil.copyfileobj(src, dst)
+                self.assertEqual(dst.getvalue(), self.DATA)
+            with open(TESTFN, "rb") as src, open(TESTFN2, "w") as dst:
+                shutil.copyfileobj(io.TextIOWrapper(src, "latin-1"), dst)
+        self.assertFalse(m.called)
+
+    def test_giveup_on_first_error(self):
+        r, w = os.pipe()
+        result = self.read_pipe(r)
+        with unittest.mock.patch("os.splice",
+                                 side_effect=OSError(errno.EINVAL, "")) as m:
+            with open(TESTFN, "rb") as src, open(w, "wb") as dst:
+                shutil.copyfileobj(src, dst)
+            self.assertTrue(m.called)
+        self.assertEqual(result(), self.DATA)
+
+    def test_error_after_copy(self):
+        r, w = os.pipe()
+        self.addCleanup(os.close, r)
+        calls = 0
+        def splice(*args):
+            nonlocal calls
+            calls += 1
+            if calls > 1:
+                raise OSError(errno.EIO, "")
+            return 100
+        with unittest.mock.patch("os.splice", splice):
+            with open(TESTFN, "rb", buffering=0) as src, open(w, "wb") as dst:
+                with self.assertRaises(OSError) as cm:
+                    shutil.copyfileobj(src, dst)
+        self.assertEqual(cm.exception.errno, errno.EIO)
+        self.assertEqual(cm.exception.filename, TESTFN)
+
+
 @unittest.skipIf(not MACOS, 'macOS only')
 class TestZeroCopyMACOS(_ZeroCopyFileTest, unittest.TestCase):
     PATCHPOINT = "posix._fcopyfile"
@@ -3215,6 +3215,80 @@ def _testRecvFromNegative(self):
         self.cli.sendto(MSG, 0, (HOST, self.port))
 
 
+@requireAttrs(socket.socket, "sendmmsg")
+@requireAttrs(socket.socket, "recvmmsg_into")
+class SendRecvMMsgUDPTest(SocketUDPTest):
+    # Tests for sendmmsg() and recvmmsg_into() over UDP.
+
+    def setUp(self):
+        super().setUp()
+        self.cli = socket.socket(socket.AF_INET, socket.SOCK_DGRAM)
+        self.addCleanup(self.cli.close)
+        self.serv.settimeout(support.SHORT_TIMEOUT)
+        self.addr = (HOST, self.port)
+
+    def testSendmmsgAddress(self):
+        msgs = [(b'a' * i, self.addr) for i in range(1, 6)]
+        self.assertEqual(self.cli.sendmmsg(msgs), 5)
+        for i in range(1, 6):
+            self.assertEqual(self.serv.recv(100), b'a' * i)
+
+    def testSendmmsgConnected(self):
+        self.cli.connect(self.addr)
+        msgs = [b'x', bytearray(b'yy'), memoryview(b'zzz')]
+        self.assertEqual(self.cli.sendmmsg(msgs), 3)
+        for expected in [b'x', b'yy', b'zzz']:
+            self.assertEqual(self.serv.recv(100), expected)
+
+    def testSendmmsgEmpty(self):
+        self.assertEqual(self.cli.sendmmsg([]), 0)
+
+    def testSendmmsgBadArgs(self):
+        self.assertRaises(TypeError, self.cli.sendmmsg)
+        self.assertRaises(TypeError, self.cli.sendmmsg, [object()])
+        self.assertRaises(TypeError, self.cli.sendmmsg, [('x', self.addr)])
+        self.assertRaises(TypeError, self.cli.sendmmsg,
+                          [(b'x', self.addr, 0)])
+        self.assertRaises(TypeError, self.cli.sendmmsg, [b'x'], 'flags')
+
+    def testRecvmmsgInto(self):
+        msgs = [(bytes([i]) * (i + 1), self.addr) for i in range(4)]
+        self.cli.sendmmsg(msgs)
+        buffers = [bytearray(16) for _ in range(8)]
+        # recvmmsg_into() waits for the first datagram only, so it may
+        # return before all of them have been queued.
+        received = []
+        while len(received) < 4:
+            result = self.serv.recvmmsg_into(buffers[len(received):])
+            self.assertGreater(len(result), 0)
+            received.extend(result)
+        cli_port = self.cli.getsockname()[1]
+        for i, (nbytes, addr) in enumerate(received):
+            self.assertEqual(nbytes, i + 1)
+            self.assertEqual(addr[1], cli_port)
+            self.assertEqual(buffers[i][:nbytes], bytes([i]) * (i + 1))
+
+    def testRecvmmsgIntoTruncated(self):
+        self.cli.sendto(b'0123456789', self.addr)
+        buf = bytearray(4)
+        [(nbytes, addr)] = self.serv.recvmmsg_into([buf])
+        self.assertEqual(nbytes, 4)
+        self.assertEqual(buf, b'0123')
+
+    def testRecvmmsgIntoTimeout(self):
+        self.serv.settimeout(0.01)
+        self.assertRaises(TimeoutError, self.serv.recvmmsg_into,
+                          [bytearray(8)])
+
+    def testRecvmmsgIntoBadArgs(self):
+        self.assertRaises(TypeError, self.serv.recvmmsg_into)
+        self.assertRaises(TypeError, self.serv.recvmmsg_into, [b'x'])
+        self.assertRaises(TypeError, self.serv.recvmmsg_into, [object()])
+
+    def testRecvmmsgIntoEmpty(self):
+        self.assertEqual(self.serv.recvmmsg_into([]), [])
+
+
 @unittest.skipUnless(HAVE_SOCKET_UDPLITE,
           'UDPLITE sockets required for this test.')
 class BasicUDPLITETest(ThreadedUDPLITESocketTest):
@@ -6887,6 +6961,48 @@ def testNonRegularFile(self):
         self.assertEqual(len(data), self.FILESIZE)
         self.assertEqual(data, self.FILEDATA)
 
+    # pipe: sent with os.splice() if available, else with send()
+
+    def _testPipe(self):
+        address = self.serv.getsockname()
+        r, w = os.pipe()
+        writer = threading.Thread(target=self._write_pipe, args=(w,))
+        writer.start()
+        with socket.create_connection(address) as sock, open(r, 'rb') as file:
+            self.assertEqual(file.read(10), self.FILEDATA[:10])
+            sent = sock.sendfile(file)
+            self.assertEqual(sent, self.FILESIZE - 10)
+            self.assertRaises(socket._GiveupOnSendfile,
+                              sock._sendfile_use_sendfile, file)
+        writer.join()
+
+    def _write_pipe(self, w):
+        with open(w, 'wb') as f:
+            f.write(self.FILEDATA)
+
+    def testPipe(self):
+        conn = self.accept_conn()
+        data = self.recv_data(conn)
+        self.assertEqual(len(data), self.FILESIZE - 10)
+        self.assertEqual(data, self.FILEDATA[10:])
+
+    def _testPipeCount(self):
+        address = self.serv.getsockname()
+        r, w = os.pipe()
+        writer = threading.Thread(target=self._write_pipe, args=(w,))
+        writer.start()
+        with socket.create_connection(address) as sock, open(r, 'rb') as file:
+            sent = sock.sendfile(file, count=5000007)
+            self.assertEqual(sent, 5000007)
+            # The rest of the data is still in the pipe.
+            self.assertEqual(file.read(), self.FILEDATA[5000007:])
+        writer.join()
+
+    def testPipeCount(self):
+        conn = self.accept_conn()
+        data = self.recv_data(conn)
+        self.assertEqual(data, self.FILEDATA[:5000007])
+
     # empty file
 
     def _testEmptyFileSend(self):
@@ -353,6 +353,31 @@ def test_rfind(self):
         self.checkequal(-1, 'a' * 100, 'rfind', '\U00100304a')
         self.checkequal(-1, '\u0102' * 100, 'rfind', '\U00100304\u0102')
 
+    def test_find_char_wide(self):
+        # test implementation details of the vectorized single character
+        # search: the filler shares its low byte with the needle, which
+        # defeats the memchr fast path, and the lengths straddle the
+        # vector width
+        for fill, c in ('\u0200', '\u0300'), ('\U00100000', '\U00100100'):
+            for n in range(1, 70):
+                s = fill * n
+                self.checkequal(-1, s, 'find', c)
+                self.checkequal(-1, s, 'rfind', c)
+                self.checkequal(0, s, 'count', c)
+                for i in sorted({0, n // 3, n - 1}):
+                    t = s[:i] + c + s[i+1:]
+                    self.checkequal(i, t, 'find', c)
+                    self.checkequal(i, t, 'rfind', c)
+                    self.checkequal(1, t, 'count', c)
+                    self.checkequal([s[:i], s[i+1:]], t, 'split', c)
+                    self.checkequal([s[:i], s[i+1:]], t, 'rsplit', c)
+                t = c + s + c
+                self.checkequal(n + 1, t, 'find', c, 1)
+                self.checkequal(0, t, 'rfind', c, 0, n + 1)
+                self.checkequal(2, t, 'count', c)
+                self.checkequal(1, t, 'count', c, 0, n + 1)
+                self.checkequal('x' + s + c, t, 'replace', c, 'x', 1)
+
     def test_index(self):
         string_tests.StringLikeTest.test_index(self)
         self.checkequalnofix(0, 'abcdefghiabc', 'index',  '')
@@ -1894,6 +1919,34 @@ def test_utf8_decode_valid_sequences(self):
             self.assertEqual(seq.decode('utf-8'), res)
 
 
+    def test_utf8_block_boundaries(self):
+        # The codecs process blocks of 8 or 16 characters at a time: check
+        # sequences straddling a block end, and errors at every offset.
+        chars = ['a', '\xe9', '\u0800', '\u20ac', '\ud7ff', '\ue000',
+                 '\uffff', '\U0001f600']
+        for n in range(30):
+            for c in chars:
+                for text in ('a' * n + c * 20, '\u4e00' * n + c + 'a' * 20,
+                             ('\u3042' + c) * n):
+                    with self.subTest(n=n, c=c, text=text):
+                        data = text.encode('utf-8')
+                        self.assertEqual(data.decode('utf-8'), text)
+                        self.assertEqual(text.encode('utf-8'), data)
+            text = '\u4e00' * n + '\ud800' + '\u4e00' * 20
+            self.assertRaises(UnicodeEncodeError, text.encode, 'utf-8')
+            self.assertEqual(text.encode('utf-8', 'surrogatepass'),
+                             b'\xe4\xb8\x80' * n + b'\xed\xa0\x80'
+                             + b'\xe4\xb8\x80' * 20)
+            for bad in (b'\x80', b'\xe4\xb8', b'\xe0\x80\x80',
+                        b'\xed\xa0\x80', b'\xff'):
+                data = b'\xe4\xb8\x80' * n + bad + b'\xe4\xb8\x80' * 20
+                with self.subTest(n=n, bad=bad):
+                    self.assertRaises(UnicodeDecodeError, data.decode, 'utf-8')
+                    self.assertEqual(
+                        data.decode('utf-8', 'replace'),
+                        '\u4e00' * n + bad.decode('utf-8', 'replace')
+                        + '\u4e00' * 20)
+
     def test_utf8_decode_invalid_sequences(self):
         # continuation bytes in a sequence of 2, 3, or 4 bytes
         continuation_bytes = [bytes([x]) for x in range(0x80, 0xC0)]
@@ -1169,6 +1169,19 @@ def test_is_gil_enabled(self):
         else:
             self.assertTrue(sys._is_gil_enabled())
 
+    def test_allocation_sampling(self):
+        self.assertEqual(sys._get_allocation_sampling(), 0)
+        self.addCleanup(sys._set_allocation_sampling, 0)
+        sys._set_allocation_sampling(4096)
+        self.assertEqual(sys._get_allocation_sampling(), 4096)
+        data = [bytes(100) for _ in range(10_000)]
+        self.assertEqual(len(data), 10_000)
+        sys._set_allocation_sampling(0)
+        self.assertEqual(sys._get_allocation_sampling(), 0)
+        with self.assertRaises(ValueError):
+            sys._set_allocation_sampling(-1)
+        self.assertEqual(sys._get_allocation_sampling(), 0)
+
     def test_is_finalizing(self):
         self.assertIs(sys.is_finalizing(), False)
         # Don't use the atexit module because _Py_Finalizing is only set
@@ -3,6 +3,7 @@
 #endif
 
 #include "Python.h"
+#include "pycore_context.h"       // PyContext
 #include "pycore_freelist.h"      // _Py_FREELIST_POP()
 #include "pycore_genobject.h"
 #include "pycore_llist.h"         // struct llist_node
@@ -10,6 +11,7 @@
 #include "pycore_modsupport.h"    // _PyArg_CheckPositional()
 #include "pycore_moduleobject.h"  // _PyModule_GetState()
 #include "pycore_object.h"        // _PyObject_SetMaybeWeakref
+#include "pycore_parking_lot.h"   // _PyParkingLot_Park()
 #include "pycore_pylifecycle.h"   // _Py_IsInterpreterFinalizing()
 #include "pycore_pystate.h"       // _PyThreadState_GET()
 #include "pycore_runtime_init.h"  // _Py_ID()
@@ -78,6 +80,37 @@ typedef struct {
     PyObject *sw_arg;
 } TaskStepMethWrapper;
 
+typedef enum {
+    READY_HANDLE,       // re_callback is a Handle added from Python
+    READY_CALLBACK,     // re_callback(re_arg), or re_callback() without arg
+    READY_TASK_STEP,    // Task.__step(re_arg) of the task re_callback
+} ready_kind;
+
+typedef struct {
+    ready_kind re_kind;
+    PyObject *re_callback;
+    PyObject *re_arg;
+    PyObject *re_context;
+} ReadyEntry;
+
+typedef struct {
+    PyMutex rs_mutex;
+    ReadyEntry *rs_entries;     // ring buffer, rs_capacity is a power of 2
+    Py_ssize_t rs_capacity;
+    Py_ssize_t rs_head;
+    Py_ssize_t rs_size;
+} ReadyShard;
+
+typedef struct {
+    PyObject_HEAD
+    PyObject *rq_loop;
+    ReadyShard *rq_shards;      // one per worker thread
+    Py_ssize_t rq_nshards;
+    Py_ssize_t rq_next_shard;   // round robin for callbacks from other threads
+    int rq_waiting;             // number of workers blocked in wait()
+    uint32_t rq_wakeups;        // bumped to wake up waiting workers
+} ReadyQueueObj;
+
 #define Future_CheckExact(state, obj) Py_IS_TYPE(obj, state->FutureType)
 #define Task_CheckExact(state, obj) Py_IS_TYPE(obj, state->TaskType)
 
@@ -146,6 +179,7 @@ typedef struct {
     PyTypeObject *TaskStepMethWrapper_Type;
     PyTypeObject *FutureType;
     PyTypeObject *TaskType;
+    PyTypeObject *ReadyQueueType;
 
     PyObject *asyncio_mod;
     PyObject *context_kwname;
@@ -163,6 +197,16 @@ typedef struct {
 
     /* Imports from asyncio.events. */
     PyObject *asyncio_get_event_loop_policy;
+    PyObject *asyncio_Handle;
+
+    /* Imports from asyncio.format_helpers. */
+    PyObject *asyncio_format_callback_source;
+
+    /* BaseEventLoop.call_soon() and BaseEventLoop._call_soon(): callbacks
+       are put straight into the ReadyQueue of loops that don't override
+       them.  Set by _set_base_event_loop(). */
+    PyObject *base_loop_call_soon;
+    PyObject *base_loop__call_soon;
 
     /* Imports from asyncio.base_futures. */
     PyObject *asyncio_future_repr_func;
@@ -232,6 +276,10 @@ static PyObject * future_new_iter(PyObject *);
 
 static PyObject *
 task_step_handle_result_impl(asyncio_state *state, TaskObj *task, PyObject *result);
+static int loop_is_multithreaded(asyncio_state *state, PyObject *loop);
+static int ready_queue_call_soon(asyncio_state *state, PyObject *loop,
+                                 ready_kind kind, PyObject *callback,
+                                 PyObject *arg, PyObject *context);
 static void unregister_task(TaskObj *task);
 
 static void
@@ -363,8 +411,8 @@ get_event_loop(asyncio_state *state)
 
 
 static int
-call_soon(asyncio_state *state, PyObject *loop, PyObject *func, PyObject *arg,
-          PyObject *ctx)
+call_soon_method(asyncio_state *state, PyObject *loop, PyObject *func,
+                 PyObject *arg, PyObject *ctx)
 {
     PyObject *handle;
 
@@ -396,6 +444,18 @@ call_soon(asyncio_state *state, PyObject *loop, PyObject *func, PyObject *arg,
     return 0;
 }
 
+static int
+call_soon(asyncio_state *state, PyObject *loop, PyObject *func, PyObject *arg,
+          PyObject *ctx)
+{
+    int res = ready_queue_call_soon(state, loop, READY_CALLBACK, func, arg,
+                                    ctx);
+    if (res != 0) {
+        return res < 0 ? -1 : 0;
+    }
+    return call_soon_method(state, loop, func, arg, ctx);
+}
+
 
 static inline int
 future_is_alive(FutureObj *fut)
@@ -2189,6 +2249,19 @@ static  PyMethodDef TaskWakeupDef = {
 static void
 register_task(_PyThreadStateImpl *ts, TaskObj *task)
 {
+#ifdef Py_GIL_DISABLED
+    if (task->task_tid == 0) {
+        // The task belongs to a loop that runs on several threads, it may
+        // finish on any of them: use the interpreter's locked list.
+        PyInterpreterState *interp = ts->base.interp;
+        PyMutex_Lock(&interp->asyncio_tasks_lock);
+        if (task->task_node.next == NULL) {
+            llist_insert_tail(&interp->asyncio_tasks_head, &task->task_node);
+        }
+        PyMutex_Unlock(&interp->asyncio_tasks_lock);
+        return;
+    }
+#endif
     if (task->task_node.next != NULL) {
         // already registered
         assert(task->task_node.prev != NULL);
@@ -2218,6 +2291,13 @@ unregister_task(TaskObj *task)
     if (task->task_tid == _Py_ThreadId()) {
         unregister_task_safe(task);
     }
+    else if (task->task_tid == 0) {
+        // registered in the interpreter's list, see register_task()
+        PyInterpreterState *interp = _PyInterpreterState_GET();
+        PyMutex_Lock(&interp->asyncio_tasks_lock);
+        unregister_task_safe(task);
+        PyMutex_Unlock(&interp->asyncio_tasks_lock);
+    }
     else {
         // we are in a different thread
         // stop the world then check and remove the task
@@ -2343,7 +2423,12 @@ _asyncio_Task___init___impl(TaskObj *self, PyObject *coro, PyObject *loop,
 
     Py_CLEAR(self->task_fut_waiter);
 #ifdef Py_GIL_DISABLED
-    self->task_tid = _Py_ThreadId();
+    int multithreaded = loop_is_multithreaded(state, self->task_loop);
+    if (multithreaded < 0) {
+        return -1;
+    }
+    // A task_tid of 0 registers the task in the interpreter's list.
+    self->task_tid = multithreaded ? 0 : _Py_ThreadId();
 #endif
     self->task_must_cancel = 0;
     self->task_log_destroy_pending = 1;
@@ -2385,15 +2470,17 @@ _asyncio_Task___init___impl(TaskObj *self, PyObject *coro, PyObject *loop,
         }
     }
 
-    if (task_call_step_soon(state, self, NULL)) {
-        return -1;
-    }
 #ifdef Py_GIL_DISABLED
     // This is required so that _Py_TryIncref(self)
     // works correctly in non-owning threads.
     _PyObject_SetMaybeWeakref((PyObject *)self);
 #endif
+    // Register the task before scheduling it: on a multithreaded loop,
+    // another thread may run it to completion before call_soon() returns.
     register_task(ts, self);
+    if (task_call_step_soon(state, self, NULL)) {
+        return -1;
+    }
     return 0;
 }
 
@@ -2995,12 +3082,19 @@ TaskObj_dealloc(PyObject *self)
 static int
 task_call_step_soon(asyncio_state *state, TaskObj *task, PyObject *arg)
 {
+    int ret = ready_queue_call_soon(state, task->task_loop, READY_TASK_STEP,
+                                    (PyObject *)task, arg, task->task_context);
+    if (ret != 0) {
+        return ret < 0 ? -1 : 0;
+    }
+
     PyObject *cb = TaskStepMethWrapper_new(task, arg);
     if (cb == NULL) {
         return -1;
     }
 
-    int ret = call_soon(state, task->task_loop, cb, NULL, task->task_context);
+    ret = call_soon_method(state, task->task_loop, cb, NULL,
+                           task->task_context);
     Py_DECREF(cb);
     return ret;
 }
@@ -3583,6 +3677,852 @@ task_wakeup(PyObject *op, PyObject *arg)
 }
 
 
+/*********************** Ready queue **************************/
+
+/* The ready queue of asyncio.BaseEventLoop.
+
+   Callbacks added from Python (Handles) are stored as is.  Callbacks that
+   Futures and Tasks schedule on a loop that doesn't override call_soon()
+   are stored as plain (callback, arg, context) entries instead: no Handle
+   is created for them, and ReadyQueue.run() calls them directly.  A Handle
+   is only created if Python code pops such an entry from the queue. */
+
+/*[clinic input]
+class _asyncio.ReadyQueue "ReadyQueueObj *" "&ReadyQueue_Type"
+[clinic start generated code]*/
+/*[clinic end generated code: output=da39a3ee5e6b4b0d input=d3d1cf86884cdb4b]*/
+
+#define READY_QUEUE_MIN_CAPACITY 16
+
+/* The worker whose callbacks the current thread is running, if any: see
+   ReadyQueue.run(). */
+static _Py_thread_local ReadyQueueObj *current_ready_queue;
+static _Py_thread_local Py_ssize_t current_worker;
+
+static void
+ready_entry_clear(ReadyEntry *entry)
+{
+    Py_CLEAR(entry->re_callback);
+    Py_CLEAR(entry->re_arg);
+    Py_CLEAR(entry->re_context);
+}
+
+static int
+ready_shard_grow(ReadyShard *shard)
+{
+    Py_ssize_t capacity = shard->rs_capacity ? shard->rs_capacity * 2
+                                             : READY_QUEUE_MIN_CAPACITY;
+    ReadyEntry *entries = PyMem_New(ReadyEntry, capacity);
+    if (entries == NULL) {
+        PyErr_NoMemory();
+        return -1;
+    }
+    Py_ssize_t mask = shard->rs_capacity - 1;
+    for (Py_ssize_t i = 0; i < shard->rs_size; i++) {
+        entries[i] = shard->rs_entries[(shard->rs_head + i) & mask];
+    }
+    PyMem_Free(shard->rs_entries);
+    shard->rs_entries = entries;
+    shard->rs_capacity = capacity;
+    shard->rs_head = 0;
+    return 0;
+}
+
+/* Move the first entry of the shard to *entry.  Return 0 if it is empty. */
+static int
+ready_shard_pop(ReadyShard *shard, ReadyEntry *entry)
+{
+    if (FT_ATOMIC_LOAD_SSIZE_RELAXED(shard->rs_size) == 0) {
+        return 0;
+    }
+    int res = 0;
+    FT_MUTEX_LOCK(&shard->rs_mutex);
+    if (shard->rs_size > 0) {
+        *entry = shard->rs_entries[shard->rs_head];
+        shard->rs_head = (shard->rs_head + 1) & (shard->rs_capacity - 1);
+        FT_ATOMIC_STORE_SSIZE_RELAXED(shard->rs_size, shard->rs_size - 1);
+        res = 1;
+    }
+    FT_MUTEX_UNLOCK(&shard->rs_mutex);
+    return res;
+}
+
+static void
+ready_queue_unpark(void *arg, void *park_arg, int has_more_waiters)
+{
+}
+
+/* Wake up one worker blocked in ReadyQueue.wait(), or all of them. */
+static void
+ready_queue_notify(ReadyQueueObj *rq, int all)
+{
+    _Py_atomic_add_uint32(&rq->rq_wakeups, 1);
+    if (all) {
+        _PyParkingLot_UnparkAll(&rq->rq_wakeups);
+    }
+    else {
+        _PyParkingLot_Unpark(&rq->rq_wakeups, ready_queue_unpark, NULL);
+    }
+}
+
+/* Append an entry, taking new references to callback, arg and context.
+
+   While a worker runs callbacks, the ones it schedules go to its own
+   shard.  Callbacks added by other threads (I/O polling, timers,
+   call_soon_threadsafe()) are spread over all the workers. */
+static int
+ready_queue_push(ReadyQueueObj *rq, ready_kind kind, PyObject *callback,
+                 PyObject *arg, PyObject *context)
+{
+    ReadyShard *shard = rq->rq_shards;
+    if (rq->rq_nshards > 1) {
+        if (current_ready_queue == rq) {
+            shard += current_worker;
+        }
+        else {
+            size_t i = (size_t)_Py_atomic_add_ssize(&rq->rq_next_shard, 1);
+            shard += i % (size_t)rq->rq_nshards;
+        }
+    }
+
+    FT_MUTEX_LOCK(&shard->rs_mutex);
+    if (shard->rs_size == shard->rs_capacity && ready_shard_grow(shard) < 0) {
+        FT_MUTEX_UNLOCK(&shard->rs_mutex);
+        return -1;
+    }
+    ReadyEntry *entry = &shard->rs_entries[
+        (shard->rs_head + shard->rs_size) & (shard->rs_capacity - 1)];
+    entry->re_kind = kind;
+    entry->re_callback = Py_NewRef(callback);
+    entry->re_arg = Py_XNewRef(arg);
+    entry->re_context = Py_XNewRef(context);
+    FT_ATOMIC_STORE_SSIZE_RELAXED(shard->rs_size, shard->rs_size + 1);
+    FT_MUTEX_UNLOCK(&shard->rs_mutex);
+
+    if (rq->rq_nshards > 1) {
+        // Pairs with the increment of rq_waiting in ReadyQueue.wait(): either
+        // the waiting worker sees the new entry, or this sees the worker.
+        _Py_atomic_fence_seq_cst();
+        if (_Py_atomic_load_int_relaxed(&rq->rq_waiting) > 0) {
+            ready_queue_notify(rq, 0);
+        }
+    }
+    return 0;
+}
+
+/* Move the next entry for 'worker' to *entry: the first one of its own
+   shard, or else one stolen from another worker.  Return 0 if the queue
+   is empty. */
+static int
+ready_queue_pop(ReadyQueueObj *rq, Py_ssize_t worker, ReadyEntry *entry)
+{
+    Py_ssize_t nshards = rq->rq_nshards;
+    for (Py_ssize_t i = 0; i < nshards; i++) {
+        if (ready_shard_pop(&rq->rq_shards[(worker + i) % nshards], entry)) {
+            return 1;
+        }
+    }
+    return 0;
+}
+
+/* Return 1 if 'loop' runs its callbacks on several threads, 0 if not, or
+   -1 on error.  Such a loop keeps one ready queue shard per thread. */
+static int
+loop_is_multithreaded(asyncio_state *state, PyObject *loop)
+{
+    if (Py_TYPE(loop)->tp_getattro != PyObject_GenericGetAttr) {
+        return 0;
+    }
+    PyObject *ready;
+    if (PyObject_GetOptionalAttr(loop, &_Py_ID(_ready), &ready) < 0) {
+        return -1;
+    }
+    int res = (ready != NULL && Py_IS_TYPE(ready, state->ReadyQueueType)
+               && ((ReadyQueueObj *)ready)->rq_nshards > 1);
+    Py_XDECREF(ready);
+    return res;
+}
+
+/* Schedule callback(arg) (or a step of the task 'callback' for
+   READY_TASK_STEP) on the ready queue of 'loop', bypassing its call_soon()
+   method.  Return 1 on success, or 0 if the loop must be called instead:
+   it isn't a BaseEventLoop, overrides call_soon(), is closed or runs in
+   debug mode. */
+static int
+ready_queue_call_soon(asyncio_state *state, PyObject *loop, ready_kind kind,
+                      PyObject *callback, PyObject *arg, PyObject *context)
+{
+    // Don't run a custom __getattribute__() here: the fallback would run it
+    // a second time.
+    if (state->base_loop_call_soon == NULL ||
+        Py_TYPE(loop)->tp_getattro != PyObject_GenericGetAttr)
+    {
+        return 0;
+    }
+
+    PyObject *meth = NULL;
+    int unbound = _PyObject_GetMethod(loop, &_Py_ID(call_soon), &meth);
+    int overridden = (!unbound || meth != state->base_loop_call_soon);
+    Py_XDECREF(meth);
+    if (overridden) {
+        PyErr_Clear();
+        return 0;
+    }
+    meth = NULL;
+    unbound = _PyObject_GetMethod(loop, &_Py_ID(_call_soon), &meth);
+    overridden = (!unbound || meth != state->base_loop__call_soon);
+    Py_XDECREF(meth);
+    if (overridden) {
+        PyErr_Clear();
+        return 0;
+    }
+
+    PyObject *flag;
+    int fast = 1;
+    if (PyObject_GetOptionalAttr(loop, &_Py_ID(_closed), &flag) < 0) {
+        return -1;
+    }
+    fast &= (flag == Py_False);
+    Py_XDECREF(flag);
+    if (PyObject_GetOptionalAttr(loop, &_Py_ID(_debug), &flag) < 0) {
+        return -1;
+    }
+    fast &= (flag == Py_False);
+    Py_XDECREF(flag);
+    if (!fast) {
+        return 0;
+    }
+
+    PyObject *ready;
+    if (PyObject_GetOptionalAttr(loop, &_Py_ID(_ready), &ready) < 0) {
+        return -1;
+    }
+    if (ready == NULL || !Py_IS_TYPE(ready, state->ReadyQueueType)
+        || ((ReadyQueueObj *)ready)->rq_loop != loop)
+    {
+        Py_XDECREF(ready);
+        return 0;
+    }
+
+    int res;
+    if (context == NULL) {
+        // Like asyncio.Handle, run the callback in a copy of the current
+        // context.
+        context = PyContext_CopyCurrent();
+        if (context == NULL) {
+            Py_DECREF(ready);
+            return -1;
+        }
+    }
+    else {
+        Py_INCREF(context);
+    }
+    res = ready_queue_push((ReadyQueueObj *)ready, kind, callback, arg,
+                           context);
+    Py_DECREF(context);
+    Py_DECREF(ready);
+    return res < 0 ? -1 : 1;
+}
+
+/* Return the Handle the pure-Python event loop would have created for the
+   entry. */
+static PyObject *
+ready_entry_as_handle(asyncio_state *state, PyObject *loop, ReadyEntry *entry)
+{
+    if (entry->re_kind == READY_HANDLE) {
+        return Py_NewRef(entry->re_callback);
+    }
+
+    PyObject *callback, *args;
+    if (entry->re_kind == READY_TASK_STEP) {
+        callback = TaskStepMethWrapper_new((TaskObj *)entry->re_callback,
+                                           entry->re_arg);
+        args = PyTuple_New(0);
+    }
+    else {
+        callback = Py_NewRef(entry->re_callback);
+        args = entry->re_arg != NULL ? PyTuple_Pack(1, entry->re_arg)
+                                     : PyTuple_New(0);
+    }
+    if (callback == NULL || args == NULL) {
+        Py_XDECREF(callback);
+        Py_XDECREF(args);
+        return NULL;
+    }
+    PyObject *handle = PyObject_CallFunctionObjArgs(
+        state->asyncio_Handle, callback, args, loop, entry->re_context, NULL);
+    Py_DECREF(callback);
+    Py_DECREF(args);
+    return handle;
+}
+
+/* Report the exception raised by the callback of a C entry the way
+   Handle._run() does, letting SystemExit and KeyboardInterrupt through. */
+static int
+ready_entry_report_error(asyncio_state *state, PyObject *loop,
+                         ReadyEntry *entry)
+{
+    PyObject *exc = PyErr_GetRaisedException();
+    if (PyErr_GivenExceptionMatches(exc, PyExc_SystemExit) ||
+        PyErr_GivenExceptionMatches(exc, PyExc_KeyboardInterrupt))
+    {
+        PyErr_SetRaisedException(exc);
+        return -1;
+    }
+
+    PyObject *handle = NULL, *callback = NULL, *args = NULL;
+    PyObject *source = NULL, *message = NULL, *context = NULL;
+    int res = -1;
+
+    handle = ready_entry_as_handle(state, loop, entry);
+    if (handle == NULL) {
+        goto finally;
+    }
+    callback = PyObject_GetAttr(handle, &_Py_ID(_callback));
+    if (callback == NULL) {
+        goto finally;
+    }
+    args = PyObject_GetAttr(handle, &_Py_ID(_args));
+    if (args == NULL) {
+        goto finally;
+    }
+    source = PyObject_CallFunctionObjArgs(
+        state->asyncio_format_callback_source, callback, args, NULL);
+    if (source == NULL) {
+        goto finally;
+    }
+    message = PyUnicode_FromFormat("Exception in callback %U", source);
+    if (message == NULL) {
+        goto finally;
+    }
+    context = PyDict_New();
+    if (context == NULL) {
+        goto finally;
+    }
+    if (PyDict_SetItem(context, &_Py_ID(message), message) < 0 ||
+        PyDict_SetItem(context, &_Py_ID(exception), exc) < 0 ||
+        PyDict_SetItem(context, &_Py_ID(handle), handle) < 0)
+    {
+        goto finally;
+    }
+    PyObject *ret = PyObject_CallMethodOneArg(
+        loop, &_Py_ID(call_exception_handler), context);
+    if (ret != NULL) {
+        Py_DECREF(ret);
+        res = 0;
+    }
+
+finally:
+    Py_XDECREF(handle);
+    Py_XDECREF(callback);
+    Py_XDECREF(args);
+    Py_XDECREF(source);
+    Py_XDECREF(message);
+    Py_XDECREF(context);
+    Py_DECREF(exc);
+    return res;
+}
+
+/* Return 1 if the current thread has entered 'context'. */
+static int
+context_entered_here(PyThreadState *tstate, PyObject *context)
+{
+    for (PyContext *ctx = (PyContext *)tstate->context; ctx != NULL;
+         ctx = ctx->ctx_prev)
+    {
+        if ((PyObject *)ctx == context) {
+            return 1;
+        }
+    }
+    return 0;
+}
+
+/* Return 1 if 'context' is entered by another thread.  On a multithreaded
+   loop, a task step which has just added a done callback to a future may
+   still be running in the task's context when another worker runs the
+   wakeup scheduled by that callback. */
+static int
+ready_context_busy(PyThreadState *tstate, PyObject *context)
+{
+    return (context != NULL && PyContext_CheckExact(context)
+            && FT_ATOMIC_LOAD_INT_RELAXED(((PyContext *)context)->ctx_entered)
+            && !context_entered_here(tstate, context));
+}
+
+/* Run one entry; the equivalent of one iteration of the loop at the end of
+   BaseEventLoop._run_once().  Return 1 without running it if its context is
+   entered by another worker: the caller queues it again. */
+static int
+ready_entry_run(asyncio_state *state, ReadyQueueObj *rq, PyObject *loop,
+                ReadyEntry *entry)
+{
+    PyThreadState *tstate = _PyThreadState_GET();
+    if (entry->re_kind == READY_HANDLE) {
+        PyObject *handle = entry->re_callback;
+        if (rq->rq_nshards > 1) {
+            PyObject *context;
+            if (PyObject_GetOptionalAttr(handle, &_Py_ID(_context),
+                                         &context) < 0)
+            {
+                return -1;
+            }
+            int busy = ready_context_busy(tstate, context);
+            Py_XDECREF(context);
+            if (busy) {
+                return 1;
+            }
+        }
+        PyObject *cancelled = PyObject_GetAttr(handle, &_Py_ID(_cancelled));
+        if (cancelled == NULL) {
+            return -1;
+        }
+        int is_cancelled = PyObject_IsTrue(cancelled);
+        Py_DECREF(cancelled);
+        if (is_cancelled) {
+            return is_cancelled < 0 ? -1 : 0;
+        }
+        PyObject *res = PyObject_CallMethodNoArgs(handle, &_Py_ID(_run));
+        if (res == NULL) {
+            return -1;
+        }
+        Py_DECREF(res);
+        return 0;
+    }
+
+    if (_PyContext_Enter(tstate, entry->re_context) < 0) {
+        // The context may have been exited again since: only check that
+        // this thread didn't enter it.
+        if (rq->rq_nshards > 1
+            && PyErr_ExceptionMatches(PyExc_RuntimeError)
+            && !context_entered_here(tstate, entry->re_context))
+        {
+            PyErr_Clear();
+            return 1;
+        }
+        return ready_entry_report_error(state, loop, entry);
+    }
+    PyObject *res;
+    if (entry->re_kind == READY_TASK_STEP) {
+        TaskObj *task = (TaskObj *)entry->re_callback;
+        Py_BEGIN_CRITICAL_SECTION(task);
+        res = task_step(state, task, entry->re_arg);
+        Py_END_CRITICAL_SECTION();
+    }
+    else if (entry->re_arg != NULL) {
+        res = PyObject_CallOneArg(entry->re_callback, entry->re_arg);
+    }
+    else {
+        res = PyObject_CallNoArgs(entry->re_callback);
+    }
+    if (_PyContext_Exit(tstate, entry->re_context) < 0) {
+        Py_CLEAR(res);
+    }
+    if (res == NULL) {
+        return ready_entry_report_error(state, loop, entry);
+    }
+    Py_DECREF(res);
+    return 0;
+}
+
+/*[clinic input]
+@classmethod
+_asyncio.ReadyQueue.__new__
+
+    loop: object
+    workers: Py_ssize_t = 1
+
+The queue of callbacks that are ready to run on an event loop.
+
+The queue is split between the given number of worker threads, see
+run().
+[clinic start generated code]*/
+
+static PyObject *
+_asyncio_ReadyQueue_impl(PyTypeObject *type, PyObject *loop,
+                         Py_ssize_t workers)
+/*[clinic end generated code: output=0cac76b2a34c43c3 input=ccbf0c69354f0f2c]*/
+{
+    if (workers < 1) {
+        PyErr_SetString(PyExc_ValueError, "workers must be at least 1");
+        return NULL;
+    }
+    ReadyShard *shards = PyMem_New(ReadyShard, workers);
+    if (shards == NULL) {
+        return PyErr_NoMemory();
+    }
+    memset(shards, 0, workers * sizeof(ReadyShard));
+    ReadyQueueObj *self = (ReadyQueueObj *)type->tp_alloc(type, 0);
+    if (self == NULL) {
+        PyMem_Free(shards);
+        return NULL;
+    }
+    self->rq_loop = Py_NewRef(loop);
+    self->rq_shards = shards;
+    self->rq_nshards = workers;
+    return (PyObject *)self;
+}
+
+/*[clinic input]
+_asyncio.ReadyQueue.append
+
+    handle: object
+    /
+
+Add a Handle to the end of the queue.
+[clinic start generated code]*/
+
+static PyObject *
+_asyncio_ReadyQueue_append_impl(ReadyQueueObj *self, PyObject *handle)
+/*[clinic end generated code: output=60a138089dbedcf1 input=3f2bb137831e5304]*/
+{
+    if (ready_queue_push(self, READY_HANDLE, handle, NULL, NULL) < 0) {
+        return NULL;
+    }
+    Py_RETURN_NONE;
+}
+
+/*[clinic input]
+_asyncio.ReadyQueue.popleft
+
+Remove and return the Handle at the start of the queue.
+[clinic start generated code]*/
+
+static PyObject *
+_asyncio_ReadyQueue_popleft_impl(ReadyQueueObj *self)
+/*[clinic end generated code: output=1bd4336c91c7f6d8 input=cd512833f97fea51]*/
+{
+    ReadyEntry entry;
+    if (!ready_queue_pop(self, 0, &entry)) {
+        PyErr_SetString(PyExc_IndexError, "pop from an empty ready queue");
+        return NULL;
+    }
+    asyncio_state *state = get_asyncio_state_by_cls(Py_TYPE(self));
+    PyObject *handle = ready_entry_as_handle(state, self->rq_loop, &entry);
+    ready_entry_clear(&entry);
+    return handle;
+}
+
+/*[clinic input]
+_asyncio.ReadyQueue.clear
+
+Remove all callbacks from the queue.
+[clinic start generated code]*/
+
+static PyObject *
+_asyncio_ReadyQueue_clear_impl(ReadyQueueObj *self)
+/*[clinic end generated code: output=f90b1a016256dd4f input=be7bb388b5798918]*/
+{
+    for (Py_ssize_t i = 0; i < self->rq_nshards; i++) {
+        ReadyShard *shard = &self->rq_shards[i];
+        // Detach the entries first: releasing them can run arbitrary code,
+        // which may add new callbacks to the queue.
+        ReadyEntry *entries;
+        Py_ssize_t capacity, head, size;
+        FT_MUTEX_LOCK(&shard->rs_mutex);
+        entries = shard->rs_entries;
+        capacity = shard->rs_capacity;
+        head = shard->rs_head;
+        size = shard->rs_size;
+        shard->rs_entries = NULL;
+        shard->rs_capacity = 0;
+        shard->rs_head = 0;
+        FT_ATOMIC_STORE_SSIZE_RELAXED(shard->rs_size, 0);
+        FT_MUTEX_UNLOCK(&shard->rs_mutex);
+
+        for (Py_ssize_t j = 0; j < size; j++) {
+            ready_entry_clear(&entries[(head + j) & (capacity - 1)]);
+        }
+        PyMem_Free(entries);
+    }
+    Py_RETURN_NONE;
+}
+
+/*[clinic input]
+_asyncio.ReadyQueue.run
+
+    ntodo: Py_ssize_t
+    worker: Py_ssize_t = 0
+    /
+
+Pop and run up to ntodo callbacks from the start of the queue.
+
+Callbacks are taken from the given worker's part of the queue, then
+from the other workers' parts once it is empty.  Meanwhile, callbacks
+scheduled by the calling thread are added to the worker's part.
+Cancelled Handles are skipped.  Return the number of callbacks popped.
+[clinic start generated code]*/
+
+static PyObject *
+_asyncio_ReadyQueue_run_impl(ReadyQueueObj *self, Py_ssize_t ntodo,
+                             Py_ssize_t worker)
+/*[clinic end generated code: output=916c7bdf53930e88 input=ae106fae5f20e706]*/
+{
+    if (worker < 0 || worker >= self->rq_nshards) {
+        PyErr_SetString(PyExc_ValueError, "worker index out of range");
+        return NULL;
+    }
+    asyncio_state *state = get_asyncio_state_by_cls(Py_TYPE(self));
+    PyObject *loop = Py_NewRef(self->rq_loop);
+    ReadyQueueObj *prev_queue = current_ready_queue;
+    Py_ssize_t prev_worker = current_worker;
+    current_ready_queue = self;
+    current_worker = worker;
+
+    int res = 0;
+    Py_ssize_t popped = 0;
+    ReadyEntry entry;
+    while (popped < ntodo && res == 0) {
+        if (!ready_queue_pop(self, worker, &entry)) {
+            break;
+        }
+        popped++;
+        res = ready_entry_run(state, self, loop, &entry);
+        if (res > 0) {
+            res = ready_queue_push(self, entry.re_kind, entry.re_callback,
+                                   entry.re_arg, entry.re_context);
+        }
+        ready_entry_clear(&entry);
+    }
+
+    current_ready_queue = prev_queue;
+    current_worker = prev_worker;
+    Py_DECREF(loop);
+    if (res < 0) {
+        return NULL;
+    }
+    return PyLong_FromSsize_t(popped);
+}
+
+static int
+ready_queue_is_empty(ReadyQueueObj *self)
+{
+    for (Py_ssize_t i = 0; i < self->rq_nshards; i++) {
+        if (FT_ATOMIC_LOAD_SSIZE(self->rq_shards[i].rs_size) != 0) {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+/*[clinic input]
+_asyncio.ReadyQueue.wait
+
+Block until callbacks are added to the queue or wakeup() is called.
+
+Return immediately if the queue is not empty, if the loop is stopping,
+or if all the other workers are already waiting: the caller is then
+the last running worker, which is expected to poll for I/O instead.
+[clinic start generated code]*/
+
+static PyObject *
+_asyncio_ReadyQueue_wait_impl(ReadyQueueObj *self)
+/*[clinic end generated code: output=e45301a3448d6bba input=8655f0ac99bc04b8]*/
+{
+    uint32_t wakeups = _Py_atomic_load_uint32(&self->rq_wakeups);
+    int waiting = _Py_atomic_add_int(&self->rq_waiting, 1) + 1;
+    int park = (waiting < self->rq_nshards && ready_queue_is_empty(self));
+    if (park) {
+        // A wakeup() after the load of rq_wakeups makes the park below
+        // return at once, one before it comes after setting _stopping.
+        PyObject *stopping;
+        if (PyObject_GetOptionalAttr(self->rq_loop, &_Py_ID(_stopping),
+                                     &stopping) < 0)
+        {
+            _Py_atomic_add_int(&self->rq_waiting, -1);
+            return NULL;
+        }
+        park = (stopping != Py_True);
+        Py_XDECREF(stopping);
+    }
+    int res = Py_PARK_OK;
+    if (park) {
+        res = _PyParkingLot_Park(&self->rq_wakeups, &wakeups,
+                                 sizeof(wakeups), -1, NULL, 1);
+    }
+    _Py_atomic_add_int(&self->rq_waiting, -1);
+    if (res == Py_PARK_INTR && PyErr_CheckSignals() < 0) {
+        return NULL;
+    }
+    Py_RETURN_NONE;
+}
+
+/*[clinic input]
+_asyncio.ReadyQueue.wakeup
+
+Wake up all the workers blocked in wait().
+[clinic start generated code]*/
+
+static PyObject *
+_asyncio_ReadyQueue_wakeup_impl(ReadyQueueObj *self)
+/*[clinic end generated code: output=bca3260a3669114a input=c1e711d5aba87fda]*/
+{
+    ready_queue_notify(self, 1);
+    Py_RETURN_NONE;
+}
+
+static PyObject *
+ReadyQueue_get_waiting(PyObject *op, void *Py_UNUSED(closure))
+{
+    ReadyQueueObj *self = (ReadyQueueObj *)op;
+    return PyLong_FromLong(_Py_atomic_load_int_relaxed(&self->rq_waiting));
+}
+
+static PyObject *
+ReadyQueue_get_workers(PyObject *op, void *Py_UNUSED(closure))
+{
+    ReadyQueueObj *self = (ReadyQueueObj *)op;
+    return PyLong_FromSsize_t(self->rq_nshards);
+}
+
+static PyObject *
+ReadyQueue_iter(PyObject *op)
+{
+    ReadyQueueObj *self = (ReadyQueueObj *)op;
+    asyncio_state *state = get_asyncio_state_by_cls(Py_TYPE(self));
+
+    // Iterate over a snapshot: creating Handles for C entries runs Python
+    // code, which could modify the queue.
+    PyObject *list = PyList_New(0);
+    if (list == NULL) {
+        return NULL;
+    }
+    for (Py_ssize_t i = 0; i < self->rq_nshards; i++) {
+        ReadyShard *shard = &self->rq_shards[i];
+        ReadyEntry *entries = NULL;
+        Py_ssize_t size;
+        FT_MUTEX_LOCK(&shard->rs_mutex);
+        size = shard->rs_size;
+        entries = PyMem_New(ReadyEntry, size ? size : 1);
+        if (entries != NULL) {
+            for (Py_ssize_t j = 0; j < size; j++) {
+                ReadyEntry *entry = &shard->rs_entries[
+                    (shard->rs_head + j) & (shard->rs_capacity - 1)];
+                entries[j] = *entry;
+                Py_INCREF(entry->re_callback);
+                Py_XINCREF(entry->re_arg);
+                Py_XINCREF(entry->re_context);
+            }
+        }
+        FT_MUTEX_UNLOCK(&shard->rs_mutex);
+        if (entries == NULL) {
+            Py_DECREF(list);
+            return PyErr_NoMemory();
+        }
+
+        for (Py_ssize_t j = 0; j < size; j++) {
+            if (list != NULL) {
+                PyObject *handle = ready_entry_as_handle(
+                    state, self->rq_loop, &entries[j]);
+                if (handle == NULL || _PyList_AppendTakeRef(
+                        (PyListObject *)list, handle) < 0)
+                {
+                    Py_CLEAR(list);
+                }
+            }
+            ready_entry_clear(&entries[j]);
+        }
+        PyMem_Free(entries);
+        if (list == NULL) {
+            return NULL;
+        }
+    }
+    PyObject *it = PyObject_GetIter(list);
+    Py_DECREF(list);
+    return it;
+}
+
+static Py_ssize_t
+ReadyQueue_len(PyObject *op)
+{
+    ReadyQueueObj *self = (ReadyQueueObj *)op;
+    Py_ssize_t size = 0;
+    for (Py_ssize_t i = 0; i < self->rq_nshards; i++) {
+        size += FT_ATOMIC_LOAD_SSIZE_RELAXED(self->rq_shards[i].rs_size);
+    }
+    return size;
+}
+
+static int
+ReadyQueue_traverse(PyObject *op, visitproc visit, void *arg)
+{
+    ReadyQueueObj *self = (ReadyQueueObj *)op;
+    Py_VISIT(Py_TYPE(self));
+    Py_VISIT(self->rq_loop);
+    for (Py_ssize_t i = 0; i < self->rq_nshards; i++) {
+        ReadyShard *shard = &self->rq_shards[i];
+        for (Py_ssize_t j = 0; j < shard->rs_size; j++) {
+            ReadyEntry *entry = &shard->rs_entries[
+                (shard->rs_head + j) & (shard->rs_capacity - 1)];
+            Py_VISIT(entry->re_callback);
+            Py_VISIT(entry->re_arg);
+            Py_VISIT(entry->re_context);
+        }
+    }
+    return 0;
+}
+
+static int
+ReadyQueue_clear(PyObject *op)
+{
+    ReadyQueueObj *self = (ReadyQueueObj *)op;
+    Py_CLEAR(self->rq_loop);
+    PyObject *res = _asyncio_ReadyQueue_clear_impl(self);
+    assert(res == Py_None);
+    Py_DECREF(res);
+    return 0;
+}
+
+static void
+ReadyQueue_dealloc(PyObject *op)
+{
+    PyTypeObject *tp = Py_TYPE(op);
+    PyObject_GC_UnTrack(op);
+    (void)ReadyQueue_clear(op);
+    PyMem_Free(((ReadyQueueObj *)op)->rq_shards);
+    tp->tp_free(op);
+    Py_DECREF(tp);
+}
+
+static PyGetSetDef ReadyQueue_getsetlist[] = {
+    {"waiting", ReadyQueue_get_waiting, NULL,
+     PyDoc_STR("Number of workers blocked in wait().")},
+    {"workers", ReadyQueue_get_workers, NULL,
+     PyDoc_STR("Number of worker threads the queue is split between.")},
+    {NULL} /* Sentinel */
+};
+
+static PyMethodDef ReadyQueue_methods[] = {
+    _ASYNCIO_READYQUEUE_APPEND_METHODDEF
+    _ASYNCIO_READYQUEUE_POPLEFT_METHODDEF
+    _ASYNCIO_READYQUEUE_CLEAR_METHODDEF
+    _ASYNCIO_READYQUEUE_RUN_METHODDEF
+    _ASYNCIO_READYQUEUE_WAIT_METHODDEF
+    _ASYNCIO_READYQUEUE_WAKEUP_METHODDEF
+    {NULL, NULL}        /* Sentinel */
+};
+
+static PyType_Slot ReadyQueue_slots[] = {
+    {Py_tp_dealloc, ReadyQueue_dealloc},
+    {Py_tp_doc, (void *)_asyncio_ReadyQueue__doc__},
+    {Py_tp_traverse, ReadyQueue_traverse},
+    {Py_tp_clear, ReadyQueue_clear},
+    {Py_tp_iter, ReadyQueue_iter},
+    {Py_tp_methods, ReadyQueue_methods},
+    {Py_tp_getset, ReadyQueue_getsetlist},
+    {Py_tp_new, _asyncio_ReadyQueue},
+    {Py_sq_length, ReadyQueue_len},
+    {0, NULL},
+};
+
+static PyType_Spec ReadyQueue_spec = {
+    .name = "_asyncio.ReadyQueue",
+    .basicsize = sizeof(ReadyQueueObj),
+    .flags = (Py_TPFLAGS_DEFAULT | Py_TPFLAGS_HAVE_GC |
+              Py_TPFLAGS_IMMUTABLETYPE),
+    .slots = ReadyQueue_slots,
+};
+
+
 /*********************** Functions **************************/
 
 
@@ -4064,7 +5004,13 @@ _asyncio_all_tasks_impl(PyObject *module, PyObject *loop)
     }
 
     _PyThreadStateImpl *ts = (_PyThreadStateImpl *)_PyThreadState_GET();
-    if (ts->asyncio_running_loop == loop) {
+    int multithreaded = loop_is_multithreaded(state, loop);
+    if (multithreaded < 0) {
+        Py_DECREF(tasks);
+        Py_DECREF(loop);
+        return NULL;
+    }
+    if (ts->asyncio_running_loop == loop && !multithreaded) {
         // Fast path for the current running loop of current thread
         // no locking or stop the world pause is required
         struct llist_node *head = &ts->asyncio_tasks_head;
@@ -4182,6 +5128,37 @@ _asyncio_future_discard_from_awaited_by_impl(PyObject *module, PyObject *fut,
     Py_RETURN_NONE;
 }
 
+/*[clinic input]
+_asyncio._set_base_event_loop
+
+    cls: object
+    /
+
+Record the asyncio.BaseEventLoop class.
+
+Futures and Tasks put their callbacks straight into the ReadyQueue of
+loops that use the call_soon() implementation of this class.
+[clinic start generated code]*/
+
+static PyObject *
+_asyncio__set_base_event_loop(PyObject *module, PyObject *cls)
+/*[clinic end generated code: output=1688c8bd91afc726 input=f90a01874d6e42ad]*/
+{
+    asyncio_state *state = get_asyncio_state(module);
+    PyObject *call_soon = PyObject_GetAttr(cls, &_Py_ID(call_soon));
+    if (call_soon == NULL) {
+        return NULL;
+    }
+    PyObject *call_soon_impl = PyObject_GetAttr(cls, &_Py_ID(_call_soon));
+    if (call_soon_impl == NULL) {
+        Py_DECREF(call_soon);
+        return NULL;
+    }
+    Py_XSETREF(state->base_loop_call_soon, call_soon);
+    Py_XSETREF(state->base_loop__call_soon, call_soon_impl);
+    Py_RETURN_NONE;
+}
+
 static int
 module_traverse(PyObject *mod, visitproc visit, void *arg)
 {
@@ -4191,11 +5168,16 @@ module_traverse(PyObject *mod, visitproc visit, void *arg)
     Py_VISIT(state->TaskStepMethWrapper_Type);
     Py_VISIT(state->FutureType);
     Py_VISIT(state->TaskType);
+    Py_VISIT(state->ReadyQueueType);
 
     Py_VISIT(state->asyncio_mod);
     Py_VISIT(state->traceback_extract_stack);
     Py_VISIT(state->asyncio_future_repr_func);
     Py_VISIT(state->asyncio_get_event_loop_policy);
+    Py_VISIT(state->asyncio_Handle);
+    Py_VISIT(state->asyncio_format_callback_source);
+    Py_VISIT(state->base_loop_call_soon);
+    Py_VISIT(state->base_loop__call_soon);
     Py_VISIT(state->asyncio_iscoroutine_func);
     Py_VISIT(state->asyncio_task_get_stack_func);
     Py_VISIT(state->asyncio_task_print_stack_func);
@@ -4221,11 +5203,16 @@ module_clear(PyObject *mod)
     Py_CLEAR(state->TaskStepMethWrapper_Type);
     Py_CLEAR(state->FutureType);
     Py_CLEAR(state->TaskType);
+    Py_CLEAR(state->ReadyQueueType);
 
     Py_CLEAR(state->asyncio_mod);
     Py_CLEAR(state->traceback_extract_stack);
     Py_CLEAR(state->asyncio_future_repr_func);
     Py_CLEAR(state->asyncio_get_event_loop_policy);
+    Py_CLEAR(state->asyncio_Handle);
+    Py_CLEAR(state->asyncio_format_callback_source);
+    Py_CLEAR(state->base_loop_call_soon);
+    Py_CLEAR(state->base_loop__call_soon);
     Py_CLEAR(state->asyncio_iscoroutine_func);
     Py_CLEAR(state->asyncio_task_get_stack_func);
     Py_CLEAR(state->asyncio_task_print_stack_func);
@@ -4289,6 +5276,10 @@ module_init(asyncio_state *state)
 
     WITH_MOD("asyncio.events")
     GET_MOD_ATTR(state->asyncio_get_event_loop_policy, "_get_event_loop_policy")
+    GET_MOD_ATTR(state->asyncio_Handle, "Handle")
+
+    WITH_MOD("asyncio.format_helpers")
+    GET_MOD_ATTR(state->asyncio_format_callback_source, "_format_callback_source")
 
     WITH_MOD("asyncio.base_futures")
     GET_MOD_ATTR(state->asyncio_future_repr_func, "_future_repr")
@@ -4353,6 +5344,7 @@ static PyMethodDef asyncio_methods[] = {
     _ASYNCIO_ALL_TASKS_METHODDEF
     _ASYNCIO_FUTURE_ADD_TO_AWAITED_BY_METHODDEF
     _ASYNCIO_FUTURE_DISCARD_FROM_AWAITED_BY_METHODDEF
+    _ASYNCIO__SET_BASE_EVENT_LOOP_METHODDEF
     {NULL, NULL}
 };
 
@@ -4375,6 +5367,7 @@ module_exec(PyObject *mod)
     CREATE_TYPE(mod, state->FutureIterType, &FutureIter_spec, NULL);
     CREATE_TYPE(mod, state->FutureType, &Future_spec, NULL);
     CREATE_TYPE(mod, state->TaskType, &Task_spec, state->FutureType);
+    CREATE_TYPE(mod, state->ReadyQueueType, &ReadyQueue_spec, NULL);
 
 #undef CREATE_TYPE
 
@@ -4385,6 +5378,10 @@ module_exec(PyObject *mod)
     if (PyModule_AddType(mod, state->TaskType) < 0) {
         return -1;
     }
+
+    if (PyModule_AddType(mod, state->ReadyQueueType) < 0) {
+        return -1;
+    }
     // Must be done after types are added to avoid a circular dependency
     if (module_init(state) < 0) {
         return -1;
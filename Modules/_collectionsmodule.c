@@ -4,6 +4,7 @@
 #include "pycore_long.h"          // _PyLong_GetZero()
 #include "pycore_moduleobject.h"  // _PyModule_GetState()
 #include "pycore_pyatomic_ft_wrappers.h"
+#include "pycore_pyerrors.h"       // _PyErr_SetKeyError()
 #include "pycore_typeobject.h"    // _PyType_GetModuleState()
 #include "pycore_weakref.h"       // FT_CLEAR_WEAKREFS()
 
@@ -15,6 +16,7 @@ typedef struct {
     PyTypeObject *dequeiter_type;
     PyTypeObject *dequereviter_type;
     PyTypeObject *tuplegetter_type;
+    PyTypeObject *concurrentdict_type;
 } collections_state;
 
 static inline collections_state *
@@ -2505,6 +2507,666 @@ static PyType_Spec defdict_spec = {
     .slots = defdict_slots,
 };
 
+/* ConcurrentDict type ******************************************************/
+
+/* A mapping split over several ordinary dicts ("shards") by key hash.
+ * Each shard is guarded by its own per-object lock, so in the
+ * free-threaded build writers to keys in different shards do not
+ * serialize on a single lock, and lookups are lock-free as for dict.
+ * The shard array is fixed at construction and never replaced, so it
+ * can be read without holding any lock.
+ */
+
+#define CONCURRENTDICT_DEFAULT_SHARDS 16
+#define CONCURRENTDICT_MAX_SHARDS 1024
+
+typedef struct {
+    PyObject_HEAD
+    Py_ssize_t nshards;
+    PyObject **shards;
+} concurrentdictobject;
+
+#define concurrentdictobject_CAST(op)  ((concurrentdictobject *)(op))
+
+static PyType_Spec concurrentdict_spec;
+
+static inline PyObject *
+concurrentdict_get_shard(concurrentdictobject *cd, Py_hash_t hash)
+{
+    /* The dicts index with the low bits of the hash, so mix in the high
+       ones: otherwise all keys of a shard could share their low bits. */
+    uint64_t h = (uint64_t)(Py_uhash_t)hash * UINT64_C(0x9E3779B97F4A7C15);
+    return cd->shards[(Py_ssize_t)((h >> 32) % (uint64_t)cd->nshards)];
+}
+
+static int
+concurrentdict_lookup(concurrentdictobject *cd, PyObject *key,
+                      PyObject **result)
+{
+    Py_hash_t hash = PyObject_Hash(key);
+    if (hash == -1) {
+        *result = NULL;
+        return -1;
+    }
+    PyObject *shard = concurrentdict_get_shard(cd, hash);
+    return _PyDict_GetItemRef_KnownHash((PyDictObject *)shard, key, hash,
+                                        result);
+}
+
+/* Insert the items of a private dict, reusing the hashes it stores. */
+static int
+concurrentdict_merge_dict(concurrentdictobject *cd, PyObject *dict)
+{
+    Py_ssize_t pos = 0;
+    PyObject *key, *value;
+    Py_hash_t hash;
+    while (_PyDict_Next(dict, &pos, &key, &value, &hash)) {
+        PyObject *shard = concurrentdict_get_shard(cd, hash);
+        if (_PyDict_SetItem_KnownHash(shard, key, value, hash) < 0) {
+            return -1;
+        }
+    }
+    return 0;
+}
+
+/* Add the items of a mapping or of an iterable of pairs, and keyword
+   arguments, with the semantics of dict.update(). */
+static int
+concurrentdict_update_common(concurrentdictobject *cd, PyObject *arg,
+                             PyObject *kwds)
+{
+    PyObject *tmp = PyDict_New();
+    if (tmp == NULL) {
+        return -1;
+    }
+    if (arg != NULL) {
+        int has_keys = PyObject_HasAttrWithError(arg, &_Py_ID(keys));
+        if (has_keys < 0) {
+            goto error;
+        }
+        if (has_keys) {
+            if (PyDict_Merge(tmp, arg, 1) < 0) {
+                goto error;
+            }
+        }
+        else if (PyDict_MergeFromSeq2(tmp, arg, 1) < 0) {
+            goto error;
+        }
+    }
+    if (kwds != NULL && PyDict_Merge(tmp, kwds, 1) < 0) {
+        goto error;
+    }
+    if (concurrentdict_merge_dict(cd, tmp) < 0) {
+        goto error;
+    }
+    Py_DECREF(tmp);
+    return 0;
+
+error:
+    Py_DECREF(tmp);
+    return -1;
+}
+
+/* Return a new dict holding the current items.  Each shard is copied
+   atomically, but the result is not a snapshot of the whole mapping
+   when other threads modify it concurrently. */
+static PyObject *
+concurrentdict_to_dict(concurrentdictobject *cd)
+{
+    PyObject *dict = PyDict_New();
+    if (dict == NULL) {
+        return NULL;
+    }
+    for (Py_ssize_t i = 0; i < cd->nshards; i++) {
+        if (PyDict_Update(dict, cd->shards[i]) < 0) {
+            Py_DECREF(dict);
+            return NULL;
+        }
+    }
+    return dict;
+}
+
+typedef PyObject *(*concurrentdict_listfunc)(PyObject *);
+
+static PyObject *
+concurrentdict_to_list(concurrentdictobject *cd, concurrentdict_listfunc func)
+{
+    PyObject *list = PyList_New(0);
+    if (list == NULL) {
+        return NULL;
+    }
+    for (Py_ssize_t i = 0; i < cd->nshards; i++) {
+        PyObject *part = func(cd->shards[i]);
+        if (part == NULL) {
+            Py_DECREF(list);
+            return NULL;
+        }
+        int res = PyList_Extend(list, part);
+        Py_DECREF(part);
+        if (res < 0) {
+            Py_DECREF(list);
+            return NULL;
+        }
+    }
+    return list;
+}
+
+static PyObject *
+concurrentdict_new(PyTypeObject *type, PyObject *args, PyObject *kwds)
+{
+    static char *kwlist[] = {"", "shards", NULL};
+    PyObject *iterable = NULL;
+    PyObject *shardsobj = Py_None;
+    Py_ssize_t nshards = CONCURRENTDICT_DEFAULT_SHARDS;
+
+    if (!PyArg_ParseTupleAndKeywords(args, kwds, "|O$O:ConcurrentDict",
+                                     kwlist, &iterable, &shardsobj)) {
+        return NULL;
+    }
+    if (shardsobj != Py_None) {
+        nshards = PyNumber_AsSsize_t(shardsobj, PyExc_OverflowError);
+        if (nshards == -1 && PyErr_Occurred()) {
+            return NULL;
+        }
+        if (nshards < 1 || nshards > CONCURRENTDICT_MAX_SHARDS) {
+            PyErr_Format(PyExc_ValueError,
+                         "shards must be between 1 and %d",
+                         CONCURRENTDICT_MAX_SHARDS);
+            return NULL;
+        }
+    }
+
+    concurrentdictobject *cd = (concurrentdictobject *)type->tp_alloc(type, 0);
+    if (cd == NULL) {
+        return NULL;
+    }
+    cd->shards = PyMem_Calloc(nshards, sizeof(PyObject *));
+    if (cd->shards == NULL) {
+        Py_DECREF(cd);
+        return PyErr_NoMemory();
+    }
+    cd->nshards = nshards;
+    for (Py_ssize_t i = 0; i < nshards; i++) {
+        cd->shards[i] = PyDict_New();
+        if (cd->shards[i] == NULL) {
+            Py_DECREF(cd);
+            return NULL;
+        }
+    }
+    if (iterable != NULL &&
+        concurrentdict_update_common(cd, iterable, NULL) < 0)
+    {
+        Py_DECREF(cd);
+        return NULL;
+    }
+    return (PyObject *)cd;
+}
+
+static Py_ssize_t
+concurrentdict_length(PyObject *op)
+{
+    concurrentdictobject *cd = concurrentdictobject_CAST(op);
+    Py_ssize_t n = 0;
+    for (Py_ssize_t i = 0; i < cd->nshards; i++) {
+        n += PyDict_GET_SIZE(cd->shards[i]);
+    }
+    return n;
+}
+
+static PyObject *
+concurrentdict_subscript(PyObject *op, PyObject *key)
+{
+    PyObject *value;
+    int res = concurrentdict_lookup(concurrentdictobject_CAST(op), key, &value);
+    if (res == 0) {
+        _PyErr_SetKeyError(key);
+    }
+    return value;
+}
+
+static int
+concurrentdict_ass_subscript(PyObject *op, PyObject *key, PyObject *value)
+{
+    concurrentdictobject *cd = concurrentdictobject_CAST(op);
+    Py_hash_t hash = PyObject_Hash(key);
+    if (hash == -1) {
+        return -1;
+    }
+    PyObject *shard = concurrentdict_get_shard(cd, hash);
+    if (value == NULL) {
+        return _PyDict_DelItem_KnownHash(shard, key, hash);
+    }
+    return _PyDict_SetItem_KnownHash(shard, key, value, hash);
+}
+
+static int
+concurrentdict_contains(PyObject *op, PyObject *key)
+{
+    PyObject *value;
+    int res = concurrentdict_lookup(concurrentdictobject_CAST(op), key, &value);
+    Py_XDECREF(value);
+    return res;
+}
+
+static PyObject *
+concurrentdict_iter(PyObject *op)
+{
+    PyObject *keys = concurrentdict_to_list(concurrentdictobject_CAST(op),
+                                            PyDict_Keys);
+    if (keys == NULL) {
+        return NULL;
+    }
+    PyObject *it = PyObject_GetIter(keys);
+    Py_DECREF(keys);
+    return it;
+}
+
+PyDoc_STRVAR(concurrentdict_get_doc,
+"get($self, key, default=None, /)\n--\n\n\
+Return the value for key if key is in the mapping, else default.");
+
+static PyObject *
+concurrentdict_get(PyObject *op, PyObject *const *args, Py_ssize_t nargs)
+{
+    if (!_PyArg_CheckPositional("get", nargs, 1, 2)) {
+        return NULL;
+    }
+    PyObject *value;
+    int res = concurrentdict_lookup(concurrentdictobject_CAST(op), args[0],
+                                    &value);
+    if (res == 0) {
+        return Py_NewRef(nargs > 1 ? args[1] : Py_None);
+    }
+    return value;
+}
+
+PyDoc_STRVAR(concurrentdict_setdefault_doc,
+"setdefault($self, key, default=None, /)\n--\n\n\
+Insert key with a value of default if key is not in the mapping.\n\
+\n\
+Return the value for key if key is in the mapping, else default.");
+
+static PyObject *
+concurrentdict_setdefault(PyObject *op, PyObject *const *args,
+                          Py_ssize_t nargs)
+{
+    if (!_PyArg_CheckPositional("setdefault", nargs, 1, 2)) {
+        return NULL;
+    }
+    concurrentdictobject *cd = concurrentdictobject_CAST(op);
+    PyObject *key = args[0];
+    PyObject *deflt = nargs > 1 ? args[1] : Py_None;
+    Py_hash_t hash = PyObject_Hash(key);
+    if (hash == -1) {
+        return NULL;
+    }
+    PyDictObject *shard = (PyDictObject *)concurrentdict_get_shard(cd, hash);
+    PyObject *result;
+    Py_BEGIN_CRITICAL_SECTION(shard);
+    int res = _PyDict_GetItemRef_KnownHash_LockHeld(shard, key, hash, &result);
+    if (res == 0) {
+        if (_PyDict_SetItem_KnownHash_LockHeld(shard, key, deflt, hash) == 0) {
+            result = Py_NewRef(deflt);
+        }
+    }
+    Py_END_CRITICAL_SECTION();
+    return result;
+}
+
+PyDoc_STRVAR(concurrentdict_pop_doc,
+"pop($self, key, default=<unrepresentable>, /)\n--\n\n\
+Remove specified key and return the corresponding value.\n\
+\n\
+If the key is not found, return the default if given; otherwise,\n\
+raise a KeyError.");
+
+static PyObject *
+concurrentdict_pop(PyObject *op, PyObject *const *args, Py_ssize_t nargs)
+{
+    if (!_PyArg_CheckPositional("pop", nargs, 1, 2)) {
+        return NULL;
+    }
+    concurrentdictobject *cd = concurrentdictobject_CAST(op);
+    PyObject *key = args[0];
+    Py_hash_t hash = PyObject_Hash(key);
+    if (hash == -1) {
+        return NULL;
+    }
+    PyDictObject *shard = (PyDictObject *)concurrentdict_get_shard(cd, hash);
+    PyObject *result;
+    int res;
+    Py_BEGIN_CRITICAL_SECTION(shard);
+    res = _PyDict_Pop_KnownHash(shard, key, hash, &result);
+    Py_END_CRITICAL_SECTION();
+    if (res == 0) {
+        if (nargs > 1) {
+            return Py_NewRef(args[1]);
+        }
+        _PyErr_SetKeyError(key);
+    }
+    return result;
+}
+
+PyDoc_STRVAR(concurrentdict_popitem_doc,
+"popitem($self, /)\n--\n\n\
+Remove and return some (key, value) pair as a 2-tuple.\n\
+\n\
+Raise KeyError if the mapping is empty.");
+
+static PyObject *
+concurrentdict_popitem(PyObject *op, PyObject *Py_UNUSED(dummy))
+{
+    concurrentdictobject *cd = concurrentdictobject_CAST(op);
+    for (Py_ssize_t i = 0; i < cd->nshards; i++) {
+        PyObject *shard = cd->shards[i];
+        if (PyDict_GET_SIZE(shard) == 0) {
+            continue;
+        }
+        PyObject *item = PyObject_CallMethod(shard, "popitem", NULL);
+        if (item != NULL) {
+            return item;
+        }
+        /* Another thread may have emptied the shard in the meantime. */
+        if (!PyErr_ExceptionMatches(PyExc_KeyError)) {
+            return NULL;
+        }
+        PyErr_Clear();
+    }
+    PyErr_SetString(PyExc_KeyError, "popitem(): mapping is empty");
+    return NULL;
+}
+
+PyDoc_STRVAR(concurrentdict_update_doc,
+"update($self, other=(), /, **kwds)\n--\n\n\
+Update the mapping from a mapping or an iterable of pairs, and kwds.");
+
+static PyObject *
+concurrentdict_update(PyObject *op, PyObject *args, PyObject *kwds)
+{
+    PyObject *arg = NULL;
+    if (!PyArg_UnpackTuple(args, "update", 0, 1, &arg)) {
+        return NULL;
+    }
+    if (concurrentdict_update_common(concurrentdictobject_CAST(op),
+                                     arg, kwds) < 0) {
+        return NULL;
+    }
+    Py_RETURN_NONE;
+}
+
+PyDoc_STRVAR(concurrentdict_clear_doc,
+"clear($self, /)\n--\n\n\
+Remove all items.");
+
+static PyObject *
+concurrentdict_clear(PyObject *op, PyObject *Py_UNUSED(dummy))
+{
+    concurrentdictobject *cd = concurrentdictobject_CAST(op);
+    for (Py_ssize_t i = 0; i < cd->nshards; i++) {
+        PyDict_Clear(cd->shards[i]);
+    }
+    Py_RETURN_NONE;
+}
+
+PyDoc_STRVAR(concurrentdict_copy_doc,
+"copy($self, /)\n--\n\n\
+Return a shallow copy with the same number of shards.");
+
+static PyObject *
+concurrentdict_copy(PyObject *op, PyObject *Py_UNUSED(dummy))
+{
+    concurrentdictobject *cd = concurrentdictobject_CAST(op);
+    PyObject *dict = concurrentdict_to_dict(cd);
+    if (dict == NULL) {
+        return NULL;
+    }
+    PyObject *copy = NULL;
+    PyObject *args = PyTuple_Pack(1, dict);
+    PyObject *kwds = Py_BuildValue("{sn}", "shards", cd->nshards);
+    if (args != NULL && kwds != NULL) {
+        copy = PyObject_Call((PyObject *)Py_TYPE(cd), args, kwds);
+    }
+    Py_XDECREF(kwds);
+    Py_XDECREF(args);
+    Py_DECREF(dict);
+    return copy;
+}
+
+PyDoc_STRVAR(concurrentdict_keys_doc,
+"keys($self, /)\n--\n\n\
+Return a list of the keys.");
+
+static PyObject *
+concurrentdict_keys(PyObject *op, PyObject *Py_UNUSED(dummy))
+{
+    return concurrentdict_to_list(concurrentdictobject_CAST(op), PyDict_Keys);
+}
+
+PyDoc_STRVAR(concurrentdict_values_doc,
+"values($self, /)\n--\n\n\
+Return a list of the values.");
+
+static PyObject *
+concurrentdict_values(PyObject *op, PyObject *Py_UNUSED(dummy))
+{
+    return concurrentdict_to_list(concurrentdictobject_CAST(op),
+                                  PyDict_Values);
+}
+
+PyDoc_STRVAR(concurrentdict_items_doc,
+"items($self, /)\n--\n\n\
+Return a list of the (key, value) pairs.");
+
+static PyObject *
+concurrentdict_items(PyObject *op, PyObject *Py_UNUSED(dummy))
+{
+    return concurrentdict_to_list(concurrentdictobject_CAST(op), PyDict_Items);
+}
+
+static PyObject *
+concurrentdict_reduce(PyObject *op, PyObject *Py_UNUSED(dummy))
+{
+    /* The shard count is keyword-only, so rebuild through
+       copyreg.__newobj_ex__(cls, args, kwargs); the items follow as
+       (key, value) pairs. */
+    concurrentdictobject *cd = concurrentdictobject_CAST(op);
+    PyObject *newobj_ex, *items, *iter, *result;
+
+    newobj_ex = PyImport_ImportModuleAttrString("copyreg", "__newobj_ex__");
+    if (newobj_ex == NULL) {
+        return NULL;
+    }
+    items = concurrentdict_items(op, NULL);
+    if (items == NULL) {
+        Py_DECREF(newobj_ex);
+        return NULL;
+    }
+    iter = PyObject_GetIter(items);
+    Py_DECREF(items);
+    if (iter == NULL) {
+        Py_DECREF(newobj_ex);
+        return NULL;
+    }
+    result = Py_BuildValue("N(O(){sn})OON", newobj_ex, Py_TYPE(cd),
+                           "shards", cd->nshards, Py_None, Py_None, iter);
+    return result;
+}
+
+static PyObject *
+concurrentdict_repr(PyObject *op)
+{
+    concurrentdictobject *cd = concurrentdictobject_CAST(op);
+    int i = Py_ReprEnter(op);
+    if (i != 0) {
+        if (i < 0) {
+            return NULL;
+        }
+        return PyUnicode_FromFormat("%s({...})", _PyType_Name(Py_TYPE(cd)));
+    }
+    PyObject *result = NULL;
+    PyObject *dict = concurrentdict_to_dict(cd);
+    if (dict != NULL) {
+        result = PyUnicode_FromFormat("%s(%R)", _PyType_Name(Py_TYPE(cd)),
+                                      dict);
+        Py_DECREF(dict);
+    }
+    Py_ReprLeave(op);
+    return result;
+}
+
+static PyObject *
+concurrentdict_richcompare(PyObject *v, PyObject *w, int op)
+{
+    if (op != Py_EQ && op != Py_NE) {
+        Py_RETURN_NOTIMPLEMENTED;
+    }
+    collections_state *state = find_module_state_by_def(Py_TYPE(v));
+    PyObject *other;
+    if (PyObject_TypeCheck(w, state->concurrentdict_type)) {
+        other = concurrentdict_to_dict(concurrentdictobject_CAST(w));
+        if (other == NULL) {
+            return NULL;
+        }
+    }
+    else if (PyDict_Check(w)) {
+        other = Py_NewRef(w);
+    }
+    else {
+        Py_RETURN_NOTIMPLEMENTED;
+    }
+    PyObject *dict = concurrentdict_to_dict(concurrentdictobject_CAST(v));
+    if (dict == NULL) {
+        Py_DECREF(other);
+        return NULL;
+    }
+    PyObject *result = PyObject_RichCompare(dict, other, op);
+    Py_DECREF(dict);
+    Py_DECREF(other);
+    return result;
+}
+
+static int
+concurrentdict_traverse(PyObject *op, visitproc visit, void *arg)
+{
+    concurrentdictobject *cd = concurrentdictobject_CAST(op);
+    Py_VISIT(Py_TYPE(cd));
+    if (cd->shards != NULL) {
+        for (Py_ssize_t i = 0; i < cd->nshards; i++) {
+            Py_VISIT(cd->shards[i]);
+        }
+    }
+    return 0;
+}
+
+static int
+concurrentdict_tp_clear(PyObject *op)
+{
+    /* Empty the shards rather than dropping them, so that every other
+       method can rely on the shard array being fully populated. */
+    concurrentdictobject *cd = concurrentdictobject_CAST(op);
+    if (cd->shards != NULL) {
+        for (Py_ssize_t i = 0; i < cd->nshards; i++) {
+            if (cd->shards[i] != NULL) {
+                PyDict_Clear(cd->shards[i]);
+            }
+        }
+    }
+    return 0;
+}
+
+static void
+concurrentdict_dealloc(PyObject *op)
+{
+    concurrentdictobject *cd = concurrentdictobject_CAST(op);
+    PyTypeObject *tp = Py_TYPE(cd);
+    PyObject_GC_UnTrack(cd);
+    if (cd->shards != NULL) {
+        for (Py_ssize_t i = 0; i < cd->nshards; i++) {
+            Py_XDECREF(cd->shards[i]);
+        }
+        PyMem_Free(cd->shards);
+    }
+    tp->tp_free(cd);
+    Py_DECREF(tp);
+}
+
+static PyMethodDef concurrentdict_methods[] = {
+    {"get", _PyCFunction_CAST(concurrentdict_get), METH_FASTCALL,
+     concurrentdict_get_doc},
+    {"setdefault", _PyCFunction_CAST(concurrentdict_setdefault), METH_FASTCALL,
+     concurrentdict_setdefault_doc},
+    {"pop", _PyCFunction_CAST(concurrentdict_pop), METH_FASTCALL,
+     concurrentdict_pop_doc},
+    {"popitem", concurrentdict_popitem, METH_NOARGS,
+     concurrentdict_popitem_doc},
+    {"update", _PyCFunction_CAST(concurrentdict_update),
+     METH_VARARGS | METH_KEYWORDS, concurrentdict_update_doc},
+    {"clear", concurrentdict_clear, METH_NOARGS,
+     concurrentdict_clear_doc},
+    {"copy", concurrentdict_copy, METH_NOARGS,
+     concurrentdict_copy_doc},
+    {"__copy__", concurrentdict_copy, METH_NOARGS,
+     concurrentdict_copy_doc},
+    {"keys", concurrentdict_keys, METH_NOARGS,
+     concurrentdict_keys_doc},
+    {"values", concurrentdict_values, METH_NOARGS,
+     concurrentdict_values_doc},
+    {"items", concurrentdict_items, METH_NOARGS,
+     concurrentdict_items_doc},
+    {"__reduce__", concurrentdict_reduce, METH_NOARGS,
+     reduce_doc},
+    {"__class_getitem__", Py_GenericAlias, METH_O|METH_CLASS,
+     PyDoc_STR("See PEP 585")},
+    {NULL}
+};
+
+static PyMemberDef concurrentdict_members[] = {
+    {"shards", Py_T_PYSSIZET, offsetof(concurrentdictobject, nshards),
+     Py_READONLY, PyDoc_STR("Number of independently locked shards.")},
+    {NULL}
+};
+
+PyDoc_STRVAR(concurrentdict_doc,
+"ConcurrentDict(iterable=(), /, *, shards=None)\n\
+--\n\
+\n\
+Mapping split over several independently locked shards by key hash.\n\
+\n\
+In the free-threaded build, threads that write to keys in different\n\
+shards do not contend on a single lock.  Iteration and the keys(),\n\
+values() and items() methods work on a list copy of each shard.");
+
+static PyType_Slot concurrentdict_slots[] = {
+    {Py_tp_token, Py_TP_USE_SPEC},
+    {Py_tp_dealloc, concurrentdict_dealloc},
+    {Py_tp_repr, concurrentdict_repr},
+    {Py_tp_hash, PyObject_HashNotImplemented},
+    {Py_tp_getattro, PyObject_GenericGetAttr},
+    {Py_tp_doc, (void *)concurrentdict_doc},
+    {Py_tp_traverse, concurrentdict_traverse},
+    {Py_tp_clear, concurrentdict_tp_clear},
+    {Py_tp_richcompare, concurrentdict_richcompare},
+    {Py_tp_iter, concurrentdict_iter},
+    {Py_tp_methods, concurrentdict_methods},
+    {Py_tp_members, concurrentdict_members},
+    {Py_tp_new, concurrentdict_new},
+    {Py_tp_alloc, PyType_GenericAlloc},
+    {Py_tp_free, PyObject_GC_Del},
+    {Py_mp_length, concurrentdict_length},
+    {Py_mp_subscript, concurrentdict_subscript},
+    {Py_mp_ass_subscript, concurrentdict_ass_subscript},
+    {Py_sq_contains, concurrentdict_contains},
+    {0, NULL},
+};
+
+static PyType_Spec concurrentdict_spec = {
+    .name = "collections.ConcurrentDict",
+    .basicsize = sizeof(concurrentdictobject),
+    .flags = (Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE | Py_TPFLAGS_HAVE_GC |
+              Py_TPFLAGS_IMMUTABLETYPE | Py_TPFLAGS_MAPPING),
+    .slots = concurrentdict_slots,
+};
+
 /* helper function for Counter  *********************************************/
 
 /*[clinic input]
@@ -2794,6 +3456,7 @@ collections_traverse(PyObject *mod, visitproc visit, void *arg)
     Py_VISIT(state->dequeiter_type);
     Py_VISIT(state->dequereviter_type);
     Py_VISIT(state->tuplegetter_type);
+    Py_VISIT(state->concurrentdict_type);
     return 0;
 }
 
@@ -2806,6 +3469,7 @@ collections_clear(PyObject *mod)
     Py_CLEAR(state->dequeiter_type);
     Py_CLEAR(state->dequereviter_type);
     Py_CLEAR(state->tuplegetter_type);
+    Py_CLEAR(state->concurrentdict_type);
     return 0;
 }
 
@@ -2819,6 +3483,7 @@ PyDoc_STRVAR(collections_doc,
 "High performance data structures.\n\
 - deque:        ordered collection accessible from endpoints only\n\
 - defaultdict:  dict subclass with a default value factory\n\
+- ConcurrentDict: mapping sharded over independently locked dicts\n\
 ");
 
 static struct PyMethodDef collections_methods[] = {
@@ -2845,6 +3510,7 @@ collections_exec(PyObject *module) {
     ADD_TYPE(module, &dequeiter_spec, state->dequeiter_type, NULL);
     ADD_TYPE(module, &dequereviter_spec, state->dequereviter_type, NULL);
     ADD_TYPE(module, &tuplegetter_spec, state->tuplegetter_type, NULL);
+    ADD_TYPE(module, &concurrentdict_spec, state->concurrentdict_type, NULL);
 
     if (PyModule_AddType(module, &PyODict_Type) < 0) {
         return -1;
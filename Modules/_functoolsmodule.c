@@ -1141,6 +1141,10 @@ _functools_reduce_impl(PyObject *module, PyObject *func, PyObject *seq,
        from being called more than once.  In the C version, the "known hash"
        variants of dictionary calls as used to the same effect.
 
+   5)  The C version can split a bounded cache into shards (see
+       sharded_lru_cache_wrapper() below).  The Python version accepts the
+       *shards* argument but always keeps a single exact LRU list.
+
 */
 
 struct lru_list_elem;
@@ -1151,6 +1155,7 @@ typedef struct lru_list_elem {
     struct lru_list_elem *prev, *next;  /* borrowed links */
     Py_hash_t hash;
     PyObject *key, *result;
+    uint8_t visited;  /* used since the last eviction scan (sharded caches) */
 } lru_list_elem;
 
 #define lru_list_elem_CAST(op)  ((lru_list_elem *)(op))
@@ -1182,6 +1187,17 @@ static PyType_Spec lru_list_elem_type_spec = {
 
 typedef PyObject *(*lru_cache_ternaryfunc)(struct lru_cache_object *, PyObject *, PyObject *);
 
+/* One shard of a sharded cache.  The cache dict doubles as the lock for
+   the shard: the list and the dict are only modified in a critical section
+   on the dict, while lookups read the dict without locking. */
+typedef struct {
+    lru_list_elem root;  /* only the links are used */
+    PyObject *cache;
+    Py_ssize_t maxsize;
+    Py_ssize_t hits;
+    Py_ssize_t misses;
+} lru_shard;
+
 typedef struct lru_cache_object {
     lru_list_elem root;  /* includes PyObject_HEAD */
     lru_cache_ternaryfunc wrapper;
@@ -1197,6 +1213,8 @@ typedef struct lru_cache_object {
     PyObject *cache_info_type;
     PyObject *dict;
     PyObject *weakreflist;
+    Py_ssize_t nshards;
+    lru_shard *shards;  /* NULL unless the cache is sharded */
 } lru_cache_object;
 
 #define lru_cache_object_CAST(op)   ((lru_cache_object *)(op))
@@ -1322,9 +1340,8 @@ lru_cache_extract_link(lru_list_elem *link)
 }
 
 static void
-lru_cache_append_link(lru_cache_object *self, lru_list_elem *link)
+lru_cache_append_link(lru_list_elem *root, lru_list_elem *link)
 {
-    lru_list_elem *root = &self->root;
     lru_list_elem *last = root->prev;
     last->next = root->prev = link;
     link->prev = last;
@@ -1332,9 +1349,8 @@ lru_cache_append_link(lru_cache_object *self, lru_list_elem *link)
 }
 
 static void
-lru_cache_prepend_link(lru_cache_object *self, lru_list_elem *link)
+lru_cache_prepend_link(lru_list_elem *root, lru_list_elem *link)
 {
-    lru_list_elem *root = &self->root;
     lru_list_elem *first = root->next;
     first->prev = root->next = link;
     link->prev = root;
@@ -1391,7 +1407,7 @@ bounded_lru_cache_get_lock_held(lru_cache_object *self, PyObject *args, PyObject
                                                     (PyObject **)&link);
     if (res > 0) {
         lru_cache_extract_link(link);
-        lru_cache_append_link(self, link);
+        lru_cache_append_link(&self->root, link);
         *result = link->result;
         FT_ATOMIC_ADD_SSIZE(self->hits, 1);
         Py_INCREF(link->result);
@@ -1469,7 +1485,7 @@ bounded_lru_cache_update_lock_held(lru_cache_object *self,
             Py_DECREF(link);
             return NULL;
         }
-        lru_cache_append_link(self, link);
+        lru_cache_append_link(&self->root, link);
         return Py_NewRef(result);
     }
     /* Since the cache is full, we need to evict an old key and add
@@ -1502,7 +1518,7 @@ bounded_lru_cache_update_lock_held(lru_cache_object *self,
            original position as the oldest link.  Then we allow the
            error propagate upward; treating it the same as an error
            arising in the user function. */
-        lru_cache_prepend_link(self, link);
+        lru_cache_prepend_link(&self->root, link);
         Py_DECREF(key);
         Py_DECREF(result);
         return NULL;
@@ -1545,7 +1561,7 @@ bounded_lru_cache_update_lock_held(lru_cache_object *self,
         Py_DECREF(oldresult);
         return NULL;
     }
-    lru_cache_append_link(self, link);
+    lru_cache_append_link(&self->root, link);
     Py_INCREF(result); /* for return */
     Py_DECREF(popresult);
     Py_DECREF(oldkey);
@@ -1584,21 +1600,174 @@ bounded_lru_cache_wrapper(lru_cache_object *self, PyObject *args, PyObject *kwds
     return result;
 }
 
+/* Sharded caches.
+
+   A bounded cache serializes every call on its lock, since even a hit
+   moves a link to the end of the list.  In the free-threaded build that
+   keeps a cache used by many threads from scaling.  A sharded cache splits
+   the entries by hash into shards, each with its own dict, list and
+   maxsize, and gives up exact LRU order for the CLOCK approximation:
+
+   - A hit looks the key up without locking and only sets the link's
+     visited flag, unless it is already set.  The links are never reused,
+     so the key and result of a link found this way stay valid.
+
+   - A miss locks the shard to add a new link at the end of the list.  If
+     the shard is full, links at the front of the list which have been
+     visited get their flag cleared and are moved to the end (a second
+     chance), and the first one which hasn't is evicted.
+
+   As in the bounded cache, the list owns one reference to each link and
+   the dict another. */
+
+static lru_shard *
+lru_cache_get_shard(lru_cache_object *self, Py_hash_t hash)
+{
+    /* The dicts index with the low bits of the hash, so mix in the high
+       ones: otherwise all keys of a shard could share their low bits. */
+    uint64_t h = (uint64_t)(Py_uhash_t)hash * UINT64_C(0x9E3779B97F4A7C15);
+    return &self->shards[(Py_ssize_t)((h >> 32) % (uint64_t)self->nshards)];
+}
+
+static int
+sharded_lru_cache_update_lock_held(lru_cache_object *self, lru_shard *shard,
+                                   PyObject *key, Py_hash_t hash,
+                                   PyObject *result, lru_list_elem **evicted)
+{
+    _Py_CRITICAL_SECTION_ASSERT_OBJECT_LOCKED(shard->cache);
+    lru_list_elem *link;
+    PyObject *testresult;
+
+    int res = _PyDict_GetItemRef_KnownHash_LockHeld((PyDictObject *)shard->cache,
+                                                    key, hash, &testresult);
+    if (res != 0) {
+        /* Either another thread or the user function added the same key
+           in the meantime, or the lookup failed. */
+        Py_XDECREF(testresult);
+        return res;
+    }
+
+    if (PyDict_GET_SIZE(shard->cache) >= shard->maxsize &&
+        shard->root.next != &shard->root)
+    {
+        /* Look for a link which hasn't been visited since the last scan,
+           but give up after a full round if hits keep setting the flags. */
+        Py_ssize_t n = PyDict_GET_SIZE(shard->cache);
+        link = shard->root.next;
+        while (n-- > 0 && FT_ATOMIC_LOAD_UINT8_RELAXED(link->visited)) {
+            FT_ATOMIC_STORE_UINT8_RELAXED(link->visited, 0);
+            lru_cache_extract_link(link);
+            lru_cache_append_link(&shard->root, link);
+            link = shard->root.next;
+        }
+        PyObject *popresult;
+        res = _PyDict_Pop_KnownHash((PyDictObject *)shard->cache, link->key,
+                                    link->hash, &popresult);
+        if (res < 0) {
+            return -1;
+        }
+        /* The list's reference to the link is released by the caller,
+           outside of the critical section.  The dict's reference can't
+           be the last one. */
+        lru_cache_extract_link(link);
+        Py_XDECREF(popresult);
+        *evicted = link;
+    }
+
+    link = (lru_list_elem *)PyObject_New(lru_list_elem,
+                                         self->lru_list_elem_type);
+    if (link == NULL) {
+        return -1;
+    }
+    link->hash = hash;
+    link->key = Py_NewRef(key);
+    link->result = Py_NewRef(result);
+    link->visited = 0;
+    if (_PyDict_SetItem_KnownHash_LockHeld((PyDictObject *)shard->cache, key,
+                                           (PyObject *)link, hash) < 0) {
+        Py_DECREF(link);
+        return -1;
+    }
+    lru_cache_append_link(&shard->root, link);
+    return 0;
+}
+
+static PyObject *
+sharded_lru_cache_wrapper(lru_cache_object *self, PyObject *args, PyObject *kwds)
+{
+    lru_list_elem *link, *evicted = NULL;
+    PyObject *result;
+    Py_hash_t hash;
+    int res;
+
+    PyObject *key = lru_cache_make_key(self->kwd_mark, args, kwds, self->typed);
+    if (!key)
+        return NULL;
+    hash = PyObject_Hash(key);
+    if (hash == -1) {
+        Py_DECREF(key);
+        return NULL;
+    }
+    lru_shard *shard = lru_cache_get_shard(self, hash);
+    res = _PyDict_GetItemRef_KnownHash((PyDictObject *)shard->cache, key, hash,
+                                       (PyObject **)&link);
+    if (res > 0) {
+        if (!FT_ATOMIC_LOAD_UINT8_RELAXED(link->visited)) {
+            FT_ATOMIC_STORE_UINT8_RELAXED(link->visited, 1);
+        }
+        result = Py_NewRef(link->result);
+        FT_ATOMIC_ADD_SSIZE(shard->hits, 1);
+        Py_DECREF(link);
+        Py_DECREF(key);
+        return result;
+    }
+    if (res < 0) {
+        Py_DECREF(key);
+        return NULL;
+    }
+    FT_ATOMIC_ADD_SSIZE(shard->misses, 1);
+
+    result = PyObject_Call(self->func, args, kwds);
+    if (!result) {
+        Py_DECREF(key);
+        return NULL;
+    }
+
+    Py_BEGIN_CRITICAL_SECTION(shard->cache);
+    res = sharded_lru_cache_update_lock_held(self, shard, key, hash,
+                                             result, &evicted);
+    Py_END_CRITICAL_SECTION();
+
+    Py_XDECREF(evicted);
+    Py_DECREF(key);
+    if (res < 0) {
+        Py_DECREF(result);
+        return NULL;
+    }
+    return result;
+}
+
 static PyObject *
 lru_cache_new(PyTypeObject *type, PyObject *args, PyObject *kw)
 {
     PyObject *func, *maxsize_O, *cache_info_type, *cachedict;
     int typed;
     lru_cache_object *obj;
-    Py_ssize_t maxsize;
+    Py_ssize_t maxsize, nshards = 1;
+    lru_shard *shards = NULL;
     PyObject *(*wrapper)(lru_cache_object *, PyObject *, PyObject *);
     _functools_state *state;
     static char *keywords[] = {"user_function", "maxsize", "typed",
-                               "cache_info_type", NULL};
+                               "cache_info_type", "shards", NULL};
 
-    if (!PyArg_ParseTupleAndKeywords(args, kw, "OOpO:lru_cache", keywords,
+    if (!PyArg_ParseTupleAndKeywords(args, kw, "OOpO|n:lru_cache", keywords,
                                      &func, &maxsize_O, &typed,
-                                     &cache_info_type)) {
+                                     &cache_info_type, &nshards)) {
+        return NULL;
+    }
+
+    if (nshards < 1) {
+        PyErr_SetString(PyExc_ValueError, "shards must be positive");
         return NULL;
     }
 
@@ -1627,20 +1796,49 @@ lru_cache_new(PyTypeObject *type, PyObject *args, PyObject *kw)
         }
         if (maxsize == 0)
             wrapper = uncached_lru_cache_wrapper;
-        else
+        else if (nshards == 1 || maxsize == 1)
             wrapper = bounded_lru_cache_wrapper;
+        else
+            wrapper = sharded_lru_cache_wrapper;
     } else {
         PyErr_SetString(PyExc_TypeError, "maxsize should be integer or None");
         return NULL;
     }
 
+    if (wrapper == sharded_lru_cache_wrapper) {
+        /* split maxsize as evenly as possible, with at least one entry
+           per shard */
+        nshards = Py_MIN(nshards, maxsize);
+        shards = PyMem_New(lru_shard, nshards);
+        if (shards == NULL) {
+            return PyErr_NoMemory();
+        }
+        for (Py_ssize_t i = 0; i < nshards; i++) {
+            lru_shard *shard = &shards[i];
+            shard->root.prev = shard->root.next = &shard->root;
+            shard->maxsize = maxsize / nshards + (i < maxsize % nshards);
+            shard->hits = shard->misses = 0;
+            shard->cache = PyDict_New();
+            if (shard->cache == NULL) {
+                while (i-- > 0) {
+                    Py_DECREF(shards[i].cache);
+                }
+                PyMem_Free(shards);
+                return NULL;
+            }
+        }
+    }
+    else {
+        nshards = 1;
+    }
+
     if (!(cachedict = PyDict_New()))
-        return NULL;
+        goto error;
 
     obj = (lru_cache_object *)type->tp_alloc(type, 0);
     if (obj == NULL) {
         Py_DECREF(cachedict);
-        return NULL;
+        goto error;
     }
 
     obj->root.prev = &obj->root;
@@ -1656,13 +1854,23 @@ lru_cache_new(PyTypeObject *type, PyObject *args, PyObject *kw)
     obj->cache_info_type = Py_NewRef(cache_info_type);
     obj->dict = NULL;
     obj->weakreflist = NULL;
+    obj->nshards = nshards;
+    obj->shards = shards;
     return (PyObject *)obj;
+
+error:
+    if (shards != NULL) {
+        for (Py_ssize_t i = 0; i < nshards; i++) {
+            Py_DECREF(shards[i].cache);
+        }
+        PyMem_Free(shards);
+    }
+    return NULL;
 }
 
 static lru_list_elem *
-lru_cache_unlink_list(lru_cache_object *self)
+lru_cache_unlink_list(lru_list_elem *root)
 {
-    lru_list_elem *root = &self->root;
     lru_list_elem *link = root->next;
     if (link == root)
         return NULL;
@@ -1684,7 +1892,15 @@ static int
 lru_cache_tp_clear(PyObject *op)
 {
     lru_cache_object *self = lru_cache_object_CAST(op);
-    lru_list_elem *list = lru_cache_unlink_list(self);
+    lru_list_elem *list = lru_cache_unlink_list(&self->root);
+    if (self->shards != NULL) {
+        for (Py_ssize_t i = 0; i < self->nshards; i++) {
+            lru_shard *shard = &self->shards[i];
+            lru_list_elem *shard_list = lru_cache_unlink_list(&shard->root);
+            Py_CLEAR(shard->cache);
+            lru_cache_clear_list(shard_list);
+        }
+    }
     Py_CLEAR(self->cache);
     Py_CLEAR(self->func);
     Py_CLEAR(self->kwd_mark);
@@ -1705,6 +1921,7 @@ lru_cache_dealloc(PyObject *op)
     FT_CLEAR_WEAKREFS(op, obj->weakreflist);
 
     (void)lru_cache_tp_clear(op);
+    PyMem_Free(obj->shards);
     tp->tp_free(obj);
     Py_DECREF(tp);
 }
@@ -1739,6 +1956,17 @@ _functools__lru_cache_wrapper_cache_info_impl(PyObject *self)
 /*[clinic end generated code: output=cc796a0b06dbd717 input=00e1acb31aa21ecc]*/
 {
     lru_cache_object *_self = (lru_cache_object *) self;
+    if (_self->shards != NULL) {
+        Py_ssize_t hits = 0, misses = 0, currsize = 0;
+        for (Py_ssize_t i = 0; i < _self->nshards; i++) {
+            lru_shard *shard = &_self->shards[i];
+            hits += FT_ATOMIC_LOAD_SSIZE_RELAXED(shard->hits);
+            misses += FT_ATOMIC_LOAD_SSIZE_RELAXED(shard->misses);
+            currsize += PyDict_GET_SIZE(shard->cache);
+        }
+        return PyObject_CallFunction(_self->cache_info_type, "nnnn",
+                                     hits, misses, _self->maxsize, currsize);
+    }
     if (_self->maxsize == -1) {
         return PyObject_CallFunction(_self->cache_info_type, "nnOn",
                                      FT_ATOMIC_LOAD_SSIZE_RELAXED(_self->hits),
@@ -1765,7 +1993,21 @@ _functools__lru_cache_wrapper_cache_clear_impl(PyObject *self)
 /*[clinic end generated code: output=58423b35efc3e381 input=dfa33acbecf8b4b2]*/
 {
     lru_cache_object *_self = (lru_cache_object *) self;
-    lru_list_elem *list = lru_cache_unlink_list(_self);
+    if (_self->shards != NULL) {
+        for (Py_ssize_t i = 0; i < _self->nshards; i++) {
+            lru_shard *shard = &_self->shards[i];
+            lru_list_elem *list;
+            Py_BEGIN_CRITICAL_SECTION(shard->cache);
+            list = lru_cache_unlink_list(&shard->root);
+            FT_ATOMIC_STORE_SSIZE_RELAXED(shard->hits, 0);
+            FT_ATOMIC_STORE_SSIZE_RELAXED(shard->misses, 0);
+            _PyDict_Clear_LockHeld(shard->cache);
+            Py_END_CRITICAL_SECTION();
+            lru_cache_clear_list(list);
+        }
+        Py_RETURN_NONE;
+    }
+    lru_list_elem *list = lru_cache_unlink_list(&_self->root);
     FT_ATOMIC_STORE_SSIZE_RELAXED(_self->hits, 0);
     FT_ATOMIC_STORE_SSIZE_RELAXED(_self->misses, 0);
     if (_self->wrapper == bounded_lru_cache_wrapper) {
@@ -1810,6 +2052,20 @@ lru_cache_tp_traverse(PyObject *op, visitproc visit, void *arg)
         Py_VISIT(Py_TYPE(link));
         link = next;
     }
+    if (self->shards != NULL) {
+        for (Py_ssize_t i = 0; i < self->nshards; i++) {
+            lru_shard *shard = &self->shards[i];
+            link = shard->root.next;
+            while (link != &shard->root) {
+                lru_list_elem *next = link->next;
+                Py_VISIT(link->key);
+                Py_VISIT(link->result);
+                Py_VISIT(Py_TYPE(link));
+                link = next;
+            }
+            Py_VISIT(shard->cache);
+        }
+    }
     Py_VISIT(self->cache);
     Py_VISIT(self->func);
     Py_VISIT(self->kwd_mark);
@@ -1833,7 +2089,11 @@ typed:    False     cache f(3) and f(3.0) as identical calls\n\
           True      cache f(3) and f(3.0) as distinct calls\n\
 \n\
 cache_info_type:    namedtuple class with the fields:\n\
-                        hits misses currsize maxsize\n"
+                        hits misses currsize maxsize\n\
+\n\
+shards:   1         for an exact LRU cache\n\
+          n         split a bounded cache into n parts with their own\n\
+                    locks and approximate LRU eviction\n"
 );
 
 static PyMethodDef lru_cache_methods[] = {
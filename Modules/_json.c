@@ -17,6 +17,15 @@
 #include "pycore_unicodeobject.h" // _PyUnicode_CheckConsistency()
 
 #include <stdbool.h>              // bool
+#include <string.h>               // memcpy()
+
+#if defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64)
+#  include <emmintrin.h>
+#  define JSON_USE_SSE2
+#elif defined(__aarch64__) && defined(__ARM_NEON)
+#  include <arm_neon.h>
+#  define JSON_USE_NEON
+#endif
 
 #include "clinic/_json.c.h"
 
@@ -116,9 +125,182 @@ encoder_write_string(PyEncoderObject *s, PyUnicodeWriter *writer, PyObject *obj)
 static PyObject *
 encoder_encode_float(PyEncoderObject *s, PyObject *obj);
 
-#define S_CHAR(c) (c >= ' ' && c <= '~' && c != '\\' && c != '"')
 #define IS_WHITESPACE(c) (((c) == ' ') || ((c) == '\t') || ((c) == '\n') || ((c) == '\r'))
 
+/* A "plain" character needs no escaping: it is not '"', '\\' or a control
+   character and, if ascii_only is set, it is not above '~'. */
+#define IS_PLAIN(c, ascii_only) \
+    ((c) >= ' ' && (c) != '"' && (c) != '\\' && (!(ascii_only) || (c) <= '~'))
+
+#if !defined(JSON_USE_SSE2) && !defined(JSON_USE_NEON)
+#  define ONES ((size_t)-1 / 0xFF)
+#  define HIGHS (ONES * 0x80)
+/* Non-zero if any byte of x is zero (resp. less than n, for n <= 0x80). */
+#  define HAS_ZERO_BYTE(x) (((x) - ONES) & ~(x) & HIGHS)
+#  define HAS_BYTE_LESS(x, n) (((x) - ONES * (n)) & ~(x) & HIGHS)
+#endif
+
+/* Return the index of the first character of buf[start:len] that is not
+   plain, or len if there is none.  Long runs of plain characters are
+   skipped a vector (or a machine word) at a time; the exact position is
+   then found by the scalar loop at the end. */
+static inline Py_ssize_t
+skip_plain_chars(int kind, const void *buf, Py_ssize_t start, Py_ssize_t len,
+                 int ascii_only)
+{
+    Py_ssize_t i = start;
+    if (kind == PyUnicode_1BYTE_KIND) {
+        const Py_UCS1 *p = (const Py_UCS1 *)buf;
+        if (i < len && !IS_PLAIN(p[i], ascii_only)) {
+            /* Don't bother with vectors between adjacent escapes. */
+            return i;
+        }
+#if defined(JSON_USE_SSE2)
+        const __m128i quote = _mm_set1_epi8('"');
+        const __m128i bslash = _mm_set1_epi8('\\');
+        const __m128i ctrl = _mm_set1_epi8(0x1f);
+        const __m128i del = _mm_set1_epi8(0x7f);
+        for (; i + 16 <= len; i += 16) {
+            __m128i v = _mm_loadu_si128((const __m128i *)(p + i));
+            __m128i m = _mm_or_si128(_mm_cmpeq_epi8(v, quote),
+                                     _mm_cmpeq_epi8(v, bslash));
+            /* Unsigned v <= 0x1f and v >= 0x7f */
+            m = _mm_or_si128(m, _mm_cmpeq_epi8(_mm_min_epu8(v, ctrl), v));
+            if (ascii_only) {
+                m = _mm_or_si128(m, _mm_cmpeq_epi8(_mm_max_epu8(v, del), v));
+            }
+            if (_mm_movemask_epi8(m)) {
+                break;
+            }
+        }
+#elif defined(JSON_USE_NEON)
+        const uint8x16_t quote = vdupq_n_u8('"');
+        const uint8x16_t bslash = vdupq_n_u8('\\');
+        for (; i + 16 <= len; i += 16) {
+            uint8x16_t v = vld1q_u8(p + i);
+            uint8x16_t m = vorrq_u8(vceqq_u8(v, quote), vceqq_u8(v, bslash));
+            m = vorrq_u8(m, vcltq_u8(v, vdupq_n_u8(' ')));
+            if (ascii_only) {
+                m = vorrq_u8(m, vcgtq_u8(v, vdupq_n_u8('~')));
+            }
+            if (vmaxvq_u8(m)) {
+                break;
+            }
+        }
+#else
+        for (; i + (Py_ssize_t)SIZEOF_SIZE_T <= len; i += SIZEOF_SIZE_T) {
+            size_t x;
+            memcpy(&x, p + i, sizeof(x));
+            if (HAS_ZERO_BYTE(x ^ (ONES * '"')) ||
+                HAS_ZERO_BYTE(x ^ (ONES * '\\')) ||
+                HAS_BYTE_LESS(x, ' ') ||
+                (ascii_only && ((x & HIGHS) || HAS_ZERO_BYTE(x ^ (ONES * 0x7f)))))
+            {
+                break;
+            }
+        }
+#endif
+        for (; i < len; i++) {
+            if (!IS_PLAIN(p[i], ascii_only)) {
+                break;
+            }
+        }
+    }
+    else if (kind == PyUnicode_2BYTE_KIND) {
+        const Py_UCS2 *p = (const Py_UCS2 *)buf;
+        if (i < len && !IS_PLAIN(p[i], ascii_only)) {
+            return i;
+        }
+#if defined(JSON_USE_SSE2)
+        const __m128i quote = _mm_set1_epi16('"');
+        const __m128i bslash = _mm_set1_epi16('\\');
+        const __m128i ctrl = _mm_set1_epi16(0x1f);
+        const __m128i tilde = _mm_set1_epi16('~');
+        const __m128i zero = _mm_setzero_si128();
+        for (; i + 8 <= len; i += 8) {
+            __m128i v = _mm_loadu_si128((const __m128i *)(p + i));
+            __m128i m = _mm_or_si128(_mm_cmpeq_epi16(v, quote),
+                                     _mm_cmpeq_epi16(v, bslash));
+            /* SSE2 has no unsigned 16-bit compare: v <= n iff v -sat n == 0 */
+            m = _mm_or_si128(m, _mm_cmpeq_epi16(_mm_subs_epu16(v, ctrl), zero));
+            if (_mm_movemask_epi8(m)) {
+                break;
+            }
+            if (ascii_only && _mm_movemask_epi8(
+                    _mm_cmpeq_epi16(_mm_subs_epu16(v, tilde), zero)) != 0xFFFF)
+            {
+                break;
+            }
+        }
+#elif defined(JSON_USE_NEON)
+        const uint16x8_t quote = vdupq_n_u16('"');
+        const uint16x8_t bslash = vdupq_n_u16('\\');
+        for (; i + 8 <= len; i += 8) {
+            uint16x8_t v = vld1q_u16(p + i);
+            uint16x8_t m = vorrq_u16(vceqq_u16(v, quote), vceqq_u16(v, bslash));
+            m = vorrq_u16(m, vcltq_u16(v, vdupq_n_u16(' ')));
+            if (ascii_only) {
+                m = vorrq_u16(m, vcgtq_u16(v, vdupq_n_u16('~')));
+            }
+            if (vmaxvq_u16(m)) {
+                break;
+            }
+        }
+#endif
+        for (; i < len; i++) {
+            if (!IS_PLAIN(p[i], ascii_only)) {
+                break;
+            }
+        }
+    }
+    else {
+        assert(kind == PyUnicode_4BYTE_KIND);
+        const Py_UCS4 *p = (const Py_UCS4 *)buf;
+        if (i < len && !IS_PLAIN(p[i], ascii_only)) {
+            return i;
+        }
+#if defined(JSON_USE_SSE2)
+        /* Code points fit in 21 bits, so signed compares are fine. */
+        const __m128i quote = _mm_set1_epi32('"');
+        const __m128i bslash = _mm_set1_epi32('\\');
+        const __m128i space = _mm_set1_epi32(' ');
+        const __m128i tilde = _mm_set1_epi32('~');
+        for (; i + 4 <= len; i += 4) {
+            __m128i v = _mm_loadu_si128((const __m128i *)(p + i));
+            __m128i m = _mm_or_si128(_mm_cmpeq_epi32(v, quote),
+                                     _mm_cmpeq_epi32(v, bslash));
+            m = _mm_or_si128(m, _mm_cmplt_epi32(v, space));
+            if (ascii_only) {
+                m = _mm_or_si128(m, _mm_cmpgt_epi32(v, tilde));
+            }
+            if (_mm_movemask_epi8(m)) {
+                break;
+            }
+        }
+#elif defined(JSON_USE_NEON)
+        const uint32x4_t quote = vdupq_n_u32('"');
+        const uint32x4_t bslash = vdupq_n_u32('\\');
+        for (; i + 4 <= len; i += 4) {
+            uint32x4_t v = vld1q_u32(p + i);
+            uint32x4_t m = vorrq_u32(vceqq_u32(v, quote), vceqq_u32(v, bslash));
+            m = vorrq_u32(m, vcltq_u32(v, vdupq_n_u32(' ')));
+            if (ascii_only) {
+                m = vorrq_u32(m, vcgtq_u32(v, vdupq_n_u32('~')));
+            }
+            if (vmaxvq_u32(m)) {
+                break;
+            }
+        }
+#endif
+        for (; i < len; i++) {
+            if (!IS_PLAIN(p[i], ascii_only)) {
+                break;
+            }
+        }
+    }
+    return i;
+}
+
 static Py_ssize_t
 ascii_escape_unichar(Py_UCS4 c, unsigned char *output, Py_ssize_t chars)
 {
@@ -162,13 +344,15 @@ ascii_escape_size(const void *input, int kind, Py_ssize_t input_chars)
     Py_ssize_t output_size;
 
     /* Compute the output size */
-    for (i = 0, output_size = 2; i < input_chars; i++) {
-        Py_UCS4 c = PyUnicode_READ(kind, input, i);
+    for (i = 0, output_size = 2; i < input_chars;) {
+        Py_ssize_t next = skip_plain_chars(kind, input, i, input_chars, 1);
         Py_ssize_t d;
-        if (S_CHAR(c)) {
-            d = 1;
+        if (next != i) {
+            d = next - i;
+            i = next;
         }
         else {
+            Py_UCS4 c = PyUnicode_READ(kind, input, i++);
             switch(c) {
             case '\\': case '"': case '\b': case '\f':
             case '\n': case '\r': case '\t':
@@ -202,12 +386,20 @@ ascii_escape_unicode_and_size(const void *input, int kind, Py_ssize_t input_char
     output = PyUnicode_1BYTE_DATA(rval);
     chars = 0;
     output[chars++] = '"';
-    for (i = 0; i < input_chars; i++) {
-        Py_UCS4 c = PyUnicode_READ(kind, input, i);
-        if (S_CHAR(c)) {
-            output[chars++] = c;
+    for (i = 0; i < input_chars;) {
+        Py_ssize_t next = skip_plain_chars(kind, input, i, input_chars, 1);
+        if (kind == PyUnicode_1BYTE_KIND) {
+            memcpy(output + chars, (const Py_UCS1 *)input + i, next - i);
+            chars += next - i;
+            i = next;
         }
         else {
+            for (; i < next; i++) {
+                output[chars++] = (Py_UCS1)PyUnicode_READ(kind, input, i);
+            }
+        }
+        if (i < input_chars) {
+            Py_UCS4 c = PyUnicode_READ(kind, input, i++);
             chars = ascii_escape_unichar(c, output, chars);
         }
     }
@@ -276,19 +468,24 @@ escape_size(const void *input, int kind, Py_ssize_t input_chars)
     Py_ssize_t output_size;
 
     /* Compute the output size */
-    for (i = 0, output_size = 2; i < input_chars; i++) {
-        Py_UCS4 c = PyUnicode_READ(kind, input, i);
+    for (i = 0, output_size = 2; i < input_chars;) {
+        Py_ssize_t next = skip_plain_chars(kind, input, i, input_chars, 0);
         Py_ssize_t d;
-        switch (c) {
-        case '\\': case '"': case '\b': case '\f':
-        case '\n': case '\r': case '\t':
-            d = 2;
-            break;
-        default:
-            if (c <= 0x1f)
+        if (next != i) {
+            d = next - i;
+            i = next;
+        }
+        else {
+            Py_UCS4 c = PyUnicode_READ(kind, input, i++);
+            switch (c) {
+            case '\\': case '"': case '\b': case '\f':
+            case '\n': case '\r': case '\t':
+                d = 2;
+                break;
+            default:
+                assert(c <= 0x1f);
                 d = 6;
-            else
-                d = 1;
+            }
         }
         if (output_size > PY_SSIZE_T_MAX - d) {
             PyErr_SetString(PyExc_OverflowError, "string is too long to escape");
@@ -316,8 +513,16 @@ escape_unicode_and_size(const void *input, int kind, Py_UCS4 maxchar, Py_ssize_t
 #define ENCODE_OUTPUT do { \
         chars = 0; \
         output[chars++] = '"'; \
-        for (i = 0; i < input_chars; i++) { \
-            Py_UCS4 c = PyUnicode_READ(kind, input, i); \
+        for (i = 0; i < input_chars;) { \
+            Py_ssize_t next = skip_plain_chars(kind, input, i, input_chars, 0); \
+            memcpy(output + chars, (const char *)input + i * kind, \
+                   (next - i) * kind); \
+            chars += next - i; \
+            i = next; \
+            if (i == input_chars) { \
+                break; \
+            } \
+            Py_UCS4 c = PyUnicode_READ(kind, input, i++); \
             switch (c) { \
             case '\\': output[chars++] = '\\'; output[chars++] = c; break; \
             case '"':  output[chars++] = '\\'; output[chars++] = c; break; \
@@ -503,6 +708,11 @@ scanstring_unicode(PyObject *pystr, Py_ssize_t end, int strict, Py_ssize_t *next
             // Use tight scope variable to help register allocation.
             Py_UCS4 d = 0;
             for (next = end; next < len; next++) {
+                next = skip_plain_chars(kind, buf, next, len, 0);
+                if (next == len) {
+                    d = 0;
+                    break;
+                }
                 d = PyUnicode_READ(kind, buf, next);
                 if (d == '"' || d == '\\') {
                     break;
@@ -672,6 +882,84 @@ py_scanstring_impl(PyObject *module, PyObject *pystr, Py_ssize_t end,
     return _build_rval_index_tuple(rval, next_end);
 }
 
+/*[clinic input]
+_json.find_item_end as py_find_item_end
+    pystr: unicode
+    idx: Py_ssize_t
+    depth: Py_ssize_t
+    in_string: bool
+    /
+
+Find the end of the JSON array item that contains index idx of s.
+
+Scanning starts at idx, which is nested depth levels deep in the item
+and inside a string if in_string is true.  Returns a tuple
+(end, depth, in_string).  If the item is complete, end is the index of
+the ',', ']' or '}' following it and in_string is False.  Otherwise
+end is where the scan should be resumed once more data is available.
+[clinic start generated code]*/
+
+static PyObject *
+py_find_item_end_impl(PyObject *module, PyObject *pystr, Py_ssize_t idx,
+                      Py_ssize_t depth, int in_string)
+/*[clinic end generated code: output=d8d56ad090b71a8c input=27cb3f20d6ab3948]*/
+{
+    Py_ssize_t len = PyUnicode_GET_LENGTH(pystr);
+    const void *buf = PyUnicode_DATA(pystr);
+    int kind = PyUnicode_KIND(pystr);
+
+    if (idx < 0 || idx > len) {
+        PyErr_SetString(PyExc_ValueError, "idx is out of bounds");
+        return NULL;
+    }
+    if (depth < 0) {
+        PyErr_SetString(PyExc_ValueError, "depth must be non-negative");
+        return NULL;
+    }
+    while (idx < len) {
+        Py_UCS4 c;
+        if (in_string) {
+            idx = skip_plain_chars(kind, buf, idx, len, 0);
+            if (idx == len) {
+                break;
+            }
+            c = PyUnicode_READ(kind, buf, idx);
+            if (c == '\\') {
+                if (idx + 1 == len) {
+                    /* Resume at the backslash to see what it escapes. */
+                    break;
+                }
+                idx += 2;
+                continue;
+            }
+            if (c == '"') {
+                in_string = 0;
+            }
+            idx++;
+            continue;
+        }
+        c = PyUnicode_READ(kind, buf, idx);
+        switch (c) {
+            case '"':
+                in_string = 1;
+                break;
+            case '[': case '{':
+                depth++;
+                break;
+            case ']': case '}': case ',':
+                if (depth == 0) {
+                    return Py_BuildValue("(nnO)", idx, (Py_ssize_t)0, Py_False);
+                }
+                if (c != ',') {
+                    depth--;
+                }
+                break;
+        }
+        idx++;
+    }
+    return Py_BuildValue("(nnO)", idx, depth, in_string ? Py_True : Py_False);
+}
+
 /*[clinic input]
 _json.encode_basestring_ascii as py_encode_basestring_ascii
     pystr: unicode
@@ -2064,6 +2352,7 @@ static PyMethodDef speedups_methods[] = {
     PY_ENCODE_BASESTRING_ASCII_METHODDEF
     PY_ENCODE_BASESTRING_METHODDEF
     PY_SCANSTRING_METHODDEF
+    PY_FIND_ITEM_END_METHODDEF
     {NULL, NULL, 0, NULL}
 };
 
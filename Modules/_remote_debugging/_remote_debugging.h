@@ -165,6 +165,9 @@ typedef enum _WIN32_THREADSTATE {
 
 #define MAX_TLBC_SIZE 2048
 
+/* Maximum number of helper threads for batched remote reads */
+#define MAX_READ_WORKERS 32
+
 /* Thread status flags */
 #define THREAD_STATUS_HAS_GIL             (1 << 0)
 #define THREAD_STATUS_ON_CPU              (1 << 1)
@@ -254,10 +257,41 @@ typedef struct {
     PyTypeObject *ThreadInfo_Type;
     PyTypeObject *InterpreterInfo_Type;
     PyTypeObject *AwaitedInfo_Type;
+    PyTypeObject *AllocationSample_Type;
     PyTypeObject *BinaryWriter_Type;
     PyTypeObject *BinaryReader_Type;
 } RemoteDebuggingState;
 
+/* Pool of helper threads for batched remote reads (see read_pool.c) */
+typedef struct ReadWorkerPool ReadWorkerPool;
+
+/* Local copy of a thread state, read together with the thread states of
+ * all other threads in as few system calls as possible.  The current frame
+ * (with frame caching) or the topmost stack chunk (without it) is read in
+ * the same way right after the thread list has been walked.
+ */
+typedef struct {
+    uintptr_t tstate_addr;  // remote address of the thread state
+    char *data;             // thread state followed by its current frame
+    int has_tstate;         // data holds this sample's copy of the thread state
+    int has_frame;          // data also holds the current frame
+    char *chunk;            // copy of the topmost stack chunk (owned), or NULL
+    int has_chunk;          // chunk holds this sample's copy
+} ThreadSnapshot;
+
+#define SNAPSHOT_FRAME(snap) \
+    ((snap)->has_frame ? (snap)->data + SIZEOF_THREAD_STATE : NULL)
+
+typedef struct {
+    ThreadSnapshot *cur;    // threads read in the current sample
+    ThreadSnapshot *prev;   // threads read in the previous sample
+    size_t num_cur;
+    size_t num_prev;
+    size_t capacity;        // capacity of cur, prev and reqs
+    size_t cursor;          // next entry of prev to match with the thread list
+    _Py_RemoteDebug_ReadRequest *reqs;  // scratch space for batched reads
+} ThreadSnapshots;
+
 enum _ThreadState {
     THREAD_STATE_RUNNING,
     THREAD_STATE_IDLE,
@@ -294,9 +328,13 @@ typedef struct {
     int cache_frames;
     int collect_stats;  // whether to collect statistics
     uint32_t stale_invalidation_counter;  // counter for throttling frame_cache_invalidate_stale
+    uint64_t alloc_samples_read;  // index of the next allocation sample to read
     RemoteDebuggingState *cached_state;
     FrameCacheEntry *frame_cache;  // preallocated array of FRAME_CACHE_MAX_THREADS entries
     UnwinderStats stats;  // statistics for performance analysis
+    ThreadSnapshots snapshots;  // thread states read in batches
+    int workers;  // number of helper threads for batched reads
+    ReadWorkerPool *read_pool;  // started on first use if workers > 0
 #ifdef Py_GIL_DISABLED
     uint32_t tlbc_generation;
     _Py_hashtable_t *tlbc_cache;
@@ -358,6 +396,7 @@ typedef struct {
     Py_ssize_t max_addrs;           // Capacity of frame_addrs array
     uintptr_t last_frame_visited;   // Last frame address visited
     int stopped_at_cached_frame;    // Whether we stopped at cached frame
+    const char *frame_copy;         // Local copy of frame_addr, or NULL
 } FrameWalkContext;
 
 /*
@@ -394,6 +433,7 @@ extern PyStructSequence_Desc CoroInfo_desc;
 extern PyStructSequence_Desc ThreadInfo_desc;
 extern PyStructSequence_Desc InterpreterInfo_desc;
 extern PyStructSequence_Desc AwaitedInfo_desc;
+extern PyStructSequence_Desc AllocationSample_desc;
 
 /* ============================================================================
  * UTILITY FUNCTION DECLARATIONS
@@ -492,6 +532,14 @@ extern int parse_frame_object(
     uintptr_t* previous_frame
 );
 
+extern int parse_frame_copy(
+    RemoteUnwinderObject *unwinder,
+    PyObject** result,
+    const char *frame,
+    uintptr_t* address_of_code_object,
+    uintptr_t* previous_frame
+);
+
 extern int parse_frame_from_chunks(
     RemoteUnwinderObject *unwinder,
     PyObject **result,
@@ -504,6 +552,8 @@ extern int parse_frame_from_chunks(
 /* Stack chunk management */
 extern void cleanup_stack_chunks(StackChunkList *chunks);
 extern int copy_stack_chunks(RemoteUnwinderObject *unwinder, uintptr_t tstate_addr, StackChunkList *out_chunks);
+extern int copy_stack_chunks_from(RemoteUnwinderObject *unwinder, uintptr_t chunk_addr,
+                                  char *first_chunk, StackChunkList *out_chunks);
 extern void *find_frame_in_chunks(StackChunkList *chunks, uintptr_t remote_ptr);
 
 extern int process_frame_chain(
@@ -571,9 +621,22 @@ extern PyObject* unwind_stack_for_thread(
     RemoteUnwinderObject *unwinder,
     uintptr_t *current_tstate,
     uintptr_t gil_holder_tstate,
-    uintptr_t gc_frame
+    uintptr_t gc_frame,
+    ThreadSnapshot *snapshot
 );
 
+/* Batched thread state reads */
+extern int thread_snapshots_begin(RemoteUnwinderObject *unwinder);
+extern int thread_snapshots_collect(RemoteUnwinderObject *unwinder, uintptr_t head,
+                                    size_t *first);
+extern void thread_snapshots_clear(ThreadSnapshots *snapshots);
+
+/* Read worker pool */
+extern ReadWorkerPool *read_pool_new(proc_handle_t *handle, int num_workers);
+extern void read_pool_free(ReadWorkerPool *pool);
+extern void read_pool_run(ReadWorkerPool *pool, _Py_RemoteDebug_ReadRequest *reqs,
+                          size_t count);
+
 /* Thread stopping functions (for blocking mode) */
 extern void _Py_RemoteDebug_InitThreadsState(RemoteUnwinderObject *unwinder, _Py_RemoteDebug_ThreadsState *st);
 extern int _Py_RemoteDebug_StopAllThreads(RemoteUnwinderObject *unwinder, _Py_RemoteDebug_ThreadsState *st);
@@ -672,6 +735,21 @@ extern int process_thread_for_async_stack_trace(
     void *context
 );
 
+/* ============================================================================
+ * ALLOCATION SAMPLE FUNCTION DECLARATIONS
+ * ============================================================================ */
+
+/* Return the allocation samples recorded by the remote process since the
+ * previous call, as a new list of AllocationSample, or NULL on error.
+ */
+extern PyObject *read_allocation_samples(RemoteUnwinderObject *unwinder);
+
+/* Read the number of allocation samples recorded so far by the remote
+ * process.  Return -1 with an exception set on error.
+ */
+extern int read_allocation_write_index(RemoteUnwinderObject *unwinder,
+                                       uint64_t *write_index);
+
 /* ============================================================================
  * SUBPROCESS ENUMERATION FUNCTION DECLARATIONS
  * ============================================================================ */
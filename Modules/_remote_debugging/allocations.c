@@ -0,0 +1,329 @@
+/******************************************************************************
+ * Remote Debugging Module - Allocation Samples
+ *
+ * This file contains the functions draining the allocation sampling ring
+ * buffer of the remote process (see Python/alloc_sampling.c).
+ ******************************************************************************/
+
+#include "_remote_debugging.h"
+
+/* Upper bounds used to reject corrupted offsets or state */
+#define ALLOC_SAMPLING_STATE_BUFFER_SIZE 256
+#define ALLOC_SAMPLING_MAX_FRAMES_LIMIT 1024
+/* Number of interpreters whose code object generation is cached per call */
+#define ALLOC_SAMPLING_MAX_INTERPRETERS 8
+
+typedef struct {
+    uintptr_t interp;
+    uint64_t code_object_generation;
+} InterpreterGeneration;
+
+typedef struct {
+    InterpreterGeneration entries[ALLOC_SAMPLING_MAX_INTERPRETERS];
+    int count;
+} InterpreterGenerationCache;
+
+/* ============================================================================
+ * SAMPLE DECODING
+ * ============================================================================ */
+
+static PyObject *
+build_frame_list(RemoteUnwinderObject *unwinder, const char *record)
+{
+    struct _alloc_sampling *offsets = &unwinder->debug_offsets.alloc_sampling;
+    uint32_t nframes = GET_MEMBER(uint32_t, record, offsets->sample_nframes);
+    if (nframes > offsets->max_frames) {
+        PyErr_SetString(PyExc_RuntimeError,
+                        "Invalid frame count (corrupted remote memory)");
+        return NULL;
+    }
+
+    PyObject *frame_info = PyList_New(0);
+    if (frame_info == NULL) {
+        return NULL;
+    }
+
+    const char *frames = record + offsets->sample_frames;
+    for (uint32_t i = 0; i < nframes; i++) {
+        const char *frame = frames + (size_t)i * offsets->frame_size;
+        CodeObjectContext code_ctx = {
+            .code_addr = GET_MEMBER(uintptr_t, frame, offsets->frame_code),
+            .instruction_pointer = GET_MEMBER(uintptr_t, frame,
+                                              offsets->frame_instr_ptr),
+            .tlbc_index = GET_MEMBER(int32_t, frame, offsets->frame_tlbc_index),
+        };
+        PyObject *item = NULL;
+        if (parse_code_object(unwinder, &item, &code_ctx) < 0) {
+            Py_DECREF(frame_info);
+            return NULL;
+        }
+        if (PyList_Append(frame_info, item) < 0) {
+            Py_DECREF(item);
+            Py_DECREF(frame_info);
+            return NULL;
+        }
+        Py_DECREF(item);
+    }
+    return frame_info;
+}
+
+static PyObject *
+build_allocation_sample(RemoteUnwinderObject *unwinder, const char *record)
+{
+    struct _alloc_sampling *offsets = &unwinder->debug_offsets.alloc_sampling;
+
+    PyObject *frame_info = build_frame_list(unwinder, record);
+    if (frame_info == NULL) {
+        return NULL;
+    }
+
+    RemoteDebuggingState *state = RemoteDebugging_GetStateFromObject((PyObject *)unwinder);
+    PyObject *sample = PyStructSequence_New(state->AllocationSample_Type);
+    if (sample == NULL) {
+        Py_DECREF(frame_info);
+        return NULL;
+    }
+
+    PyObject *items[4] = {
+        PyLong_FromUnsignedLongLong(
+            GET_MEMBER(uint64_t, record, offsets->sample_thread_id)),
+        PyLong_FromLongLong(
+            GET_MEMBER(int64_t, record, offsets->sample_interpreter_id)),
+        PyLong_FromUnsignedLongLong(
+            GET_MEMBER(uint64_t, record, offsets->sample_alloc_size)),
+        PyLong_FromUnsignedLongLong(
+            GET_MEMBER(uint64_t, record, offsets->sample_weight)),
+    };
+    for (int i = 0; i < 4; i++) {
+        if (items[i] == NULL) {
+            for (int j = 0; j < 4; j++) {
+                Py_XDECREF(items[j]);
+            }
+            Py_DECREF(frame_info);
+            Py_DECREF(sample);
+            return NULL;
+        }
+    }
+    for (int i = 0; i < 4; i++) {
+        PyStructSequence_SetItem(sample, i, items[i]);  // steals reference
+    }
+    PyStructSequence_SetItem(sample, 4, frame_info);  // steals reference
+    return sample;
+}
+
+/* ============================================================================
+ * RING BUFFER DRAINING
+ * ============================================================================ */
+
+int
+read_allocation_write_index(RemoteUnwinderObject *unwinder, uint64_t *write_index)
+{
+    uintptr_t state_addr = unwinder->runtime_start_address
+                           + unwinder->debug_offsets.runtime_state.alloc_sampling;
+    return _Py_RemoteDebug_ReadRemoteMemory(
+        &unwinder->handle,
+        state_addr + unwinder->debug_offsets.alloc_sampling.write_index,
+        sizeof(uint64_t),
+        write_index);
+}
+
+// Invalidate the code object cache if code objects were freed since the last
+// call: a sampled frame can refer to a code object that no longer exists,
+// and its address may have been reused.
+static int
+refresh_code_object_cache(RemoteUnwinderObject *unwinder)
+{
+    uint64_t code_object_generation;
+    if (_Py_RemoteDebug_ReadRemoteMemory(
+            &unwinder->handle,
+            unwinder->interpreter_addr
+            + unwinder->debug_offsets.interpreter_state.code_object_generation,
+            sizeof(uint64_t),
+            &code_object_generation) < 0) {
+        return -1;
+    }
+    if (code_object_generation != unwinder->code_object_generation) {
+        unwinder->code_object_generation = code_object_generation;
+        _Py_hashtable_clear(unwinder->code_object_cache);
+    }
+    return 0;
+}
+
+// Return 1 if no code object of the interpreter at `interp` was freed since
+// its code object generation was `generation`, 0 otherwise (the frames of
+// the sample may then refer to freed code objects).
+static int
+is_code_object_generation_current(RemoteUnwinderObject *unwinder,
+                                  InterpreterGenerationCache *cache,
+                                  uintptr_t interp, uint64_t generation)
+{
+    if (interp == 0) {
+        // Sampled without a thread state: there are no frames
+        return 1;
+    }
+    for (int i = 0; i < cache->count; i++) {
+        if (cache->entries[i].interp == interp) {
+            return cache->entries[i].code_object_generation == generation;
+        }
+    }
+
+    uint64_t current;
+    if (_Py_RemoteDebug_ReadRemoteMemory(
+            &unwinder->handle,
+            interp + unwinder->debug_offsets.interpreter_state.code_object_generation,
+            sizeof(uint64_t),
+            &current) < 0) {
+        // The interpreter was finalized
+        PyErr_Clear();
+        return 0;
+    }
+    if (cache->count < ALLOC_SAMPLING_MAX_INTERPRETERS) {
+        cache->entries[cache->count].interp = interp;
+        cache->entries[cache->count].code_object_generation = current;
+        cache->count++;
+    }
+    return current == generation;
+}
+
+PyObject *
+read_allocation_samples(RemoteUnwinderObject *unwinder)
+{
+    struct _alloc_sampling *offsets = &unwinder->debug_offsets.alloc_sampling;
+    if (offsets->size == 0 || offsets->size > ALLOC_SAMPLING_STATE_BUFFER_SIZE
+        || offsets->max_frames > ALLOC_SAMPLING_MAX_FRAMES_LIMIT
+        || offsets->sample_size < offsets->sample_frames
+                                  + offsets->max_frames * offsets->frame_size) {
+        PyErr_SetString(PyExc_RuntimeError,
+                        "Invalid allocation sampling debug offsets");
+        return NULL;
+    }
+
+    uintptr_t state_addr = unwinder->runtime_start_address
+                           + unwinder->debug_offsets.runtime_state.alloc_sampling;
+    char state_buffer[ALLOC_SAMPLING_STATE_BUFFER_SIZE];
+    if (_Py_RemoteDebug_ReadRemoteMemory(&unwinder->handle, state_addr,
+                                         offsets->size, state_buffer) < 0) {
+        set_exception_cause(unwinder, PyExc_RuntimeError,
+                            "Failed to read allocation sampling state");
+        return NULL;
+    }
+
+    PyObject *result = PyList_New(0);
+    if (result == NULL) {
+        return NULL;
+    }
+
+    uintptr_t samples_addr = GET_MEMBER(uintptr_t, state_buffer, offsets->samples);
+    uint64_t capacity = GET_MEMBER(uint32_t, state_buffer, offsets->capacity);
+    uint64_t write_index = GET_MEMBER(uint64_t, state_buffer, offsets->write_index);
+    if (samples_addr == 0) {
+        // Sampling was never enabled in the remote process
+        return result;
+    }
+    if (capacity == 0 || (capacity & (capacity - 1)) != 0) {
+        Py_DECREF(result);
+        PyErr_SetString(PyExc_RuntimeError,
+                        "Invalid allocation sample buffer (corrupted remote memory)");
+        return NULL;
+    }
+
+    // Records older than the last `capacity` ones were overwritten
+    uint64_t start = unwinder->alloc_samples_read;
+    if (start > write_index || write_index - start > capacity) {
+        start = write_index - Py_MIN(write_index, capacity);
+    }
+    uint64_t count = write_index - start;
+    if (count == 0) {
+        unwinder->alloc_samples_read = write_index;
+        return result;
+    }
+
+    size_t sample_size = (size_t)offsets->sample_size;
+    char *records = PyMem_RawMalloc((size_t)count * sample_size);
+    if (records == NULL) {
+        Py_DECREF(result);
+        PyErr_NoMemory();
+        return NULL;
+    }
+
+    // Copy the records with one read, or two if they wrap around
+    uint64_t first_slot = start & (capacity - 1);
+    uint64_t first_count = Py_MIN(count, capacity - first_slot);
+    if (_Py_RemoteDebug_ReadRemoteMemory(
+            &unwinder->handle,
+            samples_addr + (uintptr_t)(first_slot * sample_size),
+            (size_t)first_count * sample_size,
+            records) < 0
+        || (first_count < count
+            && _Py_RemoteDebug_ReadRemoteMemory(
+                &unwinder->handle,
+                samples_addr,
+                (size_t)(count - first_count) * sample_size,
+                records + first_count * sample_size) < 0)) {
+        set_exception_cause(unwinder, PyExc_RuntimeError,
+                            "Failed to read allocation samples");
+        goto error;
+    }
+
+    // Writers may have reused slots while they were being copied
+    uint64_t new_write_index;
+    if (read_allocation_write_index(unwinder, &new_write_index) < 0) {
+        set_exception_cause(unwinder, PyExc_RuntimeError,
+                            "Failed to read allocation sampling state");
+        goto error;
+    }
+    if (refresh_code_object_cache(unwinder) < 0) {
+        set_exception_cause(unwinder, PyExc_RuntimeError,
+                            "Failed to read code object generation");
+        goto error;
+    }
+
+    InterpreterGenerationCache generations = {.count = 0};
+    uint64_t index = start;
+    for (; index < write_index; index++) {
+        const char *record = records + (index - start) * sample_size;
+        if (new_write_index - index > capacity) {
+            // Overwritten during the copy
+            continue;
+        }
+        uint64_t sequence = GET_MEMBER(uint64_t, record, offsets->sample_sequence);
+        if (sequence != index + 1) {
+            // Still being written: retry on the next call
+            break;
+        }
+        if (!is_code_object_generation_current(
+                unwinder, &generations,
+                GET_MEMBER(uintptr_t, record, offsets->sample_interp),
+                GET_MEMBER(uint64_t, record,
+                           offsets->sample_code_object_generation))) {
+            // Code objects were freed since the sample was taken: its
+            // frames cannot be trusted.
+            continue;
+        }
+        PyObject *sample = build_allocation_sample(unwinder, record);
+        if (sample == NULL) {
+            if (PyErr_ExceptionMatches(PyExc_MemoryError)) {
+                goto error;
+            }
+            // A code object was freed after the generation check
+            PyErr_Clear();
+            continue;
+        }
+        if (PyList_Append(result, sample) < 0) {
+            Py_DECREF(sample);
+            goto error;
+        }
+        Py_DECREF(sample);
+    }
+    unwinder->alloc_samples_read = index;
+
+    PyMem_RawFree(records);
+    _Py_RemoteDebug_ClearCache(&unwinder->handle);
+    return result;
+
+error:
+    PyMem_RawFree(records);
+    _Py_RemoteDebug_ClearCache(&unwinder->handle);
+    Py_DECREF(result);
+    return NULL;
+}
@@ -23,7 +23,9 @@ extern "C" {
 
 #define BINARY_FORMAT_MAGIC     0x54414348  /* "TACH" (Tachyon) in native byte order */
 #define BINARY_FORMAT_MAGIC_SWAPPED 0x48434154  /* Byte-swapped magic for endianness detection */
-#define BINARY_FORMAT_VERSION   1
+#define BINARY_FORMAT_VERSION   2  /* Newest version, used by aggregated files */
+#define BINARY_FORMAT_MIN_VERSION 1  /* Oldest version read, still used by
+                                        files without aggregated samples */
 
 /* Sentinel values for optional frame fields */
 #define OPCODE_NONE             255  /* No opcode captured (u8 sentinel) */
@@ -59,7 +61,9 @@ extern "C" {
 #define HDR_SIZE_FRAME_TABLE 8
 #define HDR_OFF_COMPRESSION  (HDR_OFF_FRAME_TABLE + HDR_SIZE_FRAME_TABLE)
 #define HDR_SIZE_COMPRESSION 4
-#define FILE_HEADER_SIZE     (HDR_OFF_COMPRESSION + HDR_SIZE_COMPRESSION)
+#define HDR_OFF_FLAGS        (HDR_OFF_COMPRESSION + HDR_SIZE_COMPRESSION)
+#define HDR_SIZE_FLAGS       4
+#define FILE_HEADER_SIZE     (HDR_OFF_FLAGS + HDR_SIZE_FLAGS)
 #define FILE_HEADER_PLACEHOLDER_SIZE 64
 
 static_assert(FILE_HEADER_SIZE <= FILE_HEADER_PLACEHOLDER_SIZE,
@@ -74,12 +78,25 @@ static_assert(FILE_HEADER_SIZE <= FILE_HEADER_PLACEHOLDER_SIZE,
 #define COMPRESSION_NONE        0
 #define COMPRESSION_ZSTD        1
 
+/* Header flags */
+#define FORMAT_FLAG_AGGREGATED  0x01  /* Sample data holds aggregated records */
+
 /* Stack encoding types for delta compression */
 #define STACK_REPEAT            0x00  /* RLE: identical to previous, with count */
 #define STACK_FULL              0x01  /* Full stack (first sample or no match) */
 #define STACK_SUFFIX            0x02  /* Shares N frames from bottom */
 #define STACK_POP_PUSH          0x03  /* Remove M frames, add N frames */
 
+/* Record types of aggregated files. Stacks are deduplicated into a trie
+ * whose nodes are defined once; each time bucket then lists how many
+ * samples every (thread, stack, status) triple received. */
+#define AGG_THREAD              0x10  /* Define the next thread index */
+#define AGG_NODE                0x11  /* Define the next stack trie node */
+#define AGG_BUCKET              0x12  /* Sample counts of one time bucket */
+
+/* Trie node index of the empty stack, parent of the outermost frames */
+#define AGG_ROOT_NODE           0
+
 /* Maximum stack depth we'll buffer for delta encoding */
 #define MAX_STACK_DEPTH         256
 
@@ -90,6 +107,8 @@ static_assert(FILE_HEADER_SIZE <= FILE_HEADER_PLACEHOLDER_SIZE,
 #define INITIAL_STRING_CAPACITY 4096
 #define INITIAL_FRAME_CAPACITY  4096
 #define INITIAL_THREAD_CAPACITY 256
+#define INITIAL_NODE_CAPACITY   4096
+#define INITIAL_CELL_CAPACITY   1024
 
 /* ============================================================================
  * STATISTICS STRUCTURES
@@ -105,6 +124,9 @@ typedef struct {
     uint64_t total_frames_written;/* Total frame indices written */
     uint64_t frames_saved;        /* Frames avoided due to delta encoding */
     uint64_t bytes_written;       /* Total bytes written (before compression) */
+    uint64_t bucket_records;      /* Number of aggregated time buckets written */
+    uint64_t cell_records;        /* Number of aggregated counts written */
+    uint64_t stack_nodes;         /* Number of stack trie nodes defined */
 } BinaryWriterStats;
 
 /* Reader statistics - tracks reconstruction performance */
@@ -116,6 +138,8 @@ typedef struct {
     uint64_t pop_push_records;    /* Pop-push records decoded */
     uint64_t total_samples;       /* Total samples reconstructed */
     uint64_t stack_reconstructions; /* Number of stack array reconstructions */
+    uint64_t bucket_records;      /* Aggregated time buckets decoded */
+    uint64_t cell_records;        /* Aggregated counts decoded */
 } BinaryReaderStats;
 
 /* ============================================================================
@@ -206,6 +230,25 @@ typedef struct {
     uint8_t status;
 } PendingRLESample;
 
+/* Stack trie node key: a frame called from the stack ending at `parent` */
+typedef struct {
+    uint32_t parent;
+    uint32_t frame_idx;
+} StackNodeKey;
+
+/* Aggregated count key: samples of one thread with one stack and status */
+typedef struct {
+    uint32_t thread_idx;
+    uint32_t node;
+    uint8_t status;
+} AggregateCellKey;
+
+/* Aggregated count of the current time bucket */
+typedef struct {
+    AggregateCellKey key;
+    uint64_t count;
+} AggregateCell;
+
 /* Thread entry - tracks per-thread state for delta encoding */
 typedef struct {
     uint64_t thread_id;
@@ -222,6 +265,9 @@ typedef struct {
     size_t pending_rle_count;
     size_t pending_rle_capacity;
     int has_pending_rle;  /* Flag: do we have buffered repeats? */
+
+    /* Aggregation only: trie node of each frame of prev_stack */
+    uint32_t *prev_nodes;
 } ThreadEntry;
 
 /* Main binary writer structure */
@@ -263,6 +309,22 @@ typedef struct {
     size_t thread_count;
     size_t thread_capacity;
 
+    /* Streaming aggregation (only used if aggregate is set): stacks are
+     * interned into a trie and samples are counted per time bucket. Each
+     * bucket is written out once a sample falls in a later one. */
+    int aggregate;
+    uint64_t bucket_us;
+    uint64_t current_bucket;
+    uint64_t prev_bucket_start_us;
+    /* Trie hash table: StackNodeKey* -> node index; node 0 is the root */
+    _Py_hashtable_t *node_hash;
+    uint32_t node_count;
+    /* Count hash table: AggregateCellKey* -> index in cells + 1 */
+    _Py_hashtable_t *cell_hash;
+    AggregateCell *cells;
+    size_t cell_count;
+    size_t cell_capacity;
+
     /* Statistics */
     BinaryWriterStats stats;
 } BinaryWriter;
@@ -283,6 +345,14 @@ typedef struct {
     size_t current_stack_capacity;
 } ReaderThreadState;
 
+/* Stack trie node of an aggregated file */
+typedef struct {
+    uint32_t parent;
+    uint32_t frame_idx;
+    uint32_t depth;
+    PyObject *frame_list;  /* Cached list of FrameInfo, built on first use */
+} ReaderStackNode;
+
 /* Main binary reader structure */
 typedef struct {
     char *filename;
@@ -307,6 +377,7 @@ typedef struct {
     uint8_t py_major;
     uint8_t py_minor;
     uint8_t py_micro;
+    uint32_t version;
     int needs_swap;  /* Non-zero if file was written on different-endian system */
     uint64_t start_time_us;
     uint64_t sample_interval_us;
@@ -314,6 +385,7 @@ typedef struct {
     uint32_t thread_count;
     uint64_t string_table_offset;
     uint64_t frame_table_offset;
+    uint32_t flags;
 
     /* Parsed string table: array of Python string objects */
     PyObject **strings;
@@ -332,6 +404,11 @@ typedef struct {
     size_t thread_state_count;
     size_t thread_state_capacity;
 
+    /* Stack trie of aggregated files (node 0 is the empty stack) */
+    ReaderStackNode *nodes;
+    size_t node_count;
+    size_t node_capacity;
+
     /* Statistics */
     BinaryReaderStats stats;
 } BinaryReader;
@@ -499,6 +576,8 @@ grow_array_inplace(void **ptr_addr, size_t count, size_t *capacity, size_t elem_
  *   sample_interval_us: Sampling interval in microseconds
  *   compression_type: COMPRESSION_NONE or COMPRESSION_ZSTD
  *   start_time_us: Start timestamp in microseconds (from time.monotonic() * 1e6)
+ *   bucket_us: If non-zero, aggregate samples into time buckets of this
+ *              many microseconds instead of writing each sample
  *
  * Returns:
  *   New BinaryWriter* on success, NULL on failure (PyErr set)
@@ -507,7 +586,8 @@ BinaryWriter *binary_writer_create(
     const char *filename,
     uint64_t sample_interval_us,
     int compression_type,
-    uint64_t start_time_us
+    uint64_t start_time_us,
+    uint64_t bucket_us
 );
 
 /*
@@ -61,7 +61,7 @@ reader_parse_header(BinaryReader *reader, const uint8_t *data, size_t file_size)
         return -1;
     }
 
-    if (version != BINARY_FORMAT_VERSION) {
+    if (version < BINARY_FORMAT_MIN_VERSION || version > BINARY_FORMAT_VERSION) {
         if (version > BINARY_FORMAT_VERSION && file_size >= HDR_OFF_PY_MICRO + 1) {
             /* Newer format - try to read Python version for better error */
             uint8_t py_major = data[HDR_OFF_PY_MAJOR];
@@ -75,19 +75,20 @@ reader_parse_header(BinaryReader *reader, const uint8_t *data, size_t file_size)
                 BINARY_FORMAT_VERSION);
         } else {
             PyErr_Format(PyExc_ValueError,
-                "Unsupported format version %u (this reader supports version %d)",
-                version, BINARY_FORMAT_VERSION);
+                "Unsupported format version %u (this reader supports versions %d to %d)",
+                version, BINARY_FORMAT_MIN_VERSION, BINARY_FORMAT_VERSION);
         }
         return -1;
     }
 
+    reader->version = version;
     reader->py_major = data[HDR_OFF_PY_MAJOR];
     reader->py_minor = data[HDR_OFF_PY_MINOR];
     reader->py_micro = data[HDR_OFF_PY_MICRO];
 
     /* Read header fields with byte-swapping if needed */
     uint64_t start_time_us, sample_interval_us, string_table_offset, frame_table_offset;
-    uint32_t sample_count, thread_count, compression_type;
+    uint32_t sample_count, thread_count, compression_type, flags;
 
     memcpy(&start_time_us, &data[HDR_OFF_START_TIME], HDR_SIZE_START_TIME);
     memcpy(&sample_interval_us, &data[HDR_OFF_INTERVAL], HDR_SIZE_INTERVAL);
@@ -96,6 +97,7 @@ reader_parse_header(BinaryReader *reader, const uint8_t *data, size_t file_size)
     memcpy(&string_table_offset, &data[HDR_OFF_STR_TABLE], HDR_SIZE_STR_TABLE);
     memcpy(&frame_table_offset, &data[HDR_OFF_FRAME_TABLE], HDR_SIZE_FRAME_TABLE);
     memcpy(&compression_type, &data[HDR_OFF_COMPRESSION], HDR_SIZE_COMPRESSION);
+    memcpy(&flags, &data[HDR_OFF_FLAGS], HDR_SIZE_FLAGS);
 
     reader->start_time_us = SWAP64_IF(reader->needs_swap, start_time_us);
     reader->sample_interval_us = SWAP64_IF(reader->needs_swap, sample_interval_us);
@@ -104,6 +106,7 @@ reader_parse_header(BinaryReader *reader, const uint8_t *data, size_t file_size)
     reader->string_table_offset = SWAP64_IF(reader->needs_swap, string_table_offset);
     reader->frame_table_offset = SWAP64_IF(reader->needs_swap, frame_table_offset);
     reader->compression_type = (int)SWAP32_IF(reader->needs_swap, compression_type);
+    reader->flags = SWAP32_IF(reader->needs_swap, flags);
 
     return 0;
 }
@@ -780,20 +783,15 @@ build_frame_list(RemoteDebuggingState *state, BinaryReader *reader,
     return NULL;
 }
 
-/* Helper to build sample_list from frame indices (shared by emit functions) */
+/* Helper to build sample_list around a frame list (stolen reference) */
 static PyObject *
-build_sample_list(RemoteDebuggingState *state, BinaryReader *reader,
-                  uint64_t thread_id, uint32_t interpreter_id, uint8_t status,
-                  const uint32_t *frame_indices, size_t stack_depth)
+build_sample_list_from_frames(RemoteDebuggingState *state,
+                              uint64_t thread_id, uint32_t interpreter_id,
+                              uint8_t status, PyObject *frame_list)
 {
-    PyObject *frame_list = NULL, *thread_info = NULL, *thread_list = NULL;
+    PyObject *thread_info = NULL, *thread_list = NULL;
     PyObject *interp_info = NULL, *sample_list = NULL;
 
-    frame_list = build_frame_list(state, reader, frame_indices, stack_depth);
-    if (!frame_list) {
-        goto error;
-    }
-
     thread_info = PyStructSequence_New(state->ThreadInfo_Type);
     if (!thread_info) {
         goto error;
@@ -847,6 +845,20 @@ build_sample_list(RemoteDebuggingState *state, BinaryReader *reader,
     return NULL;
 }
 
+/* Helper to build sample_list from frame indices (shared by emit functions) */
+static PyObject *
+build_sample_list(RemoteDebuggingState *state, BinaryReader *reader,
+                  uint64_t thread_id, uint32_t interpreter_id, uint8_t status,
+                  const uint32_t *frame_indices, size_t stack_depth)
+{
+    PyObject *frame_list = build_frame_list(state, reader, frame_indices, stack_depth);
+    if (!frame_list) {
+        return NULL;
+    }
+    return build_sample_list_from_frames(state, thread_id, interpreter_id,
+                                         status, frame_list);
+}
+
 /* Helper to emit a sample to the collector. timestamps_list is borrowed. */
 static int
 emit_sample(RemoteDebuggingState *state, PyObject *collector,
@@ -901,6 +913,291 @@ invoke_progress_callback(PyObject *callback, Py_ssize_t current, uint32_t total)
     return 0;
 }
 
+/* ============================================================================
+ * AGGREGATED FILE REPLAY
+ * ============================================================================ */
+
+/* Define the next trie node. Nodes already parsed by a previous replay are
+ * only validated. Returns 0 on success, -1 on error. */
+static int
+reader_define_stack_node(BinaryReader *reader, size_t node, uint32_t parent,
+                         uint32_t frame_idx)
+{
+    if (parent >= node || frame_idx >= reader->frames_count) {
+        PyErr_Format(PyExc_ValueError,
+            "Invalid stack node (parent %u, frame %u)", parent, frame_idx);
+        return -1;
+    }
+    uint32_t depth = reader->nodes[parent].depth + 1;
+    if (depth > MAX_STACK_DEPTH) {
+        PyErr_Format(PyExc_ValueError,
+            "Stack node depth %u exceeds maximum %d", depth, MAX_STACK_DEPTH);
+        return -1;
+    }
+
+    if (node < reader->node_count) {
+        return 0;
+    }
+    if (GROW_ARRAY(reader->nodes, reader->node_count,
+                   reader->node_capacity, ReaderStackNode) < 0) {
+        return -1;
+    }
+    ReaderStackNode *entry = &reader->nodes[reader->node_count++];
+    entry->parent = parent;
+    entry->frame_idx = frame_idx;
+    entry->depth = depth;
+    entry->frame_list = NULL;
+    return 0;
+}
+
+/* Return a new reference to the frame list of a trie node. Stacks are
+ * shared by many counts, so the list is built once and reused. */
+static PyObject *
+reader_get_node_frame_list(RemoteDebuggingState *state, BinaryReader *reader,
+                           uint32_t node)
+{
+    ReaderStackNode *entry = &reader->nodes[node];
+    if (entry->frame_list == NULL) {
+        /* Walking to the root yields the frames innermost first */
+        uint32_t frame_indices[MAX_STACK_DEPTH];
+        size_t depth = 0;
+        for (uint32_t n = node; n != AGG_ROOT_NODE; n = reader->nodes[n].parent) {
+            frame_indices[depth++] = reader->nodes[n].frame_idx;
+        }
+        entry->frame_list = build_frame_list(state, reader, frame_indices, depth);
+        if (!entry->frame_list) {
+            return NULL;
+        }
+    }
+    return Py_NewRef(entry->frame_list);
+}
+
+/* Emit the counts of one AGG_BUCKET record. Every count is replayed as a
+ * single collect() call whose timestamps all equal the bucket start.
+ * Returns the number of samples replayed, or -1 on error. */
+static Py_ssize_t
+replay_aggregate_bucket(RemoteDebuggingState *state, BinaryReader *reader,
+                        PyObject *collector, size_t *offset,
+                        uint64_t bucket_start_us, Py_ssize_t replayed)
+{
+    const uint8_t *data = reader->sample_data;
+    size_t size = reader->sample_data_size;
+
+    size_t prev_offset = *offset;
+    uint64_t cell_count = decode_varint_u64(data, offset, size);
+    if (*offset == prev_offset) {
+        PyErr_SetString(PyExc_ValueError, "Malformed varint for bucket size");
+        return -1;
+    }
+    /* Each count needs at least 4 bytes */
+    if (cell_count > (size - *offset) / 4) {
+        PyErr_Format(PyExc_ValueError,
+            "Invalid bucket size %llu exceeds remaining data",
+            (unsigned long long)cell_count);
+        return -1;
+    }
+
+    PyObject *timestamp = PyLong_FromUnsignedLongLong(bucket_start_us);
+    if (!timestamp) {
+        return -1;
+    }
+
+    Py_ssize_t bucket_samples = 0;
+    for (uint64_t i = 0; i < cell_count; i++) {
+        prev_offset = *offset;
+        uint32_t thread_idx = decode_varint_u32(data, offset, size);
+        uint32_t node = 0;
+        if (*offset != prev_offset) {
+            prev_offset = *offset;
+            node = decode_varint_u32(data, offset, size);
+        }
+        if (*offset == prev_offset || *offset >= size) {
+            PyErr_Clear();
+            PyErr_SetString(PyExc_ValueError, "Malformed aggregated count");
+            goto error;
+        }
+        uint8_t status = data[(*offset)++];
+        prev_offset = *offset;
+        uint64_t count = decode_varint_u64(data, offset, size);
+        if (*offset == prev_offset) {
+            PyErr_Clear();
+            PyErr_SetString(PyExc_ValueError, "Malformed aggregated count");
+            goto error;
+        }
+
+        if (thread_idx >= reader->thread_state_count || node >= reader->node_count) {
+            PyErr_Format(PyExc_ValueError,
+                "Invalid aggregated count (thread %u, node %u)", thread_idx, node);
+            goto error;
+        }
+        /* The header bounds the total so that a corrupted count cannot
+         * exhaust memory */
+        uint64_t seen = (uint64_t)replayed + (uint64_t)bucket_samples;
+        if (count == 0 || count > reader->sample_count || seen + count > reader->sample_count) {
+            PyErr_Format(PyExc_ValueError,
+                "Invalid aggregated count %llu exceeds sample count %u",
+                (unsigned long long)count, reader->sample_count);
+            goto error;
+        }
+
+        PyObject *frame_list = reader_get_node_frame_list(state, reader, node);
+        if (!frame_list) {
+            goto error;
+        }
+        ReaderThreadState *ts = &reader->thread_states[thread_idx];
+        PyObject *sample_list = build_sample_list_from_frames(
+            state, ts->thread_id, ts->interpreter_id, status, frame_list);
+        if (!sample_list) {
+            goto error;
+        }
+
+        PyObject *timestamps_list = PyList_New((Py_ssize_t)count);
+        if (!timestamps_list) {
+            Py_DECREF(sample_list);
+            goto error;
+        }
+        for (Py_ssize_t k = 0; k < (Py_ssize_t)count; k++) {
+            PyList_SET_ITEM(timestamps_list, k, Py_NewRef(timestamp));
+        }
+
+        PyObject *result = PyObject_CallMethod(collector, "collect", "OO",
+                                               sample_list, timestamps_list);
+        Py_DECREF(sample_list);
+        Py_DECREF(timestamps_list);
+        if (!result) {
+            goto error;
+        }
+        Py_DECREF(result);
+
+        bucket_samples += (Py_ssize_t)count;
+    }
+
+    Py_DECREF(timestamp);
+    reader->stats.bucket_records++;
+    reader->stats.cell_records += cell_count;
+    reader->stats.total_samples += bucket_samples;
+    return bucket_samples;
+
+error:
+    Py_DECREF(timestamp);
+    return -1;
+}
+
+static Py_ssize_t
+replay_aggregated(RemoteDebuggingState *state, BinaryReader *reader,
+                  PyObject *collector, PyObject *progress_callback)
+{
+    const uint8_t *data = reader->sample_data;
+    size_t size = reader->sample_data_size;
+    size_t offset = 0;
+    size_t thread_defs = 0;
+    size_t node_defs = AGG_ROOT_NODE + 1;
+    uint64_t bucket_start_us = reader->start_time_us;
+    Py_ssize_t replayed = 0;
+
+    if (reader->node_count == 0) {
+        reader->nodes = PyMem_Malloc(INITIAL_NODE_CAPACITY * sizeof(ReaderStackNode));
+        if (!reader->nodes) {
+            PyErr_NoMemory();
+            return -1;
+        }
+        reader->node_capacity = INITIAL_NODE_CAPACITY;
+        reader->nodes[AGG_ROOT_NODE] = (ReaderStackNode){0};
+        reader->node_count = AGG_ROOT_NODE + 1;
+    }
+
+    if (invoke_progress_callback(progress_callback, 0, reader->sample_count) < 0) {
+        return -1;
+    }
+
+    while (offset < size) {
+        uint8_t record_type = data[offset++];
+
+        switch (record_type) {
+        case AGG_THREAD: {
+            /* [thread_id: 8] [interpreter_id: 4] */
+            if (size - offset < 12) {
+                PyErr_SetString(PyExc_ValueError, "Unexpected end of thread record");
+                return -1;
+            }
+            uint64_t thread_id_raw;
+            uint32_t interpreter_id_raw;
+            memcpy(&thread_id_raw, &data[offset], sizeof(thread_id_raw));
+            memcpy(&interpreter_id_raw, &data[offset + 8], sizeof(interpreter_id_raw));
+            offset += 12;
+
+            ReaderThreadState *ts = reader_get_or_create_thread_state(
+                reader,
+                SWAP64_IF(reader->needs_swap, thread_id_raw),
+                SWAP32_IF(reader->needs_swap, interpreter_id_raw));
+            if (!ts) {
+                return -1;
+            }
+            if (ts != &reader->thread_states[thread_defs]) {
+                PyErr_SetString(PyExc_ValueError, "Duplicate thread record");
+                return -1;
+            }
+            thread_defs++;
+            break;
+        }
+
+        case AGG_NODE: {
+            /* [parent: varint] [frame_idx: varint] */
+            size_t prev_offset = offset;
+            uint32_t parent = decode_varint_u32(data, &offset, size);
+            uint32_t frame_idx = 0;
+            if (offset != prev_offset) {
+                prev_offset = offset;
+                frame_idx = decode_varint_u32(data, &offset, size);
+            }
+            if (offset == prev_offset) {
+                PyErr_Clear();
+                PyErr_SetString(PyExc_ValueError, "Malformed stack node record");
+                return -1;
+            }
+            if (reader_define_stack_node(reader, node_defs, parent, frame_idx) < 0) {
+                return -1;
+            }
+            node_defs++;
+            break;
+        }
+
+        case AGG_BUCKET: {
+            /* [timestamp_delta: varint] [cell_count: varint] [counts...] */
+            size_t prev_offset = offset;
+            uint64_t delta = decode_varint_u64(data, &offset, size);
+            if (offset == prev_offset) {
+                PyErr_SetString(PyExc_ValueError, "Malformed varint for bucket timestamp");
+                return -1;
+            }
+            bucket_start_us += delta;
+
+            Py_ssize_t count = replay_aggregate_bucket(state, reader, collector, &offset,
+                                                       bucket_start_us, replayed);
+            if (count < 0) {
+                return -1;
+            }
+            replayed += count;
+
+            if (invoke_progress_callback(progress_callback, replayed, reader->sample_count) < 0) {
+                return -1;
+            }
+            break;
+        }
+
+        default:
+            PyErr_Format(PyExc_ValueError, "Unknown aggregated record type: %u", record_type);
+            return -1;
+        }
+    }
+
+    if (invoke_progress_callback(progress_callback, replayed, reader->sample_count) < 0) {
+        return -1;
+    }
+
+    return replayed;
+}
+
 Py_ssize_t
 binary_reader_replay(BinaryReader *reader, PyObject *collector, PyObject *progress_callback)
 {
@@ -922,6 +1219,10 @@ binary_reader_replay(BinaryReader *reader, PyObject *collector, PyObject *progre
         return -1;
     }
 
+    if (reader->flags & FORMAT_FLAG_AGGREGATED) {
+        return replay_aggregated(state, reader, collector, progress_callback);
+    }
+
     size_t offset = 0;
     Py_ssize_t replayed = 0;
 
@@ -1144,8 +1445,8 @@ binary_reader_get_info(BinaryReader *reader)
         return NULL;
     }
     return Py_BuildValue(
-        "{s:I, s:N, s:K, s:K, s:I, s:I, s:I, s:I, s:i}",
-        "version", BINARY_FORMAT_VERSION,
+        "{s:I, s:N, s:K, s:K, s:I, s:I, s:I, s:I, s:i, s:O}",
+        "version", reader->version,
         "python_version", py_version,
         "start_time_us", reader->start_time_us,
         "sample_interval_us", reader->sample_interval_us,
@@ -1153,7 +1454,8 @@ binary_reader_get_info(BinaryReader *reader)
         "thread_count", reader->thread_count,
         "string_count", reader->strings_count,
         "frame_count", reader->frames_count,
-        "compression_type", reader->compression_type
+        "compression_type", reader->compression_type,
+        "aggregated", (reader->flags & FORMAT_FLAG_AGGREGATED) ? Py_True : Py_False
     );
 }
 
@@ -1171,7 +1473,7 @@ binary_writer_get_stats(BinaryWriter *writer)
         (double)s->frames_saved / potential_frames * 100.0 : 0.0;
 
     return Py_BuildValue(
-        "{s:K, s:K, s:K, s:K, s:K, s:K, s:K, s:K, s:K, s:K, s:d}",
+        "{s:K, s:K, s:K, s:K, s:K, s:K, s:K, s:K, s:K, s:K, s:d, s:K, s:K, s:K}",
         "repeat_records", s->repeat_records,
         "repeat_samples", s->repeat_samples,
         "full_records", s->full_records,
@@ -1182,7 +1484,10 @@ binary_writer_get_stats(BinaryWriter *writer)
         "total_frames_written", s->total_frames_written,
         "frames_saved", s->frames_saved,
         "bytes_written", s->bytes_written,
-        "frame_compression_pct", compression_ratio
+        "frame_compression_pct", compression_ratio,
+        "bucket_records", s->bucket_records,
+        "cell_records", s->cell_records,
+        "stack_nodes", s->stack_nodes
     );
 }
 
@@ -1195,7 +1500,7 @@ binary_reader_get_stats(BinaryReader *reader)
                              s->suffix_records + s->pop_push_records;
 
     return Py_BuildValue(
-        "{s:K, s:K, s:K, s:K, s:K, s:K, s:K, s:K}",
+        "{s:K, s:K, s:K, s:K, s:K, s:K, s:K, s:K, s:K, s:K}",
         "repeat_records", s->repeat_records,
         "repeat_samples", s->repeat_samples,
         "full_records", s->full_records,
@@ -1203,7 +1508,9 @@ binary_reader_get_stats(BinaryReader *reader)
         "pop_push_records", s->pop_push_records,
         "total_records", total_records,
         "total_samples", s->total_samples,
-        "stack_reconstructions", s->stack_reconstructions
+        "stack_reconstructions", s->stack_reconstructions,
+        "bucket_records", s->bucket_records,
+        "cell_records", s->cell_records
     );
 }
 
@@ -1256,5 +1563,12 @@ binary_reader_close(BinaryReader *reader)
         PyMem_Free(reader->thread_states);
     }
 
+    if (reader->nodes) {
+        for (size_t i = 0; i < reader->node_count; i++) {
+            Py_XDECREF(reader->nodes[i].frame_list);
+        }
+        PyMem_Free(reader->nodes);
+    }
+
     PyMem_Free(reader);
 }
@@ -361,6 +361,50 @@ frame_key_destroy(void *key)
     PyMem_Free(key);
 }
 
+static Py_uhash_t
+stack_node_key_hash_func(const void *key)
+{
+    const StackNodeKey *nk = (const StackNodeKey *)key;
+    Py_uhash_t hash = 2166136261u;
+    hash ^= nk->parent;
+    hash *= 16777619u;
+    hash ^= nk->frame_idx;
+    hash *= 16777619u;
+    return hash;
+}
+
+static int
+stack_node_key_compare_func(const void *key1, const void *key2)
+{
+    const StackNodeKey *nk1 = (const StackNodeKey *)key1;
+    const StackNodeKey *nk2 = (const StackNodeKey *)key2;
+    return nk1->parent == nk2->parent && nk1->frame_idx == nk2->frame_idx;
+}
+
+static Py_uhash_t
+cell_key_hash_func(const void *key)
+{
+    const AggregateCellKey *ck = (const AggregateCellKey *)key;
+    Py_uhash_t hash = 2166136261u;
+    hash ^= ck->thread_idx;
+    hash *= 16777619u;
+    hash ^= ck->node;
+    hash *= 16777619u;
+    hash ^= ck->status;
+    hash *= 16777619u;
+    return hash;
+}
+
+static int
+cell_key_compare_func(const void *key1, const void *key2)
+{
+    const AggregateCellKey *ck1 = (const AggregateCellKey *)key1;
+    const AggregateCellKey *ck2 = (const AggregateCellKey *)key2;
+    return (ck1->thread_idx == ck2->thread_idx &&
+            ck1->node == ck2->node &&
+            ck1->status == ck2->status);
+}
+
 static inline int
 writer_intern_string(BinaryWriter *writer, PyObject *string, uint32_t *index)
 {
@@ -501,6 +545,28 @@ writer_get_or_create_thread_entry(BinaryWriter *writer, uint64_t thread_id,
         return NULL;
     }
 
+    if (writer->aggregate) {
+        entry->prev_nodes = PyMem_Malloc(entry->prev_stack_capacity * sizeof(uint32_t));
+        if (!entry->prev_nodes) {
+            PyMem_Free(entry->prev_stack);
+            PyMem_Free(entry->pending_rle);
+            PyErr_NoMemory();
+            return NULL;
+        }
+
+        /* [AGG_THREAD: 1] [thread_id: 8] [interpreter_id: 4] */
+        uint8_t record[1 + 8 + 4];
+        record[0] = AGG_THREAD;
+        memcpy(record + 1, &thread_id, 8);
+        memcpy(record + 9, &interpreter_id, 4);
+        if (writer_write_bytes(writer, record, sizeof(record)) < 0) {
+            PyMem_Free(entry->prev_stack);
+            PyMem_Free(entry->pending_rle);
+            PyMem_Free(entry->prev_nodes);
+            return NULL;
+        }
+    }
+
     writer->thread_count++;
     if (is_new) {
         *is_new = 1;
@@ -717,9 +783,174 @@ write_sample_with_encoding(BinaryWriter *writer, ThreadEntry *entry,
     return 0;
 }
 
+/* ============================================================================
+ * STREAMING AGGREGATION
+ * ============================================================================ */
+
+/* Get or create the trie node of frame_idx called from the stack ending at
+ * parent. New nodes are defined in the output as they are created, so they
+ * always precede the buckets that count them.
+ * Returns 0 on success, -1 on error. */
+static inline int
+writer_intern_stack_node(BinaryWriter *writer, uint32_t parent,
+                         uint32_t frame_idx, uint32_t *node)
+{
+    StackNodeKey lookup_key = {parent, frame_idx};
+
+    void *existing = _Py_hashtable_get(writer->node_hash, &lookup_key);
+    if (existing != NULL) {
+        *node = (uint32_t)(uintptr_t)existing;  /* the root is never a value */
+        return 0;
+    }
+
+    if (writer->node_count == UINT32_MAX) {
+        PyErr_SetString(PyExc_OverflowError, "Too many distinct stacks");
+        return -1;
+    }
+
+    StackNodeKey *key = PyMem_Malloc(sizeof(StackNodeKey));
+    if (!key) {
+        PyErr_NoMemory();
+        return -1;
+    }
+    *key = lookup_key;
+
+    *node = writer->node_count;
+    if (_Py_hashtable_set(writer->node_hash, key, (void *)(uintptr_t)*node) < 0) {
+        PyMem_Free(key);
+        PyErr_NoMemory();
+        return -1;
+    }
+    writer->node_count++;
+
+    /* [AGG_NODE: 1] [parent: varint] [frame_idx: varint] */
+    uint8_t record[1 + 2 * MAX_VARINT_SIZE_U32];
+    size_t pos = 0;
+    record[pos++] = AGG_NODE;
+    pos += encode_varint_u32(record + pos, parent);
+    pos += encode_varint_u32(record + pos, frame_idx);
+    if (writer_write_bytes(writer, record, pos) < 0) {
+        return -1;
+    }
+
+    writer->stats.stack_nodes++;
+    return 0;
+}
+
+/* Write the counts of the current time bucket and start an empty one.
+ * Returns 0 on success, -1 on failure. */
+static int
+flush_aggregate_bucket(BinaryWriter *writer)
+{
+    if (writer->cell_count == 0) {
+        return 0;
+    }
+
+    /* [AGG_BUCKET: 1] [timestamp_delta: varint] [cell_count: varint]
+     * [thread_idx: varint] [node: varint] [status: 1] [count: varint]... */
+    uint64_t bucket_start_us = writer->start_time_us
+                               + writer->current_bucket * writer->bucket_us;
+    uint8_t header[1 + 2 * MAX_VARINT_SIZE];
+    size_t pos = 0;
+    header[pos++] = AGG_BUCKET;
+    pos += encode_varint_u64(header + pos, bucket_start_us - writer->prev_bucket_start_us);
+    pos += encode_varint_u64(header + pos, writer->cell_count);
+    if (writer_write_bytes(writer, header, pos) < 0) {
+        return -1;
+    }
+
+    for (size_t i = 0; i < writer->cell_count; i++) {
+        AggregateCell *cell = &writer->cells[i];
+        uint8_t buf[2 * MAX_VARINT_SIZE_U32 + 1 + MAX_VARINT_SIZE];
+        pos = encode_varint_u32(buf, cell->key.thread_idx);
+        pos += encode_varint_u32(buf + pos, cell->key.node);
+        buf[pos++] = cell->key.status;
+        pos += encode_varint_u64(buf + pos, cell->count);
+        if (writer_write_bytes(writer, buf, pos) < 0) {
+            return -1;
+        }
+    }
+
+    writer->stats.bucket_records++;
+    writer->stats.cell_records += writer->cell_count;
+    writer->prev_bucket_start_us = bucket_start_us;
+    _Py_hashtable_clear(writer->cell_hash);
+    writer->cell_count = 0;
+    return 0;
+}
+
+/* Count one sample of a thread in the current time bucket.
+ * Returns 0 on success, -1 on error. */
+static int
+aggregate_thread_sample(BinaryWriter *writer, ThreadEntry *entry, uint8_t status,
+                        const uint32_t *curr_stack, size_t curr_depth)
+{
+    /* Frames shared with the previous stack of the thread keep their trie
+     * nodes: only the frames above them need to be looked up. */
+    size_t shared = 0;
+    size_t min_depth = Py_MIN(entry->prev_stack_depth, curr_depth);
+    while (shared < min_depth &&
+           entry->prev_stack[entry->prev_stack_depth - 1 - shared] ==
+           curr_stack[curr_depth - 1 - shared]) {
+        shared++;
+    }
+
+    uint32_t node = AGG_ROOT_NODE;
+    if (shared > 0) {
+        node = entry->prev_nodes[entry->prev_stack_depth - shared];
+        memmove(entry->prev_nodes + curr_depth - shared,
+                entry->prev_nodes + entry->prev_stack_depth - shared,
+                shared * sizeof(uint32_t));
+    }
+    for (size_t i = curr_depth - shared; i > 0; i--) {
+        if (writer_intern_stack_node(writer, node, curr_stack[i - 1], &node) < 0) {
+            return -1;
+        }
+        entry->prev_nodes[i - 1] = node;
+    }
+    memcpy(entry->prev_stack, curr_stack, curr_depth * sizeof(uint32_t));
+    entry->prev_stack_depth = curr_depth;
+
+    AggregateCellKey lookup_key = {
+        .thread_idx = (uint32_t)(entry - writer->thread_entries),
+        .node = node,
+        .status = status,
+    };
+    void *existing = _Py_hashtable_get(writer->cell_hash, &lookup_key);
+    if (existing != NULL) {
+        writer->cells[(uintptr_t)existing - 1].count++;
+        writer->total_samples++;
+        return 0;
+    }
+
+    if (GROW_ARRAY(writer->cells, writer->cell_count,
+                   writer->cell_capacity, AggregateCell) < 0) {
+        return -1;
+    }
+
+    AggregateCellKey *key = PyMem_Malloc(sizeof(AggregateCellKey));
+    if (!key) {
+        PyErr_NoMemory();
+        return -1;
+    }
+    *key = lookup_key;
+
+    if (_Py_hashtable_set(writer->cell_hash, key,
+                          (void *)(uintptr_t)(writer->cell_count + 1)) < 0) {
+        PyMem_Free(key);
+        PyErr_NoMemory();
+        return -1;
+    }
+    writer->cells[writer->cell_count].key = lookup_key;
+    writer->cells[writer->cell_count].count = 1;
+    writer->cell_count++;
+    writer->total_samples++;
+    return 0;
+}
+
 BinaryWriter *
 binary_writer_create(const char *filename, uint64_t sample_interval_us, int compression_type,
-                     uint64_t start_time_us)
+                     uint64_t start_time_us, uint64_t bucket_us)
 {
     BinaryWriter *writer = PyMem_Calloc(1, sizeof(BinaryWriter));
     if (!writer) {
@@ -738,6 +969,9 @@ binary_writer_create(const char *filename, uint64_t sample_interval_us, int comp
     writer->start_time_us = start_time_us;
     writer->sample_interval_us = sample_interval_us;
     writer->compression_type = compression_type;
+    writer->aggregate = (bucket_us != 0);
+    writer->bucket_us = bucket_us;
+    writer->prev_bucket_start_us = start_time_us;
 
     writer->write_buffer = PyMem_Malloc(WRITE_BUFFER_SIZE);
     if (!writer->write_buffer) {
@@ -794,6 +1028,39 @@ binary_writer_create(const char *filename, uint64_t sample_interval_us, int comp
     }
     writer->thread_capacity = INITIAL_THREAD_CAPACITY;
 
+    if (writer->aggregate) {
+        writer->node_hash = _Py_hashtable_new_full(
+            stack_node_key_hash_func,
+            stack_node_key_compare_func,
+            frame_key_destroy,   /* Key destroy: free the StackNodeKey */
+            NULL,                /* Value destroy: values are just indices, not pointers */
+            NULL                 /* Use default allocator */
+        );
+        if (!writer->node_hash) {
+            PyErr_NoMemory();
+            goto error;
+        }
+        writer->node_count = AGG_ROOT_NODE + 1;
+
+        writer->cell_hash = _Py_hashtable_new_full(
+            cell_key_hash_func,
+            cell_key_compare_func,
+            frame_key_destroy,   /* Key destroy: free the AggregateCellKey */
+            NULL,                /* Value destroy: values are just indices, not pointers */
+            NULL                 /* Use default allocator */
+        );
+        if (!writer->cell_hash) {
+            PyErr_NoMemory();
+            goto error;
+        }
+        writer->cells = PyMem_Malloc(INITIAL_CELL_CAPACITY * sizeof(AggregateCell));
+        if (!writer->cells) {
+            PyErr_NoMemory();
+            goto error;
+        }
+        writer->cell_capacity = INITIAL_CELL_CAPACITY;
+    }
+
     if (compression_type == COMPRESSION_ZSTD) {
         if (writer_init_zstd(writer) < 0) {
             goto error;
@@ -957,6 +1224,10 @@ process_thread_sample(BinaryWriter *writer, PyObject *thread_info,
         return -1;
     }
 
+    if (writer->aggregate) {
+        return aggregate_thread_sample(writer, entry, status, curr_stack, curr_depth);
+    }
+
     /* Compare with previous stack to determine encoding */
     size_t shared_count, pop_count, push_count;
     int encoding = compare_stacks(
@@ -1003,6 +1274,21 @@ binary_writer_write_sample(BinaryWriter *writer, PyObject *stack_frames, uint64_
         return -1;
     }
 
+    if (writer->aggregate) {
+        /* Timestamps are monotonic: once a sample falls in a later bucket,
+         * the current one is complete. */
+        uint64_t bucket = 0;
+        if (timestamp_us > writer->start_time_us) {
+            bucket = (timestamp_us - writer->start_time_us) / writer->bucket_us;
+        }
+        if (bucket > writer->current_bucket) {
+            if (flush_aggregate_bucket(writer) < 0) {
+                return -1;
+            }
+            writer->current_bucket = bucket;
+        }
+    }
+
     Py_ssize_t num_interpreters = PyList_GET_SIZE(stack_frames);
     for (Py_ssize_t i = 0; i < num_interpreters; i++) {
         PyObject *interp_info = PyList_GET_ITEM(stack_frames, i);
@@ -1038,6 +1324,10 @@ binary_writer_write_sample(BinaryWriter *writer, PyObject *stack_frames, uint64_
 int
 binary_writer_finalize(BinaryWriter *writer)
 {
+    if (writer->aggregate && flush_aggregate_bucket(writer) < 0) {
+        return -1;
+    }
+
     for (size_t i = 0; i < writer->thread_count; i++) {
         if (writer->thread_entries[i].has_pending_rle) {
             if (flush_pending_rle(writer, &writer->thread_entries[i]) < 0) {
@@ -1168,10 +1458,12 @@ binary_writer_finalize(BinaryWriter *writer)
     uint64_t frame_table_offset_u64 = (uint64_t)frame_table_offset;
     uint32_t thread_count_u32 = (uint32_t)writer->thread_count;
     uint32_t compression_type_u32 = (uint32_t)writer->compression_type;
+    uint32_t flags = writer->aggregate ? FORMAT_FLAG_AGGREGATED : 0;
 
     uint8_t header[FILE_HEADER_SIZE] = {0};
     uint32_t magic = BINARY_FORMAT_MAGIC;
-    uint32_t version = BINARY_FORMAT_VERSION;
+    /* Only aggregated files need a reader that knows version 2 */
+    uint32_t version = writer->aggregate ? BINARY_FORMAT_VERSION : BINARY_FORMAT_MIN_VERSION;
     memcpy(header + HDR_OFF_MAGIC, &magic, HDR_SIZE_MAGIC);
     memcpy(header + HDR_OFF_VERSION, &version, HDR_SIZE_VERSION);
     header[HDR_OFF_PY_MAJOR] = PY_MAJOR_VERSION;
@@ -1184,6 +1476,7 @@ binary_writer_finalize(BinaryWriter *writer)
     memcpy(header + HDR_OFF_STR_TABLE, &string_table_offset_u64, HDR_SIZE_STR_TABLE);
     memcpy(header + HDR_OFF_FRAME_TABLE, &frame_table_offset_u64, HDR_SIZE_FRAME_TABLE);
     memcpy(header + HDR_OFF_COMPRESSION, &compression_type_u32, HDR_SIZE_COMPRESSION);
+    memcpy(header + HDR_OFF_FLAGS, &flags, HDR_SIZE_FLAGS);
     if (fwrite_checked_allow_threads(header, FILE_HEADER_SIZE, writer->fp) < 0) {
         return -1;
     }
@@ -1235,10 +1528,19 @@ binary_writer_destroy(BinaryWriter *writer)
     }
     PyMem_Free(writer->frame_entries);
 
+    if (writer->node_hash) {
+        _Py_hashtable_destroy(writer->node_hash);
+    }
+    if (writer->cell_hash) {
+        _Py_hashtable_destroy(writer->cell_hash);
+    }
+    PyMem_Free(writer->cells);
+
     if (writer->thread_entries) {
         for (size_t i = 0; i < writer->thread_count; i++) {
             PyMem_Free(writer->thread_entries[i].prev_stack);
             PyMem_Free(writer->thread_entries[i].pending_rle);
+            PyMem_Free(writer->thread_entries[i].prev_nodes);
         }
         PyMem_Free(writer->thread_entries);
     }
@@ -14,7 +14,7 @@ PyDoc_STRVAR(_remote_debugging_RemoteUnwinder___init____doc__,
 "RemoteUnwinder(pid, *, all_threads=False, only_active_thread=False,\n"
 "               mode=0, debug=False, skip_non_matching_threads=True,\n"
 "               native=False, gc=False, opcodes=False,\n"
-"               cache_frames=False, stats=False)\n"
+"               cache_frames=False, stats=False, workers=0)\n"
 "--\n"
 "\n"
 "Initialize a new RemoteUnwinder object for debugging a remote Python process.\n"
@@ -40,6 +40,9 @@ PyDoc_STRVAR(_remote_debugging_RemoteUnwinder___init____doc__,
 "                 unchanged parent frames between samples.\n"
 "    stats: If True, collect statistics about cache hits, memory reads, etc.\n"
 "           Use get_stats() to retrieve the collected statistics.\n"
+"    workers: Number of helper threads that split the remote memory reads\n"
+"             of different threads between them when sampling all threads.\n"
+"             0 does all reads on the calling thread.\n"
 "\n"
 "The RemoteUnwinder provides functionality to inspect and debug a running Python\n"
 "process, including examining thread states, stack frames and other runtime data.\n"
@@ -48,7 +51,8 @@ PyDoc_STRVAR(_remote_debugging_RemoteUnwinder___init____doc__,
 "    PermissionError: If access to the target process is denied\n"
 "    OSError: If unable to attach to the target process or access its memory\n"
 "    RuntimeError: If unable to read debug information from the target process\n"
-"    ValueError: If both all_threads and only_active_thread are True");
+"    ValueError: If both all_threads and only_active_thread are True, or\n"
+"                if workers is out of range");
 
 static int
 _remote_debugging_RemoteUnwinder___init___impl(RemoteUnwinderObject *self,
@@ -58,7 +62,7 @@ _remote_debugging_RemoteUnwinder___init___impl(RemoteUnwinderObject *self,
                                                int skip_non_matching_threads,
                                                int native, int gc,
                                                int opcodes, int cache_frames,
-                                               int stats);
+                                               int stats, int workers);
 
 static int
 _remote_debugging_RemoteUnwinder___init__(PyObject *self, PyObject *args, PyObject *kwargs)
@@ -66,7 +70,7 @@ _remote_debugging_RemoteUnwinder___init__(PyObject *self, PyObject *args, PyObje
     int return_value = -1;
     #if defined(Py_BUILD_CORE) && !defined(Py_BUILD_CORE_MODULE)
 
-    #define NUM_KEYWORDS 11
+    #define NUM_KEYWORDS 12
     static struct {
         PyGC_Head _this_is_not_used;
         PyObject_VAR_HEAD
@@ -75,7 +79,7 @@ _remote_debugging_RemoteUnwinder___init__(PyObject *self, PyObject *args, PyObje
     } _kwtuple = {
         .ob_base = PyVarObject_HEAD_INIT(&PyTuple_Type, NUM_KEYWORDS)
         .ob_hash = -1,
-        .ob_item = { &_Py_ID(pid), &_Py_ID(all_threads), &_Py_ID(only_active_thread), &_Py_ID(mode), &_Py_ID(debug), &_Py_ID(skip_non_matching_threads), &_Py_ID(native), &_Py_ID(gc), &_Py_ID(opcodes), &_Py_ID(cache_frames), &_Py_ID(stats), },
+        .ob_item = { &_Py_ID(pid), &_Py_ID(all_threads), &_Py_ID(only_active_thread), &_Py_ID(mode), &_Py_ID(debug), &_Py_ID(skip_non_matching_threads), &_Py_ID(native), &_Py_ID(gc), &_Py_ID(opcodes), &_Py_ID(cache_frames), &_Py_ID(stats), &_Py_ID(workers), },
     };
     #undef NUM_KEYWORDS
     #define KWTUPLE (&_kwtuple.ob_base.ob_base)
@@ -84,14 +88,14 @@ _remote_debugging_RemoteUnwinder___init__(PyObject *self, PyObject *args, PyObje
     #  define KWTUPLE NULL
     #endif  // !Py_BUILD_CORE
 
-    static const char * const _keywords[] = {"pid", "all_threads", "only_active_thread", "mode", "debug", "skip_non_matching_threads", "native", "gc", "opcodes", "cache_frames", "stats", NULL};
+    static const char * const _keywords[] = {"pid", "all_threads", "only_active_thread", "mode", "debug", "skip_non_matching_threads", "native", "gc", "opcodes", "cache_frames", "stats", "workers", NULL};
     static _PyArg_Parser _parser = {
         .keywords = _keywords,
         .fname = "RemoteUnwinder",
         .kwtuple = KWTUPLE,
     };
     #undef KWTUPLE
-    PyObject *argsbuf[11];
+    PyObject *argsbuf[12];
     PyObject * const *fastargs;
     Py_ssize_t nargs = PyTuple_GET_SIZE(args);
     Py_ssize_t noptargs = nargs + (kwargs ? PyDict_GET_SIZE(kwargs) : 0) - 1;
@@ -106,6 +110,7 @@ _remote_debugging_RemoteUnwinder___init__(PyObject *self, PyObject *args, PyObje
     int opcodes = 0;
     int cache_frames = 0;
     int stats = 0;
+    int workers = 0;
 
     fastargs = _PyArg_UnpackKeywords(_PyTuple_CAST(args)->ob_item, nargs, kwargs, NULL, &_parser,
             /*minpos*/ 1, /*maxpos*/ 1, /*minkw*/ 0, /*varpos*/ 0, argsbuf);
@@ -200,12 +205,21 @@ _remote_debugging_RemoteUnwinder___init__(PyObject *self, PyObject *args, PyObje
             goto skip_optional_kwonly;
         }
     }
-    stats = PyObject_IsTrue(fastargs[10]);
-    if (stats < 0) {
+    if (fastargs[10]) {
+        stats = PyObject_IsTrue(fastargs[10]);
+        if (stats < 0) {
+            goto exit;
+        }
+        if (!--noptargs) {
+            goto skip_optional_kwonly;
+        }
+    }
+    workers = PyLong_AsInt(fastargs[11]);
+    if (workers == -1 && PyErr_Occurred()) {
         goto exit;
     }
 skip_optional_kwonly:
-    return_value = _remote_debugging_RemoteUnwinder___init___impl((RemoteUnwinderObject *)self, pid, all_threads, only_active_thread, mode, debug, skip_non_matching_threads, native, gc, opcodes, cache_frames, stats);
+    return_value = _remote_debugging_RemoteUnwinder___init___impl((RemoteUnwinderObject *)self, pid, all_threads, only_active_thread, mode, debug, skip_non_matching_threads, native, gc, opcodes, cache_frames, stats, workers);
 
 exit:
     return return_value;
@@ -388,6 +402,46 @@ _remote_debugging_RemoteUnwinder_get_async_stack_trace(PyObject *self, PyObject
     return return_value;
 }
 
+PyDoc_STRVAR(_remote_debugging_RemoteUnwinder_get_allocation_samples__doc__,
+"get_allocation_samples($self, /)\n"
+"--\n"
+"\n"
+"Return the memory allocations sampled by the target process.\n"
+"\n"
+"Allocation sampling must be enabled in the target process with\n"
+"sys._set_allocation_sampling(). Each call returns the samples recorded\n"
+"since the previous call (or since the RemoteUnwinder was created), as a\n"
+"list of AllocationSample(thread_id, interpreter_id, size, weight, frame_info)\n"
+"where frame_info has the same format as in get_stack_trace() and weight is\n"
+"the number of sampling intervals the allocation accounts for.\n"
+"\n"
+"The target process keeps a bounded number of samples: samples are lost if\n"
+"this method is not called often enough. Samples whose code objects were\n"
+"freed in the meantime are skipped.\n"
+"\n"
+"Raises:\n"
+"    RuntimeError: If there is an error copying memory from the target process\n"
+"    OSError: If there is an error accessing the target process\n"
+"    PermissionError: If access to the target process is denied");
+
+#define _REMOTE_DEBUGGING_REMOTEUNWINDER_GET_ALLOCATION_SAMPLES_METHODDEF    \
+    {"get_allocation_samples", (PyCFunction)_remote_debugging_RemoteUnwinder_get_allocation_samples, METH_NOARGS, _remote_debugging_RemoteUnwinder_get_allocation_samples__doc__},
+
+static PyObject *
+_remote_debugging_RemoteUnwinder_get_allocation_samples_impl(RemoteUnwinderObject *self);
+
+static PyObject *
+_remote_debugging_RemoteUnwinder_get_allocation_samples(PyObject *self, PyObject *Py_UNUSED(ignored))
+{
+    PyObject *return_value = NULL;
+
+    Py_BEGIN_CRITICAL_SECTION(self);
+    return_value = _remote_debugging_RemoteUnwinder_get_allocation_samples_impl((RemoteUnwinderObject *)self);
+    Py_END_CRITICAL_SECTION();
+
+    return return_value;
+}
+
 PyDoc_STRVAR(_remote_debugging_RemoteUnwinder_get_stats__doc__,
 "get_stats($self, /)\n"
 "--\n"
@@ -497,7 +551,7 @@ _remote_debugging_RemoteUnwinder_resume_threads(PyObject *self, PyObject *Py_UNU
 
 PyDoc_STRVAR(_remote_debugging_BinaryWriter___init____doc__,
 "BinaryWriter(filename, sample_interval_us, start_time_us, *,\n"
-"             compression=0)\n"
+"             compression=0, bucket_us=0)\n"
 "--\n"
 "\n"
 "High-performance binary writer for profiling data.\n"
@@ -507,6 +561,9 @@ PyDoc_STRVAR(_remote_debugging_BinaryWriter___init____doc__,
 "    sample_interval_us: Sampling interval in microseconds\n"
 "    start_time_us: Start timestamp in microseconds (from time.monotonic() * 1e6)\n"
 "    compression: 0=none, 1=zstd (default: 0)\n"
+"    bucket_us: If non-zero, aggregate samples in memory and write how many\n"
+"        samples each distinct stack received per time bucket of this many\n"
+"        microseconds, instead of every sample (default: 0)\n"
 "\n"
 "Use as a context manager or call finalize() when done.");
 
@@ -515,7 +572,8 @@ _remote_debugging_BinaryWriter___init___impl(BinaryWriterObject *self,
                                              const char *filename,
                                              unsigned long long sample_interval_us,
                                              unsigned long long start_time_us,
-                                             int compression);
+                                             int compression,
+                                             unsigned long long bucket_us);
 
 static int
 _remote_debugging_BinaryWriter___init__(PyObject *self, PyObject *args, PyObject *kwargs)
@@ -523,7 +581,7 @@ _remote_debugging_BinaryWriter___init__(PyObject *self, PyObject *args, PyObject
     int return_value = -1;
     #if defined(Py_BUILD_CORE) && !defined(Py_BUILD_CORE_MODULE)
 
-    #define NUM_KEYWORDS 4
+    #define NUM_KEYWORDS 5
     static struct {
         PyGC_Head _this_is_not_used;
         PyObject_VAR_HEAD
@@ -532,7 +590,7 @@ _remote_debugging_BinaryWriter___init__(PyObject *self, PyObject *args, PyObject
     } _kwtuple = {
         .ob_base = PyVarObject_HEAD_INIT(&PyTuple_Type, NUM_KEYWORDS)
         .ob_hash = -1,
-        .ob_item = { &_Py_ID(filename), &_Py_ID(sample_interval_us), &_Py_ID(start_time_us), &_Py_ID(compression), },
+        .ob_item = { &_Py_ID(filename), &_Py_ID(sample_interval_us), &_Py_ID(start_time_us), &_Py_ID(compression), &_Py_ID(bucket_us), },
     };
     #undef NUM_KEYWORDS
     #define KWTUPLE (&_kwtuple.ob_base.ob_base)
@@ -541,14 +599,14 @@ _remote_debugging_BinaryWriter___init__(PyObject *self, PyObject *args, PyObject
     #  define KWTUPLE NULL
     #endif  // !Py_BUILD_CORE
 
-    static const char * const _keywords[] = {"filename", "sample_interval_us", "start_time_us", "compression", NULL};
+    static const char * const _keywords[] = {"filename", "sample_interval_us", "start_time_us", "compression", "bucket_us", NULL};
     static _PyArg_Parser _parser = {
         .keywords = _keywords,
         .fname = "BinaryWriter",
         .kwtuple = KWTUPLE,
     };
     #undef KWTUPLE
-    PyObject *argsbuf[4];
+    PyObject *argsbuf[5];
     PyObject * const *fastargs;
     Py_ssize_t nargs = PyTuple_GET_SIZE(args);
     Py_ssize_t noptargs = nargs + (kwargs ? PyDict_GET_SIZE(kwargs) : 0) - 3;
@@ -556,6 +614,7 @@ _remote_debugging_BinaryWriter___init__(PyObject *self, PyObject *args, PyObject
     unsigned long long sample_interval_us;
     unsigned long long start_time_us;
     int compression = 0;
+    unsigned long long bucket_us = 0;
 
     fastargs = _PyArg_UnpackKeywords(_PyTuple_CAST(args)->ob_item, nargs, kwargs, NULL, &_parser,
             /*minpos*/ 3, /*maxpos*/ 3, /*minkw*/ 0, /*varpos*/ 0, argsbuf);
@@ -584,12 +643,20 @@ _remote_debugging_BinaryWriter___init__(PyObject *self, PyObject *args, PyObject
     if (!noptargs) {
         goto skip_optional_kwonly;
     }
-    compression = PyLong_AsInt(fastargs[3]);
-    if (compression == -1 && PyErr_Occurred()) {
+    if (fastargs[3]) {
+        compression = PyLong_AsInt(fastargs[3]);
+        if (compression == -1 && PyErr_Occurred()) {
+            goto exit;
+        }
+        if (!--noptargs) {
+            goto skip_optional_kwonly;
+        }
+    }
+    if (!_PyLong_UnsignedLongLong_Converter(fastargs[4], &bucket_us)) {
         goto exit;
     }
 skip_optional_kwonly:
-    return_value = _remote_debugging_BinaryWriter___init___impl((BinaryWriterObject *)self, filename, sample_interval_us, start_time_us, compression);
+    return_value = _remote_debugging_BinaryWriter___init___impl((BinaryWriterObject *)self, filename, sample_interval_us, start_time_us, compression, bucket_us);
 
 exit:
     return return_value;
@@ -1296,4 +1363,4 @@ _remote_debugging_is_python_process(PyObject *module, PyObject *const *args, Py_
 exit:
     return return_value;
 }
-/*[clinic end generated code: output=34f50b18f317b9b6 input=a9049054013a1b77]*/
+/*[clinic end generated code: output=96e12b44f66f2c76 input=a9049054013a1b77]*/
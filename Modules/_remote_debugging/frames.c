@@ -20,26 +20,32 @@ cleanup_stack_chunks(StackChunkList *chunks)
     PyMem_RawFree(chunks->chunks);
 }
 
+// If prefetched is not NULL, it is a PyMem_RawMalloc()ed copy of the
+// _PY_DATA_STACK_CHUNK_SIZE bytes at chunk_addr, and ownership is taken.
 static int
 process_single_stack_chunk(
     RemoteUnwinderObject *unwinder,
     uintptr_t chunk_addr,
-    StackChunkInfo *chunk_info
+    StackChunkInfo *chunk_info,
+    char *prefetched
 ) {
     // Start with default size assumption
     size_t current_size = _PY_DATA_STACK_CHUNK_SIZE;
 
-    char *this_chunk = PyMem_RawMalloc(current_size);
-    if (!this_chunk) {
-        PyErr_NoMemory();
-        set_exception_cause(unwinder, PyExc_MemoryError, "Failed to allocate stack chunk buffer");
-        return -1;
-    }
+    char *this_chunk = prefetched;
+    if (this_chunk == NULL) {
+        this_chunk = PyMem_RawMalloc(current_size);
+        if (!this_chunk) {
+            PyErr_NoMemory();
+            set_exception_cause(unwinder, PyExc_MemoryError, "Failed to allocate stack chunk buffer");
+            return -1;
+        }
 
-    if (_Py_RemoteDebug_PagedReadRemoteMemory(&unwinder->handle, chunk_addr, current_size, this_chunk) < 0) {
-        PyMem_RawFree(this_chunk);
-        set_exception_cause(unwinder, PyExc_RuntimeError, "Failed to read stack chunk");
-        return -1;
+        if (_Py_RemoteDebug_PagedReadRemoteMemory(&unwinder->handle, chunk_addr, current_size, this_chunk) < 0) {
+            PyMem_RawFree(this_chunk);
+            set_exception_cause(unwinder, PyExc_RuntimeError, "Failed to read stack chunk");
+            return -1;
+        }
     }
 
     // Check actual size and reread if necessary
@@ -81,17 +87,29 @@ copy_stack_chunks(RemoteUnwinderObject *unwinder,
                   StackChunkList *out_chunks)
 {
     uintptr_t chunk_addr;
-    StackChunkInfo *chunks = NULL;
-    size_t count = 0;
-    size_t max_chunks = 16;
-
     if (read_ptr(unwinder, tstate_addr + (uintptr_t)unwinder->debug_offsets.thread_state.datastack_chunk, &chunk_addr)) {
         set_exception_cause(unwinder, PyExc_RuntimeError, "Failed to read initial stack chunk address");
         return -1;
     }
+    return copy_stack_chunks_from(unwinder, chunk_addr, NULL, out_chunks);
+}
+
+// Copy the chain of stack chunks starting at chunk_addr.  If first_chunk is
+// not NULL, it is a PyMem_RawMalloc()ed copy of the first
+// _PY_DATA_STACK_CHUNK_SIZE bytes at chunk_addr; ownership is always taken.
+int
+copy_stack_chunks_from(RemoteUnwinderObject *unwinder,
+                       uintptr_t chunk_addr,
+                       char *first_chunk,
+                       StackChunkList *out_chunks)
+{
+    StackChunkInfo *chunks = NULL;
+    size_t count = 0;
+    size_t max_chunks = 16;
 
     chunks = PyMem_RawMalloc(max_chunks * sizeof(StackChunkInfo));
     if (!chunks) {
+        PyMem_RawFree(first_chunk);
         PyErr_NoMemory();
         set_exception_cause(unwinder, PyExc_MemoryError, "Failed to allocate stack chunks array");
         return -1;
@@ -112,7 +130,9 @@ copy_stack_chunks(RemoteUnwinderObject *unwinder,
         }
 
         // Process this chunk
-        if (process_single_stack_chunk(unwinder, chunk_addr, &chunks[count]) < 0) {
+        char *prefetched = count == 0 ? first_chunk : NULL;
+        first_chunk = NULL;
+        if (process_single_stack_chunk(unwinder, chunk_addr, &chunks[count], prefetched) < 0) {
             set_exception_cause(unwinder, PyExc_RuntimeError, "Failed to process stack chunk");
             goto error;
         }
@@ -122,6 +142,7 @@ copy_stack_chunks(RemoteUnwinderObject *unwinder,
         count++;
     }
 
+    PyMem_RawFree(first_chunk);  // unused if chunk_addr was 0
     out_chunks->chunks = chunks;
     out_chunks->count = count;
     return 0;
@@ -206,6 +227,20 @@ parse_frame_object(
     STATS_INC(unwinder, memory_reads);
     STATS_ADD(unwinder, memory_bytes_read, SIZEOF_INTERP_FRAME);
 
+    return parse_frame_copy(unwinder, result, frame, address_of_code_object, previous_frame);
+}
+
+// Like parse_frame_object(), for a frame already copied from the remote
+// process.
+int
+parse_frame_copy(
+    RemoteUnwinderObject *unwinder,
+    PyObject** result,
+    const char *frame,
+    uintptr_t* address_of_code_object,
+    uintptr_t* previous_frame
+) {
+    *address_of_code_object = 0;
     *previous_frame = GET_MEMBER(uintptr_t, frame, unwinder->debug_offsets.interpreter_frame.previous);
     uintptr_t code_object = GET_MEMBER_NO_TAG(uintptr_t, frame, unwinder->debug_offsets.interpreter_frame.executable);
     int frame_valid = is_frame_valid(unwinder, (uintptr_t)frame, code_object);
@@ -307,7 +342,14 @@ process_frame_chain(
         }
         assert(frame_count <= MAX_FRAMES);
 
-        if (parse_frame_from_chunks(unwinder, &frame, frame_addr, &next_frame_addr, &stackpointer, ctx->chunks) < 0) {
+        if (frame_count == 1 && ctx->frame_copy) {
+            uintptr_t address_of_code_object = 0;
+            if (parse_frame_copy(unwinder, &frame, ctx->frame_copy, &address_of_code_object, &next_frame_addr) < 0) {
+                set_exception_cause(unwinder, PyExc_RuntimeError, "Failed to parse frame object in chain");
+                return -1;
+            }
+        }
+        else if (parse_frame_from_chunks(unwinder, &frame, frame_addr, &next_frame_addr, &stackpointer, ctx->chunks) < 0) {
             PyErr_Clear();
             uintptr_t address_of_code_object = 0;
             if (parse_frame_object(unwinder, &frame, frame_addr, &address_of_code_object, &next_frame_addr) < 0) {
@@ -494,8 +536,15 @@ try_full_cache_hit(
     PyObject *current_frame = NULL;
     uintptr_t code_object_addr = 0;
     uintptr_t previous_frame = 0;
-    int parse_result = parse_frame_object(unwinder, &current_frame, ctx->frame_addr,
+    int parse_result;
+    if (ctx->frame_copy) {
+        parse_result = parse_frame_copy(unwinder, &current_frame, ctx->frame_copy,
+                                        &code_object_addr, &previous_frame);
+    }
+    else {
+        parse_result = parse_frame_object(unwinder, &current_frame, ctx->frame_addr,
                                           &code_object_addr, &previous_frame);
+    }
     if (parse_result < 0) {
         return -1;
     }
@@ -131,6 +131,23 @@ PyStructSequence_Desc AwaitedInfo_desc = {
     2
 };
 
+// AllocationSample structseq type
+static PyStructSequence_Field AllocationSample_fields[] = {
+    {"thread_id", "Thread ID of the allocating thread"},
+    {"interpreter_id", "Interpreter ID of the allocating thread"},
+    {"size", "Size in bytes of the sampled allocation"},
+    {"weight", "Number of sampling intervals the allocation accounts for"},
+    {"frame_info", "Frame information, most recent first"},
+    {NULL}
+};
+
+PyStructSequence_Desc AllocationSample_desc = {
+    "_remote_debugging.AllocationSample",
+    "Information about a sampled memory allocation",
+    AllocationSample_fields,
+    5
+};
+
 /* ============================================================================
  * UTILITY FUNCTIONS
  * ============================================================================ */
@@ -269,6 +286,7 @@ _remote_debugging.RemoteUnwinder.__init__
     opcodes: bool = False
     cache_frames: bool = False
     stats: bool = False
+    workers: int = 0
 
 Initialize a new RemoteUnwinder object for debugging a remote Python process.
 
@@ -293,6 +311,9 @@ Initialize a new RemoteUnwinder object for debugging a remote Python process.
                  unchanged parent frames between samples.
     stats: If True, collect statistics about cache hits, memory reads, etc.
            Use get_stats() to retrieve the collected statistics.
+    workers: Number of helper threads that split the remote memory reads
+             of different threads between them when sampling all threads.
+             0 does all reads on the calling thread.
 
 The RemoteUnwinder provides functionality to inspect and debug a running Python
 process, including examining thread states, stack frames and other runtime data.
@@ -301,7 +322,8 @@ process, including examining thread states, stack frames and other runtime data.
     PermissionError: If access to the target process is denied
     OSError: If unable to attach to the target process or access its memory
     RuntimeError: If unable to read debug information from the target process
-    ValueError: If both all_threads and only_active_thread are True
+    ValueError: If both all_threads and only_active_thread are True, or
+                if workers is out of range
 [clinic start generated code]*/
 
 static int
@@ -312,8 +334,8 @@ _remote_debugging_RemoteUnwinder___init___impl(RemoteUnwinderObject *self,
                                                int skip_non_matching_threads,
                                                int native, int gc,
                                                int opcodes, int cache_frames,
-                                               int stats)
-/*[clinic end generated code: output=0031f743f4b9ad52 input=8fb61b24102dec6e]*/
+                                               int stats, int workers)
+/*[clinic end generated code: output=d00e7b4ae7eafff5 input=6c2d6cbdb1f45cb3]*/
 {
     // Validate that all_threads and only_active_thread are not both True
     if (all_threads && only_active_thread) {
@@ -330,6 +352,12 @@ _remote_debugging_RemoteUnwinder___init___impl(RemoteUnwinderObject *self,
     }
 #endif
 
+    if (workers < 0 || workers > MAX_READ_WORKERS) {
+        PyErr_Format(PyExc_ValueError,
+                     "workers must be between 0 and %d", MAX_READ_WORKERS);
+        return -1;
+    }
+
     self->native = native;
     self->gc = gc;
     self->opcodes = opcodes;
@@ -342,6 +370,7 @@ _remote_debugging_RemoteUnwinder___init___impl(RemoteUnwinderObject *self,
     self->skip_non_matching_threads = skip_non_matching_threads;
     self->cached_state = NULL;
     self->frame_cache = NULL;
+    self->workers = workers;
 #ifdef Py_REMOTE_DEBUG_SUPPORTS_BLOCKING
     self->threads_stopped = 0;
 #endif
@@ -387,6 +416,13 @@ _remote_debugging_RemoteUnwinder___init___impl(RemoteUnwinderObject *self,
         return -1;
     }
 
+    // Only report the allocation samples recorded from now on
+    self->alloc_samples_read = 0;
+    if (read_allocation_write_index(self, &self->alloc_samples_read) < 0) {
+        PyErr_Clear();
+        self->alloc_samples_read = 0;
+    }
+
     self->code_object_cache = _Py_hashtable_new_full(
         _Py_hashtable_hash_ptr,
         _Py_hashtable_compare_direct,
@@ -503,6 +539,13 @@ _remote_debugging_RemoteUnwinder_get_stack_trace_impl(RemoteUnwinderObject *self
         return NULL;
     }
 
+    // Read the thread states in batches unless only one thread is sampled
+    int use_snapshots = !self->tstate_addr && !self->only_active_thread;
+    if (use_snapshots && thread_snapshots_begin(self) < 0) {
+        Py_CLEAR(result);
+        goto exit;
+    }
+
     // Iterate over all interpreters
     uintptr_t current_interpreter = self->interpreter_addr;
     while (current_interpreter != 0) {
@@ -583,11 +626,27 @@ _remote_debugging_RemoteUnwinder_get_stack_trace_impl(RemoteUnwinderObject *self
             current_tstate = self->tstate_addr;
         }
 
+        size_t snapshot_index = 0;
+        if (use_snapshots
+            && thread_snapshots_collect(self, current_tstate, &snapshot_index) < 0)
+        {
+            Py_DECREF(interpreter_threads);
+            set_exception_cause(self, PyExc_RuntimeError, "Failed to read thread states");
+            Py_CLEAR(result);
+            goto exit;
+        }
+
         while (current_tstate != 0) {
             uintptr_t prev_tstate = current_tstate;
+            ThreadSnapshot *snapshot = NULL;
+            if (use_snapshots && snapshot_index < self->snapshots.num_cur
+                && self->snapshots.cur[snapshot_index].tstate_addr == current_tstate)
+            {
+                snapshot = &self->snapshots.cur[snapshot_index++];
+            }
             PyObject* frame_info = unwind_stack_for_thread(self, &current_tstate,
                                                            gil_holder_tstate,
-                                                           gc_frame);
+                                                           gc_frame, snapshot);
             if (!frame_info) {
                 // Check if this was an intentional skip due to mode-based filtering
                 if ((self->mode == PROFILING_MODE_CPU || self->mode == PROFILING_MODE_GIL ||
@@ -843,6 +902,37 @@ _remote_debugging_RemoteUnwinder_get_async_stack_trace_impl(RemoteUnwinderObject
     return NULL;
 }
 
+/*[clinic input]
+@permit_long_docstring_body
+@critical_section
+_remote_debugging.RemoteUnwinder.get_allocation_samples
+
+Return the memory allocations sampled by the target process.
+
+Allocation sampling must be enabled in the target process with
+sys._set_allocation_sampling(). Each call returns the samples recorded
+since the previous call (or since the RemoteUnwinder was created), as a
+list of AllocationSample(thread_id, interpreter_id, size, weight, frame_info)
+where frame_info has the same format as in get_stack_trace() and weight is
+the number of sampling intervals the allocation accounts for.
+
+The target process keeps a bounded number of samples: samples are lost if
+this method is not called often enough. Samples whose code objects were
+freed in the meantime are skipped.
+
+Raises:
+    RuntimeError: If there is an error copying memory from the target process
+    OSError: If there is an error accessing the target process
+    PermissionError: If access to the target process is denied
+[clinic start generated code]*/
+
+static PyObject *
+_remote_debugging_RemoteUnwinder_get_allocation_samples_impl(RemoteUnwinderObject *self)
+/*[clinic end generated code: output=a288f44d9f753513 input=b6eb7381abf5bc3c]*/
+{
+    return read_allocation_samples(self);
+}
+
 /*[clinic input]
 @permit_long_docstring_body
 @critical_section
@@ -1020,6 +1110,7 @@ static PyMethodDef RemoteUnwinder_methods[] = {
     _REMOTE_DEBUGGING_REMOTEUNWINDER_GET_STACK_TRACE_METHODDEF
     _REMOTE_DEBUGGING_REMOTEUNWINDER_GET_ALL_AWAITED_BY_METHODDEF
     _REMOTE_DEBUGGING_REMOTEUNWINDER_GET_ASYNC_STACK_TRACE_METHODDEF
+    _REMOTE_DEBUGGING_REMOTEUNWINDER_GET_ALLOCATION_SAMPLES_METHODDEF
     _REMOTE_DEBUGGING_REMOTEUNWINDER_GET_STATS_METHODDEF
     _REMOTE_DEBUGGING_REMOTEUNWINDER_PAUSE_THREADS_METHODDEF
     _REMOTE_DEBUGGING_REMOTEUNWINDER_RESUME_THREADS_METHODDEF
@@ -1063,6 +1154,9 @@ RemoteUnwinder_dealloc(PyObject *op)
         _Py_RemoteDebug_ClearCache(&self->handle);
         _Py_RemoteDebug_CleanupProcHandle(&self->handle);
     }
+    read_pool_free(self->read_pool);
+    self->read_pool = NULL;
+    thread_snapshots_clear(&self->snapshots);
     frame_cache_cleanup(self);
     PyObject_Del(self);
     Py_DECREF(tp);
@@ -1169,6 +1263,14 @@ _remote_debugging_exec(PyObject *m)
         return -1;
     }
 
+    st->AllocationSample_Type = PyStructSequence_NewType(&AllocationSample_desc);
+    if (st->AllocationSample_Type == NULL) {
+        return -1;
+    }
+    if (PyModule_AddType(m, st->AllocationSample_Type) < 0) {
+        return -1;
+    }
+
     // Create BinaryWriter and BinaryReader types
     CREATE_TYPE(m, st->BinaryWriter_Type, &BinaryWriter_spec);
     if (PyModule_AddType(m, st->BinaryWriter_Type) < 0) {
@@ -1223,6 +1325,7 @@ remote_debugging_traverse(PyObject *mod, visitproc visit, void *arg)
     Py_VISIT(state->ThreadInfo_Type);
     Py_VISIT(state->InterpreterInfo_Type);
     Py_VISIT(state->AwaitedInfo_Type);
+    Py_VISIT(state->AllocationSample_Type);
     Py_VISIT(state->BinaryWriter_Type);
     Py_VISIT(state->BinaryReader_Type);
     return 0;
@@ -1240,6 +1343,7 @@ remote_debugging_clear(PyObject *mod)
     Py_CLEAR(state->ThreadInfo_Type);
     Py_CLEAR(state->InterpreterInfo_Type);
     Py_CLEAR(state->AwaitedInfo_Type);
+    Py_CLEAR(state->AllocationSample_Type);
     Py_CLEAR(state->BinaryWriter_Type);
     Py_CLEAR(state->BinaryReader_Type);
     return 0;
@@ -1270,6 +1374,7 @@ _remote_debugging.BinaryWriter.__init__
     start_time_us: unsigned_long_long
     *
     compression: int = 0
+    bucket_us: unsigned_long_long = 0
 
 High-performance binary writer for profiling data.
 
@@ -1278,6 +1383,9 @@ High-performance binary writer for profiling data.
     sample_interval_us: Sampling interval in microseconds
     start_time_us: Start timestamp in microseconds (from time.monotonic() * 1e6)
     compression: 0=none, 1=zstd (default: 0)
+    bucket_us: If non-zero, aggregate samples in memory and write how many
+        samples each distinct stack received per time bucket of this many
+        microseconds, instead of every sample (default: 0)
 
 Use as a context manager or call finalize() when done.
 [clinic start generated code]*/
@@ -1287,14 +1395,16 @@ _remote_debugging_BinaryWriter___init___impl(BinaryWriterObject *self,
                                              const char *filename,
                                              unsigned long long sample_interval_us,
                                              unsigned long long start_time_us,
-                                             int compression)
-/*[clinic end generated code: output=014c0306f1bacf4b input=3bdf01c1cc2f5a1d]*/
+                                             int compression,
+                                             unsigned long long bucket_us)
+/*[clinic end generated code: output=6bb7dde36da9bbba input=9fa5c183fbdee94a]*/
 {
     if (self->writer) {
         binary_writer_destroy(self->writer);
     }
 
-    self->writer = binary_writer_create(filename, sample_interval_us, compression, start_time_us);
+    self->writer = binary_writer_create(filename, sample_interval_us, compression,
+                                        start_time_us, bucket_us);
     if (!self->writer) {
         return -1;
     }
@@ -0,0 +1,155 @@
+/******************************************************************************
+ * Remote Debugging Module - Read Worker Pool
+ *
+ * This file contains a small pool of helper threads that split large batches
+ * of remote memory reads between them.  The workers only issue system calls
+ * and never touch the Python C API.
+ ******************************************************************************/
+
+#include "_remote_debugging.h"
+#include "internal/pycore_pythread.h"   // PyThread_start_joinable_thread()
+
+/* Don't wake a worker for fewer requests than this: one vectored system
+ * call is cheaper than handing the work over to another thread. */
+#define MIN_REQUESTS_PER_WORKER 32
+
+typedef struct {
+    ReadWorkerPool *pool;
+    PyThread_type_lock start;   // released by the caller to hand out work
+    PyThread_type_lock done;    // released by the worker once finished
+    PyThread_handle_t thread;
+    int started;
+    _Py_RemoteDebug_ReadRequest *reqs;
+    size_t count;
+} ReadWorker;
+
+struct ReadWorkerPool {
+    proc_handle_t *handle;
+    int shutdown;
+    int num_workers;
+    ReadWorker workers[1];
+};
+
+static void
+read_worker_main(void *arg)
+{
+    ReadWorker *worker = (ReadWorker *)arg;
+    for (;;) {
+        PyThread_acquire_lock(worker->start, WAIT_LOCK);
+        if (worker->pool->shutdown) {
+            break;
+        }
+        _Py_RemoteDebug_ReadRemoteMemoryBatch(worker->pool->handle,
+                                              worker->reqs, worker->count);
+        PyThread_release_lock(worker->done);
+    }
+}
+
+static void
+read_worker_clear(ReadWorker *worker)
+{
+    if (worker->start) {
+        PyThread_free_lock(worker->start);
+        worker->start = NULL;
+    }
+    if (worker->done) {
+        PyThread_free_lock(worker->done);
+        worker->done = NULL;
+    }
+}
+
+static int
+read_worker_start(ReadWorkerPool *pool, ReadWorker *worker)
+{
+    worker->pool = pool;
+    worker->start = PyThread_allocate_lock();
+    worker->done = PyThread_allocate_lock();
+    if (worker->start == NULL || worker->done == NULL) {
+        read_worker_clear(worker);
+        PyErr_NoMemory();
+        return -1;
+    }
+    // Both locks start out held: the worker blocks on "start" until it is
+    // given work, and the caller blocks on "done" until it is finished.
+    PyThread_acquire_lock(worker->start, WAIT_LOCK);
+    PyThread_acquire_lock(worker->done, WAIT_LOCK);
+
+    PyThread_ident_t ident;
+    if (PyThread_start_joinable_thread(read_worker_main, worker,
+                                       &ident, &worker->thread) < 0) {
+        read_worker_clear(worker);
+        PyErr_SetString(PyExc_RuntimeError, "can't start read worker thread");
+        return -1;
+    }
+    worker->started = 1;
+    return 0;
+}
+
+ReadWorkerPool *
+read_pool_new(proc_handle_t *handle, int num_workers)
+{
+    assert(num_workers > 0);
+    size_t size = sizeof(ReadWorkerPool) + (num_workers - 1) * sizeof(ReadWorker);
+    ReadWorkerPool *pool = PyMem_RawCalloc(1, size);
+    if (pool == NULL) {
+        PyErr_NoMemory();
+        return NULL;
+    }
+    pool->handle = handle;
+    for (int i = 0; i < num_workers; i++) {
+        if (read_worker_start(pool, &pool->workers[i]) < 0) {
+            read_pool_free(pool);
+            return NULL;
+        }
+        pool->num_workers++;
+    }
+    return pool;
+}
+
+void
+read_pool_free(ReadWorkerPool *pool)
+{
+    if (pool == NULL) {
+        return;
+    }
+    pool->shutdown = 1;
+    for (int i = 0; i < pool->num_workers; i++) {
+        ReadWorker *worker = &pool->workers[i];
+        if (worker->started) {
+            PyThread_release_lock(worker->start);
+            PyThread_join_thread(worker->thread);
+        }
+        read_worker_clear(worker);
+    }
+    PyMem_RawFree(pool);
+}
+
+void
+read_pool_run(ReadWorkerPool *pool, _Py_RemoteDebug_ReadRequest *reqs,
+              size_t count)
+{
+    size_t parts = (size_t)pool->num_workers + 1;
+    if (count / MIN_REQUESTS_PER_WORKER < parts) {
+        parts = count / MIN_REQUESTS_PER_WORKER;
+    }
+    if (parts <= 1) {
+        _Py_RemoteDebug_ReadRemoteMemoryBatch(pool->handle, reqs, count);
+        return;
+    }
+
+    // The calling thread reads the first slice itself.  It keeps its
+    // thread state attached while it waits: the workers never need it,
+    // and detaching would let another thread use this unwinder meanwhile.
+    size_t per_part = (count + parts - 1) / parts;
+    size_t dispatched = 0;
+    for (size_t start = per_part; start < count; start += per_part) {
+        ReadWorker *worker = &pool->workers[dispatched++];
+        worker->reqs = reqs + start;
+        worker->count = Py_MIN(per_part, count - start);
+        PyThread_release_lock(worker->start);
+    }
+    _Py_RemoteDebug_ReadRemoteMemoryBatch(pool->handle, reqs, per_part);
+    for (size_t i = 0; i < dispatched; i++) {
+        PyThread_acquire_lock(pool->workers[i].done, WAIT_LOCK);
+    }
+}
@@ -270,6 +270,269 @@ get_thread_status(RemoteUnwinderObject *unwinder, uint64_t tid, uint64_t pthread
 #endif
 }
 
+/* ============================================================================
+ * BATCHED THREAD STATE READS
+ *
+ * Walking the thread list one read at a time costs a system call per thread
+ * state, and another one per current frame or stack chunk.  Instead, the
+ * thread states seen in the previous sample are read in one batch when a
+ * sample starts, and the thread list is then walked through these copies,
+ * falling back to single reads for threads that were not seen before.  The
+ * current frames (or topmost stack chunks) of all threads found are read in
+ * a second batch.  With workers > 0 the batches are split between helper
+ * threads.
+ * ============================================================================ */
+
+// Make room for at least min_capacity entries in the snapshot arrays
+static int
+thread_snapshots_reserve(ThreadSnapshots *snaps, size_t min_capacity)
+{
+    if (min_capacity <= snaps->capacity) {
+        return 0;
+    }
+    size_t capacity = snaps->capacity ? snaps->capacity * 2 : 64;
+    while (capacity < min_capacity) {
+        capacity *= 2;
+    }
+
+    ThreadSnapshot *cur = PyMem_RawRealloc(snaps->cur, capacity * sizeof(ThreadSnapshot));
+    if (cur == NULL) {
+        goto error;
+    }
+    snaps->cur = cur;
+    ThreadSnapshot *prev = PyMem_RawRealloc(snaps->prev, capacity * sizeof(ThreadSnapshot));
+    if (prev == NULL) {
+        goto error;
+    }
+    snaps->prev = prev;
+    _Py_RemoteDebug_ReadRequest *reqs = PyMem_RawRealloc(
+        snaps->reqs, capacity * sizeof(_Py_RemoteDebug_ReadRequest));
+    if (reqs == NULL) {
+        goto error;
+    }
+    snaps->reqs = reqs;
+
+    size_t added = capacity - snaps->capacity;
+    memset(snaps->cur + snaps->capacity, 0, added * sizeof(ThreadSnapshot));
+    memset(snaps->prev + snaps->capacity, 0, added * sizeof(ThreadSnapshot));
+    snaps->capacity = capacity;
+    return 0;
+
+error:
+    PyErr_NoMemory();
+    return -1;
+}
+
+void
+thread_snapshots_clear(ThreadSnapshots *snaps)
+{
+    for (size_t i = 0; i < snaps->capacity; i++) {
+        PyMem_RawFree(snaps->cur[i].data);
+        PyMem_RawFree(snaps->cur[i].chunk);
+        PyMem_RawFree(snaps->prev[i].data);
+        PyMem_RawFree(snaps->prev[i].chunk);
+    }
+    PyMem_RawFree(snaps->cur);
+    PyMem_RawFree(snaps->prev);
+    PyMem_RawFree(snaps->reqs);
+    memset(snaps, 0, sizeof(*snaps));
+}
+
+static int
+read_batch(RemoteUnwinderObject *unwinder, _Py_RemoteDebug_ReadRequest *reqs, size_t count)
+{
+    if (count == 0) {
+        return 0;
+    }
+    if (unwinder->workers > 0) {
+        if (unwinder->read_pool == NULL) {
+            unwinder->read_pool = read_pool_new(&unwinder->handle, unwinder->workers);
+            if (unwinder->read_pool == NULL) {
+                set_exception_cause(unwinder, PyExc_RuntimeError, "Failed to start read workers");
+                return -1;
+            }
+        }
+        read_pool_run(unwinder->read_pool, reqs, count);
+    }
+    else {
+        _Py_RemoteDebug_ReadRemoteMemoryBatch(&unwinder->handle, reqs, count);
+    }
+    if (unwinder->collect_stats) {
+        for (size_t i = 0; i < count; i++) {
+            unwinder->stats.memory_reads++;
+            unwinder->stats.memory_bytes_read += reqs[i].ok ? reqs[i].len : 0;
+        }
+    }
+    return 0;
+}
+
+static inline size_t
+thread_state_read_size(RemoteUnwinderObject *unwinder)
+{
+    return Py_MIN((size_t)unwinder->debug_offsets.thread_state.size, SIZEOF_THREAD_STATE);
+}
+
+// Start a new sample: read the thread states of the previous sample, which
+// are the best guess for this sample's thread list.
+int
+thread_snapshots_begin(RemoteUnwinderObject *unwinder)
+{
+    ThreadSnapshots *snaps = &unwinder->snapshots;
+    ThreadSnapshot *tmp = snaps->prev;
+    snaps->prev = snaps->cur;
+    snaps->cur = tmp;
+    snaps->num_prev = snaps->num_cur;
+    snaps->num_cur = 0;
+    snaps->cursor = 0;
+
+    size_t size = thread_state_read_size(unwinder);
+    for (size_t i = 0; i < snaps->num_prev; i++) {
+        ThreadSnapshot *snap = &snaps->prev[i];
+        snaps->reqs[i] = (_Py_RemoteDebug_ReadRequest){
+            .remote_address = snap->tstate_addr,
+            .len = size,
+            .dst = snap->data,
+        };
+    }
+    if (read_batch(unwinder, snaps->reqs, snaps->num_prev) < 0) {
+        return -1;
+    }
+    for (size_t i = 0; i < snaps->num_prev; i++) {
+        snaps->prev[i].has_tstate = snaps->reqs[i].ok;
+    }
+    return 0;
+}
+
+// Find the speculatively read copy of the thread state at tstate_addr.
+// Threads usually appear in the same order as in the previous sample, so
+// the search resumes after the last match.
+static ThreadSnapshot *
+find_prefetched_thread(ThreadSnapshots *snaps, uintptr_t tstate_addr)
+{
+    for (size_t i = snaps->cursor; i < snaps->num_prev; i++) {
+        ThreadSnapshot *snap = &snaps->prev[i];
+        if (snap->tstate_addr == tstate_addr) {
+            if (!snap->has_tstate) {
+                return NULL;
+            }
+            snaps->cursor = i + 1;
+            return snap;
+        }
+    }
+    return NULL;
+}
+
+// Read the thread states of the thread list starting at head, then the
+// current frame (with frame caching) or the topmost stack chunk (without)
+// of each of those threads.  The new snapshots are appended to
+// unwinder->snapshots.cur starting at index *first.
+int
+thread_snapshots_collect(RemoteUnwinderObject *unwinder, uintptr_t head, size_t *first)
+{
+    ThreadSnapshots *snaps = &unwinder->snapshots;
+    size_t size = thread_state_read_size(unwinder);
+    const size_t MAX_THREADS = 8192;
+    size_t thread_count = 0;
+
+    *first = snaps->num_cur;
+    uintptr_t tstate_addr = head;
+    while (tstate_addr != 0 && thread_count < MAX_THREADS) {
+        thread_count++;
+        if (thread_snapshots_reserve(snaps, snaps->num_cur + 1) < 0) {
+            set_exception_cause(unwinder, PyExc_MemoryError, "Failed to grow thread snapshots");
+            return -1;
+        }
+        ThreadSnapshot *snap = &snaps->cur[snaps->num_cur];
+        ThreadSnapshot *prefetched = find_prefetched_thread(snaps, tstate_addr);
+        if (prefetched != NULL) {
+            // Swap the entries so that every buffer keeps exactly one owner
+            ThreadSnapshot tmp = *snap;
+            *snap = *prefetched;
+            *prefetched = tmp;
+            prefetched->tstate_addr = 0;
+            prefetched->has_tstate = 0;
+        }
+        else {
+            if (snap->data == NULL) {
+                snap->data = PyMem_RawMalloc(SIZEOF_THREAD_STATE + SIZEOF_INTERP_FRAME);
+                if (snap->data == NULL) {
+                    PyErr_NoMemory();
+                    set_exception_cause(unwinder, PyExc_MemoryError, "Failed to allocate thread snapshot");
+                    return -1;
+                }
+            }
+            if (_Py_RemoteDebug_PagedReadRemoteMemory(&unwinder->handle, tstate_addr,
+                                                      size, snap->data) < 0) {
+                set_exception_cause(unwinder, PyExc_RuntimeError, "Failed to read thread state");
+                return -1;
+            }
+            STATS_INC(unwinder, memory_reads);
+            STATS_ADD(unwinder, memory_bytes_read, size);
+            snap->tstate_addr = tstate_addr;
+            snap->has_tstate = 1;
+        }
+        snap->has_frame = 0;
+        snap->has_chunk = 0;
+        snaps->num_cur++;
+        tstate_addr = GET_MEMBER(uintptr_t, snap->data,
+                                 unwinder->debug_offsets.thread_state.next);
+    }
+
+    // Read the frames (or stack chunks) the unwinding will start from
+    size_t count = 0;
+    for (size_t i = *first; i < snaps->num_cur; i++) {
+        ThreadSnapshot *snap = &snaps->cur[i];
+        if (unwinder->cache_frames) {
+            uintptr_t frame_addr = GET_MEMBER(uintptr_t, snap->data,
+                unwinder->debug_offsets.thread_state.current_frame);
+            if (frame_addr == 0) {
+                continue;
+            }
+            snaps->reqs[count++] = (_Py_RemoteDebug_ReadRequest){
+                .remote_address = frame_addr,
+                .len = SIZEOF_INTERP_FRAME,
+                .dst = snap->data + SIZEOF_THREAD_STATE,
+            };
+        }
+        else {
+            uintptr_t chunk_addr = GET_MEMBER(uintptr_t, snap->data,
+                unwinder->debug_offsets.thread_state.datastack_chunk);
+            if (chunk_addr == 0) {
+                continue;
+            }
+            if (snap->chunk == NULL) {
+                snap->chunk = PyMem_RawMalloc(_PY_DATA_STACK_CHUNK_SIZE);
+                if (snap->chunk == NULL) {
+                    PyErr_NoMemory();
+                    set_exception_cause(unwinder, PyExc_MemoryError, "Failed to allocate stack chunk buffer");
+                    return -1;
+                }
+            }
+            snaps->reqs[count++] = (_Py_RemoteDebug_ReadRequest){
+                .remote_address = chunk_addr,
+                .len = _PY_DATA_STACK_CHUNK_SIZE,
+                .dst = snap->chunk,
+            };
+        }
+    }
+    if (read_batch(unwinder, snaps->reqs, count) < 0) {
+        return -1;
+    }
+    _Py_RemoteDebug_ReadRequest *req = snaps->reqs;
+    for (size_t i = *first; i < snaps->num_cur; i++) {
+        ThreadSnapshot *snap = &snaps->cur[i];
+        if (unwinder->cache_frames) {
+            if (req < snaps->reqs + count && req->dst == snap->data + SIZEOF_THREAD_STATE) {
+                snap->has_frame = (req++)->ok;
+            }
+        }
+        else if (req < snaps->reqs + count && req->dst == snap->chunk) {
+            snap->has_chunk = (req++)->ok;
+        }
+    }
+    return 0;
+}
+
 /* ============================================================================
  * STACK UNWINDING FUNCTIONS
  * ============================================================================ */
@@ -291,22 +554,30 @@ unwind_stack_for_thread(
     RemoteUnwinderObject *unwinder,
     uintptr_t *current_tstate,
     uintptr_t gil_holder_tstate,
-    uintptr_t gc_frame
+    uintptr_t gc_frame,
+    ThreadSnapshot *snapshot
 ) {
     PyObject *frame_info = NULL;
     PyObject *thread_id = NULL;
     PyObject *result = NULL;
     StackChunkList chunks = {0};
 
-    char ts[SIZEOF_THREAD_STATE];
-    int bytes_read = _Py_RemoteDebug_PagedReadRemoteMemory(
-        &unwinder->handle, *current_tstate, (size_t)unwinder->debug_offsets.thread_state.size, ts);
-    if (bytes_read < 0) {
-        set_exception_cause(unwinder, PyExc_RuntimeError, "Failed to read thread state");
-        goto error;
+    char ts_buffer[SIZEOF_THREAD_STATE];
+    char *ts = ts_buffer;
+    if (snapshot != NULL) {
+        assert(snapshot->tstate_addr == *current_tstate && snapshot->has_tstate);
+        ts = snapshot->data;
+    }
+    else {
+        int bytes_read = _Py_RemoteDebug_PagedReadRemoteMemory(
+            &unwinder->handle, *current_tstate, (size_t)unwinder->debug_offsets.thread_state.size, ts);
+        if (bytes_read < 0) {
+            set_exception_cause(unwinder, PyExc_RuntimeError, "Failed to read thread state");
+            goto error;
+        }
+        STATS_INC(unwinder, memory_reads);
+        STATS_ADD(unwinder, memory_bytes_read, unwinder->debug_offsets.thread_state.size);
     }
-    STATS_INC(unwinder, memory_reads);
-    STATS_ADD(unwinder, memory_bytes_read, unwinder->debug_offsets.thread_state.size);
 
     long tid = GET_MEMBER(long, ts, unwinder->debug_offsets.thread_state.native_thread_id);
 
@@ -427,7 +698,18 @@ unwind_stack_for_thread(
     }
 
     // In cache mode, copying stack chunks is more expensive than direct memory reads
-    if (!unwinder->cache_frames) {
+    if (!unwinder->cache_frames && snapshot != NULL && snapshot->has_chunk) {
+        uintptr_t chunk_addr = GET_MEMBER(uintptr_t, ts,
+            unwinder->debug_offsets.thread_state.datastack_chunk);
+        char *first_chunk = snapshot->chunk;
+        snapshot->chunk = NULL;
+        snapshot->has_chunk = 0;
+        if (copy_stack_chunks_from(unwinder, chunk_addr, first_chunk, &chunks) < 0) {
+            set_exception_cause(unwinder, PyExc_RuntimeError, "Failed to copy stack chunks");
+            goto error;
+        }
+    }
+    else if (!unwinder->cache_frames) {
         if (copy_stack_chunks(unwinder, *current_tstate, &chunks) < 0) {
             set_exception_cause(unwinder, PyExc_RuntimeError, "Failed to copy stack chunks");
             goto error;
@@ -444,6 +726,7 @@ unwind_stack_for_thread(
         .frame_addrs = addrs,
         .num_addrs = 0,
         .max_addrs = FRAME_CACHE_MAX_FRAMES,
+        .frame_copy = snapshot != NULL ? SNAPSHOT_FRAME(snapshot) : NULL,
     };
     assert(ctx.max_addrs == FRAME_CACHE_MAX_FRAMES);
 
@@ -455,12 +738,15 @@ unwind_stack_for_thread(
             set_exception_cause(unwinder, PyExc_RuntimeError, "Failed to collect frames");
             goto error;
         }
-        // Update last_profiled_frame for next sample
-        uintptr_t lpf_addr =
-            *current_tstate + (uintptr_t)unwinder->debug_offsets.thread_state.last_profiled_frame;
-        if (_Py_RemoteDebug_WriteRemoteMemory(&unwinder->handle, lpf_addr,
-                                              sizeof(uintptr_t), &frame_addr) < 0) {
-            PyErr_Clear();  // Non-fatal
+        // Update last_profiled_frame for next sample, unless the thread is
+        // still in the same frame (typical for idle threads)
+        if (frame_addr != ctx.last_profiled_frame) {
+            uintptr_t lpf_addr =
+                *current_tstate + (uintptr_t)unwinder->debug_offsets.thread_state.last_profiled_frame;
+            if (_Py_RemoteDebug_WriteRemoteMemory(&unwinder->handle, lpf_addr,
+                                                  sizeof(uintptr_t), &frame_addr) < 0) {
+                PyErr_Clear();  // Non-fatal
+            }
         }
     } else {
         // No caching - process entire frame chain with base_frame validation
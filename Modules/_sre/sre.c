@@ -39,6 +39,7 @@ static const char copyright[] =
     " SRE 2.2.2 Copyright (c) 1997-2002 by Secret Labs AB ";
 
 #include "Python.h"
+#include "pycore_bytesobject.h"     // _PyBytes_Find()
 #include "pycore_critical_section.h" // Py_BEGIN_CRITICAL_SECTION
 #include "pycore_dict.h"             // _PyDict_Next()
 #include "pycore_long.h"             // _PyLong_GetZero()
@@ -348,6 +349,40 @@ repeat_pool_clear(SRE_STATE *state)
     }
 }
 
+/* work area for patterns compiled with re.LINEAR, see SRE(linear).
+   a thread is a program counter plus its own copy of the match start
+   (caps[0]), the group marks (caps[1:]) and lastindex. */
+typedef struct {
+    Py_ssize_t count;
+    Py_ssize_t* pc;
+    Py_ssize_t* lastindex;
+    const void** caps;
+} SRE_LINEAR_THREADS;
+
+typedef struct {
+    Py_ssize_t pc; /* instruction to follow, or -1 to restore a mark */
+    Py_ssize_t index;
+    Py_ssize_t lastindex;
+    const void* value;
+} SRE_LINEAR_JOB;
+
+typedef struct {
+    Py_ssize_t ncaps;
+    SRE_LINEAR_THREADS threads[2];
+    Py_ssize_t* onlist; /* position at which each instruction was last
+                           added to a thread list, plus one */
+    SRE_LINEAR_JOB* jobs;
+    /* captures of the thread being followed */
+    const void** caps;
+    Py_ssize_t lastindex;
+    /* captures of the preferred match found so far */
+    const void** matched;
+    Py_ssize_t matched_lastindex;
+} SRE_LINEAR;
+
+/* longest part of a required literal that SRE(search) looks for */
+#define SRE_MAXREQUIRED 64
+
 /* generate 8-bit version */
 
 #define SRE_CHAR Py_UCS1
@@ -743,26 +778,122 @@ pattern_dealloc(PyObject *self)
     Py_DECREF(tp);
 }
 
+static Py_ssize_t
+sre_linear(SRE_STATE* state, PatternObject* pattern, int search)
+{
+    const SRE_CODE* code = PatternObject_GetCode(pattern);
+    Py_ssize_t codesize = pattern->codesize;
+    Py_ssize_t nthreads = 0, njobs = 1;
+    Py_ssize_t pc, ncaps;
+    Py_ssize_t status = SRE_ERROR_MEMORY;
+    SRE_LINEAR lin;
+
+    /* every instruction is added at most once per position, so the
+       size of the thread lists and of the job stack is bounded by the
+       number of instructions of each kind (see _validate_linear) */
+    for (pc = 0; pc < codesize; ) {
+        switch (code[pc]) {
+        case SRE_OP_JUMP:
+        case SRE_OP_AT:
+            pc += 2;
+            break;
+        case SRE_OP_BRANCH:
+            njobs++;
+            pc += 3;
+            break;
+        case SRE_OP_MARK:
+            njobs++;
+            pc += 2;
+            break;
+        case SRE_OP_FAILURE:
+            pc += 1;
+            break;
+        case SRE_OP_SUCCESS:
+        case SRE_OP_ANY:
+        case SRE_OP_ANY_ALL:
+            nthreads++;
+            pc += 1;
+            break;
+        case SRE_OP_IN:
+        case SRE_OP_IN_IGNORE:
+        case SRE_OP_IN_UNI_IGNORE:
+        case SRE_OP_IN_LOC_IGNORE:
+            nthreads++;
+            pc += 1 + code[pc+1];
+            break;
+        default:
+            nthreads++;
+            pc += 2;
+            break;
+        }
+    }
+
+    ncaps = 1 + 2 * pattern->groups;
+    memset(&lin, 0, sizeof(lin));
+    lin.ncaps = ncaps;
+    for (int i = 0; i < 2; i++) {
+        lin.threads[i].pc = PyMem_New(Py_ssize_t, nthreads);
+        lin.threads[i].lastindex = PyMem_New(Py_ssize_t, nthreads);
+        lin.threads[i].caps = PyMem_New(const void *, nthreads * ncaps);
+        if (!lin.threads[i].pc || !lin.threads[i].lastindex ||
+            !lin.threads[i].caps)
+            goto exit;
+    }
+    lin.onlist = PyMem_Calloc(codesize, sizeof(Py_ssize_t));
+    lin.jobs = PyMem_New(SRE_LINEAR_JOB, njobs);
+    lin.caps = PyMem_New(const void *, ncaps);
+    lin.matched = PyMem_New(const void *, ncaps);
+    if (!lin.onlist || !lin.jobs || !lin.caps || !lin.matched)
+        goto exit;
+
+    if (state->charsize == 1)
+        status = sre_ucs1_linear(state, &lin, code, search);
+    else if (state->charsize == 2)
+        status = sre_ucs2_linear(state, &lin, code, search);
+    else {
+        assert(state->charsize == 4);
+        status = sre_ucs4_linear(state, &lin, code, search);
+    }
+
+exit:
+    for (int i = 0; i < 2; i++) {
+        PyMem_Free(lin.threads[i].pc);
+        PyMem_Free(lin.threads[i].lastindex);
+        PyMem_Free((void *)lin.threads[i].caps);
+    }
+    PyMem_Free(lin.onlist);
+    PyMem_Free(lin.jobs);
+    PyMem_Free((void *)lin.caps);
+    PyMem_Free((void *)lin.matched);
+    return status;
+}
+
 LOCAL(Py_ssize_t)
-sre_match(SRE_STATE* state, SRE_CODE* pattern)
+sre_match(SRE_STATE* state, PatternObject* pattern)
 {
+    SRE_CODE* code = PatternObject_GetCode(pattern);
+    if (pattern->flags & SRE_FLAG_LINEAR)
+        return sre_linear(state, pattern, 0);
     if (state->charsize == 1)
-        return sre_ucs1_match(state, pattern, 1);
+        return sre_ucs1_match(state, code, 1);
     if (state->charsize == 2)
-        return sre_ucs2_match(state, pattern, 1);
+        return sre_ucs2_match(state, code, 1);
     assert(state->charsize == 4);
-    return sre_ucs4_match(state, pattern, 1);
+    return sre_ucs4_match(state, code, 1);
 }
 
 LOCAL(Py_ssize_t)
-sre_search(SRE_STATE* state, SRE_CODE* pattern)
+sre_search(SRE_STATE* state, PatternObject* pattern)
 {
+    SRE_CODE* code = PatternObject_GetCode(pattern);
+    if (pattern->flags & SRE_FLAG_LINEAR)
+        return sre_linear(state, pattern, 1);
     if (state->charsize == 1)
-        return sre_ucs1_search(state, pattern);
+        return sre_ucs1_search(state, code);
     if (state->charsize == 2)
-        return sre_ucs2_search(state, pattern);
+        return sre_ucs2_search(state, code);
     assert(state->charsize == 4);
-    return sre_ucs4_search(state, pattern);
+    return sre_ucs4_search(state, code);
 }
 
 /*[clinic input]
@@ -796,7 +927,7 @@ _sre_SRE_Pattern_prefixmatch_impl(PatternObject *self, PyTypeObject *cls,
 
     TRACE(("|%p|%p|MATCH\n", PatternObject_GetCode(self), state.ptr));
 
-    status = sre_match(&state, PatternObject_GetCode(self));
+    status = sre_match(&state, self);
 
     TRACE(("|%p|%p|END\n", PatternObject_GetCode(self), state.ptr));
     if (PyErr_Occurred()) {
@@ -842,7 +973,7 @@ _sre_SRE_Pattern_fullmatch_impl(PatternObject *self, PyTypeObject *cls,
     TRACE(("|%p|%p|FULLMATCH\n", PatternObject_GetCode(self), state.ptr));
 
     state.match_all = 1;
-    status = sre_match(&state, PatternObject_GetCode(self));
+    status = sre_match(&state, self);
 
     TRACE(("|%p|%p|END\n", PatternObject_GetCode(self), state.ptr));
     if (PyErr_Occurred()) {
@@ -887,7 +1018,7 @@ _sre_SRE_Pattern_search_impl(PatternObject *self, PyTypeObject *cls,
     INIT_TRACE(&state);
     TRACE(("|%p|%p|SEARCH\n", PatternObject_GetCode(self), state.ptr));
 
-    status = sre_search(&state, PatternObject_GetCode(self));
+    status = sre_search(&state, self);
 
     TRACE(("|%p|%p|END\n", PatternObject_GetCode(self), state.ptr));
 
@@ -938,7 +1069,7 @@ _sre_SRE_Pattern_findall_impl(PatternObject *self, PyObject *string,
 
         state.ptr = state.start;
 
-        status = sre_search(&state, PatternObject_GetCode(self));
+        status = sre_search(&state, self);
         if (PyErr_Occurred())
             goto error;
 
@@ -1103,7 +1234,7 @@ _sre_SRE_Pattern_split_impl(PatternObject *self, PyObject *string,
 
         state.ptr = state.start;
 
-        status = sre_search(&state, PatternObject_GetCode(self));
+        status = sre_search(&state, self);
         if (PyErr_Occurred())
             goto error;
 
@@ -1306,7 +1437,7 @@ pattern_subx(_sremodulestate* module_state,
 
         state.ptr = state.start;
 
-        status = sre_search(&state, PatternObject_GetCode(self));
+        status = sre_search(&state, self);
         if (PyErr_Occurred())
             goto error;
 
@@ -1530,6 +1661,7 @@ pattern_repr(PyObject *self)
         {"re.VERBOSE", SRE_FLAG_VERBOSE},
         {"re.DEBUG", SRE_FLAG_DEBUG},
         {"re.ASCII", SRE_FLAG_ASCII},
+        {"re.LINEAR", SRE_FLAG_LINEAR},
     };
 
     PatternObject *obj = _PatternObject_CAST(self);
@@ -2013,8 +2145,8 @@ _validate_inner(SRE_CODE *code, SRE_CODE *end, Py_ssize_t groups)
             {
                 /* A minimal info field is
                    <INFO> <1=skip> <2=flags> <3=min> <4=max>;
-                   If SRE_INFO_PREFIX or SRE_INFO_CHARSET is in the flags,
-                   more follows. */
+                   If SRE_INFO_REQUIRED, SRE_INFO_PREFIX or
+                   SRE_INFO_CHARSET is in the flags, more follows. */
                 SRE_CODE flags, i;
                 SRE_CODE *newcode;
                 GET_SKIP;
@@ -2025,7 +2157,8 @@ _validate_inner(SRE_CODE *code, SRE_CODE *end, Py_ssize_t groups)
                 /* Check that only valid flags are present */
                 if ((flags & ~(SRE_INFO_PREFIX |
                                SRE_INFO_LITERAL |
-                               SRE_INFO_CHARSET)) != 0)
+                               SRE_INFO_CHARSET |
+                               SRE_INFO_REQUIRED)) != 0)
                     FAIL;
                 /* PREFIX and CHARSET are mutually exclusive */
                 if ((flags & SRE_INFO_PREFIX) &&
@@ -2035,6 +2168,18 @@ _validate_inner(SRE_CODE *code, SRE_CODE *end, Py_ssize_t groups)
                 if ((flags & SRE_INFO_LITERAL) &&
                     !(flags & SRE_INFO_PREFIX))
                     FAIL;
+                /* Validate the required literal */
+                if (flags & SRE_INFO_REQUIRED) {
+                    SRE_CODE required_len, required_min;
+                    GET_ARG; required_len = arg;
+                    GET_ARG; required_min = arg;
+                    GET_ARG;
+                    if (required_len == 0 || required_min > arg)
+                        FAIL;
+                    if (required_len > (uintptr_t)(newcode - code))
+                        FAIL;
+                    code += required_len;
+                }
                 /* Validate the prefix */
                 if (flags & SRE_INFO_PREFIX) {
                     SRE_CODE prefix_len;
@@ -2250,12 +2395,141 @@ _validate_outer(SRE_CODE *code, SRE_CODE *end, Py_ssize_t groups)
     return _validate_inner(code, end-1, groups);
 }
 
+/* Returns 0 on success, -1 on failure, and the length of the
+   instruction otherwise. */
+static int
+_validate_linear_op(SRE_CODE *code, SRE_CODE *end, Py_ssize_t groups,
+                    Py_ssize_t codesize)
+{
+    /* Some variables are manipulated by the macros above */
+    SRE_CODE *start = code;
+    SRE_CODE op;
+    SRE_CODE arg;
+    SRE_CODE skip;
+
+    GET_OP;
+    switch (op) {
+
+    case SRE_OP_MARK:
+        GET_ARG;
+        if (arg >= 2 * (size_t)groups)
+            FAIL;
+        break;
+
+    case SRE_OP_LITERAL:
+    case SRE_OP_NOT_LITERAL:
+    case SRE_OP_LITERAL_IGNORE:
+    case SRE_OP_NOT_LITERAL_IGNORE:
+    case SRE_OP_LITERAL_UNI_IGNORE:
+    case SRE_OP_NOT_LITERAL_UNI_IGNORE:
+    case SRE_OP_LITERAL_LOC_IGNORE:
+    case SRE_OP_NOT_LITERAL_LOC_IGNORE:
+        GET_ARG;
+        break;
+
+    case SRE_OP_SUCCESS:
+    case SRE_OP_FAILURE:
+    case SRE_OP_ANY:
+    case SRE_OP_ANY_ALL:
+        break;
+
+    case SRE_OP_AT:
+        GET_ARG;
+        if (arg > SRE_AT_UNI_NON_BOUNDARY)
+            FAIL;
+        break;
+
+    case SRE_OP_IN:
+    case SRE_OP_IN_IGNORE:
+    case SRE_OP_IN_UNI_IGNORE:
+    case SRE_OP_IN_LOC_IGNORE:
+        GET_SKIP;
+        if (skip < 2)
+            FAIL;
+        if (_validate_charset(code, code+skip-2))
+            FAIL;
+        if (code[skip-2] != SRE_OP_FAILURE)
+            FAIL;
+        code += skip-1;
+        break;
+
+    case SRE_OP_JUMP:
+        GET_ARG;
+        if (arg >= (size_t)codesize)
+            FAIL;
+        break;
+
+    case SRE_OP_BRANCH:
+        GET_ARG;
+        if (arg >= (size_t)codesize)
+            FAIL;
+        GET_ARG;
+        if (arg >= (size_t)codesize)
+            FAIL;
+        break;
+
+    default:
+        FAIL;
+
+    }
+    return (int)(code - start);
+}
+
+static int
+_validate_linear(SRE_CODE *code, Py_ssize_t codesize, Py_ssize_t groups)
+{
+    /* Programs compiled with re.LINEAR (see _compile_linear() in
+       re/_compiler.py) use absolute jump targets, which must point at
+       the start of an instruction, and must not run off the end. */
+    SRE_CODE *end = code + codesize;
+    Py_ssize_t pc, last = -1;
+    char *isop;
+    int n, rc = 0;
+
+    if (groups < 0 || (size_t)groups > SRE_MAXGROUPS || codesize == 0)
+        FAIL;
+    isop = PyMem_Calloc(codesize, 1);
+    if (isop == NULL) {
+        PyErr_NoMemory();
+        return -1;
+    }
+    for (pc = 0; pc < codesize; pc += n) {
+        n = _validate_linear_op(code + pc, end, groups, codesize);
+        if (n < 0) {
+            PyMem_Free(isop);
+            FAIL;
+        }
+        isop[pc] = 1;
+        last = pc;
+    }
+    if (code[last] != SRE_OP_SUCCESS && code[last] != SRE_OP_FAILURE &&
+        code[last] != SRE_OP_JUMP)
+        rc = -1;
+    for (pc = 0; pc < codesize && rc == 0; pc++) {
+        if (!isop[pc])
+            continue;
+        if (code[pc] == SRE_OP_JUMP && !isop[code[pc+1]])
+            rc = -1;
+        if (code[pc] == SRE_OP_BRANCH &&
+            (!isop[code[pc+1]] || !isop[code[pc+2]]))
+            rc = -1;
+    }
+    PyMem_Free(isop);
+    return rc;
+}
+
 static int
 _validate(PatternObject *self)
 {
-    if (_validate_outer(self->code, self->code+self->codesize, self->groups))
-    {
-        PyErr_SetString(PyExc_RuntimeError, "invalid SRE code");
+    int rc;
+    if (self->flags & SRE_FLAG_LINEAR)
+        rc = _validate_linear(self->code, self->codesize, self->groups);
+    else
+        rc = _validate_outer(self->code, self->code+self->codesize,
+                             self->groups);
+    if (rc) {
+        if (!PyErr_Occurred())
+            PyErr_SetString(PyExc_RuntimeError, "invalid SRE code");
         return 0;
     }
     else
@@ -2892,7 +3166,7 @@ _sre_SRE_Scanner_prefixmatch_impl(ScannerObject *self, PyTypeObject *cls)
 
     state->ptr = state->start;
 
-    status = sre_match(state, PatternObject_GetCode(self->pattern));
+    status = sre_match(state, self->pattern);
     if (PyErr_Occurred()) {
         scanner_end(self);
         return NULL;
@@ -2942,7 +3216,7 @@ _sre_SRE_Scanner_search_impl(ScannerObject *self, PyTypeObject *cls)
 
     state->ptr = state->start;
 
-    status = sre_search(state, PatternObject_GetCode(self->pattern));
+    status = sre_search(state, self->pattern);
     if (PyErr_Occurred()) {
         scanner_end(self);
         return NULL;
@@ -11,7 +11,7 @@
  * See the sre.c file for information on usage and redistribution.
  */
 
-#define SRE_MAGIC 20230612
+#define SRE_MAGIC 20261018
 #define SRE_OP_FAILURE 0
 #define SRE_OP_SUCCESS 1
 #define SRE_OP_ANY 2
@@ -93,6 +93,8 @@
 #define SRE_FLAG_VERBOSE 64
 #define SRE_FLAG_DEBUG 128
 #define SRE_FLAG_ASCII 256
+#define SRE_FLAG_LINEAR 512
 #define SRE_INFO_PREFIX 1
 #define SRE_INFO_LITERAL 2
 #define SRE_INFO_CHARSET 4
+#define SRE_INFO_REQUIRED 8
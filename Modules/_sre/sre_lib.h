@@ -1688,6 +1688,50 @@ SRE(match)(SRE_STATE* state, const SRE_CODE* pattern, int toplevel)
 #define RESET_CAPTURE_GROUP() \
     do { state->lastmark = state->lastindex = -1; } while (0)
 
+/* find the first occurrence of needle at or after ptr + offset, using
+   the same substring search as bytes.find() */
+LOCAL(SRE_CHAR*)
+SRE(find_required)(SRE_STATE* state, const SRE_CHAR* needle, Py_ssize_t n,
+                   SRE_CHAR* ptr, Py_ssize_t offset)
+{
+    const char* haystack;
+    Py_ssize_t len, i = 0;
+
+    if (offset > (SRE_CHAR *)state->end - ptr - n)
+        return NULL;
+    haystack = (const char *)(ptr + offset);
+    len = ((SRE_CHAR *)state->end - (ptr + offset)) * sizeof(SRE_CHAR);
+    for (;;) {
+        i = _PyBytes_Find(haystack + i, len - i, (const char *)needle,
+                          n * sizeof(SRE_CHAR), i);
+        if (i < 0)
+            return NULL;
+#if SIZEOF_SRE_CHAR > 1
+        /* the bytes may straddle two characters */
+        if (i % sizeof(SRE_CHAR)) {
+            i++;
+            continue;
+        }
+#endif
+        return (SRE_CHAR *)(haystack + i);
+    }
+}
+
+/* move ptr to the first start position from which a match can reach the
+   next occurrence of the required literal, fail if there is none */
+#define SKIP_TO_REQUIRED() \
+    do { \
+        if (found - ptr < required_min) { \
+            found = SRE(find_required)(state, needle, required_len, \
+                                       ptr, required_min); \
+            if (found == NULL) \
+                return 0; \
+        } \
+        if (required_max != SRE_MAXREPEAT && \
+            found - ptr > required_max) \
+            ptr = found - required_max; \
+    } while (0)
+
 LOCAL(Py_ssize_t)
 SRE(search)(SRE_STATE* state, SRE_CODE* pattern)
 {
@@ -1699,6 +1743,12 @@ SRE(search)(SRE_STATE* state, SRE_CODE* pattern)
     SRE_CODE* prefix = NULL;
     SRE_CODE* charset = NULL;
     SRE_CODE* overlap = NULL;
+    Py_ssize_t required_len = 0;
+    Py_ssize_t required_min = 0;
+    SRE_CODE required_max = 0;
+    SRE_CODE* required = NULL;
+    SRE_CHAR needle[SRE_MAXREQUIRED];
+    SRE_CHAR* found = NULL;
     int flags = 0;
     INIT_TRACE(state);
 
@@ -1724,17 +1774,28 @@ SRE(search)(SRE_STATE* state, SRE_CODE* pattern)
                 end = ptr;
         }
 
+        SRE_CODE* info = pattern + 5;
+        if (flags & SRE_INFO_REQUIRED) {
+            /* pattern contains a known literal */
+            /* <length> <min offset> <max offset> <literal data> */
+            required_len = info[0];
+            required_min = info[1];
+            required_max = info[2];
+            required = info + 3;
+            info = required + required_len;
+        }
+
         if (flags & SRE_INFO_PREFIX) {
             /* pattern starts with a known prefix */
             /* <length> <skip> <prefix data> <overlap data> */
-            prefix_len = pattern[5];
-            prefix_skip = pattern[6];
-            prefix = pattern + 7;
+            prefix_len = info[0];
+            prefix_skip = info[1];
+            prefix = info + 2;
             overlap = prefix + prefix_len - 1;
         } else if (flags & SRE_INFO_CHARSET)
             /* pattern starts with a character from a known set */
             /* <charset> */
-            charset = pattern + 5;
+            charset = info;
 
         pattern += 1 + pattern[1];
     }
@@ -1742,6 +1803,29 @@ SRE(search)(SRE_STATE* state, SRE_CODE* pattern)
     TRACE(("prefix = %p %zd %zd\n",
            prefix, prefix_len, prefix_skip));
     TRACE(("charset = %p\n", charset));
+    TRACE(("required = %p %zd %zd\n",
+           required, required_len, required_min));
+
+    if (required_len) {
+        /* a match must contain a known literal, so there can't be
+           one unless the literal occurs in the string.  a long
+           literal is looked for by its first SRE_MAXREQUIRED
+           characters */
+        Py_ssize_t i;
+        if (required_len > SRE_MAXREQUIRED)
+            required_len = SRE_MAXREQUIRED;
+        for (i = 0; i < required_len; i++) {
+#if SIZEOF_SRE_CHAR < 4
+            if ((SRE_CODE)(SRE_CHAR) required[i] != required[i])
+                return 0; /* literal can't match: doesn't fit in char width */
+#endif
+            needle[i] = (SRE_CHAR) required[i];
+        }
+        found = SRE(find_required)(state, needle, required_len,
+                                   ptr, required_min);
+        if (found == NULL)
+            return 0;
+    }
 
     if (prefix_len == 1) {
         /* pattern starts with a literal character */
@@ -1831,6 +1915,12 @@ SRE(search)(SRE_STATE* state, SRE_CODE* pattern)
                 ptr++;
             if (ptr >= end)
                 return 0;
+            if (required_len) {
+                SRE_CHAR* prev = ptr;
+                SKIP_TO_REQUIRED();
+                if (ptr != prev)
+                    continue;
+            }
             TRACE(("|%p|%p|SEARCH CHARSET\n", pattern, ptr));
             state->start = ptr;
             state->ptr = ptr;
@@ -1843,6 +1933,13 @@ SRE(search)(SRE_STATE* state, SRE_CODE* pattern)
     } else {
         /* general case */
         assert(ptr <= end);
+        if (required_len) {
+            /* a required literal implies a non-empty match, so
+               must_advance doesn't matter */
+            SKIP_TO_REQUIRED();
+            if (ptr > end)
+                return 0;
+        }
         TRACE(("|%p|%p|SEARCH\n", pattern, ptr));
         state->start = state->ptr = ptr;
         status = SRE(match)(state, pattern, 1);
@@ -1857,6 +1954,11 @@ SRE(search)(SRE_STATE* state, SRE_CODE* pattern)
         while (status == 0 && ptr < end) {
             ptr++;
             RESET_CAPTURE_GROUP();
+            if (required_len) {
+                SKIP_TO_REQUIRED();
+                if (ptr > end)
+                    return 0;
+            }
             TRACE(("|%p|%p|SEARCH\n", pattern, ptr));
             state->start = state->ptr = ptr;
             status = SRE(match)(state, pattern, 0);
@@ -1866,6 +1968,234 @@ SRE(search)(SRE_STATE* state, SRE_CODE* pattern)
     return status;
 }
 
+#undef SKIP_TO_REQUIRED
+
+/* The re.LINEAR engine.  The program is a Thompson NFA, simulated with
+   a Pike VM: every thread advances over each character in lockstep, and
+   each instruction holds at most one thread per position, so that the
+   running time is O(len(string) * len(program)).  Threads are kept in
+   priority order, which gives the groups a backtracking matcher would
+   report for the same match.  See _compile_linear() in re/_compiler.py
+   for the program layout. */
+
+LOCAL(Py_ssize_t)
+SRE(linear_char)(SRE_STATE* state, const SRE_CODE* pattern, SRE_CODE ch)
+{
+    /* check the character test at pattern.  returns the length of the
+       instruction if ch matches, 0 otherwise */
+
+    switch (pattern[0]) {
+
+    case SRE_OP_ANY:
+        return SRE_IS_LINEBREAK(ch) ? 0 : 1;
+
+    case SRE_OP_ANY_ALL:
+        return 1;
+
+    case SRE_OP_LITERAL:
+        return ch == pattern[1] ? 2 : 0;
+
+    case SRE_OP_NOT_LITERAL:
+        return ch != pattern[1] ? 2 : 0;
+
+    case SRE_OP_LITERAL_IGNORE:
+        return (SRE_CODE) sre_lower_ascii(ch) == pattern[1] ? 2 : 0;
+
+    case SRE_OP_NOT_LITERAL_IGNORE:
+        return (SRE_CODE) sre_lower_ascii(ch) != pattern[1] ? 2 : 0;
+
+    case SRE_OP_LITERAL_UNI_IGNORE:
+        return (SRE_CODE) sre_lower_unicode(ch) == pattern[1] ? 2 : 0;
+
+    case SRE_OP_NOT_LITERAL_UNI_IGNORE:
+        return (SRE_CODE) sre_lower_unicode(ch) != pattern[1] ? 2 : 0;
+
+    case SRE_OP_LITERAL_LOC_IGNORE:
+        return char_loc_ignore(pattern[1], ch) ? 2 : 0;
+
+    case SRE_OP_NOT_LITERAL_LOC_IGNORE:
+        return !char_loc_ignore(pattern[1], ch) ? 2 : 0;
+
+    case SRE_OP_IN:
+        if (!SRE(charset)(state, pattern + 2, ch))
+            return 0;
+        return 1 + pattern[1];
+
+    case SRE_OP_IN_IGNORE:
+        if (!SRE(charset)(state, pattern + 2,
+                          (SRE_CODE) sre_lower_ascii(ch)))
+            return 0;
+        return 1 + pattern[1];
+
+    case SRE_OP_IN_UNI_IGNORE:
+        if (!SRE(charset)(state, pattern + 2,
+                          (SRE_CODE) sre_lower_unicode(ch)))
+            return 0;
+        return 1 + pattern[1];
+
+    case SRE_OP_IN_LOC_IGNORE:
+        if (!SRE(charset_loc_ignore)(state, pattern + 2, ch))
+            return 0;
+        return 1 + pattern[1];
+
+    default:
+        return 0;
+    }
+}
+
+LOCAL(void)
+SRE(linear_add)(SRE_STATE* state, SRE_LINEAR* lin, SRE_LINEAR_THREADS* list,
+                const SRE_CODE* code, Py_ssize_t pc, const SRE_CHAR* ptr,
+                Py_ssize_t gen)
+{
+    /* follow the jumps, marks and assertions from pc with the captures
+       in lin->caps, appending a thread to list for each character test
+       or SUCCESS reached.  lin->caps is restored before returning. */
+    SRE_LINEAR_JOB* jobs = lin->jobs;
+    Py_ssize_t njobs = 0;
+    Py_ssize_t n, i;
+
+    jobs[njobs++].pc = pc;
+    while (njobs > 0) {
+        SRE_LINEAR_JOB* job = &jobs[--njobs];
+        if (job->pc < 0) {
+            lin->caps[job->index] = job->value;
+            lin->lastindex = job->lastindex;
+            continue;
+        }
+        pc = job->pc;
+        for (;;) {
+            if (lin->onlist[pc] == gen)
+                break;
+            lin->onlist[pc] = gen;
+            switch (code[pc]) {
+
+            case SRE_OP_JUMP:
+                /* <JUMP> <target> */
+                pc = code[pc+1];
+                continue;
+
+            case SRE_OP_BRANCH:
+                /* <BRANCH> <preferred target> <other target> */
+                jobs[njobs++].pc = code[pc+2];
+                pc = code[pc+1];
+                continue;
+
+            case SRE_OP_MARK:
+                /* <MARK> <gid> */
+                i = code[pc+1];
+                job = &jobs[njobs++];
+                job->pc = -1;
+                job->index = i + 1;
+                job->value = lin->caps[i + 1];
+                job->lastindex = lin->lastindex;
+                lin->caps[i + 1] = ptr;
+                if (i & 1)
+                    lin->lastindex = i/2 + 1;
+                pc += 2;
+                continue;
+
+            case SRE_OP_AT:
+                /* <AT> <code> */
+                if (!SRE(at)(state, ptr, code[pc+1]))
+                    break;
+                pc += 2;
+                continue;
+
+            case SRE_OP_FAILURE:
+                break;
+
+            default:
+                /* a character test, or SUCCESS */
+                n = list->count++;
+                list->pc[n] = pc;
+                list->lastindex[n] = lin->lastindex;
+                memcpy(&list->caps[n * lin->ncaps], lin->caps,
+                       lin->ncaps * sizeof(lin->caps[0]));
+                break;
+            }
+            break;
+        }
+    }
+}
+
+LOCAL(Py_ssize_t)
+SRE(linear)(SRE_STATE* state, SRE_LINEAR* lin, const SRE_CODE* code,
+            int search)
+{
+    const SRE_CHAR* start = (const SRE_CHAR *)state->start;
+    const SRE_CHAR* end = (const SRE_CHAR *)state->end;
+    const SRE_CHAR* ptr;
+    const SRE_CHAR* matched = NULL;
+    SRE_LINEAR_THREADS* clist = &lin->threads[0];
+    SRE_LINEAR_THREADS* nlist = &lin->threads[1];
+    SRE_LINEAR_THREADS* tmp;
+    Py_ssize_t ncaps = lin->ncaps;
+    Py_ssize_t i, n, pc;
+    unsigned int sigcount = state->sigcount;
+
+    clist->count = 0;
+    for (ptr = start; ; ptr++) {
+        Py_ssize_t gen = ptr - start + 1;
+
+        if (!matched && (search || ptr == start)) {
+            /* start a new thread here, with the lowest priority */
+            memset((void *)lin->caps, 0, ncaps * sizeof(lin->caps[0]));
+            lin->caps[0] = ptr;
+            lin->lastindex = -1;
+            SRE(linear_add)(state, lin, clist, code, 0, ptr, gen);
+        }
+        if (clist->count == 0) {
+            if (matched || !search || ptr >= end)
+                break;
+            continue;
+        }
+        MAYBE_CHECK_SIGNALS;
+
+        nlist->count = 0;
+        for (i = 0; i < clist->count; i++) {
+            const void** caps = &clist->caps[i * ncaps];
+            pc = clist->pc[i];
+            if (code[pc] == SRE_OP_SUCCESS) {
+                if ((state->match_all && ptr != end) ||
+                    (state->must_advance && ptr == state->start))
+                    continue;
+                TRACE(("|%p|%p|LINEAR SUCCESS\n", code + pc, ptr));
+                memcpy((void *)lin->matched, caps, ncaps * sizeof(caps[0]));
+                lin->matched_lastindex = clist->lastindex[i];
+                matched = ptr;
+                /* the remaining threads have a lower priority */
+                break;
+            }
+            if (ptr >= end)
+                continue;
+            n = SRE(linear_char)(state, code + pc, *ptr);
+            if (n == 0)
+                continue;
+            memcpy((void *)lin->caps, caps, ncaps * sizeof(caps[0]));
+            lin->lastindex = clist->lastindex[i];
+            SRE(linear_add)(state, lin, nlist, code, pc + n, ptr + 1,
+                            gen + 1);
+        }
+        if (ptr >= end)
+            break;
+        tmp = clist;
+        clist = nlist;
+        nlist = tmp;
+    }
+    state->sigcount = sigcount;
+
+    if (!matched)
+        return 0;
+    state->start = lin->matched[0];
+    state->ptr = matched;
+    for (i = 1; i < ncaps; i++)
+        state->mark[i - 1] = lin->matched[i];
+    state->lastmark = (int)(ncaps - 2);
+    state->lastindex = (int)lin->matched_lastindex;
+    return 1;
+}
+
 #undef SRE_CHAR
 #undef SIZEOF_SRE_CHAR
 #undef SRE
@@ -0,0 +1,1328 @@
+/*
+ * Interface to Linux io_uring, used by asyncio's UringEventLoop.
+ *
+ * A Ring owns one io_uring instance.  Each I/O method queues a submission
+ * queue entry (SQE) and returns an Operation object; queued entries are
+ * handed to the kernel in one batch by the next Ring.submit() or
+ * Ring.wait() call, and wait() returns the operations whose completion
+ * queue entries (CQEs) have arrived.
+ *
+ * The ring uses the raw system calls rather than liburing so that no
+ * third-party library is needed.  While an operation is in flight, the
+ * ring holds a strong reference to it, and the operation keeps the buffer
+ * the kernel reads from or writes into alive.
+ */
+
+#ifndef Py_BUILD_CORE_BUILTIN
+#  define Py_BUILD_CORE_MODULE 1
+#endif
+
+#include "Python.h"
+#include "pycore_critical_section.h"  // Py_BEGIN_CRITICAL_SECTION()
+#include "pycore_pyatomic_ft_wrappers.h"  // FT_ATOMIC_LOAD_INT_RELAXED()
+#include "pycore_time.h"          // _PyTime_FromSecondsObject()
+
+#include <errno.h>
+#include <poll.h>                 // POLLIN
+#include <string.h>               // memset()
+#include <sys/mman.h>             // mmap()
+#include <sys/socket.h>           // SOCK_CLOEXEC
+#include <sys/syscall.h>          // __NR_io_uring_setup
+#include <unistd.h>               // syscall()
+#include <linux/io_uring.h>
+
+/*[clinic input]
+module _uring
+class _uring.Ring "RingObject *" "clinic_state()->ring_type"
+class _uring.Operation "OperationObject *" "clinic_state()->operation_type"
+[clinic start generated code]*/
+/*[clinic end generated code: output=da39a3ee5e6b4b0d input=f59b74e1328574bd]*/
+
+typedef struct {
+    PyTypeObject *ring_type;
+    PyTypeObject *operation_type;
+} uring_state;
+
+static inline uring_state *
+get_uring_state(PyObject *module)
+{
+    void *state = PyModule_GetState(module);
+    assert(state != NULL);
+    return (uring_state *)state;
+}
+
+static inline uring_state *
+get_uring_state_by_type(PyTypeObject *type)
+{
+    void *state = PyType_GetModuleState(type);
+    assert(state != NULL);
+    return (uring_state *)state;
+}
+
+#define clinic_state() (get_uring_state_by_type(Py_TYPE(self)))
+
+
+/* Kind of buffer owned by an operation */
+enum {TYPE_NONE, TYPE_READ, TYPE_READINTO, TYPE_WRITE};
+
+typedef struct {
+    PyObject_HEAD
+    /* The ring the operation was queued on. */
+    PyObject *ring;
+    int type;
+    /* True until the completion has been reaped from the ring. */
+    int pending;
+    /* The CQE result: a count, a file descriptor, a poll mask or -errno. */
+    int result;
+    union {
+        /* Buffer allocated by us: TYPE_READ */
+        PyObject *allocated_buffer;
+        /* Buffer passed by the user: TYPE_READINTO and TYPE_WRITE */
+        Py_buffer user_buffer;
+    };
+} OperationObject;
+
+#define OperationObject_CAST(op)    ((OperationObject *)(op))
+
+typedef struct {
+    PyObject_HEAD
+    int fd;
+    unsigned int features;
+
+    /* Submission queue */
+    void *sq_ring;
+    size_t sq_ring_size;
+    uint32_t *sq_khead;
+    uint32_t *sq_ktail;
+    uint32_t sq_mask;
+    uint32_t sq_entries;
+    struct io_uring_sqe *sqes;
+    size_t sqes_size;
+    /* Local copy of the SQ tail, published to the kernel on submission */
+    uint32_t sq_tail;
+    /* Number of SQEs queued but not yet consumed by the kernel */
+    uint32_t to_submit;
+
+    /* Completion queue; shares the SQ mapping with IORING_FEAT_SINGLE_MMAP */
+    void *cq_ring;
+    size_t cq_ring_size;
+    uint32_t *cq_khead;
+    uint32_t *cq_ktail;
+    uint32_t cq_mask;
+    struct io_uring_cqe *cqes;
+
+    /* Number of operations the kernel still owns */
+    Py_ssize_t inflight;
+} RingObject;
+
+#define RingObject_CAST(op)     ((RingObject *)(op))
+
+#include "clinic/_uringmodule.c.h"
+
+
+static int
+sys_io_uring_setup(unsigned int entries, struct io_uring_params *p)
+{
+    return (int)syscall(__NR_io_uring_setup, entries, p);
+}
+
+static int
+sys_io_uring_enter(int fd, unsigned int to_submit, unsigned int min_complete,
+                   unsigned int flags, void *arg, size_t argsz)
+{
+    return (int)syscall(__NR_io_uring_enter, fd, to_submit, min_complete,
+                        flags, arg, argsz);
+}
+
+static int
+sys_io_uring_register(int fd, unsigned int opcode, void *arg,
+                      unsigned int nr_args)
+{
+    return (int)syscall(__NR_io_uring_register, fd, opcode, arg, nr_args);
+}
+
+
+/*
+ * Operation objects
+ */
+
+static void
+operation_release_buffer(OperationObject *self)
+{
+    switch (self->type) {
+    case TYPE_READ:
+        Py_CLEAR(self->allocated_buffer);
+        break;
+    case TYPE_READINTO:
+    case TYPE_WRITE:
+        if (self->user_buffer.obj) {
+            PyBuffer_Release(&self->user_buffer);
+        }
+        break;
+    }
+    self->type = TYPE_NONE;
+}
+
+static OperationObject *
+operation_new(RingObject *ring, int type)
+{
+    uring_state *state = get_uring_state_by_type(Py_TYPE(ring));
+    OperationObject *self = PyObject_GC_New(OperationObject,
+                                            state->operation_type);
+    if (self == NULL) {
+        return NULL;
+    }
+    self->ring = Py_NewRef(ring);
+    self->type = type;
+    self->pending = 0;
+    self->result = 0;
+    memset(&self->user_buffer, 0, sizeof(self->user_buffer));
+    PyObject_GC_Track(self);
+    return self;
+}
+
+static int
+Operation_traverse(PyObject *op, visitproc visit, void *arg)
+{
+    OperationObject *self = OperationObject_CAST(op);
+    Py_VISIT(Py_TYPE(self));
+    Py_VISIT(self->ring);
+    switch (self->type) {
+    case TYPE_READ:
+        Py_VISIT(self->allocated_buffer);
+        break;
+    case TYPE_READINTO:
+    case TYPE_WRITE:
+        Py_VISIT(self->user_buffer.obj);
+        break;
+    }
+    return 0;
+}
+
+static int
+Operation_clear(PyObject *op)
+{
+    OperationObject *self = OperationObject_CAST(op);
+    // A pending operation is kept alive by the ring, so it is never
+    // cleared while the kernel may still access its buffer.
+    assert(!self->pending);
+    operation_release_buffer(self);
+    Py_CLEAR(self->ring);
+    return 0;
+}
+
+static void
+Operation_dealloc(PyObject *op)
+{
+    PyTypeObject *tp = Py_TYPE(op);
+    PyObject_GC_UnTrack(op);
+    (void)Operation_clear(op);
+    tp->tp_free(op);
+    Py_DECREF(tp);
+}
+
+/* Called with the ring's critical section held once the operation's CQE
+   has been reaped. */
+static int
+operation_complete(OperationObject *self, int result)
+{
+    self->pending = 0;
+    self->result = result;
+    switch (self->type) {
+    case TYPE_READ:
+        if (result < 0) {
+            Py_CLEAR(self->allocated_buffer);
+            self->type = TYPE_NONE;
+        }
+        else if (result < PyBytes_GET_SIZE(self->allocated_buffer)) {
+            // Only the operation holds a reference to the buffer.
+            if (_PyBytes_Resize(&self->allocated_buffer, result) < 0) {
+                self->type = TYPE_NONE;
+                return -1;
+            }
+        }
+        break;
+    case TYPE_READINTO:
+    case TYPE_WRITE:
+        operation_release_buffer(self);
+        break;
+    }
+    return 0;
+}
+
+/*[clinic input]
+@critical_section
+_uring.Operation.getresult
+
+Retrieve the result of the operation.
+
+Return the data read by read() and recv(), or the integer result of
+the other operations.  Raise OSError if the operation failed.
+[clinic start generated code]*/
+
+static PyObject *
+_uring_Operation_getresult_impl(OperationObject *self)
+/*[clinic end generated code: output=b8998020ec1f6bd2 input=3d81bbaed0bd5add]*/
+{
+    if (self->pending) {
+        PyErr_SetString(PyExc_ValueError, "operation is still pending");
+        return NULL;
+    }
+    if (self->result < 0) {
+        errno = -self->result;
+        return PyErr_SetFromErrno(PyExc_OSError);
+    }
+    if (self->type == TYPE_READ) {
+        return Py_NewRef(self->allocated_buffer);
+    }
+    return PyLong_FromLong(self->result);
+}
+
+static int ring_cancel(RingObject *ring, OperationObject *op);
+
+/*[clinic input]
+_uring.Operation.cancel
+
+Ask the kernel to cancel the operation if it is still pending.
+
+The operation still completes, typically with ECANCELED, and is
+returned by a later Ring.wait() call.
+[clinic start generated code]*/
+
+static PyObject *
+_uring_Operation_cancel_impl(OperationObject *self)
+/*[clinic end generated code: output=92e2e2744568eb70 input=d9534cadb17a7f7c]*/
+{
+    int res = 0;
+    RingObject *ring = RingObject_CAST(self->ring);
+    Py_BEGIN_CRITICAL_SECTION(ring);
+    if (self->pending && ring->fd >= 0) {
+        res = ring_cancel(ring, self);
+    }
+    Py_END_CRITICAL_SECTION();
+    if (res < 0) {
+        return NULL;
+    }
+    Py_RETURN_NONE;
+}
+
+static PyObject *
+Operation_getpending(PyObject *op, void *Py_UNUSED(closure))
+{
+    OperationObject *self = OperationObject_CAST(op);
+    return PyBool_FromLong(FT_ATOMIC_LOAD_INT_RELAXED(self->pending));
+}
+
+static PyMethodDef Operation_methods[] = {
+    _URING_OPERATION_GETRESULT_METHODDEF
+    _URING_OPERATION_CANCEL_METHODDEF
+    {NULL}
+};
+
+static PyGetSetDef Operation_getsets[] = {
+    {"pending", Operation_getpending, NULL,
+     "Whether the operation is pending"},
+    {NULL},
+};
+
+PyDoc_STRVAR(Operation_doc,
+"An I/O operation queued on a Ring.");
+
+static PyType_Slot operation_type_slots[] = {
+    {Py_tp_dealloc, Operation_dealloc},
+    {Py_tp_doc, (char *)Operation_doc},
+    {Py_tp_traverse, Operation_traverse},
+    {Py_tp_clear, Operation_clear},
+    {Py_tp_methods, Operation_methods},
+    {Py_tp_getset, Operation_getsets},
+    {0, 0}
+};
+
+static PyType_Spec operation_type_spec = {
+    .name = "_uring.Operation",
+    .basicsize = sizeof(OperationObject),
+    .flags = (Py_TPFLAGS_DEFAULT | Py_TPFLAGS_HAVE_GC |
+              Py_TPFLAGS_IMMUTABLETYPE | Py_TPFLAGS_DISALLOW_INSTANTIATION),
+    .slots = operation_type_slots
+};
+
+
+/*
+ * Ring objects
+ */
+
+static int
+ring_check_open(RingObject *self)
+{
+    if (self->fd < 0) {
+        PyErr_SetString(PyExc_ValueError, "I/O operation on closed ring");
+        return -1;
+    }
+    return 0;
+}
+
+static void
+ring_unmap(RingObject *self)
+{
+    if (self->sqes != NULL) {
+        munmap(self->sqes, self->sqes_size);
+        self->sqes = NULL;
+    }
+    if (self->cq_ring != NULL && self->cq_ring != self->sq_ring) {
+        munmap(self->cq_ring, self->cq_ring_size);
+    }
+    self->cq_ring = NULL;
+    if (self->sq_ring != NULL) {
+        munmap(self->sq_ring, self->sq_ring_size);
+        self->sq_ring = NULL;
+    }
+}
+
+/* Hand queued SQEs to the kernel without waiting for completions. */
+static int
+ring_submit(RingObject *self)
+{
+    while (self->to_submit) {
+        _Py_atomic_store_uint32_release(self->sq_ktail, self->sq_tail);
+        int n = sys_io_uring_enter(self->fd, self->to_submit, 0, 0, NULL, 0);
+        if (n < 0) {
+            if (errno == EINTR) {
+                if (PyErr_CheckSignals() < 0) {
+                    return -1;
+                }
+                continue;
+            }
+            if (errno == EAGAIN || errno == EBUSY) {
+                // The kernel is short of memory or the CQ ring overflowed:
+                // leave the entries queued until completions are reaped.
+                return 0;
+            }
+            PyErr_SetFromErrno(PyExc_OSError);
+            return -1;
+        }
+        self->to_submit -= (uint32_t)n;
+        if (n == 0) {
+            break;
+        }
+    }
+    return 0;
+}
+
+static struct io_uring_sqe *
+ring_get_sqe(RingObject *self)
+{
+    uint32_t head = _Py_atomic_load_uint32_acquire(self->sq_khead);
+    if (self->sq_tail - head >= self->sq_entries) {
+        if (ring_submit(self) < 0) {
+            return NULL;
+        }
+        head = _Py_atomic_load_uint32_acquire(self->sq_khead);
+        if (self->sq_tail - head >= self->sq_entries) {
+            errno = EBUSY;
+            PyErr_SetFromErrno(PyExc_OSError);
+            return NULL;
+        }
+    }
+    struct io_uring_sqe *sqe = &self->sqes[self->sq_tail & self->sq_mask];
+    memset(sqe, 0, sizeof(*sqe));
+    return sqe;
+}
+
+/* Queue an SQE filled in by the caller.  The ring takes a reference to op,
+   which is released when the completion is reaped. */
+static void
+ring_push(RingObject *self, struct io_uring_sqe *sqe, OperationObject *op)
+{
+    sqe->user_data = (uint64_t)(uintptr_t)op;
+    self->sq_tail++;
+    self->to_submit++;
+    if (op != NULL) {
+        op->pending = 1;
+        self->inflight++;
+        Py_INCREF(op);
+    }
+}
+
+static int
+ring_cancel(RingObject *self, OperationObject *op)
+{
+    struct io_uring_sqe *sqe = ring_get_sqe(self);
+    if (sqe == NULL) {
+        return -1;
+    }
+    sqe->opcode = IORING_OP_ASYNC_CANCEL;
+    sqe->fd = -1;
+    sqe->addr = (uint64_t)(uintptr_t)op;
+    // The completion of the cancel request itself is ignored.
+    ring_push(self, sqe, NULL);
+    return 0;
+}
+
+/* Move all available CQEs to the list of completed operations. */
+static int
+ring_reap(RingObject *self, PyObject *completed)
+{
+    int err = 0;
+    uint32_t head = *self->cq_khead;
+    uint32_t tail = _Py_atomic_load_uint32_acquire(self->cq_ktail);
+    for (; head != tail; head++) {
+        struct io_uring_cqe *cqe = &self->cqes[head & self->cq_mask];
+        OperationObject *op = (OperationObject *)(uintptr_t)cqe->user_data;
+        if (op == NULL) {
+            continue;
+        }
+        self->inflight--;
+        if (operation_complete(op, cqe->res) < 0) {
+            err = -1;
+        }
+        // Transfer the ring's reference to the list.
+        if (PyList_Append(completed, (PyObject *)op) < 0) {
+            err = -1;
+        }
+        Py_DECREF(op);
+    }
+    _Py_atomic_store_uint32_release(self->cq_khead, head);
+    return err;
+}
+
+static int
+ring_setup(RingObject *self, unsigned int entries)
+{
+    struct io_uring_params p;
+    unsigned int flags = 0;
+#ifdef IORING_SETUP_SUBMIT_ALL
+    flags |= IORING_SETUP_SUBMIT_ALL;
+#endif
+#ifdef IORING_SETUP_COOP_TASKRUN
+    flags |= IORING_SETUP_COOP_TASKRUN;
+#endif
+
+    memset(&p, 0, sizeof(p));
+    p.flags = flags;
+    int fd = sys_io_uring_setup(entries, &p);
+    if (fd < 0 && errno == EINVAL && flags) {
+        // Older kernels reject flags they don't know about.
+        memset(&p, 0, sizeof(p));
+        fd = sys_io_uring_setup(entries, &p);
+    }
+    if (fd < 0) {
+        PyErr_SetFromErrno(PyExc_OSError);
+        return -1;
+    }
+    self->fd = fd;
+    self->features = p.features;
+
+    // Waiting with a timeout needs IORING_ENTER_EXT_ARG (Linux 5.11).
+    if (!(p.features & IORING_FEAT_EXT_ARG)) {
+        errno = ENOSYS;
+        PyErr_SetFromErrno(PyExc_OSError);
+        return -1;
+    }
+
+    self->sq_ring_size = p.sq_off.array + p.sq_entries * sizeof(uint32_t);
+    self->cq_ring_size = (p.cq_off.cqes +
+                          p.cq_entries * sizeof(struct io_uring_cqe));
+    if (p.features & IORING_FEAT_SINGLE_MMAP) {
+        if (self->cq_ring_size > self->sq_ring_size) {
+            self->sq_ring_size = self->cq_ring_size;
+        }
+        self->cq_ring_size = self->sq_ring_size;
+    }
+    self->sq_ring = mmap(NULL, self->sq_ring_size, PROT_READ | PROT_WRITE,
+                         MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQ_RING);
+    if (self->sq_ring == MAP_FAILED) {
+        self->sq_ring = NULL;
+        PyErr_SetFromErrno(PyExc_OSError);
+        return -1;
+    }
+    if (p.features & IORING_FEAT_SINGLE_MMAP) {
+        self->cq_ring = self->sq_ring;
+    }
+    else {
+        self->cq_ring = mmap(NULL, self->cq_ring_size, PROT_READ | PROT_WRITE,
+                             MAP_SHARED | MAP_POPULATE, fd,
+                             IORING_OFF_CQ_RING);
+        if (self->cq_ring == MAP_FAILED) {
+            self->cq_ring = NULL;
+            PyErr_SetFromErrno(PyExc_OSError);
+            return -1;
+        }
+    }
+    self->sqes_size = p.sq_entries * sizeof(struct io_uring_sqe);
+    self->sqes = mmap(NULL, self->sqes_size, PROT_READ | PROT_WRITE,
+                      MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQES);
+    if (self->sqes == MAP_FAILED) {
+        self->sqes = NULL;
+        PyErr_SetFromErrno(PyExc_OSError);
+        return -1;
+    }
+
+    char *sq = (char *)self->sq_ring;
+    self->sq_khead = (uint32_t *)(sq + p.sq_off.head);
+    self->sq_ktail = (uint32_t *)(sq + p.sq_off.tail);
+    self->sq_mask = *(uint32_t *)(sq + p.sq_off.ring_mask);
+    self->sq_entries = *(uint32_t *)(sq + p.sq_off.ring_entries);
+    self->sq_tail = *self->sq_ktail;
+    // SQEs are always used in ring order, so the indirection array is
+    // the identity mapping.
+    uint32_t *array = (uint32_t *)(sq + p.sq_off.array);
+    for (uint32_t i = 0; i < self->sq_entries; i++) {
+        array[i] = i;
+    }
+
+    char *cq = (char *)self->cq_ring;
+    self->cq_khead = (uint32_t *)(cq + p.cq_off.head);
+    self->cq_ktail = (uint32_t *)(cq + p.cq_off.tail);
+    self->cq_mask = *(uint32_t *)(cq + p.cq_off.ring_mask);
+    self->cqes = (struct io_uring_cqe *)(cq + p.cq_off.cqes);
+
+    // Check that the kernel supports every operation we may submit.
+    static const uint8_t required_ops[] = {
+        IORING_OP_READ, IORING_OP_WRITE, IORING_OP_RECV, IORING_OP_SEND,
+        IORING_OP_ACCEPT, IORING_OP_POLL_ADD, IORING_OP_ASYNC_CANCEL,
+    };
+    size_t probe_size = (sizeof(struct io_uring_probe) +
+                         256 * sizeof(struct io_uring_probe_op));
+    struct io_uring_probe *probe = PyMem_Calloc(1, probe_size);
+    if (probe == NULL) {
+        PyErr_NoMemory();
+        return -1;
+    }
+    if (sys_io_uring_register(fd, IORING_REGISTER_PROBE, probe, 256) < 0) {
+        PyMem_Free(probe);
+        PyErr_SetFromErrno(PyExc_OSError);
+        return -1;
+    }
+    for (size_t i = 0; i < Py_ARRAY_LENGTH(required_ops); i++) {
+        uint8_t op = required_ops[i];
+        if (op > probe->last_op ||
+            !(probe->ops[op].flags & IO_URING_OP_SUPPORTED))
+        {
+            PyMem_Free(probe);
+            errno = ENOSYS;
+            PyErr_SetFromErrno(PyExc_OSError);
+            return -1;
+        }
+    }
+    PyMem_Free(probe);
+    return 0;
+}
+
+static void
+ring_close(RingObject *self)
+{
+    // Operations still owned by the kernel keep their references: the
+    // kernel may write into their buffers until it has torn the ring down,
+    // so they are deliberately leaked.  Ring.close() cancels them first.
+    ring_unmap(self);
+    if (self->fd >= 0) {
+        close(self->fd);
+        self->fd = -1;
+    }
+}
+
+/*[clinic input]
+@classmethod
+_uring.Ring.__new__
+
+    entries: int = 256
+
+Create an io_uring instance.
+
+The entries argument is the number of operations that can be queued
+between two submissions.  Raise OSError if io_uring is not available
+or lacks a required feature.
+[clinic start generated code]*/
+
+static PyObject *
+_uring_Ring_impl(PyTypeObject *type, int entries)
+/*[clinic end generated code: output=20cac980d273741f input=0bd74b9b717696e2]*/
+{
+    if (entries <= 0) {
+        PyErr_SetString(PyExc_ValueError, "entries must be positive");
+        return NULL;
+    }
+    RingObject *self = (RingObject *)type->tp_alloc(type, 0);
+    if (self == NULL) {
+        return NULL;
+    }
+    self->fd = -1;
+    if (ring_setup(self, (unsigned int)entries) < 0) {
+        ring_close(self);
+        Py_DECREF(self);
+        return NULL;
+    }
+    return (PyObject *)self;
+}
+
+static void
+Ring_dealloc(PyObject *op)
+{
+    RingObject *self = RingObject_CAST(op);
+    PyTypeObject *tp = Py_TYPE(self);
+    // Pending operations hold a reference to the ring.
+    assert(self->inflight == 0);
+    ring_close(self);
+    tp->tp_free(self);
+    Py_DECREF(tp);
+}
+
+/* Cancel the operations the kernel still owns and reap their completions,
+   so that they release their buffers.  Give up once the kernel stops making
+   progress: matching any request needs Linux 5.19, and some operations
+   cannot be cancelled. */
+static int
+ring_cancel_all(RingObject *self)
+{
+#ifdef IORING_ASYNC_CANCEL_ANY
+    if (self->inflight == 0) {
+        return 0;
+    }
+    struct io_uring_sqe *sqe = ring_get_sqe(self);
+    if (sqe == NULL) {
+        return -1;
+    }
+    sqe->opcode = IORING_OP_ASYNC_CANCEL;
+    sqe->fd = -1;
+    sqe->cancel_flags = IORING_ASYNC_CANCEL_ALL | IORING_ASYNC_CANCEL_ANY;
+    ring_push(self, sqe, NULL);
+
+    PyObject *completed = PyList_New(0);
+    if (completed == NULL) {
+        return -1;
+    }
+    struct __kernel_timespec ts = {.tv_sec = 1};
+    struct io_uring_getevents_arg arg;
+    memset(&arg, 0, sizeof(arg));
+    arg.ts = (uint64_t)(uintptr_t)&ts;
+    while (self->inflight > 0) {
+        Py_ssize_t inflight = self->inflight;
+        unsigned int to_submit = self->to_submit;
+        _Py_atomic_store_uint32_release(self->sq_ktail, self->sq_tail);
+        int n, err = 0;
+        Py_BEGIN_ALLOW_THREADS
+        n = sys_io_uring_enter(self->fd, to_submit, 1,
+                               IORING_ENTER_GETEVENTS | IORING_ENTER_EXT_ARG,
+                               &arg, sizeof(arg));
+        if (n < 0) {
+            err = errno;
+        }
+        Py_END_ALLOW_THREADS
+
+        if (n >= 0) {
+            self->to_submit -= (uint32_t)n;
+        }
+        else if (err == EINTR) {
+            if (PyErr_CheckSignals() < 0) {
+                Py_DECREF(completed);
+                return -1;
+            }
+            continue;
+        }
+        else if (err != ETIME) {
+            break;
+        }
+        if (ring_reap(self, completed) < 0) {
+            Py_DECREF(completed);
+            return -1;
+        }
+        if (self->inflight == inflight) {
+            break;
+        }
+    }
+    // The cancelled operations are not returned by wait(), but their
+    // result is available.
+    Py_DECREF(completed);
+#endif
+    return 0;
+}
+
+/*[clinic input]
+@critical_section
+_uring.Ring.close
+
+Close the ring.
+
+Pending operations are cancelled first.  Those which the kernel does not
+cancel are never completed, and the buffers they use are leaked.
+[clinic start generated code]*/
+
+static PyObject *
+_uring_Ring_close_impl(RingObject *self)
+/*[clinic end generated code: output=447415269da3419f input=95ccba80e5433ad7]*/
+{
+    if (self->fd >= 0 && ring_cancel_all(self) < 0) {
+        return NULL;
+    }
+    ring_close(self);
+    Py_RETURN_NONE;
+}
+
+/*[clinic input]
+@critical_section
+_uring.Ring.fileno
+
+Return the file descriptor of the ring.
+[clinic start generated code]*/
+
+static PyObject *
+_uring_Ring_fileno_impl(RingObject *self)
+/*[clinic end generated code: output=773263c5ad53ca3d input=ececdb4cb6c95cce]*/
+{
+    if (ring_check_open(self) < 0) {
+        return NULL;
+    }
+    return PyLong_FromLong(self->fd);
+}
+
+/*[clinic input]
+@critical_section
+_uring.Ring.read
+
+    fd: int
+    nbytes: Py_ssize_t
+    offset: long_long = -1
+    /
+
+Queue a read of up to nbytes bytes from fd.
+
+If offset is -1, read from the current file position.  The result is a
+bytes object.
+[clinic start generated code]*/
+
+static PyObject *
+_uring_Ring_read_impl(RingObject *self, int fd, Py_ssize_t nbytes,
+                      long long offset)
+/*[clinic end generated code: output=5474944fc6504d5a input=ab8b27e8a0f62014]*/
+{
+    if (ring_check_open(self) < 0) {
+        return NULL;
+    }
+    if (nbytes < 0 || nbytes > UINT32_MAX) {
+        PyErr_SetString(PyExc_ValueError, "nbytes out of range");
+        return NULL;
+    }
+    OperationObject *op = operation_new(self, TYPE_READ);
+    if (op == NULL) {
+        return NULL;
+    }
+    op->allocated_buffer = PyBytes_FromStringAndSize(NULL, nbytes);
+    struct io_uring_sqe *sqe;
+    if (op->allocated_buffer == NULL || (sqe = ring_get_sqe(self)) == NULL) {
+        Py_DECREF(op);
+        return NULL;
+    }
+    sqe->opcode = IORING_OP_READ;
+    sqe->fd = fd;
+    sqe->addr = (uint64_t)(uintptr_t)PyBytes_AS_STRING(op->allocated_buffer);
+    sqe->len = (uint32_t)nbytes;
+    sqe->off = (uint64_t)offset;
+    ring_push(self, sqe, op);
+    return (PyObject *)op;
+}
+
+static PyObject *
+ring_queue_buffer_op(RingObject *self, int opcode, int type, int fd,
+                     Py_buffer *buffer, uint64_t off, uint32_t msg_flags)
+{
+    if (buffer->len > UINT32_MAX) {
+        PyErr_SetString(PyExc_ValueError, "buffer too large");
+        return NULL;
+    }
+    OperationObject *op = operation_new(self, type);
+    if (op == NULL) {
+        return NULL;
+    }
+    struct io_uring_sqe *sqe = ring_get_sqe(self);
+    if (sqe == NULL) {
+        Py_DECREF(op);
+        return NULL;
+    }
+    // The operation takes over the buffer.
+    op->user_buffer = *buffer;
+    memset(buffer, 0, sizeof(*buffer));
+    sqe->opcode = opcode;
+    sqe->fd = fd;
+    sqe->addr = (uint64_t)(uintptr_t)op->user_buffer.buf;
+    sqe->len = (uint32_t)op->user_buffer.len;
+    sqe->off = off;
+    sqe->msg_flags = msg_flags;
+    ring_push(self, sqe, op);
+    return (PyObject *)op;
+}
+
+/*[clinic input]
+@critical_section
+_uring.Ring.readinto
+
+    fd: int
+    buffer: Py_buffer(accept={rwbuffer})
+    offset: long_long = -1
+    /
+
+Queue a read from fd into buffer.
+
+If offset is -1, read from the current file position.  The result is
+the number of bytes read.
+[clinic start generated code]*/
+
+static PyObject *
+_uring_Ring_readinto_impl(RingObject *self, int fd, Py_buffer *buffer,
+                          long long offset)
+/*[clinic end generated code: output=653ec18e38126ce5 input=ce2833d15e88b6c6]*/
+{
+    if (ring_check_open(self) < 0) {
+        return NULL;
+    }
+    return ring_queue_buffer_op(self, IORING_OP_READ, TYPE_READINTO, fd,
+                                buffer, (uint64_t)offset, 0);
+}
+
+/*[clinic input]
+@critical_section
+_uring.Ring.write
+
+    fd: int
+    data: Py_buffer
+    offset: long_long = -1
+    /
+
+Queue a write of data to fd.
+
+If offset is -1, write at the current file position.  The result is
+the number of bytes written.
+[clinic start generated code]*/
+
+static PyObject *
+_uring_Ring_write_impl(RingObject *self, int fd, Py_buffer *data,
+                       long long offset)
+/*[clinic end generated code: output=61d8b3d620a6c4da input=0e411f6d38ace7ca]*/
+{
+    if (ring_check_open(self) < 0) {
+        return NULL;
+    }
+    return ring_queue_buffer_op(self, IORING_OP_WRITE, TYPE_WRITE, fd,
+                                data, (uint64_t)offset, 0);
+}
+
+/*[clinic input]
+@critical_section
+_uring.Ring.recv
+
+    fd: int
+    nbytes: Py_ssize_t
+    flags: int = 0
+    /
+
+Queue a receive of up to nbytes bytes from the socket fd.
+
+The result is a bytes object.
+[clinic start generated code]*/
+
+static PyObject *
+_uring_Ring_recv_impl(RingObject *self, int fd, Py_ssize_t nbytes, int flags)
+/*[clinic end generated code: output=0935b4a58d8e93cd input=0d0015006ac6fbbf]*/
+{
+    if (ring_check_open(self) < 0) {
+        return NULL;
+    }
+    if (nbytes < 0 || nbytes > UINT32_MAX) {
+        PyErr_SetString(PyExc_ValueError, "nbytes out of range");
+        return NULL;
+    }
+    OperationObject *op = operation_new(self, TYPE_READ);
+    if (op == NULL) {
+        return NULL;
+    }
+    op->allocated_buffer = PyBytes_FromStringAndSize(NULL, nbytes);
+    struct io_uring_sqe *sqe;
+    if (op->allocated_buffer == NULL || (sqe = ring_get_sqe(self)) == NULL) {
+        Py_DECREF(op);
+        return NULL;
+    }
+    sqe->opcode = IORING_OP_RECV;
+    sqe->fd = fd;
+    sqe->addr = (uint64_t)(uintptr_t)PyBytes_AS_STRING(op->allocated_buffer);
+    sqe->len = (uint32_t)nbytes;
+    sqe->msg_flags = (uint32_t)flags;
+    ring_push(self, sqe, op);
+    return (PyObject *)op;
+}
+
+/*[clinic input]
+@critical_section
+_uring.Ring.recv_into
+
+    fd: int
+    buffer: Py_buffer(accept={rwbuffer})
+    flags: int = 0
+    /
+
+Queue a receive from the socket fd into buffer.
+
+The result is the number of bytes received.
+[clinic start generated code]*/
+
+static PyObject *
+_uring_Ring_recv_into_impl(RingObject *self, int fd, Py_buffer *buffer,
+                           int flags)
+/*[clinic end generated code: output=1ad2535142116400 input=7d5e06fc78e3bdd5]*/
+{
+    if (ring_check_open(self) < 0) {
+        return NULL;
+    }
+    return ring_queue_buffer_op(self, IORING_OP_RECV, TYPE_READINTO, fd,
+                                buffer, 0, (uint32_t)flags);
+}
+
+/*[clinic input]
+@critical_section
+_uring.Ring.send
+
+    fd: int
+    data: Py_buffer
+    flags: int = 0
+    /
+
+Queue a send of data on the socket fd.
+
+The result is the number of bytes sent.
+[clinic start generated code]*/
+
+static PyObject *
+_uring_Ring_send_impl(RingObject *self, int fd, Py_buffer *data, int flags)
+/*[clinic end generated code: output=15b343a5d9b2604e input=053b60041284596d]*/
+{
+    if (ring_check_open(self) < 0) {
+        return NULL;
+    }
+    return ring_queue_buffer_op(self, IORING_OP_SEND, TYPE_WRITE, fd,
+                                data, 0, (uint32_t)flags);
+}
+
+/*[clinic input]
+@critical_section
+_uring.Ring.accept
+
+    fd: int
+    /
+
+Queue an accept on the listening socket fd.
+
+The result is the file descriptor of the new connection, which is
+created with the close-on-exec flag set.
+[clinic start generated code]*/
+
+static PyObject *
+_uring_Ring_accept_impl(RingObject *self, int fd)
+/*[clinic end generated code: output=f1ecfea8859270f3 input=076c5c67ef8cee84]*/
+{
+    if (ring_check_open(self) < 0) {
+        return NULL;
+    }
+    OperationObject *op = operation_new(self, TYPE_NONE);
+    if (op == NULL) {
+        return NULL;
+    }
+    struct io_uring_sqe *sqe = ring_get_sqe(self);
+    if (sqe == NULL) {
+        Py_DECREF(op);
+        return NULL;
+    }
+    sqe->opcode = IORING_OP_ACCEPT;
+    sqe->fd = fd;
+    sqe->accept_flags = SOCK_CLOEXEC;
+    ring_push(self, sqe, op);
+    return (PyObject *)op;
+}
+
+/*[clinic input]
+@critical_section
+_uring.Ring.poll
+
+    fd: int
+    events: unsigned_short(bitwise=True)
+    /
+
+Queue a one-shot wait for the poll events to be signalled on fd.
+
+The result is the mask of events that occurred.
+[clinic start generated code]*/
+
+static PyObject *
+_uring_Ring_poll_impl(RingObject *self, int fd, unsigned short events)
+/*[clinic end generated code: output=e7533bc04fea1688 input=079f776cc2f6bc3e]*/
+{
+    if (ring_check_open(self) < 0) {
+        return NULL;
+    }
+    OperationObject *op = operation_new(self, TYPE_NONE);
+    if (op == NULL) {
+        return NULL;
+    }
+    struct io_uring_sqe *sqe = ring_get_sqe(self);
+    if (sqe == NULL) {
+        Py_DECREF(op);
+        return NULL;
+    }
+    sqe->opcode = IORING_OP_POLL_ADD;
+    sqe->fd = fd;
+#if PY_LITTLE_ENDIAN
+    sqe->poll32_events = events;
+#else
+    sqe->poll32_events = ((uint32_t)events << 16) | ((uint32_t)events >> 16);
+#endif
+    ring_push(self, sqe, op);
+    return (PyObject *)op;
+}
+
+/*[clinic input]
+@critical_section
+_uring.Ring.submit
+
+Hand the queued operations to the kernel.
+
+Return the number of operations that are still queued, which is only
+non-zero if the kernel is short of resources.
+[clinic start generated code]*/
+
+static PyObject *
+_uring_Ring_submit_impl(RingObject *self)
+/*[clinic end generated code: output=f8036e3d35cb13e9 input=0efc25c14201aebe]*/
+{
+    if (ring_check_open(self) < 0 || ring_submit(self) < 0) {
+        return NULL;
+    }
+    return PyLong_FromUnsignedLong(self->to_submit);
+}
+
+/*[clinic input]
+@critical_section
+_uring.Ring.wait
+
+    timeout as timeout_obj: object = None
+    /
+
+Submit the queued operations and wait for completions.
+
+Wait for up to timeout seconds for at least one operation to complete,
+or forever if timeout is None.  Return the list of completed
+operations, which is empty if the wait timed out or was interrupted.
+[clinic start generated code]*/
+
+static PyObject *
+_uring_Ring_wait_impl(RingObject *self, PyObject *timeout_obj)
+/*[clinic end generated code: output=480a97563d86ffbc input=e7c0a234ce7ba6b4]*/
+{
+    PyTime_t timeout = -1;
+    if (ring_check_open(self) < 0) {
+        return NULL;
+    }
+    if (timeout_obj != Py_None) {
+        if (_PyTime_FromSecondsObject(&timeout, timeout_obj,
+                                      _PyTime_ROUND_TIMEOUT) < 0) {
+            return NULL;
+        }
+        if (timeout < 0) {
+            PyErr_SetString(PyExc_ValueError, "timeout must be non-negative");
+            return NULL;
+        }
+    }
+
+    PyObject *completed = PyList_New(0);
+    if (completed == NULL) {
+        return NULL;
+    }
+    if (ring_reap(self, completed) < 0) {
+        goto error;
+    }
+    if (PyList_GET_SIZE(completed) || timeout == 0) {
+        // Don't block: just hand over the new operations, and pick up
+        // those that completed while being submitted.
+        if (ring_submit(self) < 0 || ring_reap(self, completed) < 0) {
+            goto error;
+        }
+        return completed;
+    }
+
+    struct __kernel_timespec ts;
+    struct io_uring_getevents_arg arg;
+    memset(&arg, 0, sizeof(arg));
+    if (timeout > 0) {
+        struct timespec tv;
+        if (_PyTime_AsTimespec(timeout, &tv) < 0) {
+            goto error;
+        }
+        ts.tv_sec = tv.tv_sec;
+        ts.tv_nsec = tv.tv_nsec;
+        arg.ts = (uint64_t)(uintptr_t)&ts;
+    }
+
+    unsigned int to_submit = self->to_submit;
+    _Py_atomic_store_uint32_release(self->sq_ktail, self->sq_tail);
+    int n, err = 0;
+    Py_BEGIN_ALLOW_THREADS
+    n = sys_io_uring_enter(self->fd, to_submit, 1,
+                           IORING_ENTER_GETEVENTS | IORING_ENTER_EXT_ARG,
+                           &arg, sizeof(arg));
+    if (n < 0) {
+        err = errno;
+    }
+    Py_END_ALLOW_THREADS
+
+    if (n >= 0) {
+        self->to_submit -= (uint32_t)n;
+    }
+    else if (err == EINTR) {
+        if (PyErr_CheckSignals() < 0) {
+            goto error;
+        }
+    }
+    else if (err != ETIME && err != EAGAIN && err != EBUSY) {
+        errno = err;
+        PyErr_SetFromErrno(PyExc_OSError);
+        goto error;
+    }
+    if (ring_reap(self, completed) < 0) {
+        goto error;
+    }
+    return completed;
+
+error:
+    Py_DECREF(completed);
+    return NULL;
+}
+
+static PyObject *
+Ring_getclosed(PyObject *op, void *Py_UNUSED(closure))
+{
+    RingObject *self = RingObject_CAST(op);
+    return PyBool_FromLong(FT_ATOMIC_LOAD_INT_RELAXED(self->fd) < 0);
+}
+
+static PyObject *
+Ring_getpending(PyObject *op, void *Py_UNUSED(closure))
+{
+    RingObject *self = RingObject_CAST(op);
+    return PyLong_FromSsize_t(FT_ATOMIC_LOAD_SSIZE_RELAXED(self->inflight));
+}
+
+static PyMethodDef Ring_methods[] = {
+    _URING_RING_CLOSE_METHODDEF
+    _URING_RING_FILENO_METHODDEF
+    _URING_RING_READ_METHODDEF
+    _URING_RING_READINTO_METHODDEF
+    _URING_RING_WRITE_METHODDEF
+    _URING_RING_RECV_METHODDEF
+    _URING_RING_RECV_INTO_METHODDEF
+    _URING_RING_SEND_METHODDEF
+    _URING_RING_ACCEPT_METHODDEF
+    _URING_RING_POLL_METHODDEF
+    _URING_RING_SUBMIT_METHODDEF
+    _URING_RING_WAIT_METHODDEF
+    {NULL}
+};
+
+static PyGetSetDef Ring_getsets[] = {
+    {"closed", Ring_getclosed, NULL,
+     "True if the ring is closed"},
+    {"pending", Ring_getpending, NULL,
+     "Number of operations that have not completed yet"},
+    {NULL},
+};
+
+static PyType_Slot ring_type_slots[] = {
+    {Py_tp_dealloc, Ring_dealloc},
+    {Py_tp_doc, (char *)_uring_Ring__doc__},
+    {Py_tp_methods, Ring_methods},
+    {Py_tp_getset, Ring_getsets},
+    {Py_tp_new, _uring_Ring},
+    {0, 0}
+};
+
+static PyType_Spec ring_type_spec = {
+    .name = "_uring.Ring",
+    .basicsize = sizeof(RingObject),
+    .flags = (Py_TPFLAGS_DEFAULT | Py_TPFLAGS_IMMUTABLETYPE),
+    .slots = ring_type_slots
+};
+
+
+/*
+ * Module
+ */
+
+static int
+uring_exec(PyObject *module)
+{
+    uring_state *state = get_uring_state(module);
+
+    state->ring_type = (PyTypeObject *)PyType_FromModuleAndSpec(
+        module, &ring_type_spec, NULL);
+    if (state->ring_type == NULL) {
+        return -1;
+    }
+    if (PyModule_AddType(module, state->ring_type) < 0) {
+        return -1;
+    }
+    state->operation_type = (PyTypeObject *)PyType_FromModuleAndSpec(
+        module, &operation_type_spec, NULL);
+    if (state->operation_type == NULL) {
+        return -1;
+    }
+    if (PyModule_AddType(module, state->operation_type) < 0) {
+        return -1;
+    }
+    return 0;
+}
+
+static int
+uring_traverse(PyObject *module, visitproc visit, void *arg)
+{
+    uring_state *state = get_uring_state(module);
+    Py_VISIT(state->ring_type);
+    Py_VISIT(state->operation_type);
+    return 0;
+}
+
+static int
+uring_clear(PyObject *module)
+{
+    uring_state *state = get_uring_state(module);
+    Py_CLEAR(state->ring_type);
+    Py_CLEAR(state->operation_type);
+    return 0;
+}
+
+static void
+uring_free(void *module)
+{
+    (void)uring_clear((PyObject *)module);
+}
+
+static PyModuleDef_Slot uring_slots[] = {
+    {Py_mod_exec, uring_exec},
+    {Py_mod_multiple_interpreters, Py_MOD_PER_INTERPRETER_GIL_SUPPORTED},
+    {Py_mod_gil, Py_MOD_GIL_NOT_USED},
+    {0, NULL}
+};
+
+PyDoc_STRVAR(uring_doc,
+"Linux io_uring support for asyncio's UringEventLoop.");
+
+static struct PyModuleDef uring_module = {
+    .m_base = PyModuleDef_HEAD_INIT,
+    .m_name = "_uring",
+    .m_doc = uring_doc,
+    .m_size = sizeof(uring_state),
+    .m_slots = uring_slots,
+    .m_traverse = uring_traverse,
+    .m_clear = uring_clear,
+    .m_free = uring_free,
+};
+
+PyMODINIT_FUNC
+PyInit__uring(void)
+{
+    return PyModuleDef_Init(&uring_module);
+}
@@ -6,6 +6,7 @@ preserve
 #  include "pycore_gc.h"          // PyGC_Head
 #  include "pycore_runtime.h"     // _Py_ID()
 #endif
+#include "pycore_abstract.h"      // _PyNumber_Index()
 #include "pycore_critical_section.h"// Py_BEGIN_CRITICAL_SECTION()
 #include "pycore_modsupport.h"    // _PyArg_UnpackKeywords()
 
@@ -1537,6 +1538,245 @@ _asyncio_Task_set_name(PyObject *self, PyObject *value)
     return return_value;
 }
 
+PyDoc_STRVAR(_asyncio_ReadyQueue__doc__,
+"ReadyQueue(loop, workers=1)\n"
+"--\n"
+"\n"
+"The queue of callbacks that are ready to run on an event loop.\n"
+"\n"
+"The queue is split between the given number of worker threads, see\n"
+"run().");
+
+static PyObject *
+_asyncio_ReadyQueue_impl(PyTypeObject *type, PyObject *loop,
+                         Py_ssize_t workers);
+
+static PyObject *
+_asyncio_ReadyQueue(PyTypeObject *type, PyObject *args, PyObject *kwargs)
+{
+    PyObject *return_value = NULL;
+    #if defined(Py_BUILD_CORE) && !defined(Py_BUILD_CORE_MODULE)
+
+    #define NUM_KEYWORDS 2
+    static struct {
+        PyGC_Head _this_is_not_used;
+        PyObject_VAR_HEAD
+        Py_hash_t ob_hash;
+        PyObject *ob_item[NUM_KEYWORDS];
+    } _kwtuple = {
+        .ob_base = PyVarObject_HEAD_INIT(&PyTuple_Type, NUM_KEYWORDS)
+        .ob_hash = -1,
+        .ob_item = { &_Py_ID(loop), &_Py_ID(workers), },
+    };
+    #undef NUM_KEYWORDS
+    #define KWTUPLE (&_kwtuple.ob_base.ob_base)
+
+    #else  // !Py_BUILD_CORE
+    #  define KWTUPLE NULL
+    #endif  // !Py_BUILD_CORE
+
+    static const char * const _keywords[] = {"loop", "workers", NULL};
+    static _PyArg_Parser _parser = {
+        .keywords = _keywords,
+        .fname = "ReadyQueue",
+        .kwtuple = KWTUPLE,
+    };
+    #undef KWTUPLE
+    PyObject *argsbuf[2];
+    PyObject * const *fastargs;
+    Py_ssize_t nargs = PyTuple_GET_SIZE(args);
+    Py_ssize_t noptargs = nargs + (kwargs ? PyDict_GET_SIZE(kwargs) : 0) - 1;
+    PyObject *loop;
+    Py_ssize_t workers = 1;
+
+    fastargs = _PyArg_UnpackKeywords(_PyTuple_CAST(args)->ob_item, nargs, kwargs, NULL, &_parser,
+            /*minpos*/ 1, /*maxpos*/ 2, /*minkw*/ 0, /*varpos*/ 0, argsbuf);
+    if (!fastargs) {
+        goto exit;
+    }
+    loop = fastargs[0];
+    if (!noptargs) {
+        goto skip_optional_pos;
+    }
+    {
+        Py_ssize_t ival = -1;
+        PyObject *iobj = _PyNumber_Index(fastargs[1]);
+        if (iobj != NULL) {
+            ival = PyLong_AsSsize_t(iobj);
+            Py_DECREF(iobj);
+        }
+        if (ival == -1 && PyErr_Occurred()) {
+            goto exit;
+        }
+        workers = ival;
+    }
+skip_optional_pos:
+    return_value = _asyncio_ReadyQueue_impl(type, loop, workers);
+
+exit:
+    return return_value;
+}
+
+PyDoc_STRVAR(_asyncio_ReadyQueue_append__doc__,
+"append($self, handle, /)\n"
+"--\n"
+"\n"
+"Add a Handle to the end of the queue.");
+
+#define _ASYNCIO_READYQUEUE_APPEND_METHODDEF    \
+    {"append", (PyCFunction)_asyncio_ReadyQueue_append, METH_O, _asyncio_ReadyQueue_append__doc__},
+
+static PyObject *
+_asyncio_ReadyQueue_append_impl(ReadyQueueObj *self, PyObject *handle);
+
+static PyObject *
+_asyncio_ReadyQueue_append(PyObject *self, PyObject *handle)
+{
+    PyObject *return_value = NULL;
+
+    return_value = _asyncio_ReadyQueue_append_impl((ReadyQueueObj *)self, handle);
+
+    return return_value;
+}
+
+PyDoc_STRVAR(_asyncio_ReadyQueue_popleft__doc__,
+"popleft($self, /)\n"
+"--\n"
+"\n"
+"Remove and return the Handle at the start of the queue.");
+
+#define _ASYNCIO_READYQUEUE_POPLEFT_METHODDEF    \
+    {"popleft", (PyCFunction)_asyncio_ReadyQueue_popleft, METH_NOARGS, _asyncio_ReadyQueue_popleft__doc__},
+
+static PyObject *
+_asyncio_ReadyQueue_popleft_impl(ReadyQueueObj *self);
+
+static PyObject *
+_asyncio_ReadyQueue_popleft(PyObject *self, PyObject *Py_UNUSED(ignored))
+{
+    return _asyncio_ReadyQueue_popleft_impl((ReadyQueueObj *)self);
+}
+
+PyDoc_STRVAR(_asyncio_ReadyQueue_clear__doc__,
+"clear($self, /)\n"
+"--\n"
+"\n"
+"Remove all callbacks from the queue.");
+
+#define _ASYNCIO_READYQUEUE_CLEAR_METHODDEF    \
+    {"clear", (PyCFunction)_asyncio_ReadyQueue_clear, METH_NOARGS, _asyncio_ReadyQueue_clear__doc__},
+
+static PyObject *
+_asyncio_ReadyQueue_clear_impl(ReadyQueueObj *self);
+
+static PyObject *
+_asyncio_ReadyQueue_clear(PyObject *self, PyObject *Py_UNUSED(ignored))
+{
+    return _asyncio_ReadyQueue_clear_impl((ReadyQueueObj *)self);
+}
+
+PyDoc_STRVAR(_asyncio_ReadyQueue_run__doc__,
+"run($self, ntodo, worker=0, /)\n"
+"--\n"
+"\n"
+"Pop and run up to ntodo callbacks from the start of the queue.\n"
+"\n"
+"Callbacks are taken from the given worker\'s part of the queue, then\n"
+"from the other workers\' parts once it is empty.  Meanwhile, callbacks\n"
+"scheduled by the calling thread are added to the worker\'s part.\n"
+"Cancelled Handles are skipped.  Return the number of callbacks popped.");
+
+#define _ASYNCIO_READYQUEUE_RUN_METHODDEF    \
+    {"run", _PyCFunction_CAST(_asyncio_ReadyQueue_run), METH_FASTCALL, _asyncio_ReadyQueue_run__doc__},
+
+static PyObject *
+_asyncio_ReadyQueue_run_impl(ReadyQueueObj *self, Py_ssize_t ntodo,
+                             Py_ssize_t worker);
+
+static PyObject *
+_asyncio_ReadyQueue_run(PyObject *self, PyObject *const *args, Py_ssize_t nargs)
+{
+    PyObject *return_value = NULL;
+    Py_ssize_t ntodo;
+    Py_ssize_t worker = 0;
+
+    if (!_PyArg_CheckPositional("run", nargs, 1, 2)) {
+        goto exit;
+    }
+    {
+        Py_ssize_t ival = -1;
+        PyObject *iobj = _PyNumber_Index(args[0]);
+        if (iobj != NULL) {
+            ival = PyLong_AsSsize_t(iobj);
+            Py_DECREF(iobj);
+        }
+        if (ival == -1 && PyErr_Occurred()) {
+            goto exit;
+        }
+        ntodo = ival;
+    }
+    if (nargs < 2) {
+        goto skip_optional;
+    }
+    {
+        Py_ssize_t ival = -1;
+        PyObject *iobj = _PyNumber_Index(args[1]);
+        if (iobj != NULL) {
+            ival = PyLong_AsSsize_t(iobj);
+            Py_DECREF(iobj);
+        }
+        if (ival == -1 && PyErr_Occurred()) {
+            goto exit;
+        }
+        worker = ival;
+    }
+skip_optional:
+    return_value = _asyncio_ReadyQueue_run_impl((ReadyQueueObj *)self, ntodo, worker);
+
+exit:
+    return return_value;
+}
+
+PyDoc_STRVAR(_asyncio_ReadyQueue_wait__doc__,
+"wait($self, /)\n"
+"--\n"
+"\n"
+"Block until callbacks are added to the queue or wakeup() is called.\n"
+"\n"
+"Return immediately if the queue is not empty, if the loop is stopping,\n"
+"or if all the other workers are already waiting: the caller is then\n"
+"the last running worker, which is expected to poll for I/O instead.");
+
+#define _ASYNCIO_READYQUEUE_WAIT_METHODDEF    \
+    {"wait", (PyCFunction)_asyncio_ReadyQueue_wait, METH_NOARGS, _asyncio_ReadyQueue_wait__doc__},
+
+static PyObject *
+_asyncio_ReadyQueue_wait_impl(ReadyQueueObj *self);
+
+static PyObject *
+_asyncio_ReadyQueue_wait(PyObject *self, PyObject *Py_UNUSED(ignored))
+{
+    return _asyncio_ReadyQueue_wait_impl((ReadyQueueObj *)self);
+}
+
+PyDoc_STRVAR(_asyncio_ReadyQueue_wakeup__doc__,
+"wakeup($self, /)\n"
+"--\n"
+"\n"
+"Wake up all the workers blocked in wait().");
+
+#define _ASYNCIO_READYQUEUE_WAKEUP_METHODDEF    \
+    {"wakeup", (PyCFunction)_asyncio_ReadyQueue_wakeup, METH_NOARGS, _asyncio_ReadyQueue_wakeup__doc__},
+
+static PyObject *
+_asyncio_ReadyQueue_wakeup_impl(ReadyQueueObj *self);
+
+static PyObject *
+_asyncio_ReadyQueue_wakeup(PyObject *self, PyObject *Py_UNUSED(ignored))
+{
+    return _asyncio_ReadyQueue_wakeup_impl((ReadyQueueObj *)self);
+}
+
 PyDoc_STRVAR(_asyncio__get_running_loop__doc__,
 "_get_running_loop($module, /)\n"
 "--\n"
@@ -2232,4 +2472,16 @@ _asyncio_future_discard_from_awaited_by(PyObject *module, PyObject *const *args,
 exit:
     return return_value;
 }
-/*[clinic end generated code: output=b69948ed810591d9 input=a9049054013a1b77]*/
+
+PyDoc_STRVAR(_asyncio__set_base_event_loop__doc__,
+"_set_base_event_loop($module, cls, /)\n"
+"--\n"
+"\n"
+"Record the asyncio.BaseEventLoop class.\n"
+"\n"
+"Futures and Tasks put their callbacks straight into the ReadyQueue of\n"
+"loops that use the call_soon() implementation of this class.");
+
+#define _ASYNCIO__SET_BASE_EVENT_LOOP_METHODDEF    \
+    {"_set_base_event_loop", (PyCFunction)_asyncio__set_base_event_loop, METH_O, _asyncio__set_base_event_loop__doc__},
+/*[clinic end generated code: output=b3a81e21e0de02a9 input=a9049054013a1b77]*/
@@ -68,6 +68,76 @@ exit:
     return return_value;
 }
 
+PyDoc_STRVAR(py_find_item_end__doc__,
+"find_item_end($module, pystr, idx, depth, in_string, /)\n"
+"--\n"
+"\n"
+"Find the end of the JSON array item that contains index idx of s.\n"
+"\n"
+"Scanning starts at idx, which is nested depth levels deep in the item\n"
+"and inside a string if in_string is true.  Returns a tuple\n"
+"(end, depth, in_string).  If the item is complete, end is the index of\n"
+"the \',\', \']\' or \'}\' following it and in_string is False.  Otherwise\n"
+"end is where the scan should be resumed once more data is available.");
+
+#define PY_FIND_ITEM_END_METHODDEF    \
+    {"find_item_end", _PyCFunction_CAST(py_find_item_end), METH_FASTCALL, py_find_item_end__doc__},
+
+static PyObject *
+py_find_item_end_impl(PyObject *module, PyObject *pystr, Py_ssize_t idx,
+                      Py_ssize_t depth, int in_string);
+
+static PyObject *
+py_find_item_end(PyObject *module, PyObject *const *args, Py_ssize_t nargs)
+{
+    PyObject *return_value = NULL;
+    PyObject *pystr;
+    Py_ssize_t idx;
+    Py_ssize_t depth;
+    int in_string;
+
+    if (!_PyArg_CheckPositional("find_item_end", nargs, 4, 4)) {
+        goto exit;
+    }
+    if (!PyUnicode_Check(args[0])) {
+        _PyArg_BadArgument("find_item_end", "argument 1", "str", args[0]);
+        goto exit;
+    }
+    pystr = args[0];
+    {
+        Py_ssize_t ival = -1;
+        PyObject *iobj = _PyNumber_Index(args[1]);
+        if (iobj != NULL) {
+            ival = PyLong_AsSsize_t(iobj);
+            Py_DECREF(iobj);
+        }
+        if (ival == -1 && PyErr_Occurred()) {
+            goto exit;
+        }
+        idx = ival;
+    }
+    {
+        Py_ssize_t ival = -1;
+        PyObject *iobj = _PyNumber_Index(args[2]);
+        if (iobj != NULL) {
+            ival = PyLong_AsSsize_t(iobj);
+            Py_DECREF(iobj);
+        }
+        if (ival == -1 && PyErr_Occurred()) {
+            goto exit;
+        }
+        depth = ival;
+    }
+    in_string = PyObject_IsTrue(args[3]);
+    if (in_string < 0) {
+        goto exit;
+    }
+    return_value = py_find_item_end_impl(module, pystr, idx, depth, in_string);
+
+exit:
+    return return_value;
+}
+
 PyDoc_STRVAR(py_encode_basestring_ascii__doc__,
 "encode_basestring_ascii($module, pystr, /)\n"
 "--\n"
@@ -125,4 +195,4 @@ py_encode_basestring(PyObject *module, PyObject *arg)
 exit:
     return return_value;
 }
-/*[clinic end generated code: output=5bdd16375c95a4d9 input=a9049054013a1b77]*/
+/*[clinic end generated code: output=9399c3af582964af input=a9049054013a1b77]*/
@@ -0,0 +1,665 @@
+/*[clinic input]
+preserve
+[clinic start generated code]*/
+
+#if defined(Py_BUILD_CORE) && !defined(Py_BUILD_CORE_MODULE)
+#  include "pycore_gc.h"          // PyGC_Head
+#  include "pycore_runtime.h"     // _Py_ID()
+#endif
+#include "pycore_abstract.h"      // _PyNumber_Index()
+#include "pycore_critical_section.h"// Py_BEGIN_CRITICAL_SECTION()
+#include "pycore_modsupport.h"    // _PyArg_UnpackKeywords()
+
+PyDoc_STRVAR(_uring_Operation_getresult__doc__,
+"getresult($self, /)\n"
+"--\n"
+"\n"
+"Retrieve the result of the operation.\n"
+"\n"
+"Return the data read by read() and recv(), or the integer result of\n"
+"the other operations.  Raise OSError if the operation failed.");
+
+#define _URING_OPERATION_GETRESULT_METHODDEF    \
+    {"getresult", (PyCFunction)_uring_Operation_getresult, METH_NOARGS, _uring_Operation_getresult__doc__},
+
+static PyObject *
+_uring_Operation_getresult_impl(OperationObject *self);
+
+static PyObject *
+_uring_Operation_getresult(PyObject *self, PyObject *Py_UNUSED(ignored))
+{
+    PyObject *return_value = NULL;
+
+    Py_BEGIN_CRITICAL_SECTION(self);
+    return_value = _uring_Operation_getresult_impl((OperationObject *)self);
+    Py_END_CRITICAL_SECTION();
+
+    return return_value;
+}
+
+PyDoc_STRVAR(_uring_Operation_cancel__doc__,
+"cancel($self, /)\n"
+"--\n"
+"\n"
+"Ask the kernel to cancel the operation if it is still pending.\n"
+"\n"
+"The operation still completes, typically with ECANCELED, and is\n"
+"returned by a later Ring.wait() call.");
+
+#define _URING_OPERATION_CANCEL_METHODDEF    \
+    {"cancel", (PyCFunction)_uring_Operation_cancel, METH_NOARGS, _uring_Operation_cancel__doc__},
+
+static PyObject *
+_uring_Operation_cancel_impl(OperationObject *self);
+
+static PyObject *
+_uring_Operation_cancel(PyObject *self, PyObject *Py_UNUSED(ignored))
+{
+    return _uring_Operation_cancel_impl((OperationObject *)self);
+}
+
+PyDoc_STRVAR(_uring_Ring__doc__,
+"Ring(entries=256)\n"
+"--\n"
+"\n"
+"Create an io_uring instance.\n"
+"\n"
+"The entries argument is the number of operations that can be queued\n"
+"between two submissions.  Raise OSError if io_uring is not available\n"
+"or lacks a required feature.");
+
+static PyObject *
+_uring_Ring_impl(PyTypeObject *type, int entries);
+
+static PyObject *
+_uring_Ring(PyTypeObject *type, PyObject *args, PyObject *kwargs)
+{
+    PyObject *return_value = NULL;
+    #if defined(Py_BUILD_CORE) && !defined(Py_BUILD_CORE_MODULE)
+
+    #define NUM_KEYWORDS 1
+    static struct {
+        PyGC_Head _this_is_not_used;
+        PyObject_VAR_HEAD
+        Py_hash_t ob_hash;
+        PyObject *ob_item[NUM_KEYWORDS];
+    } _kwtuple = {
+        .ob_base = PyVarObject_HEAD_INIT(&PyTuple_Type, NUM_KEYWORDS)
+        .ob_hash = -1,
+        .ob_item = { &_Py_ID(entries), },
+    };
+    #undef NUM_KEYWORDS
+    #define KWTUPLE (&_kwtuple.ob_base.ob_base)
+
+    #else  // !Py_BUILD_CORE
+    #  define KWTUPLE NULL
+    #endif  // !Py_BUILD_CORE
+
+    static const char * const _keywords[] = {"entries", NULL};
+    static _PyArg_Parser _parser = {
+        .keywords = _keywords,
+        .fname = "Ring",
+        .kwtuple = KWTUPLE,
+    };
+    #undef KWTUPLE
+    PyObject *argsbuf[1];
+    PyObject * const *fastargs;
+    Py_ssize_t nargs = PyTuple_GET_SIZE(args);
+    Py_ssize_t noptargs = nargs + (kwargs ? PyDict_GET_SIZE(kwargs) : 0) - 0;
+    int entries = 256;
+
+    fastargs = _PyArg_UnpackKeywords(_PyTuple_CAST(args)->ob_item, nargs, kwargs, NULL, &_parser,
+            /*minpos*/ 0, /*maxpos*/ 1, /*minkw*/ 0, /*varpos*/ 0, argsbuf);
+    if (!fastargs) {
+        goto exit;
+    }
+    if (!noptargs) {
+        goto skip_optional_pos;
+    }
+    entries = PyLong_AsInt(fastargs[0]);
+    if (entries == -1 && PyErr_Occurred()) {
+        goto exit;
+    }
+skip_optional_pos:
+    return_value = _uring_Ring_impl(type, entries);
+
+exit:
+    return return_value;
+}
+
+PyDoc_STRVAR(_uring_Ring_close__doc__,
+"close($self, /)\n"
+"--\n"
+"\n"
+"Close the ring.\n"
+"\n"
+"Pending operations are cancelled first.  Those which the kernel does not\n"
+"cancel are never completed, and the buffers they use are leaked.");
+
+#define _URING_RING_CLOSE_METHODDEF    \
+    {"close", (PyCFunction)_uring_Ring_close, METH_NOARGS, _uring_Ring_close__doc__},
+
+static PyObject *
+_uring_Ring_close_impl(RingObject *self);
+
+static PyObject *
+_uring_Ring_close(PyObject *self, PyObject *Py_UNUSED(ignored))
+{
+    PyObject *return_value = NULL;
+
+    Py_BEGIN_CRITICAL_SECTION(self);
+    return_value = _uring_Ring_close_impl((RingObject *)self);
+    Py_END_CRITICAL_SECTION();
+
+    return return_value;
+}
+
+PyDoc_STRVAR(_uring_Ring_fileno__doc__,
+"fileno($self, /)\n"
+"--\n"
+"\n"
+"Return the file descriptor of the ring.");
+
+#define _URING_RING_FILENO_METHODDEF    \
+    {"fileno", (PyCFunction)_uring_Ring_fileno, METH_NOARGS, _uring_Ring_fileno__doc__},
+
+static PyObject *
+_uring_Ring_fileno_impl(RingObject *self);
+
+static PyObject *
+_uring_Ring_fileno(PyObject *self, PyObject *Py_UNUSED(ignored))
+{
+    PyObject *return_value = NULL;
+
+    Py_BEGIN_CRITICAL_SECTION(self);
+    return_value = _uring_Ring_fileno_impl((RingObject *)self);
+    Py_END_CRITICAL_SECTION();
+
+    return return_value;
+}
+
+PyDoc_STRVAR(_uring_Ring_read__doc__,
+"read($self, fd, nbytes, offset=-1, /)\n"
+"--\n"
+"\n"
+"Queue a read of up to nbytes bytes from fd.\n"
+"\n"
+"If offset is -1, read from the current file position.  The result is a\n"
+"bytes object.");
+
+#define _URING_RING_READ_METHODDEF    \
+    {"read", _PyCFunction_CAST(_uring_Ring_read), METH_FASTCALL, _uring_Ring_read__doc__},
+
+static PyObject *
+_uring_Ring_read_impl(RingObject *self, int fd, Py_ssize_t nbytes,
+                      long long offset);
+
+static PyObject *
+_uring_Ring_read(PyObject *self, PyObject *const *args, Py_ssize_t nargs)
+{
+    PyObject *return_value = NULL;
+    int fd;
+    Py_ssize_t nbytes;
+    long long offset = -1;
+
+    if (!_PyArg_CheckPositional("read", nargs, 2, 3)) {
+        goto exit;
+    }
+    fd = PyLong_AsInt(args[0]);
+    if (fd == -1 && PyErr_Occurred()) {
+        goto exit;
+    }
+    {
+        Py_ssize_t ival = -1;
+        PyObject *iobj = _PyNumber_Index(args[1]);
+        if (iobj != NULL) {
+            ival = PyLong_AsSsize_t(iobj);
+            Py_DECREF(iobj);
+        }
+        if (ival == -1 && PyErr_Occurred()) {
+            goto exit;
+        }
+        nbytes = ival;
+    }
+    if (nargs < 3) {
+        goto skip_optional;
+    }
+    offset = PyLong_AsLongLong(args[2]);
+    if (offset == -1 && PyErr_Occurred()) {
+        goto exit;
+    }
+skip_optional:
+    Py_BEGIN_CRITICAL_SECTION(self);
+    return_value = _uring_Ring_read_impl((RingObject *)self, fd, nbytes, offset);
+    Py_END_CRITICAL_SECTION();
+
+exit:
+    return return_value;
+}
+
+PyDoc_STRVAR(_uring_Ring_readinto__doc__,
+"readinto($self, fd, buffer, offset=-1, /)\n"
+"--\n"
+"\n"
+"Queue a read from fd into buffer.\n"
+"\n"
+"If offset is -1, read from the current file position.  The result is\n"
+"the number of bytes read.");
+
+#define _URING_RING_READINTO_METHODDEF    \
+    {"readinto", _PyCFunction_CAST(_uring_Ring_readinto), METH_FASTCALL, _uring_Ring_readinto__doc__},
+
+static PyObject *
+_uring_Ring_readinto_impl(RingObject *self, int fd, Py_buffer *buffer,
+                          long long offset);
+
+static PyObject *
+_uring_Ring_readinto(PyObject *self, PyObject *const *args, Py_ssize_t nargs)
+{
+    PyObject *return_value = NULL;
+    int fd;
+    Py_buffer buffer = {NULL, NULL};
+    long long offset = -1;
+
+    if (!_PyArg_CheckPositional("readinto", nargs, 2, 3)) {
+        goto exit;
+    }
+    fd = PyLong_AsInt(args[0]);
+    if (fd == -1 && PyErr_Occurred()) {
+        goto exit;
+    }
+    if (PyObject_GetBuffer(args[1], &buffer, PyBUF_WRITABLE) < 0) {
+        _PyArg_BadArgument("readinto", "argument 2", "read-write bytes-like object", args[1]);
+        goto exit;
+    }
+    if (nargs < 3) {
+        goto skip_optional;
+    }
+    offset = PyLong_AsLongLong(args[2]);
+    if (offset == -1 && PyErr_Occurred()) {
+        goto exit;
+    }
+skip_optional:
+    Py_BEGIN_CRITICAL_SECTION(self);
+    return_value = _uring_Ring_readinto_impl((RingObject *)self, fd, &buffer, offset);
+    Py_END_CRITICAL_SECTION();
+
+exit:
+    /* Cleanup for buffer */
+    if (buffer.obj) {
+       PyBuffer_Release(&buffer);
+    }
+
+    return return_value;
+}
+
+PyDoc_STRVAR(_uring_Ring_write__doc__,
+"write($self, fd, data, offset=-1, /)\n"
+"--\n"
+"\n"
+"Queue a write of data to fd.\n"
+"\n"
+"If offset is -1, write at the current file position.  The result is\n"
+"the number of bytes written.");
+
+#define _URING_RING_WRITE_METHODDEF    \
+    {"write", _PyCFunction_CAST(_uring_Ring_write), METH_FASTCALL, _uring_Ring_write__doc__},
+
+static PyObject *
+_uring_Ring_write_impl(RingObject *self, int fd, Py_buffer *data,
+                       long long offset);
+
+static PyObject *
+_uring_Ring_write(PyObject *self, PyObject *const *args, Py_ssize_t nargs)
+{
+    PyObject *return_value = NULL;
+    int fd;
+    Py_buffer data = {NULL, NULL};
+    long long offset = -1;
+
+    if (!_PyArg_CheckPositional("write", nargs, 2, 3)) {
+        goto exit;
+    }
+    fd = PyLong_AsInt(args[0]);
+    if (fd == -1 && PyErr_Occurred()) {
+        goto exit;
+    }
+    if (PyObject_GetBuffer(args[1], &data, PyBUF_SIMPLE) != 0) {
+        goto exit;
+    }
+    if (nargs < 3) {
+        goto skip_optional;
+    }
+    offset = PyLong_AsLongLong(args[2]);
+    if (offset == -1 && PyErr_Occurred()) {
+        goto exit;
+    }
+skip_optional:
+    Py_BEGIN_CRITICAL_SECTION(self);
+    return_value = _uring_Ring_write_impl((RingObject *)self, fd, &data, offset);
+    Py_END_CRITICAL_SECTION();
+
+exit:
+    /* Cleanup for data */
+    if (data.obj) {
+       PyBuffer_Release(&data);
+    }
+
+    return return_value;
+}
+
+PyDoc_STRVAR(_uring_Ring_recv__doc__,
+"recv($self, fd, nbytes, flags=0, /)\n"
+"--\n"
+"\n"
+"Queue a receive of up to nbytes bytes from the socket fd.\n"
+"\n"
+"The result is a bytes object.");
+
+#define _URING_RING_RECV_METHODDEF    \
+    {"recv", _PyCFunction_CAST(_uring_Ring_recv), METH_FASTCALL, _uring_Ring_recv__doc__},
+
+static PyObject *
+_uring_Ring_recv_impl(RingObject *self, int fd, Py_ssize_t nbytes, int flags);
+
+static PyObject *
+_uring_Ring_recv(PyObject *self, PyObject *const *args, Py_ssize_t nargs)
+{
+    PyObject *return_value = NULL;
+    int fd;
+    Py_ssize_t nbytes;
+    int flags = 0;
+
+    if (!_PyArg_CheckPositional("recv", nargs, 2, 3)) {
+        goto exit;
+    }
+    fd = PyLong_AsInt(args[0]);
+    if (fd == -1 && PyErr_Occurred()) {
+        goto exit;
+    }
+    {
+        Py_ssize_t ival = -1;
+        PyObject *iobj = _PyNumber_Index(args[1]);
+        if (iobj != NULL) {
+            ival = PyLong_AsSsize_t(iobj);
+            Py_DECREF(iobj);
+        }
+        if (ival == -1 && PyErr_Occurred()) {
+            goto exit;
+        }
+        nbytes = ival;
+    }
+    if (nargs < 3) {
+        goto skip_optional;
+    }
+    flags = PyLong_AsInt(args[2]);
+    if (flags == -1 && PyErr_Occurred()) {
+        goto exit;
+    }
+skip_optional:
+    Py_BEGIN_CRITICAL_SECTION(self);
+    return_value = _uring_Ring_recv_impl((RingObject *)self, fd, nbytes, flags);
+    Py_END_CRITICAL_SECTION();
+
+exit:
+    return return_value;
+}
+
+PyDoc_STRVAR(_uring_Ring_recv_into__doc__,
+"recv_into($self, fd, buffer, flags=0, /)\n"
+"--\n"
+"\n"
+"Queue a receive from the socket fd into buffer.\n"
+"\n"
+"The result is the number of bytes received.");
+
+#define _URING_RING_RECV_INTO_METHODDEF    \
+    {"recv_into", _PyCFunction_CAST(_uring_Ring_recv_into), METH_FASTCALL, _uring_Ring_recv_into__doc__},
+
+static PyObject *
+_uring_Ring_recv_into_impl(RingObject *self, int fd, Py_buffer *buffer,
+                           int flags);
+
+static PyObject *
+_uring_Ring_recv_into(PyObject *self, PyObject *const *args, Py_ssize_t nargs)
+{
+    PyObject *return_value = NULL;
+    int fd;
+    Py_buffer buffer = {NULL, NULL};
+    int flags = 0;
+
+    if (!_PyArg_CheckPositional("recv_into", nargs, 2, 3)) {
+        goto exit;
+    }
+    fd = PyLong_AsInt(args[0]);
+    if (fd == -1 && PyErr_Occurred()) {
+        goto exit;
+    }
+    if (PyObject_GetBuffer(args[1], &buffer, PyBUF_WRITABLE) < 0) {
+        _PyArg_BadArgument("recv_into", "argument 2", "read-write bytes-like object", args[1]);
+        goto exit;
+    }
+    if (nargs < 3) {
+        goto skip_optional;
+    }
+    flags = PyLong_AsInt(args[2]);
+    if (flags == -1 && PyErr_Occurred()) {
+        goto exit;
+    }
+skip_optional:
+    Py_BEGIN_CRITICAL_SECTION(self);
+    return_value = _uring_Ring_recv_into_impl((RingObject *)self, fd, &buffer, flags);
+    Py_END_CRITICAL_SECTION();
+
+exit:
+    /* Cleanup for buffer */
+    if (buffer.obj) {
+       PyBuffer_Release(&buffer);
+    }
+
+    return return_value;
+}
+
+PyDoc_STRVAR(_uring_Ring_send__doc__,
+"send($self, fd, data, flags=0, /)\n"
+"--\n"
+"\n"
+"Queue a send of data on the socket fd.\n"
+"\n"
+"The result is the number of bytes sent.");
+
+#define _URING_RING_SEND_METHODDEF    \
+    {"send", _PyCFunction_CAST(_uring_Ring_send), METH_FASTCALL, _uring_Ring_send__doc__},
+
+static PyObject *
+_uring_Ring_send_impl(RingObject *self, int fd, Py_buffer *data, int flags);
+
+static PyObject *
+_uring_Ring_send(PyObject *self, PyObject *const *args, Py_ssize_t nargs)
+{
+    PyObject *return_value = NULL;
+    int fd;
+    Py_buffer data = {NULL, NULL};
+    int flags = 0;
+
+    if (!_PyArg_CheckPositional("send", nargs, 2, 3)) {
+        goto exit;
+    }
+    fd = PyLong_AsInt(args[0]);
+    if (fd == -1 && PyErr_Occurred()) {
+        goto exit;
+    }
+    if (PyObject_GetBuffer(args[1], &data, PyBUF_SIMPLE) != 0) {
+        goto exit;
+    }
+    if (nargs < 3) {
+        goto skip_optional;
+    }
+    flags = PyLong_AsInt(args[2]);
+    if (flags == -1 && PyErr_Occurred()) {
+        goto exit;
+    }
+skip_optional:
+    Py_BEGIN_CRITICAL_SECTION(self);
+    return_value = _uring_Ring_send_impl((RingObject *)self, fd, &data, flags);
+    Py_END_CRITICAL_SECTION();
+
+exit:
+    /* Cleanup for data */
+    if (data.obj) {
+       PyBuffer_Release(&data);
+    }
+
+    return return_value;
+}
+
+PyDoc_STRVAR(_uring_Ring_accept__doc__,
+"accept($self, fd, /)\n"
+"--\n"
+"\n"
+"Queue an accept on the listening socket fd.\n"
+"\n"
+"The result is the file descriptor of the new connection, which is\n"
+"created with the close-on-exec flag set.");
+
+#define _URING_RING_ACCEPT_METHODDEF    \
+    {"accept", (PyCFunction)_uring_Ring_accept, METH_O, _uring_Ring_accept__doc__},
+
+static PyObject *
+_uring_Ring_accept_impl(RingObject *self, int fd);
+
+static PyObject *
+_uring_Ring_accept(PyObject *self, PyObject *arg)
+{
+    PyObject *return_value = NULL;
+    int fd;
+
+    fd = PyLong_AsInt(arg);
+    if (fd == -1 && PyErr_Occurred()) {
+        goto exit;
+    }
+    Py_BEGIN_CRITICAL_SECTION(self);
+    return_value = _uring_Ring_accept_impl((RingObject *)self, fd);
+    Py_END_CRITICAL_SECTION();
+
+exit:
+    return return_value;
+}
+
+PyDoc_STRVAR(_uring_Ring_poll__doc__,
+"poll($self, fd, events, /)\n"
+"--\n"
+"\n"
+"Queue a one-shot wait for the poll events to be signalled on fd.\n"
+"\n"
+"The result is the mask of events that occurred.");
+
+#define _URING_RING_POLL_METHODDEF    \
+    {"poll", _PyCFunction_CAST(_uring_Ring_poll), METH_FASTCALL, _uring_Ring_poll__doc__},
+
+static PyObject *
+_uring_Ring_poll_impl(RingObject *self, int fd, unsigned short events);
+
+static PyObject *
+_uring_Ring_poll(PyObject *self, PyObject *const *args, Py_ssize_t nargs)
+{
+    PyObject *return_value = NULL;
+    int fd;
+    unsigned short events;
+
+    if (!_PyArg_CheckPositional("poll", nargs, 2, 2)) {
+        goto exit;
+    }
+    fd = PyLong_AsInt(args[0]);
+    if (fd == -1 && PyErr_Occurred()) {
+        goto exit;
+    }
+    {
+        Py_ssize_t _bytes = PyLong_AsNativeBytes(args[1], &events, sizeof(unsigned short),
+                Py_ASNATIVEBYTES_NATIVE_ENDIAN |
+                Py_ASNATIVEBYTES_ALLOW_INDEX |
+                Py_ASNATIVEBYTES_UNSIGNED_BUFFER);
+        if (_bytes < 0) {
+            goto exit;
+        }
+        if ((size_t)_bytes > sizeof(unsigned short)) {
+            if (PyErr_WarnEx(PyExc_DeprecationWarning,
+                "integer value out of range", 1) < 0)
+            {
+                goto exit;
+            }
+        }
+    }
+    Py_BEGIN_CRITICAL_SECTION(self);
+    return_value = _uring_Ring_poll_impl((RingObject *)self, fd, events);
+    Py_END_CRITICAL_SECTION();
+
+exit:
+    return return_value;
+}
+
+PyDoc_STRVAR(_uring_Ring_submit__doc__,
+"submit($self, /)\n"
+"--\n"
+"\n"
+"Hand the queued operations to the kernel.\n"
+"\n"
+"Return the number of operations that are still queued, which is only\n"
+"non-zero if the kernel is short of resources.");
+
+#define _URING_RING_SUBMIT_METHODDEF    \
+    {"submit", (PyCFunction)_uring_Ring_submit, METH_NOARGS, _uring_Ring_submit__doc__},
+
+static PyObject *
+_uring_Ring_submit_impl(RingObject *self);
+
+static PyObject *
+_uring_Ring_submit(PyObject *self, PyObject *Py_UNUSED(ignored))
+{
+    PyObject *return_value = NULL;
+
+    Py_BEGIN_CRITICAL_SECTION(self);
+    return_value = _uring_Ring_submit_impl((RingObject *)self);
+    Py_END_CRITICAL_SECTION();
+
+    return return_value;
+}
+
+PyDoc_STRVAR(_uring_Ring_wait__doc__,
+"wait($self, timeout=None, /)\n"
+"--\n"
+"\n"
+"Submit the queued operations and wait for completions.\n"
+"\n"
+"Wait for up to timeout seconds for at least one operation to complete,\n"
+"or forever if timeout is None.  Return the list of completed\n"
+"operations, which is empty if the wait timed out or was interrupted.");
+
+#define _URING_RING_WAIT_METHODDEF    \
+    {"wait", _PyCFunction_CAST(_uring_Ring_wait), METH_FASTCALL, _uring_Ring_wait__doc__},
+
+static PyObject *
+_uring_Ring_wait_impl(RingObject *self, PyObject *timeout_obj);
+
+static PyObject *
+_uring_Ring_wait(PyObject *self, PyObject *const *args, Py_ssize_t nargs)
+{
+    PyObject *return_value = NULL;
+    PyObject *timeout_obj = Py_None;
+
+    if (!_PyArg_CheckPositional("wait", nargs, 0, 1)) {
+        goto exit;
+    }
+    if (nargs < 1) {
+        goto skip_optional;
+    }
+    timeout_obj = args[0];
+skip_optional:
+    Py_BEGIN_CRITICAL_SECTION(self);
+    return_value = _uring_Ring_wait_impl((RingObject *)self, timeout_obj);
+    Py_END_CRITICAL_SECTION();
+
+exit:
+    return return_value;
+}
+/*[clinic end generated code: output=baf54aee55274c48 input=a9049054013a1b77]*/
@@ -287,6 +287,191 @@ gc_get_threshold(PyObject *module, PyObject *Py_UNUSED(ignored))
     return gc_get_threshold_impl(module);
 }
 
+PyDoc_STRVAR(gc_set_pause_target__doc__,
+"set_pause_target($module, milliseconds, /)\n"
+"--\n"
+"\n"
+"Set the target duration of automatic collections in milliseconds.\n"
+"\n"
+"With a non-zero target, the threshold of the young generation and the\n"
+"size of each increment are adapted so that automatic collections take\n"
+"about this long.  Zero disables the adaptation.  The free-threaded build\n"
+"ignores the target.");
+
+#define GC_SET_PAUSE_TARGET_METHODDEF    \
+    {"set_pause_target", (PyCFunction)gc_set_pause_target, METH_O, gc_set_pause_target__doc__},
+
+static PyObject *
+gc_set_pause_target_impl(PyObject *module, double milliseconds);
+
+static PyObject *
+gc_set_pause_target(PyObject *module, PyObject *arg)
+{
+    PyObject *return_value = NULL;
+    double milliseconds;
+
+    if (PyFloat_CheckExact(arg)) {
+        milliseconds = PyFloat_AS_DOUBLE(arg);
+    }
+    else
+    {
+        milliseconds = PyFloat_AsDouble(arg);
+        if (milliseconds == -1.0 && PyErr_Occurred()) {
+            goto exit;
+        }
+    }
+    return_value = gc_set_pause_target_impl(module, milliseconds);
+
+exit:
+    return return_value;
+}
+
+PyDoc_STRVAR(gc_get_pause_target__doc__,
+"get_pause_target($module, /)\n"
+"--\n"
+"\n"
+"Return the target duration of automatic collections in milliseconds.");
+
+#define GC_GET_PAUSE_TARGET_METHODDEF    \
+    {"get_pause_target", (PyCFunction)gc_get_pause_target, METH_NOARGS, gc_get_pause_target__doc__},
+
+static double
+gc_get_pause_target_impl(PyObject *module);
+
+static PyObject *
+gc_get_pause_target(PyObject *module, PyObject *Py_UNUSED(ignored))
+{
+    PyObject *return_value = NULL;
+    double _return_value;
+
+    _return_value = gc_get_pause_target_impl(module);
+    if ((_return_value == -1.0) && PyErr_Occurred()) {
+        goto exit;
+    }
+    return_value = PyFloat_FromDouble(_return_value);
+
+exit:
+    return return_value;
+}
+
+PyDoc_STRVAR(gc_set_mark_threads__doc__,
+"set_mark_threads($module, num_threads, /)\n"
+"--\n"
+"\n"
+"Set the number of threads used to mark reachable objects.\n"
+"\n"
+"With a value greater than one, collections of large heaps in the\n"
+"free-threaded build mark objects in parallel.  The default build\n"
+"always uses a single thread.");
+
+#define GC_SET_MARK_THREADS_METHODDEF    \
+    {"set_mark_threads", (PyCFunction)gc_set_mark_threads, METH_O, gc_set_mark_threads__doc__},
+
+static PyObject *
+gc_set_mark_threads_impl(PyObject *module, int num_threads);
+
+static PyObject *
+gc_set_mark_threads(PyObject *module, PyObject *arg)
+{
+    PyObject *return_value = NULL;
+    int num_threads;
+
+    num_threads = PyLong_AsInt(arg);
+    if (num_threads == -1 && PyErr_Occurred()) {
+        goto exit;
+    }
+    return_value = gc_set_mark_threads_impl(module, num_threads);
+
+exit:
+    return return_value;
+}
+
+PyDoc_STRVAR(gc_get_mark_threads__doc__,
+"get_mark_threads($module, /)\n"
+"--\n"
+"\n"
+"Return the number of threads used to mark reachable objects.");
+
+#define GC_GET_MARK_THREADS_METHODDEF    \
+    {"get_mark_threads", (PyCFunction)gc_get_mark_threads, METH_NOARGS, gc_get_mark_threads__doc__},
+
+static int
+gc_get_mark_threads_impl(PyObject *module);
+
+static PyObject *
+gc_get_mark_threads(PyObject *module, PyObject *Py_UNUSED(ignored))
+{
+    PyObject *return_value = NULL;
+    int _return_value;
+
+    _return_value = gc_get_mark_threads_impl(module);
+    if ((_return_value == -1) && PyErr_Occurred()) {
+        goto exit;
+    }
+    return_value = PyLong_FromLong((long)_return_value);
+
+exit:
+    return return_value;
+}
+
+PyDoc_STRVAR(gc_set_background__doc__,
+"set_background($module, enabled, /)\n"
+"--\n"
+"\n"
+"Run automatic collections on a dedicated background thread.\n"
+"\n"
+"Only available in the free-threaded build.");
+
+#define GC_SET_BACKGROUND_METHODDEF    \
+    {"set_background", (PyCFunction)gc_set_background, METH_O, gc_set_background__doc__},
+
+static PyObject *
+gc_set_background_impl(PyObject *module, int enabled);
+
+static PyObject *
+gc_set_background(PyObject *module, PyObject *arg)
+{
+    PyObject *return_value = NULL;
+    int enabled;
+
+    enabled = PyObject_IsTrue(arg);
+    if (enabled < 0) {
+        goto exit;
+    }
+    return_value = gc_set_background_impl(module, enabled);
+
+exit:
+    return return_value;
+}
+
+PyDoc_STRVAR(gc_get_background__doc__,
+"get_background($module, /)\n"
+"--\n"
+"\n"
+"Return True if automatic collections run on a background thread.");
+
+#define GC_GET_BACKGROUND_METHODDEF    \
+    {"get_background", (PyCFunction)gc_get_background, METH_NOARGS, gc_get_background__doc__},
+
+static int
+gc_get_background_impl(PyObject *module);
+
+static PyObject *
+gc_get_background(PyObject *module, PyObject *Py_UNUSED(ignored))
+{
+    PyObject *return_value = NULL;
+    int _return_value;
+
+    _return_value = gc_get_background_impl(module);
+    if ((_return_value == -1) && PyErr_Occurred()) {
+        goto exit;
+    }
+    return_value = PyBool_FromLong((long)_return_value);
+
+exit:
+    return return_value;
+}
+
 PyDoc_STRVAR(gc_get_count__doc__,
 "get_count($module, /)\n"
 "--\n"
@@ -583,4 +768,4 @@ gc_get_freeze_count(PyObject *module, PyObject *Py_UNUSED(ignored))
 exit:
     return return_value;
 }
-/*[clinic end generated code: output=19738854607938db input=a9049054013a1b77]*/
+/*[clinic end generated code: output=7a0c41a175fced2c input=a9049054013a1b77]*/
@@ -29,6 +29,57 @@ _socket_socket_close(PyObject *s, PyObject *Py_UNUSED(ignored))
     return _socket_socket_close_impl((PySocketSockObject *)s);
 }
 
+#if defined(HAVE_RECVMMSG)
+
+PyDoc_STRVAR(_socket_socket_recvmmsg_into__doc__,
+"recvmmsg_into($self, buffers, flags=0, /)\n"
+"--\n"
+"\n"
+"Receive several datagrams into a series of buffers with one system call.\n"
+"\n"
+"The buffers argument must be an iterable of objects that export\n"
+"writable buffers (e.g. bytearray objects).  Each datagram received is\n"
+"written into the next buffer; datagrams which do not fit are truncated.\n"
+"The call returns as soon as at least one datagram is available.  The\n"
+"flags argument has the same meaning as for recv().\n"
+"\n"
+"The return value is a list of (nbytes, address) tuples, one for each\n"
+"datagram received, in the order of the buffers they were written to.");
+
+#define _SOCKET_SOCKET_RECVMMSG_INTO_METHODDEF    \
+    {"recvmmsg_into", _PyCFunction_CAST(_socket_socket_recvmmsg_into), METH_FASTCALL, _socket_socket_recvmmsg_into__doc__},
+
+static PyObject *
+_socket_socket_recvmmsg_into_impl(PySocketSockObject *s, PyObject *buffers,
+                                  int flags);
+
+static PyObject *
+_socket_socket_recvmmsg_into(PyObject *s, PyObject *const *args, Py_ssize_t nargs)
+{
+    PyObject *return_value = NULL;
+    PyObject *buffers;
+    int flags = 0;
+
+    if (!_PyArg_CheckPositional("recvmmsg_into", nargs, 1, 2)) {
+        goto exit;
+    }
+    buffers = args[0];
+    if (nargs < 2) {
+        goto skip_optional;
+    }
+    flags = PyLong_AsInt(args[1]);
+    if (flags == -1 && PyErr_Occurred()) {
+        goto exit;
+    }
+skip_optional:
+    return_value = _socket_socket_recvmmsg_into_impl((PySocketSockObject *)s, buffers, flags);
+
+exit:
+    return return_value;
+}
+
+#endif /* defined(HAVE_RECVMMSG) */
+
 PyDoc_STRVAR(_socket_socket_send__doc__,
 "send($self, data, flags=0, /)\n"
 "--\n"
@@ -193,6 +244,55 @@ exit:
 
 #endif /* defined(CMSG_LEN) */
 
+#if defined(HAVE_SENDMMSG)
+
+PyDoc_STRVAR(_socket_socket_sendmmsg__doc__,
+"sendmmsg($self, messages, flags=0, /)\n"
+"--\n"
+"\n"
+"Send several datagrams with one system call.\n"
+"\n"
+"The messages argument is an iterable whose items are either\n"
+"bytes-like objects, sent to the address the socket is connected to, or\n"
+"(data, address) tuples.  The flags argument has the same meaning as\n"
+"for send().  The return value is the number of messages sent, which\n"
+"may be less than the number of items in messages; an error for a\n"
+"later message is only reported by the next call.");
+
+#define _SOCKET_SOCKET_SENDMMSG_METHODDEF    \
+    {"sendmmsg", _PyCFunction_CAST(_socket_socket_sendmmsg), METH_FASTCALL, _socket_socket_sendmmsg__doc__},
+
+static PyObject *
+_socket_socket_sendmmsg_impl(PySocketSockObject *s, PyObject *messages,
+                             int flags);
+
+static PyObject *
+_socket_socket_sendmmsg(PyObject *s, PyObject *const *args, Py_ssize_t nargs)
+{
+    PyObject *return_value = NULL;
+    PyObject *messages;
+    int flags = 0;
+
+    if (!_PyArg_CheckPositional("sendmmsg", nargs, 1, 2)) {
+        goto exit;
+    }
+    messages = args[0];
+    if (nargs < 2) {
+        goto skip_optional;
+    }
+    flags = PyLong_AsInt(args[1]);
+    if (flags == -1 && PyErr_Occurred()) {
+        goto exit;
+    }
+skip_optional:
+    return_value = _socket_socket_sendmmsg_impl((PySocketSockObject *)s, messages, flags);
+
+exit:
+    return return_value;
+}
+
+#endif /* defined(HAVE_SENDMMSG) */
+
 static int
 sock_initobj_impl(PySocketSockObject *self, int family, int type, int proto,
                   PyObject *fdobj);
@@ -526,10 +626,18 @@ exit:
 
 #endif /* (defined(HAVE_IF_NAMEINDEX) || defined(MS_WINDOWS)) */
 
+#ifndef _SOCKET_SOCKET_RECVMMSG_INTO_METHODDEF
+    #define _SOCKET_SOCKET_RECVMMSG_INTO_METHODDEF
+#endif /* !defined(_SOCKET_SOCKET_RECVMMSG_INTO_METHODDEF) */
+
 #ifndef _SOCKET_SOCKET_SENDMSG_METHODDEF
     #define _SOCKET_SOCKET_SENDMSG_METHODDEF
 #endif /* !defined(_SOCKET_SOCKET_SENDMSG_METHODDEF) */
 
+#ifndef _SOCKET_SOCKET_SENDMMSG_METHODDEF
+    #define _SOCKET_SOCKET_SENDMMSG_METHODDEF
+#endif /* !defined(_SOCKET_SOCKET_SENDMMSG_METHODDEF) */
+
 #ifndef _SOCKET_INET_NTOA_METHODDEF
     #define _SOCKET_INET_NTOA_METHODDEF
 #endif /* !defined(_SOCKET_INET_NTOA_METHODDEF) */
@@ -541,4 +649,4 @@ exit:
 #ifndef _SOCKET_IF_INDEXTONAME_METHODDEF
     #define _SOCKET_IF_INDEXTONAME_METHODDEF
 #endif /* !defined(_SOCKET_IF_INDEXTONAME_METHODDEF) */
-/*[clinic end generated code: output=36051ebf6ad1e6f8 input=a9049054013a1b77]*/
+/*[clinic end generated code: output=0b8f097696d98efa input=a9049054013a1b77]*/
@@ -185,6 +185,140 @@ gc_get_threshold_impl(PyObject *module)
                          0);
 }
 
+/*[clinic input]
+gc.set_pause_target
+
+    milliseconds: double
+    /
+
+Set the target duration of automatic collections in milliseconds.
+
+With a non-zero target, the threshold of the young generation and the
+size of each increment are adapted so that automatic collections take
+about this long.  Zero disables the adaptation.  The free-threaded build
+ignores the target.
+[clinic start generated code]*/
+
+static PyObject *
+gc_set_pause_target_impl(PyObject *module, double milliseconds)
+/*[clinic end generated code: output=b29543860f6a1620 input=306312d9748bd22e]*/
+{
+    if (!(milliseconds >= 0.0 && milliseconds <= 1e9)) {
+        PyErr_SetString(PyExc_ValueError,
+                        "pause target must be between 0 and 1e9 milliseconds");
+        return NULL;
+    }
+    GCState *gcstate = get_gc_state();
+    gcstate->pause_target = milliseconds / 1e3;
+    gcstate->pause_cost = 0.0;
+    Py_RETURN_NONE;
+}
+
+/*[clinic input]
+gc.get_pause_target -> double
+
+Return the target duration of automatic collections in milliseconds.
+[clinic start generated code]*/
+
+static double
+gc_get_pause_target_impl(PyObject *module)
+/*[clinic end generated code: output=f4f3c334d92a8021 input=e394b859b473bac9]*/
+{
+    GCState *gcstate = get_gc_state();
+    return gcstate->pause_target * 1e3;
+}
+
+/*[clinic input]
+gc.set_mark_threads
+
+    num_threads: int
+    /
+
+Set the number of threads used to mark reachable objects.
+
+With a value greater than one, collections of large heaps in the
+free-threaded build mark objects in parallel.  The default build
+always uses a single thread.
+[clinic start generated code]*/
+
+static PyObject *
+gc_set_mark_threads_impl(PyObject *module, int num_threads)
+/*[clinic end generated code: output=0f385485369d900a input=42a0f7567592ed95]*/
+{
+    if (num_threads < 1) {
+        PyErr_SetString(PyExc_ValueError,
+                        "number of mark threads must be at least 1");
+        return NULL;
+    }
+#ifdef Py_GIL_DISABLED
+    GCState *gcstate = get_gc_state();
+    _Py_atomic_store_int_relaxed(&gcstate->mark_threads, num_threads);
+#endif
+    Py_RETURN_NONE;
+}
+
+/*[clinic input]
+gc.get_mark_threads -> int
+
+Return the number of threads used to mark reachable objects.
+[clinic start generated code]*/
+
+static int
+gc_get_mark_threads_impl(PyObject *module)
+/*[clinic end generated code: output=69def07a8661eb7c input=582c033187a189eb]*/
+{
+#ifdef Py_GIL_DISABLED
+    GCState *gcstate = get_gc_state();
+    return _Py_atomic_load_int_relaxed(&gcstate->mark_threads);
+#else
+    return 1;
+#endif
+}
+
+/*[clinic input]
+gc.set_background
+
+    enabled: bool
+    /
+
+Run automatic collections on a dedicated background thread.
+
+Only available in the free-threaded build.
+[clinic start generated code]*/
+
+static PyObject *
+gc_set_background_impl(PyObject *module, int enabled)
+/*[clinic end generated code: output=8ed8a1ee8a8d67b9 input=edd8915dcdf7c948]*/
+{
+#ifdef Py_GIL_DISABLED
+    if (_PyGC_SetBackground(_PyThreadState_GET(), enabled) < 0) {
+        return NULL;
+    }
+    Py_RETURN_NONE;
+#else
+    PyErr_SetString(PyExc_NotImplementedError,
+                    "background collection requires the free-threaded build");
+    return NULL;
+#endif
+}
+
+/*[clinic input]
+gc.get_background -> bool
+
+Return True if automatic collections run on a background thread.
+[clinic start generated code]*/
+
+static int
+gc_get_background_impl(PyObject *module)
+/*[clinic end generated code: output=1ac3b1a7dd1c5106 input=f6823b2528b27010]*/
+{
+#ifdef Py_GIL_DISABLED
+    return _PyGC_GetBackground(_PyInterpreterState_GET());
+#else
+    return 0;
+#endif
+}
+
 /*[clinic input]
 gc.get_count
 
@@ -343,6 +477,7 @@ gc_get_stats_impl(PyObject *module)
 {
     int i;
     struct gc_generation_stats stats[NUM_GENERATIONS], *st;
+    int thresholds[NUM_GENERATIONS];
 
     /* To get consistent values despite allocations while constructing
        the result list, we use a snapshot of the running stats. */
@@ -350,6 +485,9 @@ gc_get_stats_impl(PyObject *module)
     for (i = 0; i < NUM_GENERATIONS; i++) {
         stats[i] = gcstate->generation_stats[i];
     }
+    thresholds[0] = gcstate->young.threshold;
+    thresholds[1] = gcstate->old[0].threshold;
+    thresholds[2] = gcstate->old[1].threshold;
 
     PyObject *result = PyList_New(0);
     if (result == NULL)
@@ -358,12 +496,14 @@ gc_get_stats_impl(PyObject *module)
     for (i = 0; i < NUM_GENERATIONS; i++) {
         PyObject *dict;
         st = &stats[i];
-        dict = Py_BuildValue("{snsnsnsnsd}",
+        dict = Py_BuildValue("{snsnsnsnsdsdsi}",
                              "collections", st->collections,
                              "collected", st->collected,
                              "uncollectable", st->uncollectable,
                              "candidates", st->candidates,
-                             "duration", st->duration
+                             "duration", st->duration,
+                             "survival_rate", st->survival_rate,
+                             "threshold", thresholds[i]
                             );
         if (dict == NULL)
             goto error;
@@ -480,6 +620,12 @@ PyDoc_STRVAR(gc__doc__,
 "get_debug() -- Get debugging flags.\n"
 "set_threshold() -- Set the collection thresholds.\n"
 "get_threshold() -- Return the current collection thresholds.\n"
+"set_pause_target() -- Set the target duration of automatic collections.\n"
+"get_pause_target() -- Return the target duration of automatic collections.\n"
+"set_mark_threads() -- Set the number of threads used to mark objects.\n"
+"get_mark_threads() -- Return the number of threads used to mark objects.\n"
+"set_background() -- Run automatic collections on a background thread.\n"
+"get_background() -- Return true if collections run on a background thread.\n"
 "get_objects() -- Return a list of all objects tracked by the collector.\n"
 "is_tracked() -- Returns true if a given object is tracked.\n"
 "is_finalized() -- Returns true if a given object has been already finalized.\n"
@@ -498,6 +644,12 @@ static PyMethodDef GcMethods[] = {
     GC_GET_COUNT_METHODDEF
     GC_SET_THRESHOLD_METHODDEF
     GC_GET_THRESHOLD_METHODDEF
+    GC_SET_PAUSE_TARGET_METHODDEF
+    GC_GET_PAUSE_TARGET_METHODDEF
+    GC_SET_MARK_THREADS_METHODDEF
+    GC_GET_MARK_THREADS_METHODDEF
+    GC_SET_BACKGROUND_METHODDEF
+    GC_GET_BACKGROUND_METHODDEF
     GC_COLLECT_METHODDEF
     GC_GET_OBJECTS_METHODDEF
     GC_GET_STATS_METHODDEF
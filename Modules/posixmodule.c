@@ -18,6 +18,7 @@
 #include "pycore_call.h"          // _PyObject_CallNoArgs()
 #include "pycore_ceval.h"         // _PyEval_ReInitThreads()
 #include "pycore_fileutils.h"     // _Py_closerange()
+#include "pycore_gc.h"            // _PyGC_AfterFork()
 #include "pycore_import.h"        // _PyImport_AcquireLock()
 #include "pycore_initconfig.h"    // _PyStatus_EXCEPTION()
 #include "pycore_long.h"          // _PyLong_IsNegative()
@@ -747,6 +748,7 @@ PyOS_AfterFork_Child(void)
 #ifdef Py_GIL_DISABLED
     _Py_brc_after_fork(tstate->interp);
     _Py_qsbr_after_fork((_PyThreadStateImpl *)tstate);
+    _PyGC_AfterFork(tstate->interp);
 #endif
 
     // Ideally we could guarantee tstate is running main.
@@ -4599,6 +4599,147 @@ it will first attempt to close any file descriptors received via the\n\
 SCM_RIGHTS mechanism.");
 #endif    /* CMSG_LEN */
 
+#ifdef HAVE_RECVMMSG
+struct sock_recvmmsg {
+    struct mmsghdr *msgvec;
+    unsigned int vlen;
+    int flags;
+    int result;
+};
+
+static int
+sock_recvmmsg_impl(PySocketSockObject *s, void *data)
+{
+    struct sock_recvmmsg *ctx = data;
+
+    ctx->result = recvmmsg(get_sock_fd(s), ctx->msgvec, ctx->vlen,
+                           ctx->flags, NULL);
+    return (ctx->result >= 0);
+}
+
+/*[clinic input]
+_socket.socket.recvmmsg_into
+    self as s: self(type="PySocketSockObject *")
+    buffers: object
+    flags: int = 0
+    /
+
+Receive several datagrams into a series of buffers with one system call.
+
+The buffers argument must be an iterable of objects that export
+writable buffers (e.g. bytearray objects).  Each datagram received is
+written into the next buffer; datagrams which do not fit are truncated.
+The call returns as soon as at least one datagram is available.  The
+flags argument has the same meaning as for recv().
+
+The return value is a list of (nbytes, address) tuples, one for each
+datagram received, in the order of the buffers they were written to.
+[clinic start generated code]*/
+
+static PyObject *
+_socket_socket_recvmmsg_into_impl(PySocketSockObject *s, PyObject *buffers,
+                                  int flags)
+/*[clinic end generated code: output=11dc80e37fa53cc0 input=fc6839089a4ed546]*/
+{
+    Py_ssize_t i, nitems, nbufs = 0;
+    socklen_t addrbuflen;
+    struct mmsghdr *msgvec = NULL;
+    struct iovec *iovs = NULL;
+    sock_addr_t *addrbufs = NULL;
+    Py_buffer *bufs = NULL;
+    PyObject *fast, *retval = NULL;
+    struct sock_recvmmsg ctx;
+
+    if (!getsockaddrlen(s, &addrbuflen)) {
+        return NULL;
+    }
+    fast = PySequence_Fast(buffers, "recvmmsg_into() argument 1 must be an "
+                                    "iterable");
+    if (fast == NULL) {
+        return NULL;
+    }
+    nitems = PySequence_Fast_GET_SIZE(fast);
+    if (nitems > INT_MAX) {
+        PyErr_SetString(PyExc_OSError, "recvmmsg_into() argument 1 is too long");
+        goto finally;
+    }
+    if (nitems == 0) {
+        retval = PyList_New(0);
+        goto finally;
+    }
+
+    msgvec = PyMem_New(struct mmsghdr, nitems);
+    iovs = PyMem_New(struct iovec, nitems);
+    addrbufs = PyMem_New(sock_addr_t, nitems);
+    bufs = PyMem_New(Py_buffer, nitems);
+    if (msgvec == NULL || iovs == NULL || addrbufs == NULL || bufs == NULL) {
+        PyErr_NoMemory();
+        goto finally;
+    }
+    memset(msgvec, 0, nitems * sizeof(struct mmsghdr));
+    for (; nbufs < nitems; nbufs++) {
+        if (!PyArg_Parse(PySequence_Fast_GET_ITEM(fast, nbufs),
+                         "w*;recvmmsg_into() argument 1 must be an iterable "
+                         "of single-segment read-write buffers",
+                         &bufs[nbufs]))
+            goto finally;
+        iovs[nbufs].iov_base = bufs[nbufs].buf;
+        iovs[nbufs].iov_len = bufs[nbufs].len;
+        /* See the comment in sock_recvmsg_guts() */
+        memset(&addrbufs[nbufs], 0, addrbuflen);
+        SAS2SA(&addrbufs[nbufs])->sa_family = AF_UNSPEC;
+        msgvec[nbufs].msg_hdr.msg_name = SAS2SA(&addrbufs[nbufs]);
+        msgvec[nbufs].msg_hdr.msg_namelen = addrbuflen;
+        msgvec[nbufs].msg_hdr.msg_iov = &iovs[nbufs];
+        msgvec[nbufs].msg_hdr.msg_iovlen = 1;
+    }
+
+    if (!IS_SELECTABLE(s)) {
+        select_error();
+        goto finally;
+    }
+
+    ctx.msgvec = msgvec;
+    ctx.vlen = (unsigned int)nitems;
+    ctx.flags = flags;
+#ifdef MSG_WAITFORONE
+    /* Don't block for more datagrams once the first one has arrived. */
+    ctx.flags |= MSG_WAITFORONE;
+#endif
+    if (sock_call(s, 0, sock_recvmmsg_impl, &ctx) < 0)
+        goto finally;
+
+    retval = PyList_New(ctx.result);
+    if (retval == NULL) {
+        goto finally;
+    }
+    for (i = 0; i < ctx.result; i++) {
+        struct msghdr *msg = &msgvec[i].msg_hdr;
+        PyObject *item = Py_BuildValue("IN",
+            msgvec[i].msg_len,
+            makesockaddr(get_sock_fd(s), SAS2SA(&addrbufs[i]),
+                         ((msg->msg_namelen > addrbuflen) ?
+                          addrbuflen : msg->msg_namelen),
+                         s->sock_proto));
+        if (item == NULL) {
+            Py_CLEAR(retval);
+            goto finally;
+        }
+        PyList_SET_ITEM(retval, i, item);
+    }
+
+finally:
+    for (i = 0; i < nbufs; i++)
+        PyBuffer_Release(&bufs[i]);
+    PyMem_Free(bufs);
+    PyMem_Free(addrbufs);
+    PyMem_Free(iovs);
+    PyMem_Free(msgvec);
+    Py_DECREF(fast);
+    return retval;
+}
+#endif    /* HAVE_RECVMMSG */
+
 
 struct sock_send {
     char *buf;
@@ -5120,6 +5261,131 @@ _socket_socket_sendmsg_impl(PySocketSockObject *s, PyObject *data_arg,
 
 #endif    /* CMSG_LEN */
 
+#ifdef HAVE_SENDMMSG
+struct sock_sendmmsg {
+    struct mmsghdr *msgvec;
+    unsigned int vlen;
+    int flags;
+    int result;
+};
+
+static int
+sock_sendmmsg_impl(PySocketSockObject *s, void *data)
+{
+    struct sock_sendmmsg *ctx = data;
+
+    ctx->result = sendmmsg(get_sock_fd(s), ctx->msgvec, ctx->vlen,
+                           ctx->flags);
+    return (ctx->result >= 0);
+}
+
+/*[clinic input]
+_socket.socket.sendmmsg
+    self as s: self(type="PySocketSockObject *")
+    messages: object
+    flags: int = 0
+    /
+
+Send several datagrams with one system call.
+
+The messages argument is an iterable whose items are either
+bytes-like objects, sent to the address the socket is connected to, or
+(data, address) tuples.  The flags argument has the same meaning as
+for send().  The return value is the number of messages sent, which
+may be less than the number of items in messages; an error for a
+later message is only reported by the next call.
+[clinic start generated code]*/
+
+static PyObject *
+_socket_socket_sendmmsg_impl(PySocketSockObject *s, PyObject *messages,
+                             int flags)
+/*[clinic end generated code: output=332d6393e760c206 input=9e558b5031aeb3ef]*/
+{
+    Py_ssize_t i, nitems, nbufs = 0;
+    struct mmsghdr *msgvec = NULL;
+    struct iovec *iovs = NULL;
+    sock_addr_t *addrbufs = NULL;
+    Py_buffer *bufs = NULL;
+    PyObject *fast, *retval = NULL;
+    struct sock_sendmmsg ctx;
+
+    fast = PySequence_Fast(messages, "sendmmsg() argument 1 must be an "
+                                     "iterable");
+    if (fast == NULL) {
+        return NULL;
+    }
+    nitems = PySequence_Fast_GET_SIZE(fast);
+    if (nitems > INT_MAX) {
+        PyErr_SetString(PyExc_OSError, "sendmmsg() argument 1 is too long");
+        goto finally;
+    }
+    if (nitems == 0) {
+        retval = PyLong_FromLong(0);
+        goto finally;
+    }
+
+    msgvec = PyMem_New(struct mmsghdr, nitems);
+    iovs = PyMem_New(struct iovec, nitems);
+    addrbufs = PyMem_New(sock_addr_t, nitems);
+    bufs = PyMem_New(Py_buffer, nitems);
+    if (msgvec == NULL || iovs == NULL || addrbufs == NULL || bufs == NULL) {
+        PyErr_NoMemory();
+        goto finally;
+    }
+    memset(msgvec, 0, nitems * sizeof(struct mmsghdr));
+    for (; nbufs < nitems; nbufs++) {
+        PyObject *item = PySequence_Fast_GET_ITEM(fast, nbufs);
+        PyObject *data = item, *addr = Py_None;
+        if (PyTuple_Check(item)) {
+            if (!PyArg_ParseTuple(item, "OO;sendmmsg() argument 1 must be "
+                                  "an iterable of bytes-like objects or "
+                                  "(data, address) tuples", &data, &addr))
+                goto finally;
+        }
+        if (addr != Py_None) {
+            int addrlen;
+            if (!getsockaddrarg(s, addr, &addrbufs[nbufs], &addrlen,
+                                "sendmmsg"))
+                goto finally;
+            msgvec[nbufs].msg_hdr.msg_name = SAS2SA(&addrbufs[nbufs]);
+            msgvec[nbufs].msg_hdr.msg_namelen = addrlen;
+        }
+        if (PySys_Audit("socket.sendmmsg", "OO", s, addr) < 0) {
+            goto finally;
+        }
+        if (PyObject_GetBuffer(data, &bufs[nbufs], PyBUF_SIMPLE) < 0)
+            goto finally;
+        iovs[nbufs].iov_base = bufs[nbufs].buf;
+        iovs[nbufs].iov_len = bufs[nbufs].len;
+        msgvec[nbufs].msg_hdr.msg_iov = &iovs[nbufs];
+        msgvec[nbufs].msg_hdr.msg_iovlen = 1;
+    }
+
+    if (!IS_SELECTABLE(s)) {
+        select_error();
+        goto finally;
+    }
+
+    ctx.msgvec = msgvec;
+    ctx.vlen = (unsigned int)nitems;
+    ctx.flags = flags;
+    if (sock_call(s, 1, sock_sendmmsg_impl, &ctx) < 0)
+        goto finally;
+
+    retval = PyLong_FromLong(ctx.result);
+
+finally:
+    for (i = 0; i < nbufs; i++)
+        PyBuffer_Release(&bufs[i]);
+    PyMem_Free(bufs);
+    PyMem_Free(addrbufs);
+    PyMem_Free(iovs);
+    PyMem_Free(msgvec);
+    Py_DECREF(fast);
+    return retval;
+}
+#endif    /* HAVE_SENDMMSG */
+
 #ifdef HAVE_SOCKADDR_ALG
 static PyObject*
 sock_sendmsg_afalg(PyObject *s, PyObject *args, PyObject *kwds)
@@ -5477,6 +5743,8 @@ static PyMethodDef sock_methods[] = {
     {"recvmsg_into", sock_recvmsg_into, METH_VARARGS, recvmsg_into_doc},
     _SOCKET_SOCKET_SENDMSG_METHODDEF
 #endif
+    _SOCKET_SOCKET_RECVMMSG_INTO_METHODDEF
+    _SOCKET_SOCKET_SENDMMSG_METHODDEF
 #ifdef HAVE_SOCKADDR_ALG
     {
         "sendmsg_afalg",
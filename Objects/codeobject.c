@@ -584,6 +584,11 @@ init_code(PyCodeObject *co, struct _PyCodeConstructor *con)
     _PyCode_Quicken(_PyCode_CODE(co), Py_SIZE(co), enable_counters);
 #else
     _PyCode_Quicken(_PyCode_CODE(co), Py_SIZE(co), interp->opt_config.specialization_enabled);
+#endif
+#ifdef _Py_TIER2
+    if (interp->opt_config.specialization_enabled) {
+        _PyJit_ApplyProfile(interp, co);
+    }
 #endif
     notify_code_watchers(PY_CODE_EVENT_CREATE, co);
     return 0;
@@ -5,6 +5,7 @@
 #endif
 
 #include "pycore_bitutils.h"      // _Py_bswap32()
+#include "simd.h"                 // STRINGLIB_SIMD_BITS
 
 /* Mask to quickly check whether a C 'size_t' contains a
    non-ASCII, UTF8-encoded char. */
@@ -19,6 +20,211 @@
 /* 10xxxxxx */
 #define IS_CONTINUATION_BYTE(ch) ((ch) >= 0x80 && (ch) < 0xC0)
 
+#if STRINGLIB_SIMD_BITS && !defined(STRINGLIB_UTF8_SIMD)
+#define STRINGLIB_UTF8_SIMD
+
+/* The vector UTF-8 decoder works on blocks of 16 bytes starting at a
+   character boundary.  It handles ASCII, 2- and 3-byte sequences and
+   leaves everything else (4-byte sequences, invalid data) to the scalar
+   decoder.  Sequences starting in the last two bytes of a block may run
+   past it, so 2 more bytes must be readable after the block. */
+
+/* Validate the block at s, whose first 16 bytes are v.  Return the number
+   of bytes decoded (16 to 18) and set *starts to the mask of the bytes
+   starting a character, or return 0 if the block cannot be handled. */
+static inline int
+stringlib_utf8_simd_check(const char *s, stringlib_simd_u8 v,
+                          uint32_t *starts)
+{
+    /* w holds bytes 2 to 17, for the continuation bytes of the sequences
+       starting at the end of the block */
+    stringlib_simd_u8 w = stringlib_simd_load(s + 2);
+    uint32_t ge_c0 = stringlib_simd_bytes_ge(v, 0xC0);
+    uint32_t ge_c2 = stringlib_simd_bytes_ge(v, 0xC2);
+    uint32_t ge_e0 = stringlib_simd_bytes_ge(v, 0xE0);
+    uint32_t ge_f0 = stringlib_simd_bytes_ge(v, 0xF0);
+    uint32_t cont = stringlib_simd_bytes_high(v) & ~ge_c0;
+    uint32_t lead2 = ge_c2 & ~ge_e0;
+    uint32_t lead3 = ge_e0;
+
+    /* \xC0, \xC1 and \xF0-\xFF */
+    if ((ge_c0 & ~ge_c2) | ge_f0) {
+        return 0;
+    }
+    /* Every lead byte must be followed by exactly the right number of
+       continuation bytes. */
+    uint32_t expected = ((lead2 | lead3) << 1) | (lead3 << 2);
+    uint32_t w_cont = stringlib_simd_bytes_high(w)
+                      & ~stringlib_simd_bytes_ge(w, 0xC0);
+    if ((expected & ~(cont | (w_cont << 2))) | (cont & ~expected)) {
+        return 0;
+    }
+    /* \xE0 must be followed by \xA0-\xBF (no overlong encoding) and \xED
+       by \x80-\x9F (no surrogate). */
+    uint32_t ge_a0 = stringlib_simd_bytes_ge(v, 0xA0)
+                     | (stringlib_simd_bytes_ge(w, 0xA0) << 2);
+    if (((stringlib_simd_bytes_eq(v, 0xE0) << 1) & ~ge_a0)
+        | ((stringlib_simd_bytes_eq(v, 0xED) << 1) & ge_a0))
+    {
+        return 0;
+    }
+    *starts = ~cont & 0xFFFF;
+    return 16 + ((expected >> 17) ? 2 : (int)(expected >> 16));
+}
+
+#ifdef STRINGLIB_SIMD_SSE2
+/* Decode the sequences starting at 8 positions, given their first three
+   bytes widened to 16 bits.  Positions holding a continuation byte give
+   garbage. */
+static inline __m128i
+stringlib_utf8_simd_decode8(__m128i b0, __m128i b1, __m128i b2)
+{
+    const __m128i low6 = _mm_set1_epi16(0x3F);
+    __m128i t1 = _mm_and_si128(b1, low6);
+    __m128i t2 = _mm_and_si128(b2, low6);
+    __m128i two = _mm_or_si128(
+        _mm_slli_epi16(_mm_and_si128(b0, _mm_set1_epi16(0x1F)), 6), t1);
+    __m128i three = _mm_or_si128(_mm_slli_epi16(b0, 12),
+                                 _mm_or_si128(_mm_slli_epi16(t1, 6), t2));
+    __m128i is3 = _mm_cmpgt_epi16(b0, _mm_set1_epi16(0xDF));
+    __m128i is_multi = _mm_cmpgt_epi16(b0, _mm_set1_epi16(0x7F));
+    __m128i multi = _mm_or_si128(_mm_and_si128(is3, three),
+                                 _mm_andnot_si128(is3, two));
+    return _mm_or_si128(_mm_and_si128(is_multi, multi),
+                        _mm_andnot_si128(is_multi, b0));
+}
+
+/* Decode the sequences starting at each of the 16 positions of the block
+   at s, whose first 16 bytes are v, into buf. */
+static inline void
+stringlib_utf8_simd_decode(const char *s, stringlib_simd_u8 v, uint16_t *buf)
+{
+    const __m128i z = _mm_setzero_si128();
+    __m128i v1 = stringlib_simd_load(s + 1);
+    __m128i v2 = stringlib_simd_load(s + 2);
+    _mm_storeu_si128((__m128i *)buf, stringlib_utf8_simd_decode8(
+        _mm_unpacklo_epi8(v, z), _mm_unpacklo_epi8(v1, z),
+        _mm_unpacklo_epi8(v2, z)));
+    _mm_storeu_si128((__m128i *)(buf + 8), stringlib_utf8_simd_decode8(
+        _mm_unpackhi_epi8(v, z), _mm_unpackhi_epi8(v1, z),
+        _mm_unpackhi_epi8(v2, z)));
+}
+#else
+static inline uint16x8_t
+stringlib_utf8_simd_decode8(uint16x8_t b0, uint16x8_t b1, uint16x8_t b2)
+{
+    const uint16x8_t low6 = vdupq_n_u16(0x3F);
+    uint16x8_t t1 = vandq_u16(b1, low6);
+    uint16x8_t t2 = vandq_u16(b2, low6);
+    uint16x8_t two = vorrq_u16(
+        vshlq_n_u16(vandq_u16(b0, vdupq_n_u16(0x1F)), 6), t1);
+    uint16x8_t three = vorrq_u16(vshlq_n_u16(b0, 12),
+                                 vorrq_u16(vshlq_n_u16(t1, 6), t2));
+    uint16x8_t multi = vbslq_u16(vcgtq_u16(b0, vdupq_n_u16(0xDF)),
+                                 three, two);
+    return vbslq_u16(vcgtq_u16(b0, vdupq_n_u16(0x7F)), multi, b0);
+}
+
+static inline void
+stringlib_utf8_simd_decode(const char *s, stringlib_simd_u8 v, uint16_t *buf)
+{
+    uint8x16_t v1 = stringlib_simd_load(s + 1);
+    uint8x16_t v2 = stringlib_simd_load(s + 2);
+    vst1q_u16(buf, stringlib_utf8_simd_decode8(
+        vmovl_u8(vget_low_u8(v)), vmovl_u8(vget_low_u8(v1)),
+        vmovl_u8(vget_low_u8(v2))));
+    vst1q_u16(buf + 8, stringlib_utf8_simd_decode8(
+        vmovl_high_u8(v), vmovl_high_u8(v1), vmovl_high_u8(v2)));
+}
+#endif
+#endif /* STRINGLIB_SIMD_BITS && !STRINGLIB_UTF8_SIMD */
+
+#if STRINGLIB_SIMD_BITS
+/* Store the 16 ASCII characters of v at p. */
+static inline void
+STRINGLIB(_utf8_simd_store_ascii)(STRINGLIB_CHAR *p, stringlib_simd_u8 v)
+{
+#  ifdef STRINGLIB_SIMD_SSE2
+#    if STRINGLIB_SIZEOF_CHAR == 1
+    _mm_storeu_si128((__m128i *)p, v);
+#    else
+    const __m128i z = _mm_setzero_si128();
+    __m128i lo = _mm_unpacklo_epi8(v, z);
+    __m128i hi = _mm_unpackhi_epi8(v, z);
+#      if STRINGLIB_SIZEOF_CHAR == 2
+    _mm_storeu_si128((__m128i *)p, lo);
+    _mm_storeu_si128((__m128i *)(p + 8), hi);
+#      else
+    _mm_storeu_si128((__m128i *)p, _mm_unpacklo_epi16(lo, z));
+    _mm_storeu_si128((__m128i *)(p + 4), _mm_unpackhi_epi16(lo, z));
+    _mm_storeu_si128((__m128i *)(p + 8), _mm_unpacklo_epi16(hi, z));
+    _mm_storeu_si128((__m128i *)(p + 12), _mm_unpackhi_epi16(hi, z));
+#      endif
+#    endif
+#  else
+#    if STRINGLIB_SIZEOF_CHAR == 1
+    vst1q_u8(p, v);
+#    else
+    uint16x8_t lo = vmovl_u8(vget_low_u8(v));
+    uint16x8_t hi = vmovl_high_u8(v);
+#      if STRINGLIB_SIZEOF_CHAR == 2
+    vst1q_u16(p, lo);
+    vst1q_u16(p + 8, hi);
+#      else
+    vst1q_u32(p, vmovl_u16(vget_low_u16(lo)));
+    vst1q_u32(p + 4, vmovl_high_u16(lo));
+    vst1q_u32(p + 8, vmovl_u16(vget_low_u16(hi)));
+    vst1q_u32(p + 12, vmovl_high_u16(hi));
+#      endif
+#    endif
+#  endif
+}
+
+/* Decode blocks of 16 bytes with vector instructions, and stop at the
+   first block better left to the scalar decoder.  Blocks of ASCII are
+   always taken.  Other blocks are only taken if they hold a 3-byte
+   sequence: mixes of ASCII and 2-byte sequences are mostly ASCII with
+   predictable branches, which the scalar decoder handles faster.  Blocks
+   holding a 4-byte sequence or invalid data are never taken. */
+static inline void
+STRINGLIB(_utf8_decode_simd)(const char **inptr, const char *end,
+                             STRINGLIB_CHAR **outptr)
+{
+    const char *s = *inptr;
+    STRINGLIB_CHAR *p = *outptr;
+
+    while (end - s >= 18) {
+        stringlib_simd_u8 v = stringlib_simd_load(s);
+        if (!stringlib_simd_bytes_high(v)) {
+            STRINGLIB(_utf8_simd_store_ascii)(p, v);
+            s += 16;
+            p += 16;
+            continue;
+        }
+#  if STRINGLIB_SIZEOF_CHAR > 1
+        uint32_t starts;
+        int n;
+        if (!stringlib_simd_bytes_ge(v, 0xE0)
+            || !(n = stringlib_utf8_simd_check(s, v, &starts)))
+        {
+            break;
+        }
+        uint16_t buf[16];
+        stringlib_utf8_simd_decode(s, v, buf);
+        do {
+            *p++ = buf[stringlib_simd_lowest(starts)];
+            starts &= starts - 1;
+        } while (starts);
+        s += n;
+#  else
+        break;
+#  endif
+    }
+    *inptr = s;
+    *outptr = p;
+}
+#endif
+
 Py_LOCAL_INLINE(Py_UCS4)
 STRINGLIB(utf8_decode)(const char **inptr, const char *end,
                        STRINGLIB_CHAR *dest,
@@ -27,8 +233,27 @@ STRINGLIB(utf8_decode)(const char **inptr, const char *end,
     Py_UCS4 ch;
     const char *s = *inptr;
     STRINGLIB_CHAR *p = dest + *outpos;
+#if STRINGLIB_SIMD_BITS
+    /* Where to try the vector decoder again after it stopped.  The
+       distance doubles each time it makes little progress, so that text
+       it cannot handle costs few attempts. */
+    const char *simd_retry = s;
+    Py_ssize_t simd_backoff = 16;
+#endif
 
     while (s < end) {
+#if STRINGLIB_SIMD_BITS
+        if (s >= simd_retry) {
+            const char *start = s;
+            STRINGLIB(_utf8_decode_simd)(&s, end, &p);
+            if (s == end) {
+                break;
+            }
+            simd_backoff = (s - start >= 64) ? 16
+                                             : Py_MIN(simd_backoff * 2, 2048);
+            simd_retry = s + simd_backoff;
+        }
+#endif
         ch = (unsigned char)*s;
 
         if (ch < 0x80) {
@@ -254,6 +479,139 @@ STRINGLIB(utf8_decode)(const char **inptr, const char *end,
 #undef ASCII_CHAR_MASK
 
 
+#if STRINGLIB_SIZEOF_CHAR > 1 && STRINGLIB_SIMD_BITS
+/* Encode blocks of 8 characters with vector instructions, and stop at the
+   first block better left to the scalar encoder: one holding a surrogate
+   or a character above U+FFFF, or mixing ASCII with U+0080-U+07FF only,
+   for which the scalar encoder is faster.  Each
+   character is written as 4 bytes of which only the first 1 to 3 are
+   kept; stopping one character before the end keeps these writes within
+   the max_char_size bytes reserved per character. */
+static inline void
+STRINGLIB(_utf8_encode_simd)(const STRINGLIB_CHAR *data, Py_ssize_t *ipos,
+                             Py_ssize_t size, char **outptr)
+{
+    Py_ssize_t i = *ipos;
+    char *p = *outptr;
+    uint32_t units[8];
+    uint64_t lengths;
+
+    while (size - i > 8) {
+#  ifdef STRINGLIB_SIMD_SSE2
+        const __m128i z = _mm_setzero_si128();
+#    if STRINGLIB_SIZEOF_CHAR == 2
+        __m128i c = _mm_loadu_si128((const __m128i *)(data + i));
+#    else
+        __m128i c0 = _mm_loadu_si128((const __m128i *)(data + i));
+        __m128i c1 = _mm_loadu_si128((const __m128i *)(data + i + 4));
+        __m128i above = _mm_srli_epi32(_mm_or_si128(c0, c1), 16);
+        if (_mm_movemask_epi8(_mm_cmpeq_epi32(above, z)) != 0xFFFF) {
+            break;
+        }
+        /* sign-extend the 16-bit values so that packing does not
+           saturate */
+        __m128i c = _mm_packs_epi32(
+            _mm_srai_epi32(_mm_slli_epi32(c0, 16), 16),
+            _mm_srai_epi32(_mm_slli_epi32(c1, 16), 16));
+#    endif
+        __m128i surrogate = _mm_cmpeq_epi16(
+            _mm_and_si128(c, _mm_set1_epi16((short)0xF800)),
+            _mm_set1_epi16((short)0xD800));
+        if (_mm_movemask_epi8(surrogate)) {
+            break;
+        }
+        __m128i ascii = _mm_cmpeq_epi16(
+            _mm_and_si128(c, _mm_set1_epi16((short)0xFF80)), z);
+        if (_mm_movemask_epi8(ascii) == 0xFFFF) {
+            _mm_storel_epi64((__m128i *)p, _mm_packus_epi16(c, c));
+            p += 8;
+            i += 8;
+            continue;
+        }
+        __m128i two = _mm_cmpeq_epi16(
+            _mm_and_si128(c, _mm_set1_epi16((short)0xF800)), z);
+        if (_mm_movemask_epi8(two) == 0xFFFF) {
+            break;
+        }
+        const __m128i low6 = _mm_set1_epi16(0x3F);
+        const __m128i cont = _mm_set1_epi16(0x80);
+        __m128i c6 = _mm_srli_epi16(c, 6);
+        /* lead bytes of the 2- and 3-byte sequences */
+        __m128i lead = _mm_or_si128(
+            _mm_and_si128(two, _mm_or_si128(c6, _mm_set1_epi16(0xC0))),
+            _mm_andnot_si128(two, _mm_or_si128(_mm_srli_epi16(c, 12),
+                                               _mm_set1_epi16(0xE0))));
+        __m128i b0 = _mm_or_si128(_mm_and_si128(ascii, c),
+                                  _mm_andnot_si128(ascii, lead));
+        __m128i b1 = _mm_or_si128(_mm_and_si128(
+            _mm_or_si128(_mm_and_si128(two, c), _mm_andnot_si128(two, c6)),
+            low6), cont);
+        __m128i b2 = _mm_or_si128(_mm_and_si128(c, low6), cont);
+        /* the masks are -1 where true */
+        __m128i len = _mm_add_epi16(_mm_set1_epi16(3),
+                                    _mm_add_epi16(ascii, two));
+        __m128i b01 = _mm_or_si128(b0, _mm_slli_epi16(b1, 8));
+        _mm_storeu_si128((__m128i *)units, _mm_unpacklo_epi16(b01, b2));
+        _mm_storeu_si128((__m128i *)(units + 4), _mm_unpackhi_epi16(b01, b2));
+        _mm_storel_epi64((__m128i *)&lengths, _mm_packus_epi16(len, len));
+#  else
+#    if STRINGLIB_SIZEOF_CHAR == 2
+        uint16x8_t c = vld1q_u16(data + i);
+#    else
+        uint32x4_t c0 = vld1q_u32(data + i);
+        uint32x4_t c1 = vld1q_u32(data + i + 4);
+        if (vmaxvq_u32(vorrq_u32(c0, c1)) > 0xFFFF) {
+            break;
+        }
+        uint16x8_t c = vcombine_u16(vmovn_u32(c0), vmovn_u32(c1));
+#    endif
+        uint16x8_t high5 = vandq_u16(c, vdupq_n_u16(0xF800));
+        if (vmaxvq_u16(vceqq_u16(high5, vdupq_n_u16(0xD800)))) {
+            break;
+        }
+        if (vmaxvq_u16(c) < 0x80) {
+            vst1_u8((uint8_t *)p, vmovn_u16(c));
+            p += 8;
+            i += 8;
+            continue;
+        }
+        if (vmaxvq_u16(c) < 0x800) {
+            break;
+        }
+        uint16x8_t ascii = vcltq_u16(c, vdupq_n_u16(0x80));
+        uint16x8_t two = vceqq_u16(high5, vdupq_n_u16(0));
+        const uint16x8_t low6 = vdupq_n_u16(0x3F);
+        const uint16x8_t cont = vdupq_n_u16(0x80);
+        uint16x8_t c6 = vshrq_n_u16(c, 6);
+        uint16x8_t lead = vbslq_u16(two, vorrq_u16(c6, vdupq_n_u16(0xC0)),
+                                    vorrq_u16(vshrq_n_u16(c, 12),
+                                              vdupq_n_u16(0xE0)));
+        uint16x8_t b0 = vbslq_u16(ascii, c, lead);
+        uint16x8_t b1 = vorrq_u16(vandq_u16(vbslq_u16(two, c, c6), low6),
+                                  cont);
+        uint16x8_t b2 = vorrq_u16(vandq_u16(c, low6), cont);
+        /* the masks are all ones where true */
+        uint16x8_t len = vsubq_u16(vsubq_u16(vdupq_n_u16(3),
+                                             vshrq_n_u16(ascii, 15)),
+                                   vshrq_n_u16(two, 15));
+        uint16x8_t b01 = vorrq_u16(b0, vshlq_n_u16(b1, 8));
+        vst1q_u32(units, vreinterpretq_u32_u16(vzip1q_u16(b01, b2)));
+        vst1q_u32(units + 4, vreinterpretq_u32_u16(vzip2q_u16(b01, b2)));
+        lengths = vget_lane_u64(vreinterpret_u64_u8(vmovn_u16(len)), 0);
+#  endif
+        /* units[k] holds the bytes of character k in memory order */
+        for (int k = 0; k < 8; k++) {
+            memcpy(p, &units[k], 4);
+            p += lengths & 0xFF;
+            lengths >>= 8;
+        }
+        i += 8;
+    }
+    *ipos = i;
+    *outptr = p;
+}
+#endif
+
 /* UTF-8 encoder specialized for a Unicode kind to avoid the slow
    PyUnicode_READ() macro. Delete some parts of the code depending on the kind:
    UCS-1 strings don't need to handle surrogates for example. */
@@ -295,7 +653,24 @@ STRINGLIB(utf8_encoder)(PyObject *unicode,
     char *p = PyBytesWriter_GetData(writer);
 
     Py_ssize_t i;                /* index into data of next input character */
+#if STRINGLIB_SIZEOF_CHAR > 1 && STRINGLIB_SIMD_BITS
+    /* where to try the vector encoder again, as in utf8_decode() */
+    Py_ssize_t simd_retry = 0;
+    Py_ssize_t simd_backoff = 8;
+#endif
     for (i = 0; i < size;) {
+#if STRINGLIB_SIZEOF_CHAR > 1 && STRINGLIB_SIMD_BITS
+        if (i >= simd_retry) {
+            Py_ssize_t start = i;
+            STRINGLIB(_utf8_encode_simd)(data, &i, size, &p);
+            if (i == size) {
+                break;
+            }
+            simd_backoff = (i - start >= 32) ? 8
+                                             : Py_MIN(simd_backoff * 2, 1024);
+            simd_retry = i + simd_backoff;
+        }
+#endif
         Py_UCS4 ch = data[i++];
 
         if (ch < 0x80) {
@@ -40,6 +40,210 @@
 #define STRINGLIB_BLOOM(mask, ch)     \
     ((mask &  (1UL << ((ch) & (STRINGLIB_BLOOM_WIDTH -1)))))
 
+/* Vector kernels for the single-character searches on 2- and 4-byte
+   strings, where memchr() cannot be used directly. */
+#include "simd.h"
+
+#if STRINGLIB_SIZEOF_CHAR > 1 && STRINGLIB_SIMD_BITS
+#  define STRINGLIB_SIMD_CHARS (16 / STRINGLIB_SIZEOF_CHAR)
+#  define STRINGLIB_SIMD_CHAR_BITS (STRINGLIB_SIMD_BITS * STRINGLIB_SIZEOF_CHAR)
+/* Number of vectors counted between checks of maxcount; small enough
+   that the per-lane counters cannot overflow. */
+#  define STRINGLIB_SIMD_COUNT_BLOCK 256
+
+/* Return a mask with STRINGLIB_SIMD_CHAR_BITS bits set for each of the
+   STRINGLIB_SIMD_CHARS characters at p that is equal to ch. */
+static inline uint64_t
+STRINGLIB(_simd_match)(const STRINGLIB_CHAR *p, STRINGLIB_CHAR ch)
+{
+#  ifdef STRINGLIB_SIMD_SSE2
+    __m128i v = _mm_loadu_si128((const __m128i *)p);
+#    if STRINGLIB_SIZEOF_CHAR == 2
+    __m128i eq = _mm_cmpeq_epi16(v, _mm_set1_epi16((short)ch));
+#    else
+    __m128i eq = _mm_cmpeq_epi32(v, _mm_set1_epi32((int)ch));
+#    endif
+    return (uint64_t)(unsigned int)_mm_movemask_epi8(eq);
+#  else
+#    if STRINGLIB_SIZEOF_CHAR == 2
+    uint16x8_t eq = vceqq_u16(vld1q_u16(p), vdupq_n_u16(ch));
+#    else
+    uint16x8_t eq = vreinterpretq_u16_u32(
+        vceqq_u32(vld1q_u32(p), vdupq_n_u32(ch)));
+#    endif
+    /* Narrow each 16-bit lane to 8 bits: 4 bits per byte. */
+    return vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(eq, 4)), 0);
+#  endif
+}
+
+/* Find the first ch in s[0:n]; n must be at least STRINGLIB_SIMD_CHARS. */
+static inline Py_ssize_t
+STRINGLIB(_simd_find_char)(const STRINGLIB_CHAR *s, Py_ssize_t n,
+                           STRINGLIB_CHAR ch)
+{
+    const Py_ssize_t step = STRINGLIB_SIMD_CHARS;
+    const STRINGLIB_CHAR *p = s, *e = s + n;
+    uint64_t m0, m1, m2, m3;
+
+    assert(n >= step);
+    while (e - p >= 4 * step) {
+        m0 = STRINGLIB(_simd_match)(p, ch);
+        m1 = STRINGLIB(_simd_match)(p + step, ch);
+        m2 = STRINGLIB(_simd_match)(p + 2 * step, ch);
+        m3 = STRINGLIB(_simd_match)(p + 3 * step, ch);
+        if (m0 | m1 | m2 | m3) {
+            if (!m0) {
+                p += step;
+                m0 = m1;
+                if (!m0) {
+                    p += step;
+                    m0 = m2;
+                    if (!m0) {
+                        p += step;
+                        m0 = m3;
+                    }
+                }
+            }
+            goto found;
+        }
+        p += 4 * step;
+    }
+    while (e - p >= step) {
+        m0 = STRINGLIB(_simd_match)(p, ch);
+        if (m0) {
+            goto found;
+        }
+        p += step;
+    }
+    if (p == e) {
+        return -1;
+    }
+    /* The last vector overlaps characters already known not to match. */
+    p = e - step;
+    m0 = STRINGLIB(_simd_match)(p, ch);
+    if (!m0) {
+        return -1;
+    }
+found:
+    return (p - s) + stringlib_simd_lowest(m0) / STRINGLIB_SIMD_CHAR_BITS;
+}
+
+/* Find the last ch in s[0:n]; n must be at least STRINGLIB_SIMD_CHARS. */
+static inline Py_ssize_t
+STRINGLIB(_simd_rfind_char)(const STRINGLIB_CHAR *s, Py_ssize_t n,
+                            STRINGLIB_CHAR ch)
+{
+    const Py_ssize_t step = STRINGLIB_SIMD_CHARS;
+    const STRINGLIB_CHAR *p = s + n;
+    uint64_t m0, m1, m2, m3;
+
+    assert(n >= step);
+    while (p - s >= 4 * step) {
+        p -= 4 * step;
+        m0 = STRINGLIB(_simd_match)(p + 3 * step, ch);
+        m1 = STRINGLIB(_simd_match)(p + 2 * step, ch);
+        m2 = STRINGLIB(_simd_match)(p + step, ch);
+        m3 = STRINGLIB(_simd_match)(p, ch);
+        if (m0 | m1 | m2 | m3) {
+            p += 3 * step;
+            if (!m0) {
+                p -= step;
+                m0 = m1;
+                if (!m0) {
+                    p -= step;
+                    m0 = m2;
+                    if (!m0) {
+                        p -= step;
+                        m0 = m3;
+                    }
+                }
+            }
+            goto found;
+        }
+    }
+    while (p - s >= step) {
+        p -= step;
+        m0 = STRINGLIB(_simd_match)(p, ch);
+        if (m0) {
+            goto found;
+        }
+    }
+    if (p == s) {
+        return -1;
+    }
+    /* The first vector overlaps characters already known not to match. */
+    p = s;
+    m0 = STRINGLIB(_simd_match)(p, ch);
+    if (!m0) {
+        return -1;
+    }
+found:
+    return (p - s) + stringlib_simd_highest(m0) / STRINGLIB_SIMD_CHAR_BITS;
+}
+
+/* Count ch in s[0:n], stopping once maxcount is reached. */
+static inline Py_ssize_t
+STRINGLIB(_simd_count_char)(const STRINGLIB_CHAR *s, Py_ssize_t n,
+                            STRINGLIB_CHAR ch, Py_ssize_t maxcount)
+{
+    const Py_ssize_t step = STRINGLIB_SIMD_CHARS;
+    const STRINGLIB_CHAR *p = s, *e = s + n;
+    Py_ssize_t count = 0;
+
+    while (e - p >= step) {
+        Py_ssize_t nvec = Py_MIN((e - p) / step, STRINGLIB_SIMD_COUNT_BLOCK);
+        /* Each matching lane is all ones, that is -1: subtracting the
+           comparisons counts the matches in every lane. */
+#  ifdef STRINGLIB_SIMD_SSE2
+#    if STRINGLIB_SIZEOF_CHAR == 2
+        __m128i needle = _mm_set1_epi16((short)ch);
+        __m128i acc = _mm_setzero_si128();
+        for (Py_ssize_t i = 0; i < nvec; i++, p += step) {
+            __m128i v = _mm_loadu_si128((const __m128i *)p);
+            acc = _mm_sub_epi16(acc, _mm_cmpeq_epi16(v, needle));
+        }
+        acc = _mm_madd_epi16(acc, _mm_set1_epi16(1));
+#    else
+        __m128i needle = _mm_set1_epi32((int)ch);
+        __m128i acc = _mm_setzero_si128();
+        for (Py_ssize_t i = 0; i < nvec; i++, p += step) {
+            __m128i v = _mm_loadu_si128((const __m128i *)p);
+            acc = _mm_sub_epi32(acc, _mm_cmpeq_epi32(v, needle));
+        }
+#    endif
+        acc = _mm_add_epi32(acc, _mm_shuffle_epi32(acc, 0x4E));
+        acc = _mm_add_epi32(acc, _mm_shuffle_epi32(acc, 0xB1));
+        count += _mm_cvtsi128_si32(acc);
+#  else
+#    if STRINGLIB_SIZEOF_CHAR == 2
+        uint16x8_t needle = vdupq_n_u16(ch);
+        uint16x8_t acc = vdupq_n_u16(0);
+        for (Py_ssize_t i = 0; i < nvec; i++, p += step) {
+            acc = vsubq_u16(acc, vceqq_u16(vld1q_u16(p), needle));
+        }
+        count += vaddlvq_u16(acc);
+#    else
+        uint32x4_t needle = vdupq_n_u32(ch);
+        uint32x4_t acc = vdupq_n_u32(0);
+        for (Py_ssize_t i = 0; i < nvec; i++, p += step) {
+            acc = vsubq_u32(acc, vceqq_u32(vld1q_u32(p), needle));
+        }
+        count += vaddvq_u32(acc);
+#    endif
+#  endif
+        if (count >= maxcount) {
+            return maxcount;
+        }
+    }
+    for (; p < e; p++) {
+        if (*p == ch) {
+            count++;
+        }
+    }
+    return Py_MIN(count, maxcount);
+}
+#endif
+
 #ifdef STRINGLIB_FAST_MEMCHR
 #  define MEMCHR_CUT_OFF 15
 #else
@@ -62,7 +266,7 @@ STRINGLIB(find_char)(const STRINGLIB_CHAR* s, Py_ssize_t n, STRINGLIB_CHAR ch)
 #else
         /* use memchr if we can choose a needle without too many likely
            false positives */
-        const STRINGLIB_CHAR *s1, *e1;
+        const STRINGLIB_CHAR *s1;
         unsigned char needle = ch & 0xff;
         /* If looking for a multiple of 256, we'd have too
            many false positives looking for the '\0' byte in UCS2
@@ -82,19 +286,30 @@ STRINGLIB(find_char)(const STRINGLIB_CHAR* s, Py_ssize_t n, STRINGLIB_CHAR ch)
                 p++;
                 if (p - s1 > MEMCHR_CUT_OFF)
                     continue;
+#ifdef STRINGLIB_SIMD_CHARS
+                /* Too many false positives: compare whole characters. */
+                break;
+#else
                 if (e - p <= MEMCHR_CUT_OFF)
                     break;
-                e1 = p + MEMCHR_CUT_OFF;
+                const STRINGLIB_CHAR *e1 = p + MEMCHR_CUT_OFF;
                 while (p != e1) {
                     if (*p == ch)
                         return (p - s);
                     p++;
                 }
+#endif
             }
             while (e - p > MEMCHR_CUT_OFF);
         }
 #endif
     }
+#ifdef STRINGLIB_SIMD_CHARS
+    if (e - p >= STRINGLIB_SIMD_CHARS) {
+        Py_ssize_t i = STRINGLIB(_simd_find_char)(p, e - p, ch);
+        return i < 0 ? -1 : (p - s) + i;
+    }
+#endif
     while (p < e) {
         if (*p == ch)
             return (p - s);
@@ -131,7 +346,6 @@ STRINGLIB(rfind_char)(const STRINGLIB_CHAR* s, Py_ssize_t n, STRINGLIB_CHAR ch)
 #else
         /* use memrchr if we can choose a needle without too many likely
            false positives */
-        const STRINGLIB_CHAR *s1;
         Py_ssize_t n1;
         unsigned char needle = ch & 0xff;
         /* If looking for a multiple of 256, we'd have too
@@ -152,21 +366,31 @@ STRINGLIB(rfind_char)(const STRINGLIB_CHAR* s, Py_ssize_t n, STRINGLIB_CHAR ch)
                 /* False positive */
                 if (n1 - n > MEMRCHR_CUT_OFF)
                     continue;
+#ifdef STRINGLIB_SIMD_CHARS
+                /* Too many false positives: compare whole characters. */
+                break;
+#else
                 if (n <= MEMRCHR_CUT_OFF)
                     break;
-                s1 = p - MEMRCHR_CUT_OFF;
+                const STRINGLIB_CHAR *s1 = p - MEMRCHR_CUT_OFF;
                 while (p > s1) {
                     p--;
                     if (*p == ch)
                         return (p - s);
                 }
                 n = p - s;
+#endif
             }
             while (n > MEMRCHR_CUT_OFF);
         }
 #endif
     }
 #endif  /* HAVE_MEMRCHR */
+#ifdef STRINGLIB_SIMD_CHARS
+    if (n >= STRINGLIB_SIMD_CHARS) {
+        return STRINGLIB(_simd_rfind_char)(s, n, ch);
+    }
+#endif
     p = s + n;
     while (p > s) {
         p--;
@@ -741,6 +965,11 @@ STRINGLIB(count_char)(const STRINGLIB_CHAR *s, Py_ssize_t n,
                       const STRINGLIB_CHAR p0, Py_ssize_t maxcount)
 {
     Py_ssize_t i, count = 0;
+#ifdef STRINGLIB_SIMD_CHARS
+    if (n >= STRINGLIB_SIMD_CHARS) {
+        return STRINGLIB(_simd_count_char)(s, n, p0, maxcount);
+    }
+#endif
     for (i = 0; i < n; i++) {
         if (s[i] == p0) {
             count++;
@@ -760,6 +989,11 @@ STRINGLIB(count_char_no_maxcount)(const STRINGLIB_CHAR *s, Py_ssize_t n,
    As a result, the compiler is able to vectorize the loop. */
 {
     Py_ssize_t count = 0;
+#ifdef STRINGLIB_SIMD_CHARS
+    if (n >= STRINGLIB_SIMD_CHARS) {
+        return STRINGLIB(_simd_count_char)(s, n, p0, PY_SSIZE_T_MAX);
+    }
+#endif
     for (Py_ssize_t i = 0; i < n; i++) {
         if (s[i] == p0) {
             count++;
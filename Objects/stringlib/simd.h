@@ -0,0 +1,146 @@
+/* stringlib: vector instruction set selection shared by the kernels in
+   fastsearch.h and codecs.h.
+
+   SSE2 and NEON are part of the x86-64 and AArch64 baselines, so the
+   kernels are selected at compile time.  A comparison of 16 bytes is
+   turned into an integer mask holding STRINGLIB_SIMD_BITS bits per byte;
+   STRINGLIB_SIMD_BITS is 0 if no vector instruction set is available. */
+
+#ifndef STRINGLIB_SIMD_BITS
+#  if defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64)
+#    include <emmintrin.h>
+#    define STRINGLIB_SIMD_SSE2
+#    define STRINGLIB_SIMD_BITS 1
+#  elif (defined(__ARM_NEON) && (defined(__aarch64__) || defined(_M_ARM64)) \
+         && PY_LITTLE_ENDIAN)
+#    include <arm_neon.h>
+#    define STRINGLIB_SIMD_NEON
+#    define STRINGLIB_SIMD_BITS 4
+#  else
+#    define STRINGLIB_SIMD_BITS 0
+#  endif
+
+#  if STRINGLIB_SIMD_BITS
+#    if defined(_MSC_VER) && !defined(__clang__)
+#      include <intrin.h>
+#    endif
+
+/* Index of the lowest set bit; mask must not be zero. */
+static inline int
+stringlib_simd_lowest(uint64_t mask)
+{
+#    if defined(__GNUC__) || defined(__clang__)
+    return __builtin_ctzll(mask);
+#    elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_ARM64))
+    unsigned long index;
+    _BitScanForward64(&index, mask);
+    return (int)index;
+#    else
+    int index = 0;
+    while (!(mask & 1)) {
+        mask >>= 1;
+        index++;
+    }
+    return index;
+#    endif
+}
+
+/* Index of the highest set bit; mask must not be zero. */
+static inline int
+stringlib_simd_highest(uint64_t mask)
+{
+#    if defined(__GNUC__) || defined(__clang__)
+    return 63 - __builtin_clzll(mask);
+#    elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_ARM64))
+    unsigned long index;
+    _BitScanReverse64(&index, mask);
+    return (int)index;
+#    else
+    int index = 63;
+    while (!(mask >> 63)) {
+        mask <<= 1;
+        index--;
+    }
+    return index;
+#    endif
+}
+
+/* Vectors of 16 bytes.  Unlike the comparison masks above, the masks
+   returned by stringlib_simd_bytes_*() hold one bit per byte. */
+#    ifdef STRINGLIB_SIMD_SSE2
+typedef __m128i stringlib_simd_u8;
+
+static inline stringlib_simd_u8
+stringlib_simd_load(const void *p)
+{
+    return _mm_loadu_si128((const __m128i *)p);
+}
+
+/* Mask of the bytes >= 0x80. */
+static inline uint32_t
+stringlib_simd_bytes_high(stringlib_simd_u8 v)
+{
+    return (uint32_t)_mm_movemask_epi8(v);
+}
+
+/* Mask of the bytes >= c, where c > 0x80. */
+static inline uint32_t
+stringlib_simd_bytes_ge(stringlib_simd_u8 v, unsigned char c)
+{
+    /* A signed comparison is right for the bytes >= 0x80; the others
+       are dropped by their sign bit. */
+    __m128i gt = _mm_cmpgt_epi8(v, _mm_set1_epi8((char)(c - 1)));
+    return (uint32_t)_mm_movemask_epi8(_mm_and_si128(gt, v));
+}
+
+/* Mask of the bytes equal to c. */
+static inline uint32_t
+stringlib_simd_bytes_eq(stringlib_simd_u8 v, unsigned char c)
+{
+    __m128i eq = _mm_cmpeq_epi8(v, _mm_set1_epi8((char)c));
+    return (uint32_t)_mm_movemask_epi8(eq);
+}
+#    else
+typedef uint8x16_t stringlib_simd_u8;
+
+static inline stringlib_simd_u8
+stringlib_simd_load(const void *p)
+{
+    return vld1q_u8((const uint8_t *)p);
+}
+
+/* Gather the top bits of the 16 bytes of m, which are 0x00 or 0xFF. */
+static inline uint32_t
+stringlib_simd_movemask(uint8x16_t m)
+{
+    static const uint8_t weights[16] = {
+        1, 2, 4, 8, 16, 32, 64, 128, 1, 2, 4, 8, 16, 32, 64, 128,
+    };
+    uint8x16_t t = vandq_u8(m, vld1q_u8(weights));
+    return (uint32_t)vaddv_u8(vget_low_u8(t))
+           | ((uint32_t)vaddv_u8(vget_high_u8(t)) << 8);
+}
+
+/* Mask of the bytes >= 0x80. */
+static inline uint32_t
+stringlib_simd_bytes_high(stringlib_simd_u8 v)
+{
+    return stringlib_simd_movemask(vcgeq_u8(v, vdupq_n_u8(0x80)));
+}
+
+/* Mask of the bytes >= c, where c > 0x80. */
+static inline uint32_t
+stringlib_simd_bytes_ge(stringlib_simd_u8 v, unsigned char c)
+{
+    return stringlib_simd_movemask(vcgeq_u8(v, vdupq_n_u8(c)));
+}
+
+/* Mask of the bytes equal to c. */
+static inline uint32_t
+stringlib_simd_bytes_eq(stringlib_simd_u8 v, unsigned char c)
+{
+    return stringlib_simd_movemask(vceqq_u8(v, vdupq_n_u8(c)));
+}
+#    endif
+#  endif
+#endif
@@ -113,6 +113,17 @@ STRINGLIB(split_char)(PyObject* str_obj,
 
     i = j = 0;
     while ((j < str_len) && (maxcount-- > 0)) {
+#ifdef STRINGLIB_SIMD_CHARS
+        /* For 1-byte strings memchr makes no difference, but the vector
+           search beats the loop below for wider characters. */
+        Py_ssize_t pos = STRINGLIB(find_char)(str + j, str_len - j, ch);
+        if (pos < 0) {
+            break;
+        }
+        j += pos;
+        SPLIT_ADD(str, i, j);
+        i = j = j + 1;
+#else
         for(; j < str_len; j++) {
             /* I found that using memchr makes no difference */
             if (str[j] == ch) {
@@ -121,6 +132,7 @@ STRINGLIB(split_char)(PyObject* str_obj,
                 break;
             }
         }
+#endif
     }
 #if !STRINGLIB_MUTABLE
     if (count == 0 && STRINGLIB_CHECK_EXACT(str_obj)) {
@@ -254,6 +266,14 @@ STRINGLIB(rsplit_char)(PyObject* str_obj,
 
     i = j = str_len - 1;
     while ((i >= 0) && (maxcount-- > 0)) {
+#ifdef STRINGLIB_SIMD_CHARS
+        i = STRINGLIB(rfind_char)(str, i + 1, ch);
+        if (i < 0) {
+            break;
+        }
+        SPLIT_ADD(str, i + 1, j + 1);
+        j = i = i - 1;
+#else
         for(; i >= 0; i--) {
             if (str[i] == ch) {
                 SPLIT_ADD(str, i + 1, j + 1);
@@ -261,6 +281,7 @@ STRINGLIB(rsplit_char)(PyObject* str_obj,
                 break;
             }
         }
+#endif
     }
 #if !STRINGLIB_MUTABLE
     if (count == 0 && STRINGLIB_CHECK_EXACT(str_obj)) {
@@ -9,3 +9,6 @@
 #undef STRINGLIB_IS_UNICODE
 #undef STRINGLIB_MUTABLE
 #undef STRINGLIB_FAST_MEMCHR
+#undef STRINGLIB_SIMD_CHARS
+#undef STRINGLIB_SIMD_CHAR_BITS
+#undef STRINGLIB_SIMD_COUNT_BLOCK
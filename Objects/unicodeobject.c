@@ -5047,14 +5047,30 @@ vector_utf8_start_chars(size_t v)
 }
 
 
-// Count the number of UTF-8 code points in a given byte sequence.
+// Set the 0x80 bit of each byte of v that is at least c, where c >= 0x80:
+// adding 0x100 - c to the low 7 bits of such a byte sets its bit 7.
+static inline size_t
+vector_bytes_at_least(size_t v, unsigned int c)
+{
+    return ((v & ~ASCII_CHAR_MASK) + (0x100 - c) * VECTOR_0101) & v;
+}
+
+
+// Count the number of UTF-8 code points in a given byte sequence, and
+// compute in *maxchar the maximum character of the narrowest PEP 393
+// kind able to hold them (assuming the sequence is valid and not ASCII).
 static Py_ssize_t
-utf8_count_codepoints(const unsigned char *s, const unsigned char *end)
+utf8_count_codepoints(const unsigned char *s, const unsigned char *end,
+                      Py_UCS4 *maxchar)
 {
     Py_ssize_t len = 0;
+    int ucs2 = 0, ucs4 = 0;
 
     if (end - s >= SIZEOF_SIZE_T) {
+        size_t vucs2 = 0, vucs4 = 0;
         while (!_Py_IS_ALIGNED(s, ALIGNOF_SIZE_T)) {
+            ucs2 |= *s >= 0xc4;
+            ucs4 |= *s >= 0xf0;
             len += scalar_utf8_start_char(*s++);
         }
 
@@ -5068,6 +5084,9 @@ utf8_count_codepoints(const unsigned char *s, const unsigned char *end)
                 size_t v = *(size_t*)s;
                 size_t vs = vector_utf8_start_chars(v);
                 vstart += vs;
+                // lead bytes of characters above U+00FF and U+FFFF
+                vucs2 |= vector_bytes_at_least(v, 0xc4);
+                vucs4 |= vector_bytes_at_least(v, 0xf0);
                 s += SIZEOF_SIZE_T;
             }
             vstart = (vstart & VECTOR_00FF) + ((vstart >> 8) & VECTOR_00FF);
@@ -5077,10 +5096,15 @@ utf8_count_codepoints(const unsigned char *s, const unsigned char *end)
 #endif
             len += vstart & 0x7ff;
         }
+        ucs2 |= (vucs2 & ASCII_CHAR_MASK) != 0;
+        ucs4 |= (vucs4 & ASCII_CHAR_MASK) != 0;
     }
     while (s < end) {
+        ucs2 |= *s >= 0xc4;
+        ucs4 |= *s >= 0xf0;
         len += scalar_utf8_start_char(*s++);
     }
+    *maxchar = ucs4 ? 0x10ffff : ucs2 ? 0xffff : 0xff;
     return len;
 }
 
@@ -5293,21 +5317,15 @@ unicode_decode_utf8(const char *s, Py_ssize_t size,
     // otherwise: check the input and decide the maxchr and maxsize to reduce
     // reallocation and copy.
     if (error_handler == _Py_ERROR_STRICT && !consumed && ch >= 0xc2) {
-        // we only calculate the number of codepoints and don't determine the exact maxchr.
-        // This is because writing fast and portable SIMD code to find maxchr is difficult.
-        // If reallocation occurs for a larger maxchar, knowing the exact number of codepoints
-        // means that it is no longer necessary to allocate several times the required amount
-        // of memory.
-        maxsize = utf8_count_codepoints((const unsigned char *)s, (const unsigned char *)end);
-        if (ch < 0xc4) { // latin1
-            maxchr = 0xff;
-        }
-        else if (ch < 0xf0) { // ucs2
-            maxchr = 0xffff;
-        }
-        else { // ucs4
-            maxchr = 0x10ffff;
-        }
+        // Calculate the exact number of codepoints and the kind of the
+        // result from the lead bytes, so that the string is created with
+        // its final size and kind and never needs to be widened.  If the
+        // input turns out to be invalid, the decoder raises anyway.
+        Py_UCS4 maxchar;
+        maxsize = utf8_count_codepoints((const unsigned char *)s,
+                                        (const unsigned char *)end,
+                                        &maxchar);
+        maxchr = maxchar;
     }
     PyObject *u = PyUnicode_New(maxsize, maxchr);
     if (!u) {
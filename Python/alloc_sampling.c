@@ -0,0 +1,272 @@
+/* Allocation sampling for out-of-process profilers.
+
+   While sampling is enabled, the allocators of the PYMEM_DOMAIN_MEM and
+   PYMEM_DOMAIN_OBJ domains are wrapped.  Each thread counts down the bytes
+   it allocates; when the count crosses zero, the allocation is recorded
+   with the Python stack of the thread in a ring buffer of fixed size
+   records.  The buffer is described by _Py_DebugOffsets so that a remote
+   profiler (see Modules/_remote_debugging) can drain it without stopping
+   the process.  Recording does not allocate memory and takes no lock. */
+
+#include "Python.h"
+#include "pycore_alloc_sampling.h"
+#include "pycore_interpframe.h"   // _PyThreadState_GetFrame()
+#include "pycore_lock.h"          // PyMutex_Lock()
+#include "pycore_pystate.h"       // _PyThreadState_GET()
+#include "pycore_runtime.h"       // _PyRuntime
+
+
+#define sampling_state _PyRuntime.alloc_sampling
+
+/* Bytes the current thread can still allocate before the next sample */
+static _Py_thread_local int64_t sampling_countdown = 0;
+/* State of the per-thread pseudo-random generator (xorshift64*) */
+static _Py_thread_local uint64_t sampling_rng = 0;
+
+
+/* Return a random offset in [-interval/2, interval/2) added to the distance
+   between two samples: the mean distance stays `interval`, but allocation
+   patterns which repeat with a period dividing the interval are not always
+   sampled at the same allocation. */
+static int64_t
+sampling_jitter(uint64_t interval)
+{
+    uint64_t x = sampling_rng;
+    if (x == 0) {
+        x = (uint64_t)(uintptr_t)&sampling_rng ^ 0x9e3779b97f4a7c15;
+    }
+    x ^= x >> 12;
+    x ^= x << 25;
+    x ^= x >> 27;
+    sampling_rng = x;
+    uint64_t r = (x * 0x2545f4914f6cdd1d) % interval;
+    return (int64_t)r - (int64_t)(interval / 2);
+}
+
+
+static void
+record_sample(size_t size, int64_t countdown)
+{
+    struct _alloc_sampling_runtime_state *state = &sampling_state;
+    uint64_t interval = _Py_atomic_load_uint64_relaxed(&state->interval);
+    if (interval == 0) {
+        // Sampling was stopped but the hooks are still installed
+        sampling_countdown = 0;
+        return;
+    }
+
+    // The allocation covers every interval boundary it crosses
+    uint64_t over = (uint64_t)(-countdown);
+    uint64_t weight = 1 + over / interval;
+    int64_t next = (int64_t)(interval - over % interval) + sampling_jitter(interval);
+    sampling_countdown = next > 0 ? next : 1;
+
+    uint64_t index = _Py_atomic_add_uint64(&state->write_index, 1);
+    struct _Py_alloc_sample *sample =
+        &state->samples[index & (state->capacity - 1)];
+    _Py_atomic_store_uint64_relaxed(&sample->sequence, 0);
+
+    sample->size = size;
+    sample->weight = weight;
+    uint32_t nframes = 0;
+    PyThreadState *tstate = _PyThreadState_GET();
+    if (tstate != NULL) {
+#ifdef PY_HAVE_THREAD_NATIVE_ID
+        sample->thread_id = tstate->native_thread_id;
+#else
+        sample->thread_id = tstate->thread_id;
+#endif
+        sample->interpreter_id = tstate->interp->id;
+        sample->interp = (uintptr_t)tstate->interp;
+        sample->code_object_generation = _Py_atomic_load_uint64_relaxed(
+            &tstate->interp->_code_object_generation);
+        _PyInterpreterFrame *frame = _PyThreadState_GetFrame(tstate);
+        while (frame != NULL && nframes < _Py_ALLOC_SAMPLING_MAX_FRAMES) {
+            struct _Py_alloc_sample_frame *f = &sample->frames[nframes++];
+            f->code = (uintptr_t)_PyFrame_GetCode(frame);
+            f->instr_ptr = (uintptr_t)frame->instr_ptr;
+#ifdef Py_GIL_DISABLED
+            f->tlbc_index = frame->tlbc_index;
+#else
+            f->tlbc_index = 0;
+#endif
+            frame = _PyFrame_GetFirstComplete(frame->previous);
+        }
+    }
+    else {
+#ifdef PY_HAVE_THREAD_NATIVE_ID
+        sample->thread_id = PyThread_get_thread_native_id();
+#else
+        sample->thread_id = PyThread_get_thread_ident();
+#endif
+        sample->interpreter_id = -1;
+        sample->interp = 0;
+        sample->code_object_generation = 0;
+    }
+    sample->nframes = nframes;
+
+    _Py_atomic_store_uint64_release(&sample->sequence, index + 1);
+}
+
+
+static inline void
+sample_allocation(size_t size)
+{
+    int64_t countdown = sampling_countdown - (int64_t)size;
+    if (countdown > 0) {
+        sampling_countdown = countdown;
+        return;
+    }
+    record_sample(size, countdown);
+}
+
+
+static void *
+sampling_malloc(void *ctx, size_t size)
+{
+    PyMemAllocatorEx *alloc = (PyMemAllocatorEx *)ctx;
+    void *ptr = alloc->malloc(alloc->ctx, size);
+    if (ptr != NULL) {
+        sample_allocation(size);
+    }
+    return ptr;
+}
+
+
+static void *
+sampling_calloc(void *ctx, size_t nelem, size_t elsize)
+{
+    PyMemAllocatorEx *alloc = (PyMemAllocatorEx *)ctx;
+    void *ptr = alloc->calloc(alloc->ctx, nelem, elsize);
+    if (ptr != NULL) {
+        // calloc() succeeded, so nelem * elsize does not overflow
+        sample_allocation(nelem * elsize);
+    }
+    return ptr;
+}
+
+
+static void *
+sampling_realloc(void *ctx, void *ptr, size_t new_size)
+{
+    PyMemAllocatorEx *alloc = (PyMemAllocatorEx *)ctx;
+    void *ptr2 = alloc->realloc(alloc->ctx, ptr, new_size);
+    if (ptr2 != NULL) {
+        sample_allocation(new_size);
+    }
+    return ptr2;
+}
+
+
+static void
+sampling_free(void *ctx, void *ptr)
+{
+    PyMemAllocatorEx *alloc = (PyMemAllocatorEx *)ctx;
+    alloc->free(alloc->ctx, ptr);
+}
+
+
+static void
+install_hooks(void)
+{
+    struct _alloc_sampling_runtime_state *state = &sampling_state;
+    if (state->hooks_installed) {
+        return;
+    }
+
+    PyMemAllocatorEx alloc;
+    alloc.malloc = sampling_malloc;
+    alloc.calloc = sampling_calloc;
+    alloc.realloc = sampling_realloc;
+    alloc.free = sampling_free;
+
+    alloc.ctx = &state->allocators.mem;
+    PyMem_GetAllocator(PYMEM_DOMAIN_MEM, &state->allocators.mem);
+    PyMem_SetAllocator(PYMEM_DOMAIN_MEM, &alloc);
+
+    alloc.ctx = &state->allocators.obj;
+    PyMem_GetAllocator(PYMEM_DOMAIN_OBJ, &state->allocators.obj);
+    PyMem_SetAllocator(PYMEM_DOMAIN_OBJ, &alloc);
+
+    state->hooks_installed = 1;
+}
+
+
+/* Remove the hooks, unless another hook (like tracemalloc) was installed on
+   top of them since: they then stay in place and only pass calls through.
+   Return 1 if the hooks were removed. */
+static int
+uninstall_hooks(void)
+{
+    struct _alloc_sampling_runtime_state *state = &sampling_state;
+    if (!state->hooks_installed) {
+        return 1;
+    }
+
+    PyMemAllocatorEx mem, obj;
+    PyMem_GetAllocator(PYMEM_DOMAIN_MEM, &mem);
+    PyMem_GetAllocator(PYMEM_DOMAIN_OBJ, &obj);
+    if (mem.malloc != sampling_malloc || obj.malloc != sampling_malloc) {
+        return 0;
+    }
+
+    PyMem_SetAllocator(PYMEM_DOMAIN_MEM, &state->allocators.mem);
+    PyMem_SetAllocator(PYMEM_DOMAIN_OBJ, &state->allocators.obj);
+    state->hooks_installed = 0;
+    return 1;
+}
+
+
+int
+_PyAllocSampling_SetInterval(uint64_t interval)
+{
+    struct _alloc_sampling_runtime_state *state = &sampling_state;
+    PyMutex_Lock(&state->mutex);
+
+    if (interval != 0 && state->samples == NULL) {
+        // Allocated once and only released at exit: a remote reader may be
+        // copying records at any time.
+        assert(state->capacity != 0);
+        assert((state->capacity & (state->capacity - 1)) == 0);
+        state->samples = PyMem_RawCalloc(state->capacity,
+                                         sizeof(struct _Py_alloc_sample));
+        if (state->samples == NULL) {
+            PyMutex_Unlock(&state->mutex);
+            PyErr_NoMemory();
+            return -1;
+        }
+    }
+
+    _Py_atomic_store_uint64_relaxed(&state->interval, interval);
+    if (interval != 0) {
+        install_hooks();
+    }
+    else {
+        (void)uninstall_hooks();
+    }
+
+    PyMutex_Unlock(&state->mutex);
+    return 0;
+}
+
+
+uint64_t
+_PyAllocSampling_GetInterval(void)
+{
+    return _Py_atomic_load_uint64_relaxed(&sampling_state.interval);
+}
+
+
+void
+_PyAllocSampling_Fini(void)
+{
+    struct _alloc_sampling_runtime_state *state = &sampling_state;
+    PyMutex_Lock(&state->mutex);
+    _Py_atomic_store_uint64_relaxed(&state->interval, 0);
+    // If the hooks cannot be removed, they still reference the buffer
+    if (uninstall_hooks()) {
+        PyMem_RawFree(state->samples);
+        state->samples = NULL;
+    }
+    PyMutex_Unlock(&state->mutex);
+}
@@ -604,6 +604,7 @@ dummy_func(
             BINARY_OP_SUBSCR_DICT,
             BINARY_OP_SUBSCR_GETITEM,
             BINARY_OP_INPLACE_ADD_UNICODE,
+            BINARY_OP_INPLACE_ADD_UNICODE_DEREF,
             BINARY_OP_EXTEND,
         };
 
@@ -757,6 +758,101 @@ dummy_func(
         macro(BINARY_OP_SUBTRACT_FLOAT) =
             _GUARD_TOS_FLOAT + _GUARD_NOS_FLOAT + unused/5 + _BINARY_OP_SUBTRACT_FLOAT + _POP_TOP_FLOAT + _POP_TOP_FLOAT;
 
+        /* The optimizer replaces the float operations above with these when
+         * an operand is an intermediate result rather than a borrowed
+         * reference.  If the stack holds the only reference to the operand,
+         * the result is stored into it, so that a chain of arithmetic on
+         * temporaries reuses one float object instead of allocating a new
+         * one for each step.  The operands are still popped afterwards, so
+         * the reused object is returned as a new reference.
+         */
+        tier2 op(_BINARY_OP_ADD_FLOAT_INPLACE, (left, right -- res, l, r)) {
+            PyObject *left_o = PyStackRef_AsPyObjectBorrow(left);
+            PyObject *right_o = PyStackRef_AsPyObjectBorrow(right);
+            assert(PyFloat_CheckExact(left_o));
+            assert(PyFloat_CheckExact(right_o));
+
+            STAT_INC(BINARY_OP, hit);
+            double dres =
+                ((PyFloatObject *)left_o)->ob_fval +
+                ((PyFloatObject *)right_o)->ob_fval;
+            if (PyStackRef_RefcountOnObject(left) && _PyObject_IsUniquelyReferenced(left_o)) {
+                ((PyFloatObject *)left_o)->ob_fval = dres;
+                res = PyStackRef_DUP(left);
+            }
+            else if (PyStackRef_RefcountOnObject(right) && _PyObject_IsUniquelyReferenced(right_o)) {
+                ((PyFloatObject *)right_o)->ob_fval = dres;
+                res = PyStackRef_DUP(right);
+            }
+            else {
+                res = PyStackRef_FromPyObjectSteal(PyFloat_FromDouble(dres));
+                if (PyStackRef_IsNull(res)) {
+                    ERROR_NO_POP();
+                }
+            }
+            l = left;
+            r = right;
+            INPUTS_DEAD();
+        }
+
+        tier2 op(_BINARY_OP_SUBTRACT_FLOAT_INPLACE, (left, right -- res, l, r)) {
+            PyObject *left_o = PyStackRef_AsPyObjectBorrow(left);
+            PyObject *right_o = PyStackRef_AsPyObjectBorrow(right);
+            assert(PyFloat_CheckExact(left_o));
+            assert(PyFloat_CheckExact(right_o));
+
+            STAT_INC(BINARY_OP, hit);
+            double dres =
+                ((PyFloatObject *)left_o)->ob_fval -
+                ((PyFloatObject *)right_o)->ob_fval;
+            if (PyStackRef_RefcountOnObject(left) && _PyObject_IsUniquelyReferenced(left_o)) {
+                ((PyFloatObject *)left_o)->ob_fval = dres;
+                res = PyStackRef_DUP(left);
+            }
+            else if (PyStackRef_RefcountOnObject(right) && _PyObject_IsUniquelyReferenced(right_o)) {
+                ((PyFloatObject *)right_o)->ob_fval = dres;
+                res = PyStackRef_DUP(right);
+            }
+            else {
+                res = PyStackRef_FromPyObjectSteal(PyFloat_FromDouble(dres));
+                if (PyStackRef_IsNull(res)) {
+                    ERROR_NO_POP();
+                }
+            }
+            l = left;
+            r = right;
+            INPUTS_DEAD();
+        }
+
+        tier2 op(_BINARY_OP_MULTIPLY_FLOAT_INPLACE, (left, right -- res, l, r)) {
+            PyObject *left_o = PyStackRef_AsPyObjectBorrow(left);
+            PyObject *right_o = PyStackRef_AsPyObjectBorrow(right);
+            assert(PyFloat_CheckExact(left_o));
+            assert(PyFloat_CheckExact(right_o));
+
+            STAT_INC(BINARY_OP, hit);
+            double dres =
+                ((PyFloatObject *)left_o)->ob_fval *
+                ((PyFloatObject *)right_o)->ob_fval;
+            if (PyStackRef_RefcountOnObject(left) && _PyObject_IsUniquelyReferenced(left_o)) {
+                ((PyFloatObject *)left_o)->ob_fval = dres;
+                res = PyStackRef_DUP(left);
+            }
+            else if (PyStackRef_RefcountOnObject(right) && _PyObject_IsUniquelyReferenced(right_o)) {
+                ((PyFloatObject *)right_o)->ob_fval = dres;
+                res = PyStackRef_DUP(right);
+            }
+            else {
+                res = PyStackRef_FromPyObjectSteal(PyFloat_FromDouble(dres));
+                if (PyStackRef_IsNull(res)) {
+                    ERROR_NO_POP();
+                }
+            }
+            l = left;
+            r = right;
+            INPUTS_DEAD();
+        }
+
         pure op(_BINARY_OP_ADD_UNICODE, (left, right -- res, l, r)) {
             PyObject *left_o = PyStackRef_AsPyObjectBorrow(left);
             PyObject *right_o = PyStackRef_AsPyObjectBorrow(right);
@@ -823,6 +919,38 @@ dummy_func(
             res = PyStackRef_FromPyObjectSteal(temp);
         }
 
+        // The same for a cell variable: `left += right` followed by
+        // STORE_DEREF, as in a closure using `nonlocal`.  The cell's
+        // reference is cleared before appending and STORE_DEREF stores
+        // the result.  Only specialized with the GIL, since other threads
+        // could observe the empty cell otherwise.
+        op(_BINARY_OP_INPLACE_ADD_UNICODE_DEREF, (left, right -- res)) {
+            PyObject *left_o = PyStackRef_AsPyObjectBorrow(left);
+            assert(PyUnicode_CheckExact(left_o));
+            assert(PyUnicode_CheckExact(PyStackRef_AsPyObjectBorrow(right)));
+
+            int next_oparg;
+        #if TIER_ONE
+            assert(next_instr->op.code == STORE_DEREF);
+            next_oparg = next_instr->op.arg;
+        #else
+            next_oparg = (int)CURRENT_OPERAND0_16();
+        #endif
+            PyCellObject *cell = (PyCellObject *)PyStackRef_AsPyObjectBorrow(GETLOCAL(next_oparg));
+            DEOPT_IF(cell->ob_ref != left_o);
+            STAT_INC(BINARY_OP, hit);
+            assert(Py_REFCNT(left_o) >= 2 || !PyStackRef_IsHeapSafe(left));
+            PyObject *temp = cell->ob_ref;
+            cell->ob_ref = NULL;
+            PyObject *right_o = PyStackRef_AsPyObjectSteal(right);
+            PyStackRef_CLOSE_SPECIALIZED(left, _PyUnicode_ExactDealloc);
+            DEAD(left);
+            PyUnicode_Append(&temp, right_o);
+            _Py_DECREF_SPECIALIZED(right_o, _PyUnicode_ExactDealloc);
+            ERROR_IF(temp == NULL);
+            res = PyStackRef_FromPyObjectSteal(temp);
+        }
+
        op(_GUARD_BINARY_OP_EXTEND, (descr/4, left, right -- left, right)) {
             PyObject *left_o = PyStackRef_AsPyObjectBorrow(left);
             PyObject *right_o = PyStackRef_AsPyObjectBorrow(right);
@@ -858,6 +986,9 @@ dummy_func(
         macro(BINARY_OP_INPLACE_ADD_UNICODE) =
             _GUARD_TOS_UNICODE + _GUARD_NOS_UNICODE + unused/5 + _BINARY_OP_INPLACE_ADD_UNICODE;
 
+        macro(BINARY_OP_INPLACE_ADD_UNICODE_DEREF) =
+            _GUARD_TOS_UNICODE + _GUARD_NOS_UNICODE + unused/5 + _BINARY_OP_INPLACE_ADD_UNICODE_DEREF;
+
         specializing op(_SPECIALIZE_BINARY_SLICE, (container, start, stop -- container, start, stop)) {
             // Placeholder until we implement BINARY_SLICE specialization
             #if ENABLE_SPECIALIZATION
@@ -6,6 +6,7 @@ preserve
 #  include "pycore_gc.h"          // PyGC_Head
 #  include "pycore_runtime.h"     // _Py_ID()
 #endif
+#include "pycore_abstract.h"      // _PyNumber_Index()
 #include "pycore_modsupport.h"    // _PyArg_UnpackKeywords()
 
 PyDoc_STRVAR(sys_addaudithook__doc__,
@@ -1820,6 +1821,74 @@ exit:
     return return_value;
 }
 
+PyDoc_STRVAR(sys__set_allocation_sampling__doc__,
+"_set_allocation_sampling($module, interval, /)\n"
+"--\n"
+"\n"
+"Sample one memory allocation every *interval* bytes on average.\n"
+"\n"
+"The samples and the Python stack that made them are recorded for\n"
+"out-of-process profilers such as profiling.sampling.  Pass 0 to stop\n"
+"sampling.");
+
+#define SYS__SET_ALLOCATION_SAMPLING_METHODDEF    \
+    {"_set_allocation_sampling", (PyCFunction)sys__set_allocation_sampling, METH_O, sys__set_allocation_sampling__doc__},
+
+static PyObject *
+sys__set_allocation_sampling_impl(PyObject *module, Py_ssize_t interval);
+
+static PyObject *
+sys__set_allocation_sampling(PyObject *module, PyObject *arg)
+{
+    PyObject *return_value = NULL;
+    Py_ssize_t interval;
+
+    {
+        Py_ssize_t ival = -1;
+        PyObject *iobj = _PyNumber_Index(arg);
+        if (iobj != NULL) {
+            ival = PyLong_AsSsize_t(iobj);
+            Py_DECREF(iobj);
+        }
+        if (ival == -1 && PyErr_Occurred()) {
+            goto exit;
+        }
+        interval = ival;
+    }
+    return_value = sys__set_allocation_sampling_impl(module, interval);
+
+exit:
+    return return_value;
+}
+
+PyDoc_STRVAR(sys__get_allocation_sampling__doc__,
+"_get_allocation_sampling($module, /)\n"
+"--\n"
+"\n"
+"Return the allocation sampling interval in bytes, or 0 if it is off.");
+
+#define SYS__GET_ALLOCATION_SAMPLING_METHODDEF    \
+    {"_get_allocation_sampling", (PyCFunction)sys__get_allocation_sampling, METH_NOARGS, sys__get_allocation_sampling__doc__},
+
+static Py_ssize_t
+sys__get_allocation_sampling_impl(PyObject *module);
+
+static PyObject *
+sys__get_allocation_sampling(PyObject *module, PyObject *Py_UNUSED(ignored))
+{
+    PyObject *return_value = NULL;
+    Py_ssize_t _return_value;
+
+    _return_value = sys__get_allocation_sampling_impl(module);
+    if ((_return_value == -1) && PyErr_Occurred()) {
+        goto exit;
+    }
+    return_value = PyLong_FromSsize_t(_return_value);
+
+exit:
+    return return_value;
+}
+
 PyDoc_STRVAR(sys_set_lazy_imports_filter__doc__,
 "set_lazy_imports_filter($module, /, filter)\n"
 "--\n"
@@ -2121,4 +2190,4 @@ exit:
 #ifndef SYS_GETANDROIDAPILEVEL_METHODDEF
     #define SYS_GETANDROIDAPILEVEL_METHODDEF
 #endif /* !defined(SYS_GETANDROIDAPILEVEL_METHODDEF) */
-/*[clinic end generated code: output=adbadb629b98eabf input=a9049054013a1b77]*/
+/*[clinic end generated code: output=7f46f79d292be7ed input=a9049054013a1b77]*/
@@ -1372,6 +1372,73 @@ add_stats(GCState *gcstate, int gen, struct gc_collection_stats *stats)
     gcstate->generation_stats[gen].uncollectable += stats->uncollectable;
     gcstate->generation_stats[gen].candidates += stats->candidates;
     gcstate->generation_stats[gen].collections += 1;
+    _PyGC_UpdateSurvivalRate(&gcstate->generation_stats[gen],
+                             stats->candidates, stats->collected);
+}
+
+/* Bounds of the young generation threshold when it is adapted to the pause
+ * target set by gc.set_pause_target(). */
+#define ADAPTIVE_MIN_THRESHOLD 100
+#define ADAPTIVE_MAX_THRESHOLD 100000
+
+/* Resize the young generation after an automatic increment so that the next
+ * one is expected to take about as long as the pause target.
+ *
+ * Pauses longer than the target shrink the threshold in proportion.  Pauses
+ * well under the target grow it, to amortise the fixed cost of a collection
+ * over more allocations.  It grows faster when most objects survive, since
+ * collecting them early then buys little memory.
+ */
+static void
+adapt_young_threshold(GCState *gcstate, struct gc_collection_stats *stats)
+{
+    double target = gcstate->pause_target;
+    if (target <= 0.0 || gcstate->young.threshold == 0 || stats->candidates == 0) {
+        return;
+    }
+    double cost = stats->duration / (double)stats->candidates;
+    if (gcstate->pause_cost == 0.0) {
+        gcstate->pause_cost = cost;
+    }
+    else {
+        gcstate->pause_cost += (cost - gcstate->pause_cost) / 4;
+    }
+    double threshold = gcstate->young.threshold;
+    if (stats->duration > target) {
+        threshold *= target / stats->duration;
+    }
+    else if (stats->duration < target / 2) {
+        double survival_rate = gcstate->generation_stats[1].survival_rate;
+        threshold *= 1.1 + 0.4 * survival_rate;
+    }
+    if (threshold < ADAPTIVE_MIN_THRESHOLD) {
+        threshold = ADAPTIVE_MIN_THRESHOLD;
+    }
+    else if (threshold > ADAPTIVE_MAX_THRESHOLD) {
+        threshold = ADAPTIVE_MAX_THRESHOLD;
+    }
+    gcstate->young.threshold = (int)threshold;
+}
+
+/* Maximum number of objects to put in an increment, given that the young
+ * generation alone contributes young_size objects. */
+static Py_ssize_t
+increment_limit(GCState *gcstate, Py_ssize_t young_size)
+{
+    if (gcstate->pause_target <= 0.0 || gcstate->pause_cost <= 0.0) {
+        return PY_SSIZE_T_MAX;
+    }
+    double budget = gcstate->pause_target / gcstate->pause_cost;
+    /* Always scan at least as many old objects as there are young ones, or
+     * the collector would fall behind; the unfinished work is carried over
+     * in work_to_do and the young threshold shrinks to compensate. */
+    if (budget < 2.0 * young_size) {
+        return 2 * young_size;
+    }
+    if (budget >= (double)PY_SSIZE_T_MAX) {
+        return PY_SSIZE_T_MAX;
+    }
+    return (Py_ssize_t)budget;
 }
 
 static void
@@ -1686,7 +1753,8 @@ gc_collect_increment(PyThreadState *tstate, struct gc_collection_stats *stats)
     gc_list_merge(&gcstate->young.head, &increment);
     gc_list_validate_space(&increment, gcstate->visited_space);
     Py_ssize_t increment_size = gc_list_size(&increment);
-    while (increment_size < gcstate->work_to_do) {
+    Py_ssize_t limit = increment_limit(gcstate, increment_size);
+    while (increment_size < gcstate->work_to_do && increment_size < limit) {
         if (gc_list_is_empty(not_visited)) {
             break;
         }
@@ -2112,6 +2180,9 @@ _PyGC_Collect(PyThreadState *tstate, int generation, _PyGC_Reason reason)
     (void)PyTime_PerfCounterRaw(&stop);
     stats.duration = PyTime_AsSecondsDouble(stop - start);
     add_stats(gcstate, generation, &stats);
+    if (generation == 1 && reason == _Py_GC_REASON_HEAP) {
+        adapt_young_threshold(gcstate, &stats);
+    }
     if (PyDTrace_GC_DONE_ENABLED()) {
         PyDTrace_GC_DONE(stats.uncollectable + stats.collected);
     }
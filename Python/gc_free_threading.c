@@ -9,8 +9,12 @@
 #include "pycore_initconfig.h"    // _PyStatus_NO_MEMORY()
 #include "pycore_interp.h"        // PyInterpreterState.gc
 #include "pycore_interpframe.h"   // _PyFrame_GetLocalsArray()
+#include "pycore_lock.h"          // _Py_yield()
 #include "pycore_object_alloc.h"  // _PyObject_MallocWithType()
+#include "pycore_parking_lot.h"   // _PyParkingLot_Park()
+#include "pycore_pylifecycle.h"   // _PyThreadState_DeleteCurrent()
 #include "pycore_pystate.h"       // _PyThreadState_GET()
+#include "pycore_pythread.h"      // PyThread_start_joinable_thread()
 #include "pycore_tstate.h"        // _PyThreadStateImpl
 #include "pycore_tuple.h"         // _PyTuple_MaybeUntrack()
 #include "pycore_weakref.h"       // _PyWeakref_ClearRef()
@@ -858,11 +862,11 @@ gc_abort_mark_alive(PyInterpreterState *interp,
 
 #ifdef GC_MARK_ALIVE_STACKS
 static int
-gc_visit_stackref_mark_alive(gc_mark_args_t *args, _PyStackRef stackref)
+gc_visit_stackref_mark_alive(visitproc visit, void *args, _PyStackRef stackref)
 {
     if (!PyStackRef_IsNullOrInt(stackref)) {
         PyObject *op = PyStackRef_AsPyObjectBorrow(stackref);
-        if (gc_mark_enqueue(op, args) < 0) {
+        if (visit(op, args) < 0) {
             return -1;
         }
     }
@@ -870,7 +874,8 @@ gc_visit_stackref_mark_alive(gc_mark_args_t *args, _PyStackRef stackref)
 }
 
 static int
-gc_visit_thread_stacks_mark_alive(PyInterpreterState *interp, gc_mark_args_t *args)
+gc_visit_thread_stacks_mark_alive(PyInterpreterState *interp,
+                                  visitproc visit, void *args)
 {
     int err = 0;
     _Py_FOR_EACH_TSTATE_BEGIN(interp, p) {
@@ -887,13 +892,13 @@ gc_visit_thread_stacks_mark_alive(PyInterpreterState *interp, gc_mark_args_t *ar
             }
 
             _PyStackRef *top = f->stackpointer;
-            if (gc_visit_stackref_mark_alive(args, f->f_executable) < 0) {
+            if (gc_visit_stackref_mark_alive(visit, args, f->f_executable) < 0) {
                 err = -1;
                 goto exit;
             }
             while (top != f->localsplus) {
                 --top;
-                if (gc_visit_stackref_mark_alive(args, *top) < 0) {
+                if (gc_visit_stackref_mark_alive(visit, args, *top) < 0) {
                     err = -1;
                     goto exit;
                 }
@@ -1381,6 +1386,327 @@ gc_propagate_alive(gc_mark_args_t *args)
     }
 }
 
+// Call visit() on each of the known root objects (which must be non-garbage)
+// used by the "mark alive" pass.
+static int
+gc_visit_roots_mark_alive(PyInterpreterState *interp, visitproc visit,
+                          void *args)
+{
+    #define MARK_ENQUEUE(op) \
+        if (op != NULL ) { \
+            if (visit(op, args) < 0) { \
+                return -1; \
+            } \
+        }
+    MARK_ENQUEUE(interp->sysdict);
+#ifdef GC_MARK_ALIVE_EXTRA_ROOTS
+    MARK_ENQUEUE(interp->builtins);
+    MARK_ENQUEUE(interp->dict);
+    struct types_state *types = &interp->types;
+    for (int i = 0; i < _Py_MAX_MANAGED_STATIC_BUILTIN_TYPES; i++) {
+        MARK_ENQUEUE(types->builtins.initialized[i].tp_dict);
+        MARK_ENQUEUE(types->builtins.initialized[i].tp_subclasses);
+    }
+    for (int i = 0; i < _Py_MAX_MANAGED_STATIC_EXT_TYPES; i++) {
+        MARK_ENQUEUE(types->for_extensions.initialized[i].tp_dict);
+        MARK_ENQUEUE(types->for_extensions.initialized[i].tp_subclasses);
+    }
+#endif
+#ifdef GC_MARK_ALIVE_STACKS
+    if (gc_visit_thread_stacks_mark_alive(interp, visit, args) < 0) {
+        return -1;
+    }
+#endif
+    #undef MARK_ENQUEUE
+    return 0;
+}
+
+static int
+gc_mark_enqueue_visitproc(PyObject *op, void *args)
+{
+    if (op == NULL) {
+        return 0;
+    }
+    return gc_mark_enqueue(op, (gc_mark_args_t *)args);
+}
+
+// parallel marking //////////////////////////////////////////////////////
+
+// For large heaps, the "mark alive" pass can be split across several
+// threads (see gc.set_mark_threads()).  The collecting thread and a set of
+// helper threads, which are started for the duration of the pass, each
+// have a private mark stack.  Busy workers donate chunks of their stack to
+// a shared pool that idle workers take from.  The world is stopped, so the
+// only data shared between workers are the object GC bits: an object is
+// claimed by atomically setting its alive bit, which ensures that each
+// object is traversed exactly once.
+//
+// Helper threads don't have a thread state, so they use the raw memory
+// allocator and never call into code that could run Python code.
+
+// Number of object pointers handed from one mark worker to another at once.
+#define GC_PAR_CHUNK_SIZE 256
+
+// The helper threads are only started if the heap has at least this many
+// long lived objects.  Below that, the cost of starting the threads is
+// larger than the time saved.
+#define GC_PAR_MIN_OBJECTS 100000
+
+typedef struct gc_par_chunk {
+    struct gc_par_chunk *next;
+    Py_ssize_t size;
+    PyObject *items[GC_PAR_CHUNK_SIZE];
+} gc_par_chunk_t;
+
+// State shared between all mark workers
+typedef struct {
+    PyMutex mutex;              // protects "pool"
+    gc_par_chunk_t *pool;       // chunks of work donated by busy workers
+    Py_ssize_t pool_size;       // number of chunks in pool
+    int num_workers;            // workers that were started
+    int num_idle;               // workers that ran out of work
+    int error;                  // set if a worker ran out of memory
+} gc_par_shared_t;
+
+typedef struct {
+    gc_par_shared_t *shared;
+    PyObject **items;           // private mark stack
+    Py_ssize_t size;
+    Py_ssize_t capacity;
+    PyThread_handle_t handle;
+    PyThread_ident_t ident;
+} gc_par_worker_t;
+
+// Atomically set the alive bit of a tracked object.  Return true if this
+// thread set the bit and so is responsible for traversing the object.
+static inline bool
+gc_try_claim_alive(PyObject *op)
+{
+    uint8_t bits = _Py_atomic_load_uint8_relaxed(&op->ob_gc_bits);
+    do {
+        if ((bits & _PyGC_BITS_ALIVE) || !(bits & _PyGC_BITS_TRACKED)) {
+            return false;
+        }
+    } while (!_Py_atomic_compare_exchange_uint8(&op->ob_gc_bits, &bits,
+                                                bits | _PyGC_BITS_ALIVE));
+    return true;
+}
+
+// Make room for at least n more objects on the worker's stack.
+static int
+gc_par_reserve(gc_par_worker_t *w, Py_ssize_t n)
+{
+    if (w->size + n <= w->capacity) {
+        return 0;
+    }
+    Py_ssize_t capacity = w->capacity ? w->capacity : 4 * GC_PAR_CHUNK_SIZE;
+    while (capacity < w->size + n) {
+        capacity *= 2;
+    }
+    PyObject **items = PyMem_RawRealloc(w->items, capacity * sizeof(PyObject *));
+    if (items == NULL) {
+        return -1;
+    }
+    w->items = items;
+    w->capacity = capacity;
+    return 0;
+}
+
+static inline int
+gc_par_push(gc_par_worker_t *w, PyObject *op)
+{
+    if (gc_par_reserve(w, 1) < 0) {
+        return -1;
+    }
+    w->items[w->size++] = op;
+    return 0;
+}
+
+static void
+gc_par_pool_push(gc_par_shared_t *shared, gc_par_chunk_t *chunk)
+{
+    PyMutex_LockFlags(&shared->mutex, _Py_LOCK_DONT_DETACH);
+    chunk->next = shared->pool;
+    shared->pool = chunk;
+    _Py_atomic_store_ssize_relaxed(&shared->pool_size, shared->pool_size + 1);
+    PyMutex_Unlock(&shared->mutex);
+}
+
+static gc_par_chunk_t *
+gc_par_pool_pop(gc_par_shared_t *shared)
+{
+    PyMutex_LockFlags(&shared->mutex, _Py_LOCK_DONT_DETACH);
+    gc_par_chunk_t *chunk = shared->pool;
+    if (chunk != NULL) {
+        shared->pool = chunk->next;
+        _Py_atomic_store_ssize_relaxed(&shared->pool_size,
+                                       shared->pool_size - 1);
+    }
+    PyMutex_Unlock(&shared->mutex);
+    return chunk;
+}
+
+// Visitor used with tp_traverse: claim the object and push it on the
+// worker's private stack.
+static int
+gc_par_mark_enqueue(PyObject *op, void *arg)
+{
+    gc_par_worker_t *w = (gc_par_worker_t *)arg;
+    if (op == NULL || !gc_try_claim_alive(op)) {
+        return 0;
+    }
+    if (gc_maybe_untrack(op)) {
+        // Only the thread that claimed the object modifies its bits
+        // non-atomically.  Others will fail to claim it since the tracked
+        // bit is now clear.
+        gc_clear_alive(op);
+        return 0;
+    }
+    return gc_par_push(w, op);
+}
+
+// Move the top of a busy worker's stack to the shared pool, if some other
+// worker is waiting for work.
+static int
+gc_par_maybe_donate(gc_par_worker_t *w)
+{
+    gc_par_shared_t *shared = w->shared;
+    if (w->size < 2 * GC_PAR_CHUNK_SIZE ||
+        _Py_atomic_load_int_relaxed(&shared->num_idle) == 0 ||
+        _Py_atomic_load_ssize_relaxed(&shared->pool_size) > 0)
+    {
+        return 0;
+    }
+    gc_par_chunk_t *chunk = PyMem_RawMalloc(sizeof(gc_par_chunk_t));
+    if (chunk == NULL) {
+        return -1;
+    }
+    w->size -= GC_PAR_CHUNK_SIZE;
+    memcpy(chunk->items, &w->items[w->size],
+           GC_PAR_CHUNK_SIZE * sizeof(PyObject *));
+    chunk->size = GC_PAR_CHUNK_SIZE;
+    gc_par_pool_push(shared, chunk);
+    return 0;
+}
+
+// Wait until either there is work in the shared pool or all workers are
+// idle.  Returns true if the worker's stack was refilled.
+static bool
+gc_par_steal(gc_par_worker_t *w)
+{
+    gc_par_shared_t *shared = w->shared;
+    assert(w->size == 0);
+    _Py_atomic_add_int(&shared->num_idle, 1);
+    for (;;) {
+        if (_Py_atomic_load_int_relaxed(&shared->error)) {
+            return false;
+        }
+        if (_Py_atomic_load_ssize_relaxed(&shared->pool_size) > 0) {
+            gc_par_chunk_t *chunk = gc_par_pool_pop(shared);
+            if (chunk != NULL) {
+                if (gc_par_reserve(w, chunk->size) < 0) {
+                    // The chunk is freed with the rest of the pool.
+                    gc_par_pool_push(shared, chunk);
+                    _Py_atomic_store_int(&shared->error, 1);
+                    return false;
+                }
+                _Py_atomic_add_int(&shared->num_idle, -1);
+                memcpy(w->items, chunk->items, chunk->size * sizeof(PyObject *));
+                w->size = chunk->size;
+                PyMem_RawFree(chunk);
+                return true;
+            }
+        }
+        // An idle worker holds no work, so once all of the workers are idle
+        // and the pool is empty, marking is complete.
+        if (_Py_atomic_load_int(&shared->num_idle) ==
+                _Py_atomic_load_int(&shared->num_workers) &&
+            _Py_atomic_load_ssize(&shared->pool_size) == 0)
+        {
+            return false;
+        }
+        _Py_yield();
+    }
+}
+
+static void
+gc_par_mark_worker(void *arg)
+{
+    gc_par_worker_t *w = (gc_par_worker_t *)arg;
+    gc_par_shared_t *shared = w->shared;
+    do {
+        while (w->size > 0) {
+            PyObject *op = w->items[--w->size];
+            assert(gc_is_alive(op));
+            traverseproc traverse = Py_TYPE(op)->tp_traverse;
+            if (traverse(op, gc_par_mark_enqueue, w) < 0 ||
+                gc_par_maybe_donate(w) < 0)
+            {
+                _Py_atomic_store_int(&shared->error, 1);
+            }
+            if (_Py_atomic_load_int_relaxed(&shared->error)) {
+                w->size = 0;
+                _Py_atomic_add_int(&shared->num_idle, 1);
+                return;
+            }
+        }
+    } while (gc_par_steal(w));
+}
+
+static int
+gc_mark_alive_parallel(PyInterpreterState *interp, int num_threads)
+{
+    gc_par_shared_t shared = {0};
+    gc_par_worker_t *workers = PyMem_RawCalloc(num_threads,
+                                               sizeof(gc_par_worker_t));
+    if (workers == NULL) {
+        return -1;
+    }
+    for (int i = 0; i < num_threads; i++) {
+        workers[i].shared = &shared;
+    }
+    shared.num_workers = num_threads;
+
+    // The collecting thread is worker 0 and starts with all of the roots.
+    if (gc_visit_roots_mark_alive(interp, gc_par_mark_enqueue,
+                                  &workers[0]) < 0)
+    {
+        shared.error = 1;
+        num_threads = 1;
+    }
+
+    int started = 1;
+    for (; started < num_threads; started++) {
+        gc_par_worker_t *w = &workers[started];
+        if (PyThread_start_joinable_thread(gc_par_mark_worker, w,
+                                           &w->ident, &w->handle) != 0) {
+            break;
+        }
+    }
+    if (started < num_threads) {
+        // Continue with fewer helper threads.  The ones that failed to start
+        // never hold any work.
+        _Py_atomic_add_int(&shared.num_workers, started - num_threads);
+    }
+
+    gc_par_mark_worker(&workers[0]);
+
+    for (int i = 1; i < started; i++) {
+        PyThread_join_thread(workers[i].handle);
+    }
+    int err = shared.error ? -1 : 0;
+    while (shared.pool != NULL) {
+        gc_par_chunk_t *next = shared.pool->next;
+        PyMem_RawFree(shared.pool);
+        shared.pool = next;
+    }
+    for (int i = 0; i < num_threads; i++) {
+        PyMem_RawFree(workers[i].items);
+    }
+    PyMem_RawFree(workers);
+    return err;
+}
+
 // Using tp_traverse, mark everything reachable from known root objects
 // (which must be non-garbage) as alive (_PyGC_BITS_ALIVE is set).  In
 // most programs, this marks nearly all objects that are not actually
@@ -1405,6 +1731,18 @@ gc_mark_alive_from_roots(PyInterpreterState *interp,
     // Check that all objects don't have alive bit set
     gc_visit_heaps(interp, &validate_alive_bits, &state->base);
 #endif
+    int num_threads = _Py_atomic_load_int_relaxed(&interp->gc.mark_threads);
+    if (num_threads > 1 &&
+        interp->gc.long_lived_total >= GC_PAR_MIN_OBJECTS &&
+        state->reason != _Py_GC_REASON_SHUTDOWN)
+    {
+        if (gc_mark_alive_parallel(interp, num_threads) < 0) {
+            gc_visit_heaps(interp, &gc_clear_alive_bits, &state->base);
+            return -1;
+        }
+        return 0;
+    }
+
     gc_mark_args_t mark_args = { 0 };
 
     // Using prefetch instructions is only a win if the set of objects being
@@ -1415,34 +1753,12 @@ gc_mark_alive_from_roots(PyInterpreterState *interp,
     // would hold about 130k objects.
     mark_args.use_prefetch = interp->gc.long_lived_total > 200000;
 
-    #define MARK_ENQUEUE(op) \
-        if (op != NULL ) { \
-            if (gc_mark_enqueue(op, &mark_args) < 0) { \
-                gc_abort_mark_alive(interp, state, &mark_args); \
-                return -1; \
-            } \
-        }
-    MARK_ENQUEUE(interp->sysdict);
-#ifdef GC_MARK_ALIVE_EXTRA_ROOTS
-    MARK_ENQUEUE(interp->builtins);
-    MARK_ENQUEUE(interp->dict);
-    struct types_state *types = &interp->types;
-    for (int i = 0; i < _Py_MAX_MANAGED_STATIC_BUILTIN_TYPES; i++) {
-        MARK_ENQUEUE(types->builtins.initialized[i].tp_dict);
-        MARK_ENQUEUE(types->builtins.initialized[i].tp_subclasses);
-    }
-    for (int i = 0; i < _Py_MAX_MANAGED_STATIC_EXT_TYPES; i++) {
-        MARK_ENQUEUE(types->for_extensions.initialized[i].tp_dict);
-        MARK_ENQUEUE(types->for_extensions.initialized[i].tp_subclasses);
-    }
-#endif
-#ifdef GC_MARK_ALIVE_STACKS
-    if (gc_visit_thread_stacks_mark_alive(interp, &mark_args) < 0) {
+    if (gc_visit_roots_mark_alive(interp, gc_mark_enqueue_visitproc,
+                                  &mark_args) < 0)
+    {
         gc_abort_mark_alive(interp, state, &mark_args);
         return -1;
     }
-#endif
-    #undef MARK_ENQUEUE
 
     // Use tp_traverse to find everything reachable from roots.
     if (gc_propagate_alive(&mark_args) < 0) {
@@ -1690,6 +2006,7 @@ _PyGC_InitState(GCState *gcstate)
 {
     // TODO: move to pycore_runtime_init.h once the incremental GC lands.
     gcstate->young.threshold = 2000;
+    gcstate->mark_threads = 1;
 }
 
 
@@ -2477,6 +2794,7 @@ gc_collect_main(PyThreadState *tstate, int generation, _PyGC_Reason reason)
     stats->uncollectable += n;
     stats->duration += duration;
     stats->candidates += state.candidates;
+    _PyGC_UpdateSurvivalRate(stats, state.candidates, m);
 
     GC_STAT_ADD(generation, objects_collected, m);
 #ifdef Py_STATS
@@ -2892,12 +3210,143 @@ _PyObject_GC_Link(PyObject *op)
     record_allocation(_PyThreadState_GET());
 }
 
+// Background collections ///////////////////////////////////////////////
+
+// With gc.set_background(True), automatic collections are run by a
+// dedicated thread instead of the thread that happened to trigger them.
+// Only the reachability analysis stops the world; the application's
+// threads keep running while the background thread calls finalizers and
+// weakref callbacks, clears the garbage and deallocates it.
+//
+// The thread sleeps on gcstate->background_state using the parking lot.
+// It has a daemon thread state: if it tries to attach while the
+// interpreter is finalizing, it hangs like any other daemon thread.
+
+enum {
+    GC_BACKGROUND_IDLE = 0,
+    GC_BACKGROUND_REQUESTED = 1,
+    GC_BACKGROUND_STOP = 2,
+};
+
+static void
+gc_background_thread(void *arg)
+{
+    PyThreadState *tstate = (PyThreadState *)arg;
+    GCState *gcstate = &tstate->interp->gc;
+    _PyThreadState_Bind(tstate);
+    for (;;) {
+        int state = _Py_atomic_load_int(&gcstate->background_state);
+        if (state == GC_BACKGROUND_STOP) {
+            break;
+        }
+        if (state == GC_BACKGROUND_IDLE) {
+            _PyParkingLot_Park(&gcstate->background_state, &state,
+                               sizeof(state), -1, NULL, 0);
+            continue;
+        }
+        assert(state == GC_BACKGROUND_REQUESTED);
+        if (!_Py_atomic_compare_exchange_int(&gcstate->background_state,
+                                             &state, GC_BACKGROUND_IDLE)) {
+            continue;
+        }
+        PyEval_AcquireThread(tstate);
+        if (PyGC_IsEnabled()) {
+            gc_collect_main(tstate, 0, _Py_GC_REASON_HEAP);
+        }
+        PyEval_ReleaseThread(tstate);
+    }
+    PyEval_AcquireThread(tstate);
+    PyThreadState_Clear(tstate);
+    _PyThreadState_DeleteCurrent(tstate);
+}
+
+int
+_PyGC_SetBackground(PyThreadState *tstate, int enabled)
+{
+    PyInterpreterState *interp = tstate->interp;
+    GCState *gcstate = &interp->gc;
+    if (enabled == gcstate->background) {
+        return 0;
+    }
+    if (enabled) {
+        if (!_Py_IsMainInterpreter(interp)) {
+            _PyErr_SetString(tstate, PyExc_RuntimeError,
+                             "background collection is only supported "
+                             "in the main interpreter");
+            return -1;
+        }
+        PyThreadState *gc_tstate = _PyThreadState_New(
+            interp, _PyThreadState_WHENCE_THREADING_DAEMON);
+        if (gc_tstate == NULL) {
+            _PyErr_NoMemory(tstate);
+            return -1;
+        }
+        _Py_atomic_store_int(&gcstate->background_state, GC_BACKGROUND_IDLE);
+        PyThread_ident_t ident;
+        PyThread_handle_t handle;
+        if (PyThread_start_joinable_thread(gc_background_thread, gc_tstate,
+                                           &ident, &handle) != 0) {
+            PyThreadState_Clear(gc_tstate);
+            PyThreadState_Delete(gc_tstate);
+            _PyErr_SetString(tstate, PyExc_RuntimeError,
+                             "can't start background collection thread");
+            return -1;
+        }
+        gcstate->background_handle = handle;
+        _Py_atomic_store_int(&gcstate->background, 1);
+    }
+    else {
+        _Py_atomic_store_int(&gcstate->background, 0);
+        _Py_atomic_store_int(&gcstate->background_state, GC_BACKGROUND_STOP);
+        _PyParkingLot_UnparkAll(&gcstate->background_state);
+        // The thread may need to attach (and stop the world) before it
+        // notices the request.
+        Py_BEGIN_ALLOW_THREADS
+        PyThread_join_thread(gcstate->background_handle);
+        Py_END_ALLOW_THREADS
+        gcstate->background_handle = 0;
+        _Py_atomic_store_int(&gcstate->background_state, GC_BACKGROUND_IDLE);
+    }
+    return 0;
+}
+
+int
+_PyGC_GetBackground(PyInterpreterState *interp)
+{
+    return _Py_atomic_load_int(&interp->gc.background);
+}
+
+void
+_PyGC_AfterFork(PyInterpreterState *interp)
+{
+    // The background thread doesn't exist in the child process and its
+    // thread state has been deleted.  Go back to collecting in the thread
+    // that triggers a collection.
+    GCState *gcstate = &interp->gc;
+    if (gcstate->background) {
+        PyThread_detach_thread(gcstate->background_handle);
+        gcstate->background = 0;
+        gcstate->background_handle = 0;
+        gcstate->background_state = GC_BACKGROUND_IDLE;
+    }
+}
+
 void
 _Py_RunGC(PyThreadState *tstate)
 {
     if (!PyGC_IsEnabled()) {
         return;
     }
+    GCState *gcstate = &tstate->interp->gc;
+    if (_Py_atomic_load_int_relaxed(&gcstate->background)) {
+        int expected = GC_BACKGROUND_IDLE;
+        if (_Py_atomic_compare_exchange_int(&gcstate->background_state,
+                                            &expected,
+                                            GC_BACKGROUND_REQUESTED)) {
+            _PyParkingLot_UnparkAll(&gcstate->background_state);
+        }
+        return;
+    }
     gc_collect_main(tstate, 0, _Py_GC_REASON_HEAP);
 }
 
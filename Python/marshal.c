@@ -22,6 +22,11 @@
 #  include "TargetConditionals.h"
 #endif /* __APPLE__ */
 
+#if defined(HAVE_MMAP) && defined(HAVE_SYS_MMAN_H)
+#  include <sys/mman.h>              // mmap()
+#  define MARSHAL_USE_MMAP
+#endif
+
 
 /*[clinic input]
 module marshal
@@ -1783,9 +1788,43 @@ getfilesize(FILE *fp)
         return (off_t)st.st_size;
 }
 
-/* If we can get the size of the file up-front, and it's reasonably small,
- * read it in one gulp and delegate to ...FromString() instead.  Much quicker
- * than reading a byte at a time from file; speeds .pyc imports.
+#ifdef MARSHAL_USE_MMAP
+/* Map the whole file read-only and unmarshal the remainder of it (starting
+ * at the current stream position) straight out of the page cache.  This
+ * avoids copying the file into a private heap buffer first, and the mapping
+ * pages are shared between processes that load the same file.
+ * Return NULL without an exception set if the file cannot be mapped; the
+ * caller then falls back to reading it.
+ */
+static PyObject *
+read_last_object_from_mapping(FILE *fp, off_t filesize)
+{
+    if (filesize <= 0 || filesize >= PY_SSIZE_T_MAX) {
+        return NULL;
+    }
+    long pos = ftell(fp);
+    if (pos < 0 || (off_t)pos > filesize) {
+        return NULL;
+    }
+    void *map = mmap(NULL, (size_t)filesize, PROT_READ, MAP_PRIVATE,
+                     fileno(fp), 0);
+    if (map == MAP_FAILED) {
+        return NULL;
+    }
+#ifdef MADV_SEQUENTIAL
+    (void)madvise(map, (size_t)filesize, MADV_SEQUENTIAL);
+#endif
+    PyObject *v = PyMarshal_ReadObjectFromString((const char *)map + pos,
+                                                 (Py_ssize_t)(filesize - pos));
+    (void)munmap(map, (size_t)filesize);
+    return v;
+}
+#endif
+
+/* If we can get the size of the file up-front, map it (where mmap() is
+ * available) or, if it's reasonably small, read it in one gulp and delegate
+ * to ...FromString() instead.  Much quicker than reading a byte at a time
+ * from file; speeds .pyc imports.
  * CAUTION:  since this may read the entire remainder of the file, don't
  * call it unless you know you're done with the file.
  */
@@ -1796,6 +1835,12 @@ PyMarshal_ReadLastObjectFromFile(FILE *fp)
 #define REASONABLE_FILE_LIMIT (1L << 18)
     off_t filesize;
     filesize = getfilesize(fp);
+#ifdef MARSHAL_USE_MMAP
+    PyObject *v = read_last_object_from_mapping(fp, filesize);
+    if (v != NULL || PyErr_Occurred()) {
+        return v;
+    }
+#endif
     if (filesize > 0 && filesize <= REASONABLE_FILE_LIMIT) {
         char* pBuf = (char *)PyMem_Malloc(filesize);
         if (pBuf != NULL) {
@@ -22,6 +22,13 @@
 #include <stdint.h>
 #include <stddef.h>
 
+#ifdef HAVE_UNISTD_H
+#  include <unistd.h>             // getpid()
+#endif
+#ifdef MS_WINDOWS
+#  include <process.h>            // getpid()
+#endif
+
 #define NEED_OPCODE_METADATA
 #include "pycore_uop_metadata.h" // Uop tables
 #undef NEED_OPCODE_METADATA
@@ -114,6 +121,9 @@ insert_executor(PyCodeObject *code, _Py_CODEUNIT *instr, int index, _PyExecutorO
 static _PyExecutorObject *
 make_executor_from_uops(_PyThreadStateImpl *tstate, _PyUOpInstruction *buffer, int length, const _PyBloomFilter *dependencies);
 
+static void
+record_hot_loop(PyInterpreterState *interp, PyCodeObject *co, _Py_CODEUNIT *instr);
+
 static int
 uop_optimize(_PyInterpreterFrame *frame, PyThreadState *tstate,
              _PyExecutorObject **exec_ptr,
@@ -160,6 +170,7 @@ _PyOptimizer_Optimize(
         interp->compiling = false;
         return 0;
     }
+    _PyExitData *exit = _tstate->jit_tracer_state->initial_state.exit;
     _PyExecutorObject *executor;
     int err = uop_optimize(frame, tstate, &executor, progress_needed);
     if (err <= 0) {
@@ -181,10 +192,13 @@ _PyOptimizer_Optimize(
             return 0;
         }
         insert_executor(code, start, index, executor);
+        if (exit == NULL) {
+            record_hot_loop(interp, code,
+                            _tstate->jit_tracer_state->initial_state.jump_backward_instr);
+        }
     }
     executor->vm_data.chain_depth = chain_depth;
     assert(executor->vm_data.valid);
-    _PyExitData *exit = _tstate->jit_tracer_state->initial_state.exit;
     if (exit != NULL && !progress_needed) {
         exit->executor = executor;
     }
@@ -588,6 +602,34 @@ is_terminator(const _PyUOpInstruction *uop)
     );
 }
 
+/* A backward jump in a generator that the trace entered through
+ * FOR_ITER_GEN or SEND_GEN usually leads straight to the next yield, which
+ * returns to the loop being traced.  Trace through it, so that a pipeline of
+ * generators is stitched into a single executor instead of ending the trace
+ * at each stage.  Reaching the same jump a second time means the generator
+ * is looping without yielding, so it is treated like any other inner loop.
+ */
+static bool
+can_trace_through_generator_loop(_PyJitTracerState *tracer, _Py_CODEUNIT *jump_instr)
+{
+    _PyInterpreterFrame *frame = tracer->prev_state.instr_frame;
+    if (frame->owner != FRAME_OWNED_BY_GENERATOR ||
+        _PyFrame_GetCode(frame) == tracer->initial_state.code) {
+        return false;
+    }
+    _PyJitTracerTranslatorState *state = &tracer->translator_state;
+    for (int i = 0; i < state->generator_loops_len; i++) {
+        if (state->generator_loops[i] == jump_instr) {
+            return false;
+        }
+    }
+    if (state->generator_loops_len == MAX_GENERATOR_LOOPS_PER_TRACE) {
+        return false;
+    }
+    state->generator_loops[state->generator_loops_len++] = jump_instr;
+    return true;
+}
+
 /* Returns 1 on success (added to trace), 0 on trace end.
  */
 // gh-142543: inlining this function causes stack overflows
@@ -804,7 +846,8 @@ _PyJit_translate_single_bytecode_to_trace(
                 // For side exits, we don't want to terminate them early.
                 tracer->initial_state.exit == NULL &&
                 // These are coroutines, and we want to unroll those usually.
-                opcode != JUMP_BACKWARD_NO_INTERRUPT) {
+                opcode != JUMP_BACKWARD_NO_INTERRUPT &&
+                !can_trace_through_generator_loop(tracer, target_instr)) {
                 // We encountered a JUMP_BACKWARD but not to the top of our own loop.
                 // We don't want to continue tracing as we might get stuck in the
                 // inner loop. Instead, end the trace where the executor of the
@@ -910,10 +953,13 @@ _PyJit_translate_single_bytecode_to_trace(
                                 expansion->uops[i].offset);
                         Py_FatalError("garbled expansion");
                 }
-                if (uop == _BINARY_OP_INPLACE_ADD_UNICODE) {
+                if (uop == _BINARY_OP_INPLACE_ADD_UNICODE ||
+                    uop == _BINARY_OP_INPLACE_ADD_UNICODE_DEREF)
+                {
                     assert(i + 1 == nuops);
                     _Py_CODEUNIT *next = target_instr + 1 + _PyOpcode_Caches[_PyOpcode_Deopt[opcode]];
-                    assert(next->op.code == STORE_FAST);
+                    assert(next->op.code == (uop == _BINARY_OP_INPLACE_ADD_UNICODE
+                                             ? STORE_FAST : STORE_DEREF));
                     operand = next->op.arg;
                 }
                 else if (_PyUop_Flags[uop] & HAS_RECORDS_VALUE_FLAG) {
@@ -1031,6 +1077,7 @@ _PyJit_TryInitializeTracing(
     tracer->prev_state.instr_oparg = oparg;
     tracer->prev_state.instr_stacklevel = tracer->initial_state.stack_depth;
     tracer->prev_state.recorded_value = NULL;
+    tracer->translator_state.generator_loops_len = 0;
     uint8_t record_func_index = _PyOpcode_RecordFunctionIndices[curr_instr->op.code];
     if (record_func_index) {
         _Py_RecordFuncPtr record_func = _PyOpcode_RecordFunctions[record_func_index];
@@ -2120,6 +2167,238 @@ executor_to_gv(_PyExecutorObject *executor, FILE *out)
     }
 }
 
+/* Warm-start profile of hot loops.
+ *
+ * Executors cannot outlive the process: they embed the addresses of the
+ * objects they were specialized for.  What can be carried over is which loops
+ * were worth compiling.  If PYTHON_JIT_PROFILE names a file, the loops that
+ * get an executor are recorded and written to it at exit, and the loops listed
+ * in it start with a much lower JUMP_BACKWARD counter in the next run.  The
+ * trace is still recorded and optimized afresh, against the types and
+ * versions of that run.
+ *
+ * A loop is identified by a hash of its code object (file name, qualified
+ * name, first line and instructions) and the offset of its JUMP_BACKWARD, so
+ * entries for code that has changed are simply never matched.
+ */
+
+#define JIT_PROFILE_HEADER "# CPython JIT profile 1\n"
+#define JIT_PROFILE_MAX_ENTRIES 4096
+
+#define FNV_OFFSET_BASIS 0xcbf29ce484222325ULL
+#define FNV_PRIME 0x100000001b3ULL
+
+static uint64_t
+fnv1a(uint64_t hash, const void *data, size_t size)
+{
+    const unsigned char *p = (const unsigned char *)data;
+    for (size_t i = 0; i < size; i++) {
+        hash = (hash ^ p[i]) * FNV_PRIME;
+    }
+    return hash;
+}
+
+// Unlike PyObject_Hash(), the result doesn't depend on PYTHONHASHSEED.
+static uint64_t
+code_profile_hash(PyCodeObject *co)
+{
+    uint64_t hash = FNV_OFFSET_BASIS;
+    PyObject *names[2] = {co->co_filename, co->co_qualname};
+    for (int i = 0; i < 2; i++) {
+        PyObject *name = names[i];
+        hash = fnv1a(hash, PyUnicode_DATA(name),
+                     PyUnicode_GET_LENGTH(name) * PyUnicode_KIND(name));
+    }
+    hash = fnv1a(hash, &co->co_firstlineno, sizeof(co->co_firstlineno));
+    Py_ssize_t size = Py_SIZE(co);
+    for (Py_ssize_t i = 0; i < size; i++) {
+        _Py_CODEUNIT inst = _Py_GetBaseCodeUnit(co, (int)i);
+        uint8_t unit[2] = {inst.op.code, inst.op.arg};
+        hash = fnv1a(hash, unit, sizeof(unit));
+        // Caches hold counters that change as the code runs:
+        i += _PyOpcode_Caches[inst.op.code];
+    }
+    return hash;
+}
+
+static int
+compare_profile_entries(const void *a, const void *b)
+{
+    const struct _PyJitProfileEntry *x = a;
+    const struct _PyJitProfileEntry *y = b;
+    if (x->code_hash != y->code_hash) {
+        return x->code_hash < y->code_hash ? -1 : 1;
+    }
+    if (x->offset != y->offset) {
+        return x->offset < y->offset ? -1 : 1;
+    }
+    return 0;
+}
+
+// Return the index of the first entry that is not less than key.
+static Py_ssize_t
+profile_lower_bound(_PyJitProfile *profile, struct _PyJitProfileEntry *key)
+{
+    Py_ssize_t lo = 0, hi = profile->size;
+    while (lo < hi) {
+        Py_ssize_t mid = lo + (hi - lo) / 2;
+        if (compare_profile_entries(&profile->entries[mid], key) < 0) {
+            lo = mid + 1;
+        }
+        else {
+            hi = mid;
+        }
+    }
+    return lo;
+}
+
+static int
+profile_add(_PyJitProfile *profile, uint64_t code_hash, uint32_t offset)
+{
+    struct _PyJitProfileEntry key = {code_hash, offset};
+    Py_ssize_t index = profile_lower_bound(profile, &key);
+    if (index < profile->size &&
+        compare_profile_entries(&profile->entries[index], &key) == 0) {
+        return 0;
+    }
+    if (profile->size >= JIT_PROFILE_MAX_ENTRIES) {
+        return 0;
+    }
+    if (profile->size == profile->capacity) {
+        Py_ssize_t capacity = profile->capacity ? profile->capacity * 2 : 64;
+        struct _PyJitProfileEntry *entries = PyMem_RawRealloc(
+            profile->entries, capacity * sizeof(struct _PyJitProfileEntry));
+        if (entries == NULL) {
+            return -1;
+        }
+        profile->entries = entries;
+        profile->capacity = capacity;
+    }
+    memmove(&profile->entries[index + 1], &profile->entries[index],
+            (profile->size - index) * sizeof(struct _PyJitProfileEntry));
+    profile->entries[index] = key;
+    profile->size++;
+    return 1;
+}
+
+void
+_PyJit_LoadProfile(PyInterpreterState *interp, const char *path)
+{
+    _PyJitProfile *profile = &interp->jit_profile;
+    assert(profile->path == NULL);
+    profile->path = _PyMem_RawStrdup(path);
+    if (profile->path == NULL) {
+        return;
+    }
+    FILE *fp = fopen(path, "r");
+    if (fp == NULL) {
+        // Not written yet.
+        return;
+    }
+    char line[64];
+    if (fgets(line, sizeof(line), fp) == NULL ||
+        strcmp(line, JIT_PROFILE_HEADER) != 0)
+    {
+        // Unknown format: start over.
+        fclose(fp);
+        profile->modified = true;
+        return;
+    }
+    unsigned long long code_hash;
+    unsigned long offset;
+    while (fgets(line, sizeof(line), fp) != NULL) {
+        if (sscanf(line, "%llx %lu", &code_hash, &offset) != 2 ||
+            offset > UINT32_MAX) {
+            continue;
+        }
+        if (profile_add(profile, (uint64_t)code_hash, (uint32_t)offset) < 0) {
+            break;
+        }
+    }
+    fclose(fp);
+}
+
+void
+_PyJit_ApplyProfile(PyInterpreterState *interp, PyCodeObject *co)
+{
+    _PyJitProfile *profile = &interp->jit_profile;
+    if (profile->size == 0) {
+        return;
+    }
+    struct _PyJitProfileEntry key = {code_profile_hash(co), 0};
+    Py_ssize_t index = profile_lower_bound(profile, &key);
+    _Py_CODEUNIT *instructions = _PyCode_CODE(co);
+    for (; index < profile->size; index++) {
+        struct _PyJitProfileEntry *entry = &profile->entries[index];
+        if (entry->code_hash != key.code_hash) {
+            break;
+        }
+        if (entry->offset + 1 < (uint32_t)Py_SIZE(co) &&
+            _PyOpcode_Deopt[instructions[entry->offset].op.code] == JUMP_BACKWARD) {
+            instructions[entry->offset + 1].counter = make_backoff_counter(
+                JUMP_BACKWARD_PROFILED_VALUE, JUMP_BACKWARD_PROFILED_BACKOFF);
+        }
+    }
+}
+
+static void
+record_hot_loop(PyInterpreterState *interp, PyCodeObject *co, _Py_CODEUNIT *instr)
+{
+    _PyJitProfile *profile = &interp->jit_profile;
+    if (profile->path == NULL) {
+        return;
+    }
+    uint32_t offset = (uint32_t)(instr - _PyCode_CODE(co));
+    if (_Py_GetBaseCodeUnit(co, (int)offset).op.code != JUMP_BACKWARD) {
+        return;
+    }
+    if (profile_add(profile, code_profile_hash(co), offset) > 0) {
+        profile->modified = true;
+    }
+}
+
+void
+_PyJit_SaveProfile(PyInterpreterState *interp)
+{
+    _PyJitProfile *profile = &interp->jit_profile;
+    if (profile->path == NULL) {
+        return;
+    }
+    if (profile->modified) {
+        // Write to a temporary file and rename it, so that concurrent
+        // processes sharing the profile never see a partial file.
+        size_t size = strlen(profile->path) + 32;
+        char *tmp_path = PyMem_RawMalloc(size);
+        if (tmp_path != NULL) {
+            PyOS_snprintf(tmp_path, size, "%s.%ld.tmp",
+                          profile->path, (long)getpid());
+            FILE *fp = fopen(tmp_path, "w");
+            if (fp != NULL) {
+                int ok = fputs(JIT_PROFILE_HEADER, fp) >= 0;
+                for (Py_ssize_t i = 0; ok && i < profile->size; i++) {
+                    struct _PyJitProfileEntry *entry = &profile->entries[i];
+                    ok = fprintf(fp, "%016llx %lu\n",
+                                 (unsigned long long)entry->code_hash,
+                                 (unsigned long)entry->offset) > 0;
+                }
+                ok = (fclose(fp) == 0) && ok;
+#ifdef MS_WINDOWS
+                if (ok) {
+                    (void)remove(profile->path);
+                }
+#endif
+                if (!ok || rename(tmp_path, profile->path) != 0) {
+                    (void)remove(tmp_path);
+                }
+            }
+            PyMem_RawFree(tmp_path);
+        }
+    }
+    PyMem_RawFree(profile->path);
+    PyMem_RawFree(profile->entries);
+    memset(profile, 0, sizeof(*profile));
+}
+
 /* Write the graph of all the live tracelets in graphviz format. */
 int
 _PyDumpExecutors(FILE *out)
@@ -300,18 +300,45 @@ dummy_func(void) {
     }
 
     op(_BINARY_OP_ADD_FLOAT, (left, right -- res, l, r)) {
+        if (!PyJitRef_IsBorrowed(left) || !PyJitRef_IsBorrowed(right)) {
+            ADD_OP(_BINARY_OP_ADD_FLOAT_INPLACE, 0, 0);
+        }
+        res = sym_new_type(ctx, &PyFloat_Type);
+        l = left;
+        r = right;
+    }
+
+    op(_BINARY_OP_ADD_FLOAT_INPLACE, (left, right -- res, l, r)) {
         res = sym_new_type(ctx, &PyFloat_Type);
         l = left;
         r = right;
     }
 
     op(_BINARY_OP_SUBTRACT_FLOAT, (left, right -- res, l, r)) {
+        if (!PyJitRef_IsBorrowed(left) || !PyJitRef_IsBorrowed(right)) {
+            ADD_OP(_BINARY_OP_SUBTRACT_FLOAT_INPLACE, 0, 0);
+        }
+        res = sym_new_type(ctx, &PyFloat_Type);
+        l = left;
+        r = right;
+    }
+
+    op(_BINARY_OP_SUBTRACT_FLOAT_INPLACE, (left, right -- res, l, r)) {
         res = sym_new_type(ctx, &PyFloat_Type);
         l = left;
         r = right;
     }
 
     op(_BINARY_OP_MULTIPLY_FLOAT, (left, right -- res, l, r)) {
+        if (!PyJitRef_IsBorrowed(left) || !PyJitRef_IsBorrowed(right)) {
+            ADD_OP(_BINARY_OP_MULTIPLY_FLOAT_INPLACE, 0, 0);
+        }
+        res = sym_new_type(ctx, &PyFloat_Type);
+        l = left;
+        r = right;
+    }
+
+    op(_BINARY_OP_MULTIPLY_FLOAT_INPLACE, (left, right -- res, l, r)) {
         res = sym_new_type(ctx, &PyFloat_Type);
         l = left;
         r = right;
@@ -347,6 +374,10 @@ dummy_func(void) {
         GETLOCAL(this_instr->operand0) = sym_new_null(ctx);
     }
 
+    op(_BINARY_OP_INPLACE_ADD_UNICODE_DEREF, (left, right -- res)) {
+        res = sym_new_type(ctx, &PyUnicode_Type);
+    }
+
     op(_BINARY_OP_SUBSCR_CHECK_FUNC, (container, unused -- container, unused, getitem)) {
         getitem = sym_new_not_null(ctx);
         PyTypeObject *tp = sym_get_type(container);
@@ -782,6 +782,9 @@
             JitOptRef r;
             right = stack_pointer[-1];
             left = stack_pointer[-2];
+            if (!PyJitRef_IsBorrowed(left) || !PyJitRef_IsBorrowed(right)) {
+                ADD_OP(_BINARY_OP_MULTIPLY_FLOAT_INPLACE, 0, 0);
+            }
             res = sym_new_type(ctx, &PyFloat_Type);
             l = left;
             r = right;
@@ -802,6 +805,9 @@
             JitOptRef r;
             right = stack_pointer[-1];
             left = stack_pointer[-2];
+            if (!PyJitRef_IsBorrowed(left) || !PyJitRef_IsBorrowed(right)) {
+                ADD_OP(_BINARY_OP_ADD_FLOAT_INPLACE, 0, 0);
+            }
             res = sym_new_type(ctx, &PyFloat_Type);
             l = left;
             r = right;
@@ -815,6 +821,69 @@
         }
 
         case _BINARY_OP_SUBTRACT_FLOAT: {
+            JitOptRef right;
+            JitOptRef left;
+            JitOptRef res;
+            JitOptRef l;
+            JitOptRef r;
+            right = stack_pointer[-1];
+            left = stack_pointer[-2];
+            if (!PyJitRef_IsBorrowed(left) || !PyJitRef_IsBorrowed(right)) {
+                ADD_OP(_BINARY_OP_SUBTRACT_FLOAT_INPLACE, 0, 0);
+            }
+            res = sym_new_type(ctx, &PyFloat_Type);
+            l = left;
+            r = right;
+            CHECK_STACK_BOUNDS(1);
+            stack_pointer[-2] = res;
+            stack_pointer[-1] = l;
+            stack_pointer[0] = r;
+            stack_pointer += 1;
+            ASSERT_WITHIN_STACK_BOUNDS(__FILE__, __LINE__);
+            break;
+        }
+
+        case _BINARY_OP_ADD_FLOAT_INPLACE: {
+            JitOptRef right;
+            JitOptRef left;
+            JitOptRef res;
+            JitOptRef l;
+            JitOptRef r;
+            right = stack_pointer[-1];
+            left = stack_pointer[-2];
+            res = sym_new_type(ctx, &PyFloat_Type);
+            l = left;
+            r = right;
+            CHECK_STACK_BOUNDS(1);
+            stack_pointer[-2] = res;
+            stack_pointer[-1] = l;
+            stack_pointer[0] = r;
+            stack_pointer += 1;
+            ASSERT_WITHIN_STACK_BOUNDS(__FILE__, __LINE__);
+            break;
+        }
+
+        case _BINARY_OP_SUBTRACT_FLOAT_INPLACE: {
+            JitOptRef right;
+            JitOptRef left;
+            JitOptRef res;
+            JitOptRef l;
+            JitOptRef r;
+            right = stack_pointer[-1];
+            left = stack_pointer[-2];
+            res = sym_new_type(ctx, &PyFloat_Type);
+            l = left;
+            r = right;
+            CHECK_STACK_BOUNDS(1);
+            stack_pointer[-2] = res;
+            stack_pointer[-1] = l;
+            stack_pointer[0] = r;
+            stack_pointer += 1;
+            ASSERT_WITHIN_STACK_BOUNDS(__FILE__, __LINE__);
+            break;
+        }
+
+        case _BINARY_OP_MULTIPLY_FLOAT_INPLACE: {
             JitOptRef right;
             JitOptRef left;
             JitOptRef res;
@@ -883,6 +952,16 @@
             break;
         }
 
+        case _BINARY_OP_INPLACE_ADD_UNICODE_DEREF: {
+            JitOptRef res;
+            res = sym_new_type(ctx, &PyUnicode_Type);
+            CHECK_STACK_BOUNDS(-1);
+            stack_pointer[-2] = res;
+            stack_pointer += -1;
+            ASSERT_WITHIN_STACK_BOUNDS(__FILE__, __LINE__);
+            break;
+        }
+
         case _GUARD_BINARY_OP_EXTEND: {
             break;
         }
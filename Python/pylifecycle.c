@@ -1389,6 +1389,10 @@ init_interp_main(PyThreadState *tstate)
 #endif
             {
                 interp->jit = true;
+                char *profile = Py_GETENV("PYTHON_JIT_PROFILE");
+                if (profile && *profile != '\0') {
+                    _PyJit_LoadProfile(interp, profile);
+                }
             }
         }
     }
@@ -1749,6 +1753,7 @@ finalize_modules(PyThreadState *tstate)
     interp->jit = false;
     interp->compiling = false;
 #ifdef _Py_TIER2
+    _PyJit_SaveProfile(interp);
     _Py_Executors_InvalidateAll(interp, 0);
 #endif
 
@@ -2325,6 +2330,7 @@ _Py_Finalize(_PyRuntimeState *runtime)
     /* Disable tracemalloc after all Python objects have been destroyed,
        so it is possible to use tracemalloc in objects destructor. */
     _PyTraceMalloc_Fini();
+    _PyAllocSampling_Fini();
 
     /* Finalize any remaining import state */
     // XXX Move these up to where finalize_modules() is currently.
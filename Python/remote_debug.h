@@ -1163,6 +1163,135 @@ _Py_RemoteDebug_ReadRemoteMemory(proc_handle_t *handle, uintptr_t remote_address
 #endif
 }
 
+// One range of a batched read: len bytes at remote_address are copied to dst.
+// ok is set by _Py_RemoteDebug_ReadRemoteMemoryBatch().
+typedef struct {
+    uintptr_t remote_address;
+    size_t len;
+    void *dst;
+    int ok;
+} _Py_RemoteDebug_ReadRequest;
+
+// Maximum number of ranges passed to a single process_vm_readv() call
+// (UIO_MAXIOV on Linux).
+#define _Py_REMOTE_DEBUG_MAX_IOV 1024
+
+// Read a single range without touching the Python C API.
+// Returns 0 on success and -1 on failure, without setting an exception.
+static int
+read_remote_memory_raw(proc_handle_t *handle, uintptr_t remote_address, size_t len, void *dst)
+{
+#ifdef MS_WINDOWS
+    SIZE_T read_bytes = 0;
+    SIZE_T result = 0;
+    do {
+        if (!ReadProcessMemory(handle->hProcess, (LPCVOID)(remote_address + result),
+                               (char*)dst + result, len - result, &read_bytes)
+            || read_bytes == 0)
+        {
+            return -1;
+        }
+        result += read_bytes;
+    } while (result < len);
+    return 0;
+#elif defined(__linux__) && HAVE_PROCESS_VM_READV
+    size_t result = 0;
+    while (result < len) {
+        Py_ssize_t read_bytes;
+        if (handle->memfd != -1) {
+            read_bytes = pread(handle->memfd, (char*)dst + result, len - result,
+                               (off_t)(remote_address + result));
+        }
+        else {
+            struct iovec local = {(char*)dst + result, len - result};
+            struct iovec remote = {(void*)(remote_address + result), len - result};
+            read_bytes = process_vm_readv(handle->pid, &local, 1, &remote, 1, 0);
+        }
+        if (read_bytes <= 0) {
+            return -1;
+        }
+        result += (size_t)read_bytes;
+    }
+    return 0;
+#elif defined(__APPLE__) && defined(TARGET_OS_OSX) && TARGET_OS_OSX
+    mach_vm_size_t result = 0;
+    kern_return_t kr = mach_vm_read_overwrite(
+        handle->task,
+        (mach_vm_address_t)remote_address,
+        len,
+        (mach_vm_address_t)dst,
+        &result);
+    return (kr == KERN_SUCCESS && result == len) ? 0 : -1;
+#else
+    return -1;
+#endif
+}
+
+// Read many independent ranges with as few system calls as possible: on
+// Linux a single process_vm_readv() call covers up to
+// _Py_REMOTE_DEBUG_MAX_IOV ranges.  This does not use the Python C API, so
+// it may run on threads without an attached thread state.
+//
+// Each request's ok field reports whether the range was read completely.
+// Failed requests should be retried with _Py_RemoteDebug_ReadRemoteMemory(),
+// which reports the error.  Returns the number of failed requests.
+UNUSED static size_t
+_Py_RemoteDebug_ReadRemoteMemoryBatch(proc_handle_t *handle,
+                                      _Py_RemoteDebug_ReadRequest *reqs,
+                                      size_t count)
+{
+    size_t failed = 0;
+#if defined(__linux__) && HAVE_PROCESS_VM_READV
+    if (handle->memfd == -1) {
+        struct iovec local[_Py_REMOTE_DEBUG_MAX_IOV];
+        struct iovec remote[_Py_REMOTE_DEBUG_MAX_IOV];
+        size_t i = 0;
+        while (i < count) {
+            size_t n = 0;
+            for (; n < _Py_REMOTE_DEBUG_MAX_IOV && i + n < count; n++) {
+                _Py_RemoteDebug_ReadRequest *req = &reqs[i + n];
+                local[n].iov_base = req->dst;
+                local[n].iov_len = req->len;
+                remote[n].iov_base = (void*)req->remote_address;
+                remote[n].iov_len = req->len;
+            }
+            Py_ssize_t read_bytes = process_vm_readv(handle->pid, local, n,
+                                                     remote, n, 0);
+            if (read_bytes < 0 && errno != EFAULT) {
+                // The process is gone or the call is unsupported: let the
+                // caller's single reads report the error.
+                for (; i < count; i++) {
+                    reqs[i].ok = 0;
+                    failed++;
+                }
+                break;
+            }
+            // The kernel stops at the first range it cannot read; mark the
+            // ranges before it and resume right after it.
+            size_t done = 0;
+            size_t remaining = read_bytes < 0 ? 0 : (size_t)read_bytes;
+            for (; done < n && reqs[i + done].len <= remaining; done++) {
+                remaining -= reqs[i + done].len;
+                reqs[i + done].ok = 1;
+            }
+            if (done < n) {
+                reqs[i + done].ok = 0;
+                failed++;
+                done++;
+            }
+            i += done;
+        }
+        return failed;
+    }
+#endif
+    for (size_t i = 0; i < count; i++) {
+        reqs[i].ok = read_remote_memory_raw(handle, reqs[i].remote_address,
+                                            reqs[i].len, reqs[i].dst) == 0;
+        failed += !reqs[i].ok;
+    }
+    return failed;
+}
+
 #if defined(__linux__) && HAVE_PROCESS_VM_READV
 // Fallback write using /proc/pid/mem
 static int
@@ -1286,10 +1415,15 @@ _Py_RemoteDebug_PagedReadRemoteMemory(proc_handle_t *handle,
         return _Py_RemoteDebug_ReadRemoteMemory(handle, addr, size, out);
     }
 
-    // Search for valid cached page
+    // Search for valid cached page.  Slots are filled in order and only
+    // ever invalidated all at once, so the valid entries form a prefix and
+    // the first invalid one ends the search.
     for (int i = 0; i < MAX_PAGES; i++) {
         page_cache_entry_t *entry = &handle->pages[i];
-        if (entry->valid && entry->page_addr == page_base) {
+        if (!entry->valid) {
+            break;
+        }
+        if (entry->page_addr == page_base) {
             memcpy(out, entry->data + offset_in_page, size);
             return 0;
         }
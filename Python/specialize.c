@@ -2227,6 +2227,15 @@ _Py_Specialize_BinaryOp(_PyStackRef lhs_st, _PyStackRef rhs_st, _Py_CODEUNIT *in
                     specialize(instr, BINARY_OP_INPLACE_ADD_UNICODE);
                     return;
                 }
+#ifndef Py_GIL_DISABLED
+                if (next.op.code == STORE_DEREF) {
+                    PyObject *cell = PyStackRef_AsPyObjectBorrow(locals[next.op.arg]);
+                    if (PyCell_GET(cell) == lhs) {
+                        specialize(instr, BINARY_OP_INPLACE_ADD_UNICODE_DEREF);
+                        return;
+                    }
+                }
+#endif
                 specialize(instr, BINARY_OP_ADD_UNICODE);
                 return;
             }
@@ -15,6 +15,7 @@ Data members:
 */
 
 #include "Python.h"
+#include "pycore_alloc_sampling.h" // _PyAllocSampling_SetInterval()
 #include "pycore_audit.h"         // _Py_AuditHookEntry
 #include "pycore_call.h"          // _PyObject_CallNoArgs()
 #include "pycore_ceval.h"         // _PyEval_SetAsyncGenFinalizer()
@@ -2669,6 +2670,48 @@ sys__is_gil_enabled_impl(PyObject *module)
 }
 
 
+/*[clinic input]
+sys._set_allocation_sampling
+
+    interval: Py_ssize_t
+    /
+
+Sample one memory allocation every *interval* bytes on average.
+
+The samples and the Python stack that made them are recorded for
+out-of-process profilers such as profiling.sampling.  Pass 0 to stop
+sampling.
+[clinic start generated code]*/
+
+static PyObject *
+sys__set_allocation_sampling_impl(PyObject *module, Py_ssize_t interval)
+/*[clinic end generated code: output=7ea56c64be0bed61 input=e9446054c5222e1a]*/
+{
+    if (interval < 0) {
+        PyErr_SetString(PyExc_ValueError, "interval must be >= 0");
+        return NULL;
+    }
+    if (_PyAllocSampling_SetInterval((uint64_t)interval) < 0) {
+        return NULL;
+    }
+    Py_RETURN_NONE;
+}
+
+
+/*[clinic input]
+sys._get_allocation_sampling -> Py_ssize_t
+
+Return the allocation sampling interval in bytes, or 0 if it is off.
+[clinic start generated code]*/
+
+static Py_ssize_t
+sys__get_allocation_sampling_impl(PyObject *module)
+/*[clinic end generated code: output=ec1feb788ed0e36b input=21f70826e625fa3e]*/
+{
+    return (Py_ssize_t)_PyAllocSampling_GetInterval();
+}
+
+
 #ifndef MS_WINDOWS
 static PerfMapState perf_map_state;
 #endif
@@ -2985,6 +3028,8 @@ static PyMethodDef sys_methods[] = {
 #endif
     SYS__GET_CPU_COUNT_CONFIG_METHODDEF
     SYS__IS_GIL_ENABLED_METHODDEF
+    SYS__SET_ALLOCATION_SAMPLING_METHODDEF
+    SYS__GET_ALLOCATION_SAMPLING_METHODDEF
     SYS__DUMP_TRACELETS_METHODDEF
     {NULL, NULL}  // sentinel
 };
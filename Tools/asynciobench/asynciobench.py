@@ -0,0 +1,128 @@
+# Micro-benchmarks for the asyncio event loop's callback scheduling.
+#
+# Usage: python Tools/asynciobench/asynciobench.py [-n NUMBER] [BENCHMARK ...]
+#
+# Each benchmark runs a fixed number of operations on a fresh event loop and
+# reports the best of several runs in thousands of operations per second.
+# The benchmarks stress the paths where Tasks and Futures hand callbacks to
+# the loop (task wakeups, done callbacks) rather than I/O.
+
+import argparse
+import asyncio
+import time
+
+
+async def sleep0(n):
+    # One task step scheduled through the ready queue per iteration.
+    for _ in range(n):
+        await asyncio.sleep(0)
+
+
+async def future_roundtrip(n):
+    # A task waits on a future that another callback completes: one done
+    # callback (the task wakeup) per iteration.
+    loop = asyncio.get_running_loop()
+    for _ in range(n):
+        fut = loop.create_future()
+        loop.call_soon(fut.set_result, None)
+        await fut
+
+
+async def done_callbacks(n):
+    # Futures with several done callbacks, as used by gather() and wait().
+    loop = asyncio.get_running_loop()
+    callback = lambda fut: None
+    for _ in range(n // 4):
+        fut = loop.create_future()
+        for _ in range(4):
+            fut.add_done_callback(callback)
+        fut.set_result(None)
+        await asyncio.sleep(0)
+
+
+async def gather_tasks(n):
+    # Many short tasks created and gathered in batches of 100.
+    async def noop():
+        pass
+    for _ in range(n // 100):
+        await asyncio.gather(*[noop() for _ in range(100)])
+
+
+async def queue_pingpong(n):
+    # Two tasks exchanging messages through a pair of queues.
+    ping = asyncio.Queue()
+    pong = asyncio.Queue()
+
+    async def echo():
+        for _ in range(n):
+            pong.put_nowait(await ping.get())
+
+    task = asyncio.create_task(echo())
+    for i in range(n):
+        ping.put_nowait(i)
+        await pong.get()
+    await task
+
+
+async def call_soon_python(n):
+    # Plain call_soon() from Python code; not affected by the C fast path
+    # but shows the cost of the ready queue itself.
+    loop = asyncio.get_running_loop()
+    done = loop.create_future()
+    remaining = n
+
+    def callback():
+        nonlocal remaining
+        remaining -= 1
+        if remaining == 0:
+            done.set_result(None)
+
+    for _ in range(n):
+        loop.call_soon(callback)
+    await done
+
+
+BENCHMARKS = {
+    "sleep0": sleep0,
+    "future_roundtrip": future_roundtrip,
+    "done_callbacks": done_callbacks,
+    "gather_tasks": gather_tasks,
+    "queue_pingpong": queue_pingpong,
+    "call_soon_python": call_soon_python,
+}
+
+
+def run(func, number, repeat):
+    best = None
+    for _ in range(repeat):
+        start = time.perf_counter()
+        asyncio.run(func(number))
+        elapsed = time.perf_counter() - start
+        if best is None or elapsed < best:
+            best = elapsed
+    return best
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description="Benchmark asyncio callback scheduling")
+    parser.add_argument("-n", "--number", type=int, default=100_000,
+                        help="operations per run (default: 100000)")
+    parser.add_argument("-r", "--repeat", type=int, default=5,
+                        help="runs per benchmark, best is reported "
+                             "(default: 5)")
+    parser.add_argument("benchmarks", nargs="*", choices=list(BENCHMARKS),
+                        metavar="BENCHMARK",
+                        help=f"benchmarks to run (default: all of "
+                             f"{', '.join(BENCHMARKS)})")
+    args = parser.parse_args()
+
+    print(f"{'Benchmark':<20}{'Time (ms)':>12}{'Ops (kHz)':>12}")
+    for name in args.benchmarks or BENCHMARKS:
+        elapsed = run(BENCHMARKS[name], args.number, args.repeat)
+        print(f"{name:<20}{elapsed * 1e3:>12.1f}"
+              f"{args.number / elapsed / 1e3:>12.1f}")
+
+
+if __name__ == "__main__":
+    main()
@@ -1403,9 +1403,16 @@ def get_uop_cache_depths(uop: Uop) -> Iterator[tuple[int, int, int]]:
         ideal_outputs = MAX_CACHED_REGISTER
     at_end = uop.properties.sync_sp or uop.properties.side_exit_at_end
     exit_depth = ideal_outputs if at_end else ideal_inputs
-    if uop.properties.escapes or uop.properties.sync_sp or has_array or is_large(uop):
+    if uop.properties.sync_sp or has_array or is_large(uop):
         yield ideal_inputs, ideal_outputs, exit_depth
         return
+    if uop.properties.escapes:
+        # Escaping uops must have everything below their inputs in memory.
+        # Rather than needing a separate _SPILL_OR_RELOAD uop in front of
+        # them, accept extra cached items and spill them as part of the uop.
+        for inputs in range(ideal_inputs, MAX_CACHED_REGISTER + 1):
+            yield inputs, ideal_outputs, exit_depth
+        return
     for inputs in range(MAX_CACHED_REGISTER + 1):
         outputs = ideal_outputs - ideal_inputs + inputs
         if outputs < ideal_outputs:
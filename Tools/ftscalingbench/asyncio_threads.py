@@ -0,0 +1,75 @@
+# This script measures how CPU-bound asyncio code scales with the number of
+# threads of asyncio.MultiThreadedEventLoop.
+#
+# It runs many tasks doing pure Python work, each yielding to the loop
+# regularly with "await asyncio.sleep(0)", and reports the best time of
+# several runs for each thread count.  The default event loop is measured
+# first as the baseline.  On the default build, the GIL keeps the tasks from
+# running in parallel and no speedup is expected.
+
+import asyncio
+import os
+import sys
+import time
+
+
+def work(n):
+    total = 0
+    for i in range(n):
+        total += i * i % 7
+    return total
+
+
+async def worker(steps, step_size):
+    for _ in range(steps):
+        work(step_size)
+        await asyncio.sleep(0)
+
+
+async def run_tasks(tasks, steps, step_size):
+    async with asyncio.TaskGroup() as tg:
+        for _ in range(tasks):
+            tg.create_task(worker(steps, step_size))
+
+
+def time_run(loop_factory, opts):
+    best = float('inf')
+    for _ in range(opts.repeat):
+        t0 = time.perf_counter()
+        asyncio.run(run_tasks(opts.tasks, opts.steps, opts.step_size),
+                    loop_factory=loop_factory)
+        best = min(best, time.perf_counter() - t0)
+    return best
+
+
+def main(opts):
+    if sys._is_gil_enabled():
+        print("warning: this is not a free-threaded build; "
+              "tasks will not run in parallel", file=sys.stderr)
+
+    thread_counts = opts.threads or sorted({1, 2, 4, 8, os.cpu_count() or 1})
+    baseline = time_run(None, opts)
+    print(f"{'threads':>8} {'time (ms)':>10} {'speedup':>8}")
+    print(f"{'default':>8} {baseline * 1e3:>10.1f} {1:>7.2f}x")
+    for n in thread_counts:
+        t = time_run(lambda: asyncio.MultiThreadedEventLoop(threads=n), opts)
+        print(f"{n:>8} {t * 1e3:>10.1f} {baseline / t:>7.2f}x")
+
+
+if __name__ == "__main__":
+    import argparse
+
+    parser = argparse.ArgumentParser()
+    parser.add_argument("-t", "--tasks", type=int, default=64,
+                        help="number of tasks")
+    parser.add_argument("-s", "--steps", type=int, default=100,
+                        help="number of steps run by each task")
+    parser.add_argument("--step-size", type=int, default=2000,
+                        help="loop iterations of CPU work per step")
+    parser.add_argument("-r", "--repeat", type=int, default=3,
+                        help="number of runs timed per thread count")
+    parser.add_argument("threads", type=int, nargs="*",
+                        help="thread counts to measure (default: 1, 2, 4, "
+                             "8 and the number of CPUs)")
+    options = parser.parse_args()
+    main(options)
@@ -28,8 +28,9 @@
 import sys
 import threading
 import time
-from collections import namedtuple
+from collections import ConcurrentDict, namedtuple
 from dataclasses import dataclass
+from functools import lru_cache
 from operator import methodcaller
 from typing import NamedTuple
 
@@ -248,6 +249,41 @@ def deepcopy():
     for i in range(40 * WORK_SCALE):
         copy.deepcopy(x)
 
+@lru_cache(maxsize=256)
+def lru_cached_square(x):
+    return x * x
+
+@lru_cache(maxsize=256, shards=16)
+def lru_sharded_square(x):
+    return x * x
+
+@register_benchmark
+def lru_cache_hits():
+    for i in range(1000 * WORK_SCALE):
+        lru_cached_square(i & 127)
+
+@register_benchmark
+def lru_cache_sharded_hits():
+    for i in range(1000 * WORK_SCALE):
+        lru_sharded_square(i & 127)
+
+shared_dict = {}
+shared_concurrent_dict = ConcurrentDict()
+
+def _write_shared(mapping):
+    # Each thread writes its own keys, so only the locks are shared.
+    base = threading.get_ident() * 64
+    for i in range(1000 * WORK_SCALE):
+        mapping[base + (i & 63)] = i
+
+@register_benchmark
+def shared_dict_writes():
+    _write_shared(shared_dict)
+
+@register_benchmark
+def shared_concurrent_dict_writes():
+    _write_shared(shared_concurrent_dict)
+
 
 def bench_one_thread(func):
     t0 = time.perf_counter_ns()
@@ -0,0 +1,79 @@
+# This script measures how the duration of a full garbage collection
+# scales with the number of threads used for the "mark alive" pass of the
+# free-threaded collector (see gc.set_mark_threads()).
+#
+# It builds a large heap of live container objects plus some cyclic garbage
+# and reports the best time of several gc.collect() calls for each thread
+# count.  On the default build, marking always uses a single thread.
+
+import gc
+import os
+import sys
+import time
+
+
+class Node:
+    def __init__(self, children):
+        self.children = children
+
+
+def build_heap(size):
+    # A wide tree of lists, dicts and instances with a high fan-out, which is
+    # what a typical application heap looks like to the collector.
+    leaves = [Node([i, str(i)]) for i in range(size)]
+    branches = [{'items': leaves[i:i+64]} for i in range(0, size, 64)]
+    return [branches[i:i+64] for i in range(0, len(branches), 64)]
+
+
+def make_garbage(count):
+    for _ in range(count):
+        a = Node(None)
+        b = Node([a])
+        a.children = [b]
+
+
+def time_collect(repeat):
+    best = float('inf')
+    for _ in range(repeat):
+        make_garbage(1000)
+        t0 = time.perf_counter()
+        gc.collect()
+        best = min(best, time.perf_counter() - t0)
+    return best
+
+
+def main(opts):
+    if sys._is_gil_enabled():
+        print("warning: this is not a free-threaded build; "
+              "marking will use a single thread", file=sys.stderr)
+
+    gc.disable()
+    heap = build_heap(opts.objects)
+    gc.collect()
+
+    thread_counts = opts.threads or sorted({1, 2, 4, 8, os.cpu_count() or 1})
+    baseline = None
+    print(f"{'threads':>8} {'time (ms)':>10} {'speedup':>8}")
+    for n in thread_counts:
+        gc.set_mark_threads(n)
+        t = time_collect(opts.repeat)
+        if baseline is None:
+            baseline = t
+        print(f"{n:>8} {t * 1e3:>10.1f} {baseline / t:>7.2f}x")
+    gc.set_mark_threads(1)
+    del heap
+
+
+if __name__ == "__main__":
+    import argparse
+
+    parser = argparse.ArgumentParser()
+    parser.add_argument("-n", "--objects", type=int, default=2_000_000,
+                        help="number of leaf objects in the live heap")
+    parser.add_argument("-r", "--repeat", type=int, default=5,
+                        help="number of collections timed per thread count")
+    parser.add_argument("threads", type=int, nargs="*",
+                        help="thread counts to measure (default: 1, 2, 4, "
+                             "8 and the number of CPUs)")
+    options = parser.parse_args()
+    main(options)
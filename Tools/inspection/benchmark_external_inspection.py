@@ -151,6 +151,23 @@ def create_threads(n):
     time.sleep(0.05)
 '''
 
+# Template for --thread-counts: {num_threads} threads parked {depth} frames deep
+SCALING_CODE_TEMPLATE = """\
+import threading
+import time
+
+def park(depth):
+    if depth > 0:
+        return park(depth - 1)
+    while True:
+        time.sleep(1000)
+
+for _ in range({num_threads}):
+    threading.Thread(target=park, args=({depth},), daemon=True).start()
+while True:
+    time.sleep(1000)
+"""
+
 CODE_EXAMPLES = {
     "basic": {
         "code": CODE,
@@ -312,6 +329,27 @@ def print_benchmark_results(results):
     )
 
 
+def print_scaling_results(rows):
+    """Print samples/sec and per-thread cost for each thread count"""
+    colors = get_colors(can_colorize())
+
+    print(f"\n{colors.BOLD_GREEN}{'='*60}{colors.RESET}")
+    print(f"{colors.BOLD_GREEN}get_stack_trace() Thread Scaling Results{colors.RESET}")
+    print(f"{colors.BOLD_GREEN}{'='*60}{colors.RESET}")
+    print(
+        f"{colors.BOLD_CYAN}{'threads':>10} {'samples/sec':>14} "
+        f"{'µs/sample':>12} {'µs/thread':>12}{colors.RESET}"
+    )
+    for num_threads, results in rows:
+        avg_us = results["avg_work_time_us"]
+        print(
+            f"{colors.YELLOW}{num_threads:>10}{colors.RESET} "
+            f"{colors.MAGENTA}{results['samples_per_sec']:>14.1f}{colors.RESET} "
+            f"{avg_us:>12.1f} "
+            f"{avg_us / (num_threads + 1):>12.2f}"
+        )
+
+
 def parse_arguments():
     """Parse command line arguments"""
     # Build the code examples description
@@ -329,6 +367,8 @@ def parse_arguments():
   %(prog)s -d 60                     # Run basic benchmark for 60 seconds
   %(prog)s --code deep_static        # Run deep static call stack benchmark
   %(prog)s --code deep_static -d 30  # Run deep static benchmark for 30 seconds
+  %(prog)s --thread-counts 1,100,500 # Measure samples/sec vs thread count
+  %(prog)s --thread-counts 500 --workers 4  # Split remote reads on 4 workers
 
 Available code examples:
 {examples_desc}
@@ -365,14 +405,37 @@ def parse_arguments():
         help="Stop all threads before sampling for consistent snapshots",
     )
 
+    parser.add_argument(
+        "--workers",
+        type=int,
+        default=0,
+        help="Number of helper threads used to read remote memory (default: 0)",
+    )
+
+    parser.add_argument(
+        "--thread-counts",
+        type=lambda value: [int(n) for n in value.split(",")],
+        metavar="N[,N...]",
+        help="Instead of --code, benchmark targets parked in N idle threads "
+             "each and report samples/sec vs thread count",
+    )
+
+    parser.add_argument(
+        "--depth",
+        type=int,
+        default=10,
+        help="Stack depth of each thread for --thread-counts (default: 10)",
+    )
+
     return parser.parse_args()
 
 
-def create_target_process(temp_file, code_example="basic"):
+def create_target_process(temp_file, code_example="basic", code=None):
     """Create and start the target process for benchmarking"""
-    example_info = CODE_EXAMPLES.get(code_example, {"code": CODE})
-    selected_code = example_info["code"]
-    temp_file.write(selected_code)
+    if code is None:
+        example_info = CODE_EXAMPLES.get(code_example, {"code": CODE})
+        code = example_info["code"]
+    temp_file.write(code)
     temp_file.flush()
 
     process = subprocess.Popen(
@@ -404,11 +467,61 @@ def cleanup_process(process, temp_file_path):
                 process.wait()
 
 
+def create_unwinder(pid, args):
+    """Create a RemoteUnwinder configured from the command line"""
+    kwargs = {}
+    if args.threads == "all":
+        kwargs["all_threads"] = True
+    elif args.threads == "main":
+        kwargs["all_threads"] = False
+    elif args.threads == "only_active":
+        kwargs["only_active_thread"] = True
+    return _remote_debugging.RemoteUnwinder(
+        pid, cache_frames=True, workers=args.workers, **kwargs
+    )
+
+
+def run_scaling_benchmark(args):
+    """Benchmark one target process per entry of --thread-counts"""
+    colors = get_colors(can_colorize())
+    rows = []
+    for num_threads in args.thread_counts:
+        code = SCALING_CODE_TEMPLATE.format(
+            num_threads=num_threads, depth=args.depth
+        )
+        print(
+            f"\n{colors.BLUE}Starting target with {num_threads} threads...{colors.RESET}"
+        )
+        with tempfile.NamedTemporaryFile(mode="w", suffix=".py") as temp_file:
+            process, temp_file_path = create_target_process(temp_file, code=code)
+            with process:
+                try:
+                    unwinder = create_unwinder(process.pid, args)
+                    results = benchmark(
+                        unwinder,
+                        duration_seconds=args.duration,
+                        blocking=args.blocking,
+                    )
+                finally:
+                    cleanup_process(process, temp_file_path)
+        rows.append((num_threads, results))
+    print_scaling_results(rows)
+    return 0
+
+
 def main():
     """Main benchmark function"""
     colors = get_colors(can_colorize())
     args = parse_arguments()
 
+    if args.thread_counts:
+        print(f"{colors.BOLD_MAGENTA}External Inspection Benchmark Tool{colors.RESET}")
+        print(f"{colors.BOLD_MAGENTA}{'=' * 34}{colors.RESET}")
+        print(
+            f"{colors.CYAN}Workers:{colors.RESET} {colors.YELLOW}{args.workers}{colors.RESET}"
+        )
+        return run_scaling_benchmark(args)
+
     print(f"{colors.BOLD_MAGENTA}External Inspection Benchmark Tool{colors.RESET}")
     print(f"{colors.BOLD_MAGENTA}{'=' * 34}{colors.RESET}")
 
@@ -441,16 +554,7 @@ def main():
                 # Create unwinder and run benchmark
                 print(f"{colors.BLUE}Initializing unwinder...{colors.RESET}")
                 try:
-                    kwargs = {}
-                    if args.threads == "all":
-                        kwargs["all_threads"] = True
-                    elif args.threads == "main":
-                        kwargs["all_threads"] = False
-                    elif args.threads == "only_active":
-                        kwargs["only_active_thread"] = True
-                    unwinder = _remote_debugging.RemoteUnwinder(
-                        process.pid, cache_frames=True, **kwargs
-                    )
+                    unwinder = create_unwinder(process.pid, args)
                     results = benchmark(unwinder, duration_seconds=args.duration, blocking=args.blocking)
                 finally:
                     cleanup_process(process, temp_file_path)